@@ -0,0 +1,58 @@
+/**
+ ******************************************************************************
+ *
+ * @file       /root/repo/build/firmware/fw_simposix/uavobjectsinit.o.firmware_info.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2011.
+ * @brief      Firmware version info file autogenerated using template
+ *             /root/repo/flight/templates/firmware_info.c.template
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <stdint.h>
+#include <pios_board_info.h>
+/**
+ * We have 100 bytes for the whole description.
+ *
+ * Structure is:
+ *   4 bytes: header: "OpFw".
+ *   4 bytes: GIT commit tag (short version of SHA1).
+ *   4 bytes: Unix timestamp of compile time.
+ *   2 bytes: target platform. Should follow same rule as BOARD_TYPE and BOARD_REVISION in board define files.
+ *  26 bytes: commit tag if it is there, otherwise branch name. '-dirty' may be added if needed. Zero-padded.
+ *  20 bytes: SHA1 sum of the firmware.
+ *  20 bytes: SHA1 sum of the uavo definitions.
+ *  20 bytes: free for now.
+ *
+ */
+
+#if (defined(__MACH__) && defined(__APPLE__))
+const struct fw_version_info fw_version_blob __attribute__((used)) __attribute__((__section__("__TEXT,.fw_version_blob"))) = {
+#else
+const struct fw_version_info fw_version_blob __attribute__((used)) __attribute__((__section__(".fw_version_blob"))) = {
+#endif
+    .magic              = { 'O','p','F','w' },
+    .commit_hash_prefix = 0x04102201,
+    .timestamp          = 1792388407,
+    .board_type         = 0x10,
+    .board_revision     = 0x01,
+    .commit_tag_name    = "master-dirty",
+    .sha1sum            = { 0xe8,0x9e,0x56,0x31,0xb8,0x6f,0xd6,0xc4,0xca,0x75,0x1f,0x60,0xd9,0x64,0x2e,0x8a,0xb7,0xe2,0x72,0x70 },
+    .uavosha1           = { 0xb2,0x5b,0xbf,0x53,0xd2,0x51,0x3f,0x96,0xc0,0xcc,0x30,0xd3,0x91,0xf8,0xb3,0x71,0xf7,0xc4,0x47,0x8e },
+};
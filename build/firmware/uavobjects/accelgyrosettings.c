@@ -0,0 +1,272 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AccelGyroSettings AccelGyroSettings
+ * @brief Settings for Accelerometer and Gyroscope calibration 
+ *
+ * Autogenerated files and functions for AccelGyroSettings Object
+ * @{ 
+ *
+ * @file       accelgyrosettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AccelGyroSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: accelgyrosettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "accelgyrosettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if ACCELGYROSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(AccelGyroSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AccelGyroSettingsInitialize(void)
+{
+    // Compile time assertion that the AccelGyroSettingsDataPacked and AccelGyroSettingsData structs
+    // have the same size (though instances of AccelGyroSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AccelGyroSettingsDataPacked) == sizeof(AccelGyroSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ACCELGYROSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = ACCELGYROSETTINGS_OBJID,
+       .instance_size = ACCELGYROSETTINGS_NUMBYTES,
+       .init_callback = &AccelGyroSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        ACCELGYROSETTINGS_ISSINGLEINST, ACCELGYROSETTINGS_ISSETTINGS, ACCELGYROSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) AccelGyroSettingsData * data) {}
+
+void AccelGyroSettingsDataOverrideDefaults(AccelGyroSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AccelGyroSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AccelGyroSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AccelGyroSettingsData));
+    data.accel_bias.X = 0.000000e+00f;
+    data.accel_bias.Y = 0.000000e+00f;
+    data.accel_bias.Z = 0.000000e+00f;
+    data.accel_scale.X = 1.000000e+00f;
+    data.accel_scale.Y = 1.000000e+00f;
+    data.accel_scale.Z = 1.000000e+00f;
+    data.accel_temp_coeff.X = 0.000000e+00f;
+    data.accel_temp_coeff.Y = 0.000000e+00f;
+    data.accel_temp_coeff.Z = 0.000000e+00f;
+    data.gyro_bias.X = 0.000000e+00f;
+    data.gyro_bias.Y = 0.000000e+00f;
+    data.gyro_bias.Z = 0.000000e+00f;
+    data.gyro_scale.X = 1.000000e+00f;
+    data.gyro_scale.Y = 1.000000e+00f;
+    data.gyro_scale.Z = 1.000000e+00f;
+    data.gyro_temp_coeff.X = 0.000000e+00f;
+    data.gyro_temp_coeff.X2 = 0.000000e+00f;
+    data.gyro_temp_coeff.Y = 0.000000e+00f;
+    data.gyro_temp_coeff.Y2 = 0.000000e+00f;
+    data.gyro_temp_coeff.Z = 0.000000e+00f;
+    data.gyro_temp_coeff.Z2 = 0.000000e+00f;
+    data.temp_calibrated_extent.min = 0.000000e+00f;
+    data.temp_calibrated_extent.max = 0.000000e+00f;
+
+    AccelGyroSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AccelGyroSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AccelGyroSettingsaccel_biasSet( AccelGyroSettingsaccel_biasData *Newaccel_bias )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_bias, offsetof(AccelGyroSettingsData, accel_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_biasGet( AccelGyroSettingsaccel_biasData *Newaccel_bias )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_bias, offsetof(AccelGyroSettingsData, accel_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_biasArraySet( float *Newaccel_bias )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_bias, offsetof(AccelGyroSettingsData, accel_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_biasArrayGet( float *Newaccel_bias )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_bias, offsetof(AccelGyroSettingsData, accel_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_scaleSet( AccelGyroSettingsaccel_scaleData *Newaccel_scale )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_scale, offsetof(AccelGyroSettingsData, accel_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_scaleGet( AccelGyroSettingsaccel_scaleData *Newaccel_scale )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_scale, offsetof(AccelGyroSettingsData, accel_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_scaleArraySet( float *Newaccel_scale )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_scale, offsetof(AccelGyroSettingsData, accel_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_scaleArrayGet( float *Newaccel_scale )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_scale, offsetof(AccelGyroSettingsData, accel_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_temp_coeffSet( AccelGyroSettingsaccel_temp_coeffData *Newaccel_temp_coeff )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_temp_coeff, offsetof(AccelGyroSettingsData, accel_temp_coeff), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_temp_coeffGet( AccelGyroSettingsaccel_temp_coeffData *Newaccel_temp_coeff )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_temp_coeff, offsetof(AccelGyroSettingsData, accel_temp_coeff), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_temp_coeffArraySet( float *Newaccel_temp_coeff )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_temp_coeff, offsetof(AccelGyroSettingsData, accel_temp_coeff), 3*sizeof(float));
+}
+void AccelGyroSettingsaccel_temp_coeffArrayGet( float *Newaccel_temp_coeff )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newaccel_temp_coeff, offsetof(AccelGyroSettingsData, accel_temp_coeff), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_biasSet( AccelGyroSettingsgyro_biasData *Newgyro_bias )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_bias, offsetof(AccelGyroSettingsData, gyro_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_biasGet( AccelGyroSettingsgyro_biasData *Newgyro_bias )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_bias, offsetof(AccelGyroSettingsData, gyro_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_biasArraySet( float *Newgyro_bias )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_bias, offsetof(AccelGyroSettingsData, gyro_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_biasArrayGet( float *Newgyro_bias )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_bias, offsetof(AccelGyroSettingsData, gyro_bias), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_scaleSet( AccelGyroSettingsgyro_scaleData *Newgyro_scale )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_scale, offsetof(AccelGyroSettingsData, gyro_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_scaleGet( AccelGyroSettingsgyro_scaleData *Newgyro_scale )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_scale, offsetof(AccelGyroSettingsData, gyro_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_scaleArraySet( float *Newgyro_scale )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_scale, offsetof(AccelGyroSettingsData, gyro_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_scaleArrayGet( float *Newgyro_scale )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_scale, offsetof(AccelGyroSettingsData, gyro_scale), 3*sizeof(float));
+}
+void AccelGyroSettingsgyro_temp_coeffSet( AccelGyroSettingsgyro_temp_coeffData *Newgyro_temp_coeff )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_temp_coeff, offsetof(AccelGyroSettingsData, gyro_temp_coeff), 6*sizeof(float));
+}
+void AccelGyroSettingsgyro_temp_coeffGet( AccelGyroSettingsgyro_temp_coeffData *Newgyro_temp_coeff )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_temp_coeff, offsetof(AccelGyroSettingsData, gyro_temp_coeff), 6*sizeof(float));
+}
+void AccelGyroSettingsgyro_temp_coeffArraySet( float *Newgyro_temp_coeff )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_temp_coeff, offsetof(AccelGyroSettingsData, gyro_temp_coeff), 6*sizeof(float));
+}
+void AccelGyroSettingsgyro_temp_coeffArrayGet( float *Newgyro_temp_coeff )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newgyro_temp_coeff, offsetof(AccelGyroSettingsData, gyro_temp_coeff), 6*sizeof(float));
+}
+void AccelGyroSettingstemp_calibrated_extentSet( AccelGyroSettingstemp_calibrated_extentData *Newtemp_calibrated_extent )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newtemp_calibrated_extent, offsetof(AccelGyroSettingsData, temp_calibrated_extent), 2*sizeof(float));
+}
+void AccelGyroSettingstemp_calibrated_extentGet( AccelGyroSettingstemp_calibrated_extentData *Newtemp_calibrated_extent )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newtemp_calibrated_extent, offsetof(AccelGyroSettingsData, temp_calibrated_extent), 2*sizeof(float));
+}
+void AccelGyroSettingstemp_calibrated_extentArraySet( float *Newtemp_calibrated_extent )
+{
+    UAVObjSetDataField(AccelGyroSettingsHandle(), (void *)Newtemp_calibrated_extent, offsetof(AccelGyroSettingsData, temp_calibrated_extent), 2*sizeof(float));
+}
+void AccelGyroSettingstemp_calibrated_extentArrayGet( float *Newtemp_calibrated_extent )
+{
+    UAVObjGetDataField(AccelGyroSettingsHandle(), (void *)Newtemp_calibrated_extent, offsetof(AccelGyroSettingsData, temp_calibrated_extent), 2*sizeof(float));
+}
+
+
+/**
+ * @}
+ */
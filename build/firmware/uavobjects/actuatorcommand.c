@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup ActuatorCommand ActuatorCommand
+ * @brief Contains the pulse duration sent to each of the channels.  Set by @ref ActuatorModule
+ *
+ * Autogenerated files and functions for ActuatorCommand Object
+ * @{ 
+ *
+ * @file       actuatorcommand.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ActuatorCommand object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: actuatorcommand.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "actuatorcommand.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if ACTUATORCOMMAND_ISSETTINGS
+SETTINGS_INITCALL(ActuatorCommandInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ActuatorCommandInitialize(void)
+{
+    // Compile time assertion that the ActuatorCommandDataPacked and ActuatorCommandData structs
+    // have the same size (though instances of ActuatorCommandData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(ActuatorCommandDataPacked) == sizeof(ActuatorCommandData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ACTUATORCOMMAND_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = ACTUATORCOMMAND_OBJID,
+       .instance_size = ACTUATORCOMMAND_NUMBYTES,
+       .init_callback = &ActuatorCommandSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        ACTUATORCOMMAND_ISSINGLEINST, ACTUATORCOMMAND_ISSETTINGS, ACTUATORCOMMAND_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) ActuatorCommandData * data) {}
+
+void ActuatorCommandDataOverrideDefaults(ActuatorCommandData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ActuatorCommandSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    ActuatorCommandData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(ActuatorCommandData));
+
+    ActuatorCommandDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ActuatorCommandHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ActuatorCommandChannelSet( int16_t *NewChannel )
+{
+    UAVObjSetDataField(ActuatorCommandHandle(), (void *)NewChannel, offsetof(ActuatorCommandData, Channel), 12*sizeof(int16_t));
+}
+void ActuatorCommandChannelGet( int16_t *NewChannel )
+{
+    UAVObjGetDataField(ActuatorCommandHandle(), (void *)NewChannel, offsetof(ActuatorCommandData, Channel), 12*sizeof(int16_t));
+}
+void ActuatorCommandUpdateTimeSet(uint16_t *NewUpdateTime)
+{
+    UAVObjSetDataField(ActuatorCommandHandle(), (void *)NewUpdateTime, offsetof(ActuatorCommandData, UpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandUpdateTimeGet(uint16_t *NewUpdateTime)
+{
+    UAVObjGetDataField(ActuatorCommandHandle(), (void *)NewUpdateTime, offsetof(ActuatorCommandData, UpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandMaxUpdateTimeSet(uint16_t *NewMaxUpdateTime)
+{
+    UAVObjSetDataField(ActuatorCommandHandle(), (void *)NewMaxUpdateTime, offsetof(ActuatorCommandData, MaxUpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandMaxUpdateTimeGet(uint16_t *NewMaxUpdateTime)
+{
+    UAVObjGetDataField(ActuatorCommandHandle(), (void *)NewMaxUpdateTime, offsetof(ActuatorCommandData, MaxUpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandNumFailedUpdatesSet(uint8_t *NewNumFailedUpdates)
+{
+    UAVObjSetDataField(ActuatorCommandHandle(), (void *)NewNumFailedUpdates, offsetof(ActuatorCommandData, NumFailedUpdates), sizeof(uint8_t));
+}
+void ActuatorCommandNumFailedUpdatesGet(uint8_t *NewNumFailedUpdates)
+{
+    UAVObjGetDataField(ActuatorCommandHandle(), (void *)NewNumFailedUpdates, offsetof(ActuatorCommandData, NumFailedUpdates), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
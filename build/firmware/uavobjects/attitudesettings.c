@@ -0,0 +1,273 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AttitudeSettings AttitudeSettings
+ * @brief Settings for the @ref Attitude module used on CopterControl
+ *
+ * Autogenerated files and functions for AttitudeSettings Object
+ * @{ 
+ *
+ * @file       attitudesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AttitudeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "attitudesettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if ATTITUDESETTINGS_ISSETTINGS
+SETTINGS_INITCALL(AttitudeSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AttitudeSettingsInitialize(void)
+{
+    // Compile time assertion that the AttitudeSettingsDataPacked and AttitudeSettingsData structs
+    // have the same size (though instances of AttitudeSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AttitudeSettingsDataPacked) == sizeof(AttitudeSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ATTITUDESETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = ATTITUDESETTINGS_OBJID,
+       .instance_size = ATTITUDESETTINGS_NUMBYTES,
+       .init_callback = &AttitudeSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        ATTITUDESETTINGS_ISSINGLEINST, ATTITUDESETTINGS_ISSETTINGS, ATTITUDESETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) AttitudeSettingsData * data) {}
+
+void AttitudeSettingsDataOverrideDefaults(AttitudeSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AttitudeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AttitudeSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AttitudeSettingsData));
+    data.BoardRotation.Roll = 0.000000e+00f;
+    data.BoardRotation.Pitch = 0.000000e+00f;
+    data.BoardRotation.Yaw = 0.000000e+00f;
+    data.BoardLevelTrim.Roll = 0.000000e+00f;
+    data.BoardLevelTrim.Pitch = 0.000000e+00f;
+    data.AccelKp = 5.000000e-02f;
+    data.AccelKi = 1.000000e-04f;
+    data.MagKi = 5.000000e-05f;
+    data.MagKp = 1.000000e+00f;
+    data.AccelTau = 5.000000e-02f;
+    data.YawBiasRate = 1.000000e-06f;
+    data.BoardSteadyMaxVariance = 5.000000e+00f;
+    data.ZeroDuringArming = 1;
+    data.BiasCorrectGyro = 1;
+    data.InitialZeroWhenBoardSteady = 1;
+    data.TrimFlight = 0;
+
+    AttitudeSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AttitudeSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AttitudeSettingsBoardRotationSet( AttitudeSettingsBoardRotationData *NewBoardRotation )
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewBoardRotation, offsetof(AttitudeSettingsData, BoardRotation), 3*sizeof(float));
+}
+void AttitudeSettingsBoardRotationGet( AttitudeSettingsBoardRotationData *NewBoardRotation )
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewBoardRotation, offsetof(AttitudeSettingsData, BoardRotation), 3*sizeof(float));
+}
+void AttitudeSettingsBoardRotationArraySet( float *NewBoardRotation )
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewBoardRotation, offsetof(AttitudeSettingsData, BoardRotation), 3*sizeof(float));
+}
+void AttitudeSettingsBoardRotationArrayGet( float *NewBoardRotation )
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewBoardRotation, offsetof(AttitudeSettingsData, BoardRotation), 3*sizeof(float));
+}
+void AttitudeSettingsBoardLevelTrimSet( AttitudeSettingsBoardLevelTrimData *NewBoardLevelTrim )
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewBoardLevelTrim, offsetof(AttitudeSettingsData, BoardLevelTrim), 2*sizeof(float));
+}
+void AttitudeSettingsBoardLevelTrimGet( AttitudeSettingsBoardLevelTrimData *NewBoardLevelTrim )
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewBoardLevelTrim, offsetof(AttitudeSettingsData, BoardLevelTrim), 2*sizeof(float));
+}
+void AttitudeSettingsBoardLevelTrimArraySet( float *NewBoardLevelTrim )
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewBoardLevelTrim, offsetof(AttitudeSettingsData, BoardLevelTrim), 2*sizeof(float));
+}
+void AttitudeSettingsBoardLevelTrimArrayGet( float *NewBoardLevelTrim )
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewBoardLevelTrim, offsetof(AttitudeSettingsData, BoardLevelTrim), 2*sizeof(float));
+}
+void AttitudeSettingsAccelKpSet(float *NewAccelKp)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewAccelKp, offsetof(AttitudeSettingsData, AccelKp), sizeof(float));
+}
+void AttitudeSettingsAccelKpGet(float *NewAccelKp)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewAccelKp, offsetof(AttitudeSettingsData, AccelKp), sizeof(float));
+}
+void AttitudeSettingsAccelKiSet(float *NewAccelKi)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewAccelKi, offsetof(AttitudeSettingsData, AccelKi), sizeof(float));
+}
+void AttitudeSettingsAccelKiGet(float *NewAccelKi)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewAccelKi, offsetof(AttitudeSettingsData, AccelKi), sizeof(float));
+}
+void AttitudeSettingsMagKiSet(float *NewMagKi)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewMagKi, offsetof(AttitudeSettingsData, MagKi), sizeof(float));
+}
+void AttitudeSettingsMagKiGet(float *NewMagKi)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewMagKi, offsetof(AttitudeSettingsData, MagKi), sizeof(float));
+}
+void AttitudeSettingsMagKpSet(float *NewMagKp)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewMagKp, offsetof(AttitudeSettingsData, MagKp), sizeof(float));
+}
+void AttitudeSettingsMagKpGet(float *NewMagKp)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewMagKp, offsetof(AttitudeSettingsData, MagKp), sizeof(float));
+}
+void AttitudeSettingsAccelTauSet(float *NewAccelTau)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewAccelTau, offsetof(AttitudeSettingsData, AccelTau), sizeof(float));
+}
+void AttitudeSettingsAccelTauGet(float *NewAccelTau)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewAccelTau, offsetof(AttitudeSettingsData, AccelTau), sizeof(float));
+}
+void AttitudeSettingsYawBiasRateSet(float *NewYawBiasRate)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewYawBiasRate, offsetof(AttitudeSettingsData, YawBiasRate), sizeof(float));
+}
+void AttitudeSettingsYawBiasRateGet(float *NewYawBiasRate)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewYawBiasRate, offsetof(AttitudeSettingsData, YawBiasRate), sizeof(float));
+}
+void AttitudeSettingsBoardSteadyMaxVarianceSet(float *NewBoardSteadyMaxVariance)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewBoardSteadyMaxVariance, offsetof(AttitudeSettingsData, BoardSteadyMaxVariance), sizeof(float));
+}
+void AttitudeSettingsBoardSteadyMaxVarianceGet(float *NewBoardSteadyMaxVariance)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewBoardSteadyMaxVariance, offsetof(AttitudeSettingsData, BoardSteadyMaxVariance), sizeof(float));
+}
+void AttitudeSettingsZeroDuringArmingSet(AttitudeSettingsZeroDuringArmingOptions *NewZeroDuringArming)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewZeroDuringArming, offsetof(AttitudeSettingsData, ZeroDuringArming), sizeof(AttitudeSettingsZeroDuringArmingOptions));
+}
+void AttitudeSettingsZeroDuringArmingGet(AttitudeSettingsZeroDuringArmingOptions *NewZeroDuringArming)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewZeroDuringArming, offsetof(AttitudeSettingsData, ZeroDuringArming), sizeof(AttitudeSettingsZeroDuringArmingOptions));
+}
+void AttitudeSettingsBiasCorrectGyroSet(AttitudeSettingsBiasCorrectGyroOptions *NewBiasCorrectGyro)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewBiasCorrectGyro, offsetof(AttitudeSettingsData, BiasCorrectGyro), sizeof(AttitudeSettingsBiasCorrectGyroOptions));
+}
+void AttitudeSettingsBiasCorrectGyroGet(AttitudeSettingsBiasCorrectGyroOptions *NewBiasCorrectGyro)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewBiasCorrectGyro, offsetof(AttitudeSettingsData, BiasCorrectGyro), sizeof(AttitudeSettingsBiasCorrectGyroOptions));
+}
+void AttitudeSettingsInitialZeroWhenBoardSteadySet(AttitudeSettingsInitialZeroWhenBoardSteadyOptions *NewInitialZeroWhenBoardSteady)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewInitialZeroWhenBoardSteady, offsetof(AttitudeSettingsData, InitialZeroWhenBoardSteady), sizeof(AttitudeSettingsInitialZeroWhenBoardSteadyOptions));
+}
+void AttitudeSettingsInitialZeroWhenBoardSteadyGet(AttitudeSettingsInitialZeroWhenBoardSteadyOptions *NewInitialZeroWhenBoardSteady)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewInitialZeroWhenBoardSteady, offsetof(AttitudeSettingsData, InitialZeroWhenBoardSteady), sizeof(AttitudeSettingsInitialZeroWhenBoardSteadyOptions));
+}
+void AttitudeSettingsTrimFlightSet(AttitudeSettingsTrimFlightOptions *NewTrimFlight)
+{
+    UAVObjSetDataField(AttitudeSettingsHandle(), (void *)NewTrimFlight, offsetof(AttitudeSettingsData, TrimFlight), sizeof(AttitudeSettingsTrimFlightOptions));
+}
+void AttitudeSettingsTrimFlightGet(AttitudeSettingsTrimFlightOptions *NewTrimFlight)
+{
+    UAVObjGetDataField(AttitudeSettingsHandle(), (void *)NewTrimFlight, offsetof(AttitudeSettingsData, TrimFlight), sizeof(AttitudeSettingsTrimFlightOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,238 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup CameraControlSettings CameraControlSettings
+ * @brief Settings for the @ref CameraControl module
+ *
+ * Autogenerated files and functions for CameraControlSettings Object
+ * @{ 
+ *
+ * @file       cameracontrolsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the CameraControlSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: cameracontrolsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "cameracontrolsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if CAMERACONTROLSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(CameraControlSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t CameraControlSettingsInitialize(void)
+{
+    // Compile time assertion that the CameraControlSettingsDataPacked and CameraControlSettingsData structs
+    // have the same size (though instances of CameraControlSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(CameraControlSettingsDataPacked) == sizeof(CameraControlSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(CAMERACONTROLSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = CAMERACONTROLSETTINGS_OBJID,
+       .instance_size = CAMERACONTROLSETTINGS_NUMBYTES,
+       .init_callback = &CameraControlSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        CAMERACONTROLSETTINGS_ISSINGLEINST, CAMERACONTROLSETTINGS_ISSETTINGS, CAMERACONTROLSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) CameraControlSettingsData * data) {}
+
+void CameraControlSettingsDataOverrideDefaults(CameraControlSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void CameraControlSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    CameraControlSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(CameraControlSettingsData));
+    data.OutputValues.Idle = 0.000000e+00f;
+    data.OutputValues.Shot = -1.000000e+00f;
+    data.OutputValues.Video = 1.000000e+00f;
+    data.InputValues.Idle = 0.000000e+00f;
+    data.InputValues.Shot = -1.000000e+00f;
+    data.InputValues.Video = 1.000000e+00f;
+    data.TimeInterval = 5.000000e+00f;
+    data.SpaceInterval = 0.000000e+00f;
+    data.MinimumTimeInterval = 2.500000e+00f;
+    data.TriggerPulseWidth = 50;
+    data.AutoTriggerInput = 0;
+    data.ManualTriggerInput = 0;
+    data.AutoTriggerMode = 1;
+
+    CameraControlSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle CameraControlSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void CameraControlSettingsOutputValuesSet( CameraControlSettingsOutputValuesData *NewOutputValues )
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsOutputValuesGet( CameraControlSettingsOutputValuesData *NewOutputValues )
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsOutputValuesArraySet( float *NewOutputValues )
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsOutputValuesArrayGet( float *NewOutputValues )
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesSet( CameraControlSettingsInputValuesData *NewInputValues )
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesGet( CameraControlSettingsInputValuesData *NewInputValues )
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesArraySet( float *NewInputValues )
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesArrayGet( float *NewInputValues )
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsTimeIntervalSet(float *NewTimeInterval)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewTimeInterval, offsetof(CameraControlSettingsData, TimeInterval), sizeof(float));
+}
+void CameraControlSettingsTimeIntervalGet(float *NewTimeInterval)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewTimeInterval, offsetof(CameraControlSettingsData, TimeInterval), sizeof(float));
+}
+void CameraControlSettingsSpaceIntervalSet(float *NewSpaceInterval)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewSpaceInterval, offsetof(CameraControlSettingsData, SpaceInterval), sizeof(float));
+}
+void CameraControlSettingsSpaceIntervalGet(float *NewSpaceInterval)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewSpaceInterval, offsetof(CameraControlSettingsData, SpaceInterval), sizeof(float));
+}
+void CameraControlSettingsMinimumTimeIntervalSet(float *NewMinimumTimeInterval)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewMinimumTimeInterval, offsetof(CameraControlSettingsData, MinimumTimeInterval), sizeof(float));
+}
+void CameraControlSettingsMinimumTimeIntervalGet(float *NewMinimumTimeInterval)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewMinimumTimeInterval, offsetof(CameraControlSettingsData, MinimumTimeInterval), sizeof(float));
+}
+void CameraControlSettingsTriggerPulseWidthSet(uint16_t *NewTriggerPulseWidth)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewTriggerPulseWidth, offsetof(CameraControlSettingsData, TriggerPulseWidth), sizeof(uint16_t));
+}
+void CameraControlSettingsTriggerPulseWidthGet(uint16_t *NewTriggerPulseWidth)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewTriggerPulseWidth, offsetof(CameraControlSettingsData, TriggerPulseWidth), sizeof(uint16_t));
+}
+void CameraControlSettingsAutoTriggerInputSet(CameraControlSettingsAutoTriggerInputOptions *NewAutoTriggerInput)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewAutoTriggerInput, offsetof(CameraControlSettingsData, AutoTriggerInput), sizeof(CameraControlSettingsAutoTriggerInputOptions));
+}
+void CameraControlSettingsAutoTriggerInputGet(CameraControlSettingsAutoTriggerInputOptions *NewAutoTriggerInput)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewAutoTriggerInput, offsetof(CameraControlSettingsData, AutoTriggerInput), sizeof(CameraControlSettingsAutoTriggerInputOptions));
+}
+void CameraControlSettingsManualTriggerInputSet(CameraControlSettingsManualTriggerInputOptions *NewManualTriggerInput)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewManualTriggerInput, offsetof(CameraControlSettingsData, ManualTriggerInput), sizeof(CameraControlSettingsManualTriggerInputOptions));
+}
+void CameraControlSettingsManualTriggerInputGet(CameraControlSettingsManualTriggerInputOptions *NewManualTriggerInput)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewManualTriggerInput, offsetof(CameraControlSettingsData, ManualTriggerInput), sizeof(CameraControlSettingsManualTriggerInputOptions));
+}
+void CameraControlSettingsAutoTriggerModeSet(CameraControlSettingsAutoTriggerModeOptions *NewAutoTriggerMode)
+{
+    UAVObjSetDataField(CameraControlSettingsHandle(), (void *)NewAutoTriggerMode, offsetof(CameraControlSettingsData, AutoTriggerMode), sizeof(CameraControlSettingsAutoTriggerModeOptions));
+}
+void CameraControlSettingsAutoTriggerModeGet(CameraControlSettingsAutoTriggerModeOptions *NewAutoTriggerMode)
+{
+    UAVObjGetDataField(CameraControlSettingsHandle(), (void *)NewAutoTriggerMode, offsetof(CameraControlSettingsData, AutoTriggerMode), sizeof(CameraControlSettingsAutoTriggerModeOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,479 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup FixedWingPathFollowerSettings FixedWingPathFollowerSettings
+ * @brief Settings for the @ref FixedWingPathFollowerModule
+ *
+ * Autogenerated files and functions for FixedWingPathFollowerSettings Object
+ *
+ * @{
+ *
+ * @file       fixedwingpathfollowersettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FixedWingPathFollowerSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: fixedwingpathfollowersettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FIXEDWINGPATHFOLLOWERSETTINGS_H
+#define FIXEDWINGPATHFOLLOWERSETTINGS_H
+#include <stdbool.h>
+
+/* Object constants */
+#define FIXEDWINGPATHFOLLOWERSETTINGS_OBJID 0xDA4294AA
+#define FIXEDWINGPATHFOLLOWERSETTINGS_ISSINGLEINST 1
+#define FIXEDWINGPATHFOLLOWERSETTINGS_ISSETTINGS 1
+#define FIXEDWINGPATHFOLLOWERSETTINGS_ISPRIORITY 0
+#define FIXEDWINGPATHFOLLOWERSETTINGS_NUMBYTES sizeof(FixedWingPathFollowerSettingsData)
+
+/* Generic interface functions */
+int32_t FixedWingPathFollowerSettingsInitialize();
+UAVObjHandle FixedWingPathFollowerSettingsHandle();
+void FixedWingPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field HorizontalVelMax information */
+
+/* Field HorizontalVelMin information */
+
+/* Field VerticalVelMax information */
+
+/* Field CourseFeedForward information */
+
+/* Field ReverseCourseOverlap information */
+
+/* Field HorizontalPosP information */
+
+/* Field VerticalPosP information */
+
+/* Field CoursePI information */
+
+// Array element names for field CoursePI
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_COURSEPI_KP=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_COURSEPI_KI=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_COURSEPI_ILIMIT=2
+} FixedWingPathFollowerSettingsCoursePIElem;
+
+// Number of elements for field CoursePI
+#define FIXEDWINGPATHFOLLOWERSETTINGS_COURSEPI_NUMELEM 3
+
+/* Field SpeedPI information */
+
+// Array element names for field SpeedPI
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_SPEEDPI_KP=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SPEEDPI_KI=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SPEEDPI_ILIMIT=2
+} FixedWingPathFollowerSettingsSpeedPIElem;
+
+// Number of elements for field SpeedPI
+#define FIXEDWINGPATHFOLLOWERSETTINGS_SPEEDPI_NUMELEM 3
+
+/* Field VerticalToPitchCrossFeed information */
+
+// Array element names for field VerticalToPitchCrossFeed
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_VERTICALTOPITCHCROSSFEED_KP=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_VERTICALTOPITCHCROSSFEED_MAX=1
+} FixedWingPathFollowerSettingsVerticalToPitchCrossFeedElem;
+
+// Number of elements for field VerticalToPitchCrossFeed
+#define FIXEDWINGPATHFOLLOWERSETTINGS_VERTICALTOPITCHCROSSFEED_NUMELEM 2
+
+/* Field AirspeedToPowerCrossFeed information */
+
+// Array element names for field AirspeedToPowerCrossFeed
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_AIRSPEEDTOPOWERCROSSFEED_KP=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_AIRSPEEDTOPOWERCROSSFEED_MAX=1
+} FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedElem;
+
+// Number of elements for field AirspeedToPowerCrossFeed
+#define FIXEDWINGPATHFOLLOWERSETTINGS_AIRSPEEDTOPOWERCROSSFEED_NUMELEM 2
+
+/* Field PowerPI information */
+
+// Array element names for field PowerPI
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_POWERPI_KP=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_POWERPI_KI=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_POWERPI_ILIMIT=2
+} FixedWingPathFollowerSettingsPowerPIElem;
+
+// Number of elements for field PowerPI
+#define FIXEDWINGPATHFOLLOWERSETTINGS_POWERPI_NUMELEM 3
+
+/* Field RollLimit information */
+
+// Array element names for field RollLimit
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_ROLLLIMIT_MIN=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_ROLLLIMIT_NEUTRAL=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_ROLLLIMIT_MAX=2
+} FixedWingPathFollowerSettingsRollLimitElem;
+
+// Number of elements for field RollLimit
+#define FIXEDWINGPATHFOLLOWERSETTINGS_ROLLLIMIT_NUMELEM 3
+
+/* Field PitchLimit information */
+
+// Array element names for field PitchLimit
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_PITCHLIMIT_MIN=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_PITCHLIMIT_NEUTRAL=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_PITCHLIMIT_MAX=2
+} FixedWingPathFollowerSettingsPitchLimitElem;
+
+// Number of elements for field PitchLimit
+#define FIXEDWINGPATHFOLLOWERSETTINGS_PITCHLIMIT_NUMELEM 3
+
+/* Field ThrustLimit information */
+
+// Array element names for field ThrustLimit
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_THRUSTLIMIT_MIN=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_THRUSTLIMIT_NEUTRAL=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_THRUSTLIMIT_MAX=2
+} FixedWingPathFollowerSettingsThrustLimitElem;
+
+// Number of elements for field ThrustLimit
+#define FIXEDWINGPATHFOLLOWERSETTINGS_THRUSTLIMIT_NUMELEM 3
+
+/* Field Safetymargins information */
+
+// Array element names for field Safetymargins
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_WIND=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_STALLSPEED=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_LOWSPEED=2,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_HIGHSPEED=3,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_OVERSPEED=4,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_LOWPOWER=5,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_HIGHPOWER=6,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_ROLLCONTROL=7,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_PITCHCONTROL=8
+} FixedWingPathFollowerSettingsSafetymarginsElem;
+
+// Number of elements for field Safetymargins
+#define FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYMARGINS_NUMELEM 9
+
+/* Field SafetyCutoffLimits information */
+
+// Array element names for field SafetyCutoffLimits
+typedef enum {
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYCUTOFFLIMITS_ROLLDEG=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYCUTOFFLIMITS_PITCHDEG=1,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYCUTOFFLIMITS_YAWDEG=2,
+    FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYCUTOFFLIMITS_MAXDECELERATIONDELTAMPS=3
+} FixedWingPathFollowerSettingsSafetyCutoffLimitsElem;
+
+// Number of elements for field SafetyCutoffLimits
+#define FIXEDWINGPATHFOLLOWERSETTINGS_SAFETYCUTOFFLIMITS_NUMELEM 4
+
+/* Field TakeOffPitch information */
+
+/* Field LandingPitch information */
+
+/* Field UpdatePeriod information */
+
+/* Field UseAirspeedSensor information */
+
+// Enumeration options for field UseAirspeedSensor
+typedef enum __attribute__ ((__packed__)) {
+    FIXEDWINGPATHFOLLOWERSETTINGS_USEAIRSPEEDSENSOR_FALSE=0,
+    FIXEDWINGPATHFOLLOWERSETTINGS_USEAIRSPEEDSENSOR_TRUE=1
+} FixedWingPathFollowerSettingsUseAirspeedSensorOptions;
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float ILimit;
+}  FixedWingPathFollowerSettingsCoursePIData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FixedWingPathFollowerSettingsCoursePIDataArray ;
+#define FixedWingPathFollowerSettingsCoursePIToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsCoursePIData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float ILimit;
+}  FixedWingPathFollowerSettingsSpeedPIData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FixedWingPathFollowerSettingsSpeedPIDataArray ;
+#define FixedWingPathFollowerSettingsSpeedPIToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsSpeedPIData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Max;
+}  FixedWingPathFollowerSettingsVerticalToPitchCrossFeedData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[2];
+}  FixedWingPathFollowerSettingsVerticalToPitchCrossFeedDataArray ;
+#define FixedWingPathFollowerSettingsVerticalToPitchCrossFeedToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsVerticalToPitchCrossFeedData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Max;
+}  FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[2];
+}  FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedDataArray ;
+#define FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float ILimit;
+}  FixedWingPathFollowerSettingsPowerPIData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FixedWingPathFollowerSettingsPowerPIDataArray ;
+#define FixedWingPathFollowerSettingsPowerPIToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsPowerPIData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Min;
+    float Neutral;
+    float Max;
+}  FixedWingPathFollowerSettingsRollLimitData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FixedWingPathFollowerSettingsRollLimitDataArray ;
+#define FixedWingPathFollowerSettingsRollLimitToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsRollLimitData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Min;
+    float Neutral;
+    float Max;
+}  FixedWingPathFollowerSettingsPitchLimitData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FixedWingPathFollowerSettingsPitchLimitDataArray ;
+#define FixedWingPathFollowerSettingsPitchLimitToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsPitchLimitData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Min;
+    float Neutral;
+    float Max;
+}  FixedWingPathFollowerSettingsThrustLimitData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FixedWingPathFollowerSettingsThrustLimitDataArray ;
+#define FixedWingPathFollowerSettingsThrustLimitToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsThrustLimitData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Wind;
+    float Stallspeed;
+    float Lowspeed;
+    float Highspeed;
+    float Overspeed;
+    float Lowpower;
+    float Highpower;
+    float Rollcontrol;
+    float Pitchcontrol;
+}  FixedWingPathFollowerSettingsSafetymarginsData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[9];
+}  FixedWingPathFollowerSettingsSafetymarginsDataArray ;
+#define FixedWingPathFollowerSettingsSafetymarginsToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsSafetymarginsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float RollDeg;
+    float PitchDeg;
+    float YawDeg;
+    float MaxDecelerationDeltaMPS;
+}  FixedWingPathFollowerSettingsSafetyCutoffLimitsData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  FixedWingPathFollowerSettingsSafetyCutoffLimitsDataArray ;
+#define FixedWingPathFollowerSettingsSafetyCutoffLimitsToArray( var ) UAVObjectFieldToArray( FixedWingPathFollowerSettingsSafetyCutoffLimitsData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float HorizontalVelMax;
+    float HorizontalVelMin;
+    float VerticalVelMax;
+    float CourseFeedForward;
+    float ReverseCourseOverlap;
+    float HorizontalPosP;
+    float VerticalPosP;
+    FixedWingPathFollowerSettingsCoursePIData CoursePI;
+    FixedWingPathFollowerSettingsSpeedPIData SpeedPI;
+    FixedWingPathFollowerSettingsVerticalToPitchCrossFeedData VerticalToPitchCrossFeed;
+    FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedData AirspeedToPowerCrossFeed;
+    FixedWingPathFollowerSettingsPowerPIData PowerPI;
+    FixedWingPathFollowerSettingsRollLimitData RollLimit;
+    FixedWingPathFollowerSettingsPitchLimitData PitchLimit;
+    FixedWingPathFollowerSettingsThrustLimitData ThrustLimit;
+    FixedWingPathFollowerSettingsSafetymarginsData Safetymargins;
+    FixedWingPathFollowerSettingsSafetyCutoffLimitsData SafetyCutoffLimits;
+    float TakeOffPitch;
+    float LandingPitch;
+    int32_t UpdatePeriod;
+    FixedWingPathFollowerSettingsUseAirspeedSensorOptions UseAirspeedSensor;
+
+} __attribute__((packed)) FixedWingPathFollowerSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef FixedWingPathFollowerSettingsDataPacked __attribute__((aligned(4))) FixedWingPathFollowerSettingsData;
+
+void FixedWingPathFollowerSettingsDataOverrideDefaults(FixedWingPathFollowerSettingsData * data);
+
+/* Typesafe Object access functions */
+static inline int32_t FixedWingPathFollowerSettingsGet(FixedWingPathFollowerSettingsData * dataOut) {
+    return UAVObjGetData(FixedWingPathFollowerSettingsHandle(), dataOut);
+}
+static inline int32_t FixedWingPathFollowerSettingsSet(const FixedWingPathFollowerSettingsData * dataIn) {
+    return UAVObjSetData(FixedWingPathFollowerSettingsHandle(), dataIn);
+}
+static inline int32_t FixedWingPathFollowerSettingsInstGet(uint16_t instId, FixedWingPathFollowerSettingsData * dataOut) {
+    return UAVObjGetInstanceData(FixedWingPathFollowerSettingsHandle(), instId, dataOut);
+}
+static inline int32_t FixedWingPathFollowerSettingsInstSet(uint16_t instId, const FixedWingPathFollowerSettingsData * dataIn) {
+    return UAVObjSetInstanceData(FixedWingPathFollowerSettingsHandle(), instId, dataIn);
+}
+static inline int32_t FixedWingPathFollowerSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(FixedWingPathFollowerSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t FixedWingPathFollowerSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(FixedWingPathFollowerSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t FixedWingPathFollowerSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(FixedWingPathFollowerSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t FixedWingPathFollowerSettingsCreateInstance() {
+    return UAVObjCreateInstance(FixedWingPathFollowerSettingsHandle());
+}
+static inline void FixedWingPathFollowerSettingsRequestUpdate() {
+    UAVObjRequestUpdate(FixedWingPathFollowerSettingsHandle());
+}
+static inline void FixedWingPathFollowerSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(FixedWingPathFollowerSettingsHandle(), instId);
+}
+static inline void FixedWingPathFollowerSettingsUpdated() {
+    UAVObjUpdated(FixedWingPathFollowerSettingsHandle());
+}
+static inline void FixedWingPathFollowerSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(FixedWingPathFollowerSettingsHandle(), instId);
+}
+static inline void FixedWingPathFollowerSettingsLogging() {
+    UAVObjLogging(FixedWingPathFollowerSettingsHandle());
+}
+static inline void FixedWingPathFollowerSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(FixedWingPathFollowerSettingsHandle(), instId);
+}
+static inline int32_t FixedWingPathFollowerSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(FixedWingPathFollowerSettingsHandle(), dataOut);
+}
+static inline int32_t FixedWingPathFollowerSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(FixedWingPathFollowerSettingsHandle(), dataIn);
+}
+static inline int8_t FixedWingPathFollowerSettingsReadOnly() {
+    return UAVObjReadOnly(FixedWingPathFollowerSettingsHandle());
+}
+
+/* Set/Get functions */
+extern void FixedWingPathFollowerSettingsHorizontalVelMaxSet(float *NewHorizontalVelMax);
+extern void FixedWingPathFollowerSettingsHorizontalVelMaxGet(float *NewHorizontalVelMax);
+extern void FixedWingPathFollowerSettingsHorizontalVelMinSet(float *NewHorizontalVelMin);
+extern void FixedWingPathFollowerSettingsHorizontalVelMinGet(float *NewHorizontalVelMin);
+extern void FixedWingPathFollowerSettingsVerticalVelMaxSet(float *NewVerticalVelMax);
+extern void FixedWingPathFollowerSettingsVerticalVelMaxGet(float *NewVerticalVelMax);
+extern void FixedWingPathFollowerSettingsCourseFeedForwardSet(float *NewCourseFeedForward);
+extern void FixedWingPathFollowerSettingsCourseFeedForwardGet(float *NewCourseFeedForward);
+extern void FixedWingPathFollowerSettingsReverseCourseOverlapSet(float *NewReverseCourseOverlap);
+extern void FixedWingPathFollowerSettingsReverseCourseOverlapGet(float *NewReverseCourseOverlap);
+extern void FixedWingPathFollowerSettingsHorizontalPosPSet(float *NewHorizontalPosP);
+extern void FixedWingPathFollowerSettingsHorizontalPosPGet(float *NewHorizontalPosP);
+extern void FixedWingPathFollowerSettingsVerticalPosPSet(float *NewVerticalPosP);
+extern void FixedWingPathFollowerSettingsVerticalPosPGet(float *NewVerticalPosP);
+extern void FixedWingPathFollowerSettingsCoursePISet(FixedWingPathFollowerSettingsCoursePIData *NewCoursePI);
+extern void FixedWingPathFollowerSettingsCoursePIGet(FixedWingPathFollowerSettingsCoursePIData *NewCoursePI);
+extern void FixedWingPathFollowerSettingsCoursePIArraySet(float *NewCoursePI);
+extern void FixedWingPathFollowerSettingsCoursePIArrayGet(float *NewCoursePI);
+extern void FixedWingPathFollowerSettingsSpeedPISet(FixedWingPathFollowerSettingsSpeedPIData *NewSpeedPI);
+extern void FixedWingPathFollowerSettingsSpeedPIGet(FixedWingPathFollowerSettingsSpeedPIData *NewSpeedPI);
+extern void FixedWingPathFollowerSettingsSpeedPIArraySet(float *NewSpeedPI);
+extern void FixedWingPathFollowerSettingsSpeedPIArrayGet(float *NewSpeedPI);
+extern void FixedWingPathFollowerSettingsVerticalToPitchCrossFeedSet(FixedWingPathFollowerSettingsVerticalToPitchCrossFeedData *NewVerticalToPitchCrossFeed);
+extern void FixedWingPathFollowerSettingsVerticalToPitchCrossFeedGet(FixedWingPathFollowerSettingsVerticalToPitchCrossFeedData *NewVerticalToPitchCrossFeed);
+extern void FixedWingPathFollowerSettingsVerticalToPitchCrossFeedArraySet(float *NewVerticalToPitchCrossFeed);
+extern void FixedWingPathFollowerSettingsVerticalToPitchCrossFeedArrayGet(float *NewVerticalToPitchCrossFeed);
+extern void FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedSet(FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedData *NewAirspeedToPowerCrossFeed);
+extern void FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedGet(FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedData *NewAirspeedToPowerCrossFeed);
+extern void FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedArraySet(float *NewAirspeedToPowerCrossFeed);
+extern void FixedWingPathFollowerSettingsAirspeedToPowerCrossFeedArrayGet(float *NewAirspeedToPowerCrossFeed);
+extern void FixedWingPathFollowerSettingsPowerPISet(FixedWingPathFollowerSettingsPowerPIData *NewPowerPI);
+extern void FixedWingPathFollowerSettingsPowerPIGet(FixedWingPathFollowerSettingsPowerPIData *NewPowerPI);
+extern void FixedWingPathFollowerSettingsPowerPIArraySet(float *NewPowerPI);
+extern void FixedWingPathFollowerSettingsPowerPIArrayGet(float *NewPowerPI);
+extern void FixedWingPathFollowerSettingsRollLimitSet(FixedWingPathFollowerSettingsRollLimitData *NewRollLimit);
+extern void FixedWingPathFollowerSettingsRollLimitGet(FixedWingPathFollowerSettingsRollLimitData *NewRollLimit);
+extern void FixedWingPathFollowerSettingsRollLimitArraySet(float *NewRollLimit);
+extern void FixedWingPathFollowerSettingsRollLimitArrayGet(float *NewRollLimit);
+extern void FixedWingPathFollowerSettingsPitchLimitSet(FixedWingPathFollowerSettingsPitchLimitData *NewPitchLimit);
+extern void FixedWingPathFollowerSettingsPitchLimitGet(FixedWingPathFollowerSettingsPitchLimitData *NewPitchLimit);
+extern void FixedWingPathFollowerSettingsPitchLimitArraySet(float *NewPitchLimit);
+extern void FixedWingPathFollowerSettingsPitchLimitArrayGet(float *NewPitchLimit);
+extern void FixedWingPathFollowerSettingsThrustLimitSet(FixedWingPathFollowerSettingsThrustLimitData *NewThrustLimit);
+extern void FixedWingPathFollowerSettingsThrustLimitGet(FixedWingPathFollowerSettingsThrustLimitData *NewThrustLimit);
+extern void FixedWingPathFollowerSettingsThrustLimitArraySet(float *NewThrustLimit);
+extern void FixedWingPathFollowerSettingsThrustLimitArrayGet(float *NewThrustLimit);
+extern void FixedWingPathFollowerSettingsSafetymarginsSet(FixedWingPathFollowerSettingsSafetymarginsData *NewSafetymargins);
+extern void FixedWingPathFollowerSettingsSafetymarginsGet(FixedWingPathFollowerSettingsSafetymarginsData *NewSafetymargins);
+extern void FixedWingPathFollowerSettingsSafetymarginsArraySet(float *NewSafetymargins);
+extern void FixedWingPathFollowerSettingsSafetymarginsArrayGet(float *NewSafetymargins);
+extern void FixedWingPathFollowerSettingsSafetyCutoffLimitsSet(FixedWingPathFollowerSettingsSafetyCutoffLimitsData *NewSafetyCutoffLimits);
+extern void FixedWingPathFollowerSettingsSafetyCutoffLimitsGet(FixedWingPathFollowerSettingsSafetyCutoffLimitsData *NewSafetyCutoffLimits);
+extern void FixedWingPathFollowerSettingsSafetyCutoffLimitsArraySet(float *NewSafetyCutoffLimits);
+extern void FixedWingPathFollowerSettingsSafetyCutoffLimitsArrayGet(float *NewSafetyCutoffLimits);
+extern void FixedWingPathFollowerSettingsTakeOffPitchSet(float *NewTakeOffPitch);
+extern void FixedWingPathFollowerSettingsTakeOffPitchGet(float *NewTakeOffPitch);
+extern void FixedWingPathFollowerSettingsLandingPitchSet(float *NewLandingPitch);
+extern void FixedWingPathFollowerSettingsLandingPitchGet(float *NewLandingPitch);
+extern void FixedWingPathFollowerSettingsUpdatePeriodSet(int32_t *NewUpdatePeriod);
+extern void FixedWingPathFollowerSettingsUpdatePeriodGet(int32_t *NewUpdatePeriod);
+extern void FixedWingPathFollowerSettingsUseAirspeedSensorSet(FixedWingPathFollowerSettingsUseAirspeedSensorOptions *NewUseAirspeedSensor);
+extern void FixedWingPathFollowerSettingsUseAirspeedSensorGet(FixedWingPathFollowerSettingsUseAirspeedSensorOptions *NewUseAirspeedSensor);
+
+
+#endif // FIXEDWINGPATHFOLLOWERSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
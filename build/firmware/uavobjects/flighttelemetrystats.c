@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FlightTelemetryStats FlightTelemetryStats
+ * @brief Maintains the telemetry statistics from the OpenPilot flight computer.
+ *
+ * Autogenerated files and functions for FlightTelemetryStats Object
+ * @{ 
+ *
+ * @file       flighttelemetrystats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightTelemetryStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flighttelemetrystats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "flighttelemetrystats.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if FLIGHTTELEMETRYSTATS_ISSETTINGS
+SETTINGS_INITCALL(FlightTelemetryStatsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightTelemetryStatsInitialize(void)
+{
+    // Compile time assertion that the FlightTelemetryStatsDataPacked and FlightTelemetryStatsData structs
+    // have the same size (though instances of FlightTelemetryStatsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FlightTelemetryStatsDataPacked) == sizeof(FlightTelemetryStatsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FLIGHTTELEMETRYSTATS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = FLIGHTTELEMETRYSTATS_OBJID,
+       .instance_size = FLIGHTTELEMETRYSTATS_NUMBYTES,
+       .init_callback = &FlightTelemetryStatsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        FLIGHTTELEMETRYSTATS_ISSINGLEINST, FLIGHTTELEMETRYSTATS_ISSETTINGS, FLIGHTTELEMETRYSTATS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) FlightTelemetryStatsData * data) {}
+
+void FlightTelemetryStatsDataOverrideDefaults(FlightTelemetryStatsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightTelemetryStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FlightTelemetryStatsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FlightTelemetryStatsData));
+
+    FlightTelemetryStatsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 5000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightTelemetryStatsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void FlightTelemetryStatsTxDataRateSet(float *NewTxDataRate)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxDataRate, offsetof(FlightTelemetryStatsData, TxDataRate), sizeof(float));
+}
+void FlightTelemetryStatsTxDataRateGet(float *NewTxDataRate)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxDataRate, offsetof(FlightTelemetryStatsData, TxDataRate), sizeof(float));
+}
+void FlightTelemetryStatsTxBytesSet(uint32_t *NewTxBytes)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxBytes, offsetof(FlightTelemetryStatsData, TxBytes), sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxBytesGet(uint32_t *NewTxBytes)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxBytes, offsetof(FlightTelemetryStatsData, TxBytes), sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxFailuresSet(uint32_t *NewTxFailures)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxFailures, offsetof(FlightTelemetryStatsData, TxFailures), sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxFailuresGet(uint32_t *NewTxFailures)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxFailures, offsetof(FlightTelemetryStatsData, TxFailures), sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxRetriesSet(uint32_t *NewTxRetries)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxRetries, offsetof(FlightTelemetryStatsData, TxRetries), sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxRetriesGet(uint32_t *NewTxRetries)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxRetries, offsetof(FlightTelemetryStatsData, TxRetries), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxDataRateSet(float *NewRxDataRate)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewRxDataRate, offsetof(FlightTelemetryStatsData, RxDataRate), sizeof(float));
+}
+void FlightTelemetryStatsRxDataRateGet(float *NewRxDataRate)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewRxDataRate, offsetof(FlightTelemetryStatsData, RxDataRate), sizeof(float));
+}
+void FlightTelemetryStatsRxBytesSet(uint32_t *NewRxBytes)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewRxBytes, offsetof(FlightTelemetryStatsData, RxBytes), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxBytesGet(uint32_t *NewRxBytes)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewRxBytes, offsetof(FlightTelemetryStatsData, RxBytes), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxFailuresSet(uint32_t *NewRxFailures)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewRxFailures, offsetof(FlightTelemetryStatsData, RxFailures), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxFailuresGet(uint32_t *NewRxFailures)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewRxFailures, offsetof(FlightTelemetryStatsData, RxFailures), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxSyncErrorsSet(uint32_t *NewRxSyncErrors)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewRxSyncErrors, offsetof(FlightTelemetryStatsData, RxSyncErrors), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxSyncErrorsGet(uint32_t *NewRxSyncErrors)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewRxSyncErrors, offsetof(FlightTelemetryStatsData, RxSyncErrors), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxCrcErrorsSet(uint32_t *NewRxCrcErrors)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewRxCrcErrors, offsetof(FlightTelemetryStatsData, RxCrcErrors), sizeof(uint32_t));
+}
+void FlightTelemetryStatsRxCrcErrorsGet(uint32_t *NewRxCrcErrors)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewRxCrcErrors, offsetof(FlightTelemetryStatsData, RxCrcErrors), sizeof(uint32_t));
+}
+void FlightTelemetryStatsLinkCapacitySet(float *NewLinkCapacity)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewLinkCapacity, offsetof(FlightTelemetryStatsData, LinkCapacity), sizeof(float));
+}
+void FlightTelemetryStatsLinkCapacityGet(float *NewLinkCapacity)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewLinkCapacity, offsetof(FlightTelemetryStatsData, LinkCapacity), sizeof(float));
+}
+void FlightTelemetryStatsTxUtilizationSet( FlightTelemetryStatsTxUtilizationData *NewTxUtilization )
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxUtilization, offsetof(FlightTelemetryStatsData, TxUtilization), 3*sizeof(float));
+}
+void FlightTelemetryStatsTxUtilizationGet( FlightTelemetryStatsTxUtilizationData *NewTxUtilization )
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxUtilization, offsetof(FlightTelemetryStatsData, TxUtilization), 3*sizeof(float));
+}
+void FlightTelemetryStatsTxUtilizationArraySet( float *NewTxUtilization )
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxUtilization, offsetof(FlightTelemetryStatsData, TxUtilization), 3*sizeof(float));
+}
+void FlightTelemetryStatsTxUtilizationArrayGet( float *NewTxUtilization )
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxUtilization, offsetof(FlightTelemetryStatsData, TxUtilization), 3*sizeof(float));
+}
+void FlightTelemetryStatsTxDroppedSet( FlightTelemetryStatsTxDroppedData *NewTxDropped )
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxDropped, offsetof(FlightTelemetryStatsData, TxDropped), 2*sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxDroppedGet( FlightTelemetryStatsTxDroppedData *NewTxDropped )
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxDropped, offsetof(FlightTelemetryStatsData, TxDropped), 2*sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxDroppedArraySet( uint32_t *NewTxDropped )
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxDropped, offsetof(FlightTelemetryStatsData, TxDropped), 2*sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxDroppedArrayGet( uint32_t *NewTxDropped )
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxDropped, offsetof(FlightTelemetryStatsData, TxDropped), 2*sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxMergedSet(uint32_t *NewTxMerged)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewTxMerged, offsetof(FlightTelemetryStatsData, TxMerged), sizeof(uint32_t));
+}
+void FlightTelemetryStatsTxMergedGet(uint32_t *NewTxMerged)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewTxMerged, offsetof(FlightTelemetryStatsData, TxMerged), sizeof(uint32_t));
+}
+void FlightTelemetryStatsStatusSet(FlightTelemetryStatsStatusOptions *NewStatus)
+{
+    UAVObjSetDataField(FlightTelemetryStatsHandle(), (void *)NewStatus, offsetof(FlightTelemetryStatsData, Status), sizeof(FlightTelemetryStatsStatusOptions));
+}
+void FlightTelemetryStatsStatusGet(FlightTelemetryStatsStatusOptions *NewStatus)
+{
+    UAVObjGetDataField(FlightTelemetryStatsHandle(), (void *)NewStatus, offsetof(FlightTelemetryStatsData, Status), sizeof(FlightTelemetryStatsStatusOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,258 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup FlightTelemetryStats FlightTelemetryStats
+ * @brief Maintains the telemetry statistics from the OpenPilot flight computer.
+ *
+ * Autogenerated files and functions for FlightTelemetryStats Object
+ *
+ * @{
+ *
+ * @file       flighttelemetrystats.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightTelemetryStats object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: flighttelemetrystats.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTTELEMETRYSTATS_H
+#define FLIGHTTELEMETRYSTATS_H
+#include <stdbool.h>
+
+/* Object constants */
+#define FLIGHTTELEMETRYSTATS_OBJID 0x3316C294
+#define FLIGHTTELEMETRYSTATS_ISSINGLEINST 1
+#define FLIGHTTELEMETRYSTATS_ISSETTINGS 0
+#define FLIGHTTELEMETRYSTATS_ISPRIORITY 1
+#define FLIGHTTELEMETRYSTATS_NUMBYTES sizeof(FlightTelemetryStatsData)
+
+/* Generic interface functions */
+int32_t FlightTelemetryStatsInitialize();
+UAVObjHandle FlightTelemetryStatsHandle();
+void FlightTelemetryStatsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field TxDataRate information */
+
+/* Field TxBytes information */
+
+/* Field TxFailures information */
+
+/* Field TxRetries information */
+
+/* Field RxDataRate information */
+
+/* Field RxBytes information */
+
+/* Field RxFailures information */
+
+/* Field RxSyncErrors information */
+
+/* Field RxCrcErrors information */
+
+/* Field LinkCapacity information */
+
+/* Field TxUtilization information */
+
+// Array element names for field TxUtilization
+typedef enum {
+    FLIGHTTELEMETRYSTATS_TXUTILIZATION_CRITICAL=0,
+    FLIGHTTELEMETRYSTATS_TXUTILIZATION_ONCHANGE=1,
+    FLIGHTTELEMETRYSTATS_TXUTILIZATION_PERIODIC=2
+} FlightTelemetryStatsTxUtilizationElem;
+
+// Number of elements for field TxUtilization
+#define FLIGHTTELEMETRYSTATS_TXUTILIZATION_NUMELEM 3
+
+/* Field TxDropped information */
+
+// Array element names for field TxDropped
+typedef enum {
+    FLIGHTTELEMETRYSTATS_TXDROPPED_ONCHANGE=0,
+    FLIGHTTELEMETRYSTATS_TXDROPPED_PERIODIC=1
+} FlightTelemetryStatsTxDroppedElem;
+
+// Number of elements for field TxDropped
+#define FLIGHTTELEMETRYSTATS_TXDROPPED_NUMELEM 2
+
+/* Field TxMerged information */
+
+/* Field Status information */
+
+// Enumeration options for field Status
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTTELEMETRYSTATS_STATUS_DISCONNECTED=0,
+    FLIGHTTELEMETRYSTATS_STATUS_HANDSHAKEREQ=1,
+    FLIGHTTELEMETRYSTATS_STATUS_HANDSHAKEACK=2,
+    FLIGHTTELEMETRYSTATS_STATUS_CONNECTED=3
+} FlightTelemetryStatsStatusOptions;
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float Critical;
+    float OnChange;
+    float Periodic;
+}  FlightTelemetryStatsTxUtilizationData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  FlightTelemetryStatsTxUtilizationDataArray ;
+#define FlightTelemetryStatsTxUtilizationToArray( var ) UAVObjectFieldToArray( FlightTelemetryStatsTxUtilizationData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t OnChange;
+    uint32_t Periodic;
+}  FlightTelemetryStatsTxDroppedData ;
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t array[2];
+}  FlightTelemetryStatsTxDroppedDataArray ;
+#define FlightTelemetryStatsTxDroppedToArray( var ) UAVObjectFieldToArray( FlightTelemetryStatsTxDroppedData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float TxDataRate;
+    uint32_t TxBytes;
+    uint32_t TxFailures;
+    uint32_t TxRetries;
+    float RxDataRate;
+    uint32_t RxBytes;
+    uint32_t RxFailures;
+    uint32_t RxSyncErrors;
+    uint32_t RxCrcErrors;
+    float LinkCapacity;
+    FlightTelemetryStatsTxUtilizationData TxUtilization;
+    FlightTelemetryStatsTxDroppedData TxDropped;
+    uint32_t TxMerged;
+    FlightTelemetryStatsStatusOptions Status;
+
+} __attribute__((packed)) FlightTelemetryStatsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef FlightTelemetryStatsDataPacked __attribute__((aligned(4))) FlightTelemetryStatsData;
+
+void FlightTelemetryStatsDataOverrideDefaults(FlightTelemetryStatsData * data);
+
+/* Typesafe Object access functions */
+static inline int32_t FlightTelemetryStatsGet(FlightTelemetryStatsData * dataOut) {
+    return UAVObjGetData(FlightTelemetryStatsHandle(), dataOut);
+}
+static inline int32_t FlightTelemetryStatsSet(const FlightTelemetryStatsData * dataIn) {
+    return UAVObjSetData(FlightTelemetryStatsHandle(), dataIn);
+}
+static inline int32_t FlightTelemetryStatsInstGet(uint16_t instId, FlightTelemetryStatsData * dataOut) {
+    return UAVObjGetInstanceData(FlightTelemetryStatsHandle(), instId, dataOut);
+}
+static inline int32_t FlightTelemetryStatsInstSet(uint16_t instId, const FlightTelemetryStatsData * dataIn) {
+    return UAVObjSetInstanceData(FlightTelemetryStatsHandle(), instId, dataIn);
+}
+static inline int32_t FlightTelemetryStatsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(FlightTelemetryStatsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t FlightTelemetryStatsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(FlightTelemetryStatsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t FlightTelemetryStatsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(FlightTelemetryStatsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t FlightTelemetryStatsCreateInstance() {
+    return UAVObjCreateInstance(FlightTelemetryStatsHandle());
+}
+static inline void FlightTelemetryStatsRequestUpdate() {
+    UAVObjRequestUpdate(FlightTelemetryStatsHandle());
+}
+static inline void FlightTelemetryStatsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(FlightTelemetryStatsHandle(), instId);
+}
+static inline void FlightTelemetryStatsUpdated() {
+    UAVObjUpdated(FlightTelemetryStatsHandle());
+}
+static inline void FlightTelemetryStatsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(FlightTelemetryStatsHandle(), instId);
+}
+static inline void FlightTelemetryStatsLogging() {
+    UAVObjLogging(FlightTelemetryStatsHandle());
+}
+static inline void FlightTelemetryStatsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(FlightTelemetryStatsHandle(), instId);
+}
+static inline int32_t FlightTelemetryStatsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(FlightTelemetryStatsHandle(), dataOut);
+}
+static inline int32_t FlightTelemetryStatsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(FlightTelemetryStatsHandle(), dataIn);
+}
+static inline int8_t FlightTelemetryStatsReadOnly() {
+    return UAVObjReadOnly(FlightTelemetryStatsHandle());
+}
+
+/* Set/Get functions */
+extern void FlightTelemetryStatsTxDataRateSet(float *NewTxDataRate);
+extern void FlightTelemetryStatsTxDataRateGet(float *NewTxDataRate);
+extern void FlightTelemetryStatsTxBytesSet(uint32_t *NewTxBytes);
+extern void FlightTelemetryStatsTxBytesGet(uint32_t *NewTxBytes);
+extern void FlightTelemetryStatsTxFailuresSet(uint32_t *NewTxFailures);
+extern void FlightTelemetryStatsTxFailuresGet(uint32_t *NewTxFailures);
+extern void FlightTelemetryStatsTxRetriesSet(uint32_t *NewTxRetries);
+extern void FlightTelemetryStatsTxRetriesGet(uint32_t *NewTxRetries);
+extern void FlightTelemetryStatsRxDataRateSet(float *NewRxDataRate);
+extern void FlightTelemetryStatsRxDataRateGet(float *NewRxDataRate);
+extern void FlightTelemetryStatsRxBytesSet(uint32_t *NewRxBytes);
+extern void FlightTelemetryStatsRxBytesGet(uint32_t *NewRxBytes);
+extern void FlightTelemetryStatsRxFailuresSet(uint32_t *NewRxFailures);
+extern void FlightTelemetryStatsRxFailuresGet(uint32_t *NewRxFailures);
+extern void FlightTelemetryStatsRxSyncErrorsSet(uint32_t *NewRxSyncErrors);
+extern void FlightTelemetryStatsRxSyncErrorsGet(uint32_t *NewRxSyncErrors);
+extern void FlightTelemetryStatsRxCrcErrorsSet(uint32_t *NewRxCrcErrors);
+extern void FlightTelemetryStatsRxCrcErrorsGet(uint32_t *NewRxCrcErrors);
+extern void FlightTelemetryStatsLinkCapacitySet(float *NewLinkCapacity);
+extern void FlightTelemetryStatsLinkCapacityGet(float *NewLinkCapacity);
+extern void FlightTelemetryStatsTxUtilizationSet(FlightTelemetryStatsTxUtilizationData *NewTxUtilization);
+extern void FlightTelemetryStatsTxUtilizationGet(FlightTelemetryStatsTxUtilizationData *NewTxUtilization);
+extern void FlightTelemetryStatsTxUtilizationArraySet(float *NewTxUtilization);
+extern void FlightTelemetryStatsTxUtilizationArrayGet(float *NewTxUtilization);
+extern void FlightTelemetryStatsTxDroppedSet(FlightTelemetryStatsTxDroppedData *NewTxDropped);
+extern void FlightTelemetryStatsTxDroppedGet(FlightTelemetryStatsTxDroppedData *NewTxDropped);
+extern void FlightTelemetryStatsTxDroppedArraySet(uint32_t *NewTxDropped);
+extern void FlightTelemetryStatsTxDroppedArrayGet(uint32_t *NewTxDropped);
+extern void FlightTelemetryStatsTxMergedSet(uint32_t *NewTxMerged);
+extern void FlightTelemetryStatsTxMergedGet(uint32_t *NewTxMerged);
+extern void FlightTelemetryStatsStatusSet(FlightTelemetryStatsStatusOptions *NewStatus);
+extern void FlightTelemetryStatsStatusGet(FlightTelemetryStatsStatusOptions *NewStatus);
+
+
+#endif // FLIGHTTELEMETRYSTATS_H
+
+/**
+ * @}
+ * @}
+ */
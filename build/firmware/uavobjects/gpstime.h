@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup GPSTime GPSTime
+ * @brief Contains the GPS time from @ref GPSModule.  Required to compute the world magnetic model correctly when setting the home location.
+ *
+ * Autogenerated files and functions for GPSTime Object
+ *
+ * @{
+ *
+ * @file       gpstime.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSTime object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: gpstime.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef GPSTIME_H
+#define GPSTIME_H
+#include <stdbool.h>
+
+/* Object constants */
+#define GPSTIME_OBJID 0x1E2F477E
+#define GPSTIME_ISSINGLEINST 1
+#define GPSTIME_ISSETTINGS 0
+#define GPSTIME_ISPRIORITY 0
+#define GPSTIME_NUMBYTES sizeof(GPSTimeData)
+
+/* Generic interface functions */
+int32_t GPSTimeInitialize();
+UAVObjHandle GPSTimeHandle();
+void GPSTimeSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Year information */
+
+/* Field Millisecond information */
+
+/* Field Month information */
+
+/* Field Day information */
+
+/* Field Hour information */
+
+/* Field Minute information */
+
+/* Field Second information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        int16_t Year;
+    int16_t Millisecond;
+    int8_t Month;
+    int8_t Day;
+    int8_t Hour;
+    int8_t Minute;
+    int8_t Second;
+
+} __attribute__((packed)) GPSTimeDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef GPSTimeDataPacked __attribute__((aligned(4))) GPSTimeData;
+
+void GPSTimeDataOverrideDefaults(GPSTimeData * data);
+
+/* Typesafe Object access functions */
+static inline int32_t GPSTimeGet(GPSTimeData * dataOut) {
+    return UAVObjGetData(GPSTimeHandle(), dataOut);
+}
+static inline int32_t GPSTimeSet(const GPSTimeData * dataIn) {
+    return UAVObjSetData(GPSTimeHandle(), dataIn);
+}
+static inline int32_t GPSTimeInstGet(uint16_t instId, GPSTimeData * dataOut) {
+    return UAVObjGetInstanceData(GPSTimeHandle(), instId, dataOut);
+}
+static inline int32_t GPSTimeInstSet(uint16_t instId, const GPSTimeData * dataIn) {
+    return UAVObjSetInstanceData(GPSTimeHandle(), instId, dataIn);
+}
+static inline int32_t GPSTimeConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(GPSTimeHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t GPSTimeConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GPSTimeHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t GPSTimeConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GPSTimeHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t GPSTimeCreateInstance() {
+    return UAVObjCreateInstance(GPSTimeHandle());
+}
+static inline void GPSTimeRequestUpdate() {
+    UAVObjRequestUpdate(GPSTimeHandle());
+}
+static inline void GPSTimeRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(GPSTimeHandle(), instId);
+}
+static inline void GPSTimeUpdated() {
+    UAVObjUpdated(GPSTimeHandle());
+}
+static inline void GPSTimeInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(GPSTimeHandle(), instId);
+}
+static inline void GPSTimeLogging() {
+    UAVObjLogging(GPSTimeHandle());
+}
+static inline void GPSTimeInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(GPSTimeHandle(), instId);
+}
+static inline int32_t GPSTimeGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(GPSTimeHandle(), dataOut);
+}
+static inline int32_t GPSTimeSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(GPSTimeHandle(), dataIn);
+}
+static inline int8_t GPSTimeReadOnly() {
+    return UAVObjReadOnly(GPSTimeHandle());
+}
+
+/* Set/Get functions */
+extern void GPSTimeYearSet(int16_t *NewYear);
+extern void GPSTimeYearGet(int16_t *NewYear);
+extern void GPSTimeMillisecondSet(int16_t *NewMillisecond);
+extern void GPSTimeMillisecondGet(int16_t *NewMillisecond);
+extern void GPSTimeMonthSet(int8_t *NewMonth);
+extern void GPSTimeMonthGet(int8_t *NewMonth);
+extern void GPSTimeDaySet(int8_t *NewDay);
+extern void GPSTimeDayGet(int8_t *NewDay);
+extern void GPSTimeHourSet(int8_t *NewHour);
+extern void GPSTimeHourGet(int8_t *NewHour);
+extern void GPSTimeMinuteSet(int8_t *NewMinute);
+extern void GPSTimeMinuteGet(int8_t *NewMinute);
+extern void GPSTimeSecondSet(int8_t *NewSecond);
+extern void GPSTimeSecondGet(int8_t *NewSecond);
+
+
+#endif // GPSTIME_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GyroSensor GyroSensor
+ * @brief Calibrated sensor data from 3 axis gyroscope in deg/s.
+ *
+ * Autogenerated files and functions for GyroSensor Object
+ * @{ 
+ *
+ * @file       gyrosensor.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GyroSensor object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gyrosensor.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gyrosensor.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if GYROSENSOR_ISSETTINGS
+SETTINGS_INITCALL(GyroSensorInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GyroSensorInitialize(void)
+{
+    // Compile time assertion that the GyroSensorDataPacked and GyroSensorData structs
+    // have the same size (though instances of GyroSensorData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GyroSensorDataPacked) == sizeof(GyroSensorData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GYROSENSOR_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = GYROSENSOR_OBJID,
+       .instance_size = GYROSENSOR_NUMBYTES,
+       .init_callback = &GyroSensorSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        GYROSENSOR_ISSINGLEINST, GYROSENSOR_ISSETTINGS, GYROSENSOR_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) GyroSensorData * data) {}
+
+void GyroSensorDataOverrideDefaults(GyroSensorData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GyroSensorSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GyroSensorData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GyroSensorData));
+
+    GyroSensorDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GyroSensorHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GyroSensorxSet(float *Newx)
+{
+    UAVObjSetDataField(GyroSensorHandle(), (void *)Newx, offsetof(GyroSensorData, x), sizeof(float));
+}
+void GyroSensorxGet(float *Newx)
+{
+    UAVObjGetDataField(GyroSensorHandle(), (void *)Newx, offsetof(GyroSensorData, x), sizeof(float));
+}
+void GyroSensorySet(float *Newy)
+{
+    UAVObjSetDataField(GyroSensorHandle(), (void *)Newy, offsetof(GyroSensorData, y), sizeof(float));
+}
+void GyroSensoryGet(float *Newy)
+{
+    UAVObjGetDataField(GyroSensorHandle(), (void *)Newy, offsetof(GyroSensorData, y), sizeof(float));
+}
+void GyroSensorzSet(float *Newz)
+{
+    UAVObjSetDataField(GyroSensorHandle(), (void *)Newz, offsetof(GyroSensorData, z), sizeof(float));
+}
+void GyroSensorzGet(float *Newz)
+{
+    UAVObjGetDataField(GyroSensorHandle(), (void *)Newz, offsetof(GyroSensorData, z), sizeof(float));
+}
+void GyroSensortemperatureSet(float *Newtemperature)
+{
+    UAVObjSetDataField(GyroSensorHandle(), (void *)Newtemperature, offsetof(GyroSensorData, temperature), sizeof(float));
+}
+void GyroSensortemperatureGet(float *Newtemperature)
+{
+    UAVObjGetDataField(GyroSensorHandle(), (void *)Newtemperature, offsetof(GyroSensorData, temperature), sizeof(float));
+}
+void GyroSensorSensorReadTimestampSet(uint32_t *NewSensorReadTimestamp)
+{
+    UAVObjSetDataField(GyroSensorHandle(), (void *)NewSensorReadTimestamp, offsetof(GyroSensorData, SensorReadTimestamp), sizeof(uint32_t));
+}
+void GyroSensorSensorReadTimestampGet(uint32_t *NewSensorReadTimestamp)
+{
+    UAVObjGetDataField(GyroSensorHandle(), (void *)NewSensorReadTimestamp, offsetof(GyroSensorData, SensorReadTimestamp), sizeof(uint32_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,245 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HoTTBridgeSettings HoTTBridgeSettings
+ * @brief Settings for the @ref HoTT Telemetry Module
+ *
+ * Autogenerated files and functions for HoTTBridgeSettings Object
+ * @{ 
+ *
+ * @file       hottbridgesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HoTTBridgeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hottbridgesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hottbridgesettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HOTTBRIDGESETTINGS_ISSETTINGS
+SETTINGS_INITCALL(HoTTBridgeSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HoTTBridgeSettingsInitialize(void)
+{
+    // Compile time assertion that the HoTTBridgeSettingsDataPacked and HoTTBridgeSettingsData structs
+    // have the same size (though instances of HoTTBridgeSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HoTTBridgeSettingsDataPacked) == sizeof(HoTTBridgeSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HOTTBRIDGESETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HOTTBRIDGESETTINGS_OBJID,
+       .instance_size = HOTTBRIDGESETTINGS_NUMBYTES,
+       .init_callback = &HoTTBridgeSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HOTTBRIDGESETTINGS_ISSINGLEINST, HOTTBRIDGESETTINGS_ISSETTINGS, HOTTBRIDGESETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HoTTBridgeSettingsData * data) {}
+
+void HoTTBridgeSettingsDataOverrideDefaults(HoTTBridgeSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HoTTBridgeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HoTTBridgeSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HoTTBridgeSettingsData));
+    data.Limit.MinSpeed = 3.000000e+01f;
+    data.Limit.MaxSpeed = 1.000000e+02f;
+    data.Limit.NegDifference1 = -1.000000e+01f;
+    data.Limit.PosDifference1 = 1.000000e+01f;
+    data.Limit.NegDifference2 = -1.000000e+00f;
+    data.Limit.PosDifference2 = 1.000000e+00f;
+    data.Limit.MinHeight = 2.000000e+01f;
+    data.Limit.MaxHeight = 5.000000e+02f;
+    data.Limit.MaxDistance = 1.500000e+03f;
+    data.Limit.MinPowerVoltage = 5.000000e+00f;
+    data.Limit.MaxPowerVoltage = 3.000000e+01f;
+    data.Limit.MinSensor1Voltage = 5.000000e+00f;
+    data.Limit.MaxSensor1Voltage = 3.000000e+01f;
+    data.Limit.MinSensor2Voltage = 5.000000e+00f;
+    data.Limit.MaxSensor2Voltage = 3.000000e+01f;
+    data.Limit.MinCellVoltage = 3.300000e+00f;
+    data.Limit.MaxCurrent = 4.000000e+01f;
+    data.Limit.MaxUsedCapacity = 2.000000e+03f;
+    data.Limit.MinSensor1Temp = 0.000000e+00f;
+    data.Limit.MaxSensor1Temp = 1.000000e+02f;
+    data.Limit.MinSensor2Temp = 0.000000e+00f;
+    data.Limit.MaxSensor2Temp = 1.000000e+02f;
+    data.Limit.MaxServoTemp = 1.000000e+02f;
+    data.Limit.MinRPM = 1.000000e+02f;
+    data.Limit.MaxRPM = 7.000000e+03f;
+    data.Limit.MinFuel = 1.000000e+03f;
+    data.Limit.MaxServoDifference = 0.000000e+00f;
+    data.Sensor.VARIO = 0;
+    data.Sensor.GPS = 0;
+    data.Sensor.EAM = 0;
+    data.Sensor.GAM = 0;
+    data.Sensor.ESC = 0;
+    data.Warning.AltitudeBeep = 0;
+    data.Warning.MinSpeed = 0;
+    data.Warning.MaxSpeed = 0;
+    data.Warning.NegDifference1 = 0;
+    data.Warning.PosDifference1 = 0;
+    data.Warning.NegDifference2 = 0;
+    data.Warning.PosDifference2 = 0;
+    data.Warning.MinHeight = 0;
+    data.Warning.MaxHeight = 0;
+    data.Warning.MaxDistance = 0;
+    data.Warning.MinPowerVoltage = 0;
+    data.Warning.MaxPowerVoltage = 0;
+    data.Warning.MinSensor1Voltage = 0;
+    data.Warning.MaxSensor1Voltage = 0;
+    data.Warning.MinSensor2Voltage = 0;
+    data.Warning.MaxSensor2Voltage = 0;
+    data.Warning.MinCellVoltage = 0;
+    data.Warning.MaxCurrent = 0;
+    data.Warning.MaxUsedCapacity = 0;
+    data.Warning.MinSensor1Temp = 0;
+    data.Warning.MaxSensor1Temp = 0;
+    data.Warning.MinSensor2Temp = 0;
+    data.Warning.MaxSensor2Temp = 0;
+    data.Warning.MaxServoTemp = 0;
+    data.Warning.MinRPM = 0;
+    data.Warning.MaxRPM = 0;
+    data.Warning.MinFuel = 0;
+    data.Warning.MaxServoDifference = 0;
+
+    HoTTBridgeSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HoTTBridgeSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HoTTBridgeSettingsLimitSet( HoTTBridgeSettingsLimitData *NewLimit )
+{
+    UAVObjSetDataField(HoTTBridgeSettingsHandle(), (void *)NewLimit, offsetof(HoTTBridgeSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTBridgeSettingsLimitGet( HoTTBridgeSettingsLimitData *NewLimit )
+{
+    UAVObjGetDataField(HoTTBridgeSettingsHandle(), (void *)NewLimit, offsetof(HoTTBridgeSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTBridgeSettingsLimitArraySet( float *NewLimit )
+{
+    UAVObjSetDataField(HoTTBridgeSettingsHandle(), (void *)NewLimit, offsetof(HoTTBridgeSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTBridgeSettingsLimitArrayGet( float *NewLimit )
+{
+    UAVObjGetDataField(HoTTBridgeSettingsHandle(), (void *)NewLimit, offsetof(HoTTBridgeSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTBridgeSettingsSensorSet( HoTTBridgeSettingsSensorData *NewSensor )
+{
+    UAVObjSetDataField(HoTTBridgeSettingsHandle(), (void *)NewSensor, offsetof(HoTTBridgeSettingsData, Sensor), 5*sizeof(HoTTBridgeSettingsSensorOptions));
+}
+void HoTTBridgeSettingsSensorGet( HoTTBridgeSettingsSensorData *NewSensor )
+{
+    UAVObjGetDataField(HoTTBridgeSettingsHandle(), (void *)NewSensor, offsetof(HoTTBridgeSettingsData, Sensor), 5*sizeof(HoTTBridgeSettingsSensorOptions));
+}
+void HoTTBridgeSettingsSensorArraySet( HoTTBridgeSettingsSensorOptions *NewSensor )
+{
+    UAVObjSetDataField(HoTTBridgeSettingsHandle(), (void *)NewSensor, offsetof(HoTTBridgeSettingsData, Sensor), 5*sizeof(HoTTBridgeSettingsSensorOptions));
+}
+void HoTTBridgeSettingsSensorArrayGet( HoTTBridgeSettingsSensorOptions *NewSensor )
+{
+    UAVObjGetDataField(HoTTBridgeSettingsHandle(), (void *)NewSensor, offsetof(HoTTBridgeSettingsData, Sensor), 5*sizeof(HoTTBridgeSettingsSensorOptions));
+}
+void HoTTBridgeSettingsWarningSet( HoTTBridgeSettingsWarningData *NewWarning )
+{
+    UAVObjSetDataField(HoTTBridgeSettingsHandle(), (void *)NewWarning, offsetof(HoTTBridgeSettingsData, Warning), 28*sizeof(HoTTBridgeSettingsWarningOptions));
+}
+void HoTTBridgeSettingsWarningGet( HoTTBridgeSettingsWarningData *NewWarning )
+{
+    UAVObjGetDataField(HoTTBridgeSettingsHandle(), (void *)NewWarning, offsetof(HoTTBridgeSettingsData, Warning), 28*sizeof(HoTTBridgeSettingsWarningOptions));
+}
+void HoTTBridgeSettingsWarningArraySet( HoTTBridgeSettingsWarningOptions *NewWarning )
+{
+    UAVObjSetDataField(HoTTBridgeSettingsHandle(), (void *)NewWarning, offsetof(HoTTBridgeSettingsData, Warning), 28*sizeof(HoTTBridgeSettingsWarningOptions));
+}
+void HoTTBridgeSettingsWarningArrayGet( HoTTBridgeSettingsWarningOptions *NewWarning )
+{
+    UAVObjGetDataField(HoTTBridgeSettingsHandle(), (void *)NewWarning, offsetof(HoTTBridgeSettingsData, Warning), 28*sizeof(HoTTBridgeSettingsWarningOptions));
+}
+
+
+/**
+ * @}
+ */
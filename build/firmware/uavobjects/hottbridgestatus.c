@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HoTTBridgeStatus HoTTBridgeStatus
+ * @brief HoTTBridge Status Information
+ *
+ * Autogenerated files and functions for HoTTBridgeStatus Object
+ * @{ 
+ *
+ * @file       hottbridgestatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HoTTBridgeStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hottbridgestatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hottbridgestatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HOTTBRIDGESTATUS_ISSETTINGS
+SETTINGS_INITCALL(HoTTBridgeStatusInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HoTTBridgeStatusInitialize(void)
+{
+    // Compile time assertion that the HoTTBridgeStatusDataPacked and HoTTBridgeStatusData structs
+    // have the same size (though instances of HoTTBridgeStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HoTTBridgeStatusDataPacked) == sizeof(HoTTBridgeStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HOTTBRIDGESTATUS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HOTTBRIDGESTATUS_OBJID,
+       .instance_size = HOTTBRIDGESTATUS_NUMBYTES,
+       .init_callback = &HoTTBridgeStatusSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HOTTBRIDGESTATUS_ISSINGLEINST, HOTTBRIDGESTATUS_ISSETTINGS, HOTTBRIDGESTATUS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HoTTBridgeStatusData * data) {}
+
+void HoTTBridgeStatusDataOverrideDefaults(HoTTBridgeStatusData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HoTTBridgeStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HoTTBridgeStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HoTTBridgeStatusData));
+
+    HoTTBridgeStatusDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 5000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HoTTBridgeStatusHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HoTTBridgeStatusTxPacketsSet(uint32_t *NewTxPackets)
+{
+    UAVObjSetDataField(HoTTBridgeStatusHandle(), (void *)NewTxPackets, offsetof(HoTTBridgeStatusData, TxPackets), sizeof(uint32_t));
+}
+void HoTTBridgeStatusTxPacketsGet(uint32_t *NewTxPackets)
+{
+    UAVObjGetDataField(HoTTBridgeStatusHandle(), (void *)NewTxPackets, offsetof(HoTTBridgeStatusData, TxPackets), sizeof(uint32_t));
+}
+void HoTTBridgeStatusRxPacketsSet(uint32_t *NewRxPackets)
+{
+    UAVObjSetDataField(HoTTBridgeStatusHandle(), (void *)NewRxPackets, offsetof(HoTTBridgeStatusData, RxPackets), sizeof(uint32_t));
+}
+void HoTTBridgeStatusRxPacketsGet(uint32_t *NewRxPackets)
+{
+    UAVObjGetDataField(HoTTBridgeStatusHandle(), (void *)NewRxPackets, offsetof(HoTTBridgeStatusData, RxPackets), sizeof(uint32_t));
+}
+void HoTTBridgeStatusTxFailSet(uint32_t *NewTxFail)
+{
+    UAVObjSetDataField(HoTTBridgeStatusHandle(), (void *)NewTxFail, offsetof(HoTTBridgeStatusData, TxFail), sizeof(uint32_t));
+}
+void HoTTBridgeStatusTxFailGet(uint32_t *NewTxFail)
+{
+    UAVObjGetDataField(HoTTBridgeStatusHandle(), (void *)NewTxFail, offsetof(HoTTBridgeStatusData, TxFail), sizeof(uint32_t));
+}
+void HoTTBridgeStatusRxFailSet(uint32_t *NewRxFail)
+{
+    UAVObjSetDataField(HoTTBridgeStatusHandle(), (void *)NewRxFail, offsetof(HoTTBridgeStatusData, RxFail), sizeof(uint32_t));
+}
+void HoTTBridgeStatusRxFailGet(uint32_t *NewRxFail)
+{
+    UAVObjGetDataField(HoTTBridgeStatusHandle(), (void *)NewRxFail, offsetof(HoTTBridgeStatusData, RxFail), sizeof(uint32_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,166 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HwPikoBLXSettings HwPikoBLXSettings
+ * @brief Furious FPV Piko BLX Micro Flight Controller hardware configuration
+ *
+ * Autogenerated files and functions for HwPikoBLXSettings Object
+ * @{ 
+ *
+ * @file       hwpikoblxsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HwPikoBLXSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwpikoblxsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hwpikoblxsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HWPIKOBLXSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(HwPikoBLXSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwPikoBLXSettingsInitialize(void)
+{
+    // Compile time assertion that the HwPikoBLXSettingsDataPacked and HwPikoBLXSettingsData structs
+    // have the same size (though instances of HwPikoBLXSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HwPikoBLXSettingsDataPacked) == sizeof(HwPikoBLXSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HWPIKOBLXSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HWPIKOBLXSETTINGS_OBJID,
+       .instance_size = HWPIKOBLXSETTINGS_NUMBYTES,
+       .init_callback = &HwPikoBLXSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HWPIKOBLXSETTINGS_ISSINGLEINST, HWPIKOBLXSETTINGS_ISSETTINGS, HWPIKOBLXSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HwPikoBLXSettingsData * data) {}
+
+void HwPikoBLXSettingsDataOverrideDefaults(HwPikoBLXSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwPikoBLXSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HwPikoBLXSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HwPikoBLXSettingsData));
+    data.UARTPort[0] = 0;
+    data.UARTPort[1] = 0;
+    data.UARTPort[2] = 0;
+    data.LEDPort = 0;
+    data.PPMPort = 0;
+
+    HwPikoBLXSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwPikoBLXSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwPikoBLXSettingsUARTPortSet( HwPikoBLXSettingsUARTPortOptions *NewUARTPort )
+{
+    UAVObjSetDataField(HwPikoBLXSettingsHandle(), (void *)NewUARTPort, offsetof(HwPikoBLXSettingsData, UARTPort), 3*sizeof(HwPikoBLXSettingsUARTPortOptions));
+}
+void HwPikoBLXSettingsUARTPortGet( HwPikoBLXSettingsUARTPortOptions *NewUARTPort )
+{
+    UAVObjGetDataField(HwPikoBLXSettingsHandle(), (void *)NewUARTPort, offsetof(HwPikoBLXSettingsData, UARTPort), 3*sizeof(HwPikoBLXSettingsUARTPortOptions));
+}
+void HwPikoBLXSettingsLEDPortSet(HwPikoBLXSettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjSetDataField(HwPikoBLXSettingsHandle(), (void *)NewLEDPort, offsetof(HwPikoBLXSettingsData, LEDPort), sizeof(HwPikoBLXSettingsLEDPortOptions));
+}
+void HwPikoBLXSettingsLEDPortGet(HwPikoBLXSettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjGetDataField(HwPikoBLXSettingsHandle(), (void *)NewLEDPort, offsetof(HwPikoBLXSettingsData, LEDPort), sizeof(HwPikoBLXSettingsLEDPortOptions));
+}
+void HwPikoBLXSettingsPPMPortSet(HwPikoBLXSettingsPPMPortOptions *NewPPMPort)
+{
+    UAVObjSetDataField(HwPikoBLXSettingsHandle(), (void *)NewPPMPort, offsetof(HwPikoBLXSettingsData, PPMPort), sizeof(HwPikoBLXSettingsPPMPortOptions));
+}
+void HwPikoBLXSettingsPPMPortGet(HwPikoBLXSettingsPPMPortOptions *NewPPMPort)
+{
+    UAVObjGetDataField(HwPikoBLXSettingsHandle(), (void *)NewPPMPort, offsetof(HwPikoBLXSettingsData, PPMPort), sizeof(HwPikoBLXSettingsPPMPortOptions));
+}
+
+
+/**
+ * @}
+ */
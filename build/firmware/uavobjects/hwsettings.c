@@ -0,0 +1,432 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HwSettings HwSettings
+ * @brief Selection of optional hardware configurations.
+ *
+ * Autogenerated files and functions for HwSettings Object
+ * @{ 
+ *
+ * @file       hwsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HwSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hwsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HWSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(HwSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSettingsInitialize(void)
+{
+    // Compile time assertion that the HwSettingsDataPacked and HwSettingsData structs
+    // have the same size (though instances of HwSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HwSettingsDataPacked) == sizeof(HwSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HWSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HWSETTINGS_OBJID,
+       .instance_size = HWSETTINGS_NUMBYTES,
+       .init_callback = &HwSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HWSETTINGS_ISSINGLEINST, HWSETTINGS_ISSETTINGS, HWSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HwSettingsData * data) {}
+
+void HwSettingsDataOverrideDefaults(HwSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HwSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HwSettingsData));
+    data.CC_RcvrPort = 1;
+    data.CC_MainPort = 1;
+    data.CC_FlexiPort = 0;
+    data.RV_RcvrPort = 1;
+    data.RV_AuxPort = 0;
+    data.RV_AuxSBusPort = 0;
+    data.RV_FlexiPort = 0;
+    data.RV_TelemetryPort = 1;
+    data.RV_GPSPort = 2;
+    data.RM_RcvrPort = 1;
+    data.RM_MainPort = 0;
+    data.RM_FlexiPort = 0;
+    data.SPK2_RcvrPort = 1;
+    data.SPK2_MainPort = 0;
+    data.SPK2_FlexiPort = 0;
+    data.SPK2_I2CPort = 0;
+    data.TelemetrySpeed = 5;
+    data.GPSSpeed = 5;
+    data.DebugConsoleSpeed = 5;
+    data.MSPSpeed = 6;
+    data.MAVLinkSpeed = 5;
+    data.USB_HIDPort = 0;
+    data.USB_VCPPort = 3;
+    data.RadioAuxStream = 1;
+    data.OptionalModules.CameraStab = 0;
+    data.OptionalModules.CameraControl = 0;
+    data.OptionalModules.GPS = 0;
+    data.OptionalModules.Fault = 0;
+    data.OptionalModules.Altitude = 0;
+    data.OptionalModules.Airspeed = 0;
+    data.OptionalModules.TxPID = 0;
+    data.OptionalModules.Battery = 0;
+    data.OptionalModules.Overo = 0;
+    data.OptionalModules.MagBaro = 0;
+    data.OptionalModules.OsdHk = 0;
+    data.OptionalModules.AutoTune = 0;
+    data.ADCRouting.adc0 = 0;
+    data.ADCRouting.adc1 = 0;
+    data.ADCRouting.adc2 = 0;
+    data.ADCRouting.adc3 = 0;
+    data.ADCRouting.adc4 = 0;
+    data.ADCRouting.adc5 = 0;
+    data.ADCRouting.adc6 = 0;
+    data.ADCRouting.adc7 = 0;
+    data.DSMxBind = 0;
+    data.SBusMode = 0;
+    data.WS2811LED_Out = 8;
+
+    HwSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSettingsCC_RcvrPortSet(HwSettingsCC_RcvrPortOptions *NewCC_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewCC_RcvrPort, offsetof(HwSettingsData, CC_RcvrPort), sizeof(HwSettingsCC_RcvrPortOptions));
+}
+void HwSettingsCC_RcvrPortGet(HwSettingsCC_RcvrPortOptions *NewCC_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewCC_RcvrPort, offsetof(HwSettingsData, CC_RcvrPort), sizeof(HwSettingsCC_RcvrPortOptions));
+}
+void HwSettingsCC_MainPortSet(HwSettingsCC_MainPortOptions *NewCC_MainPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewCC_MainPort, offsetof(HwSettingsData, CC_MainPort), sizeof(HwSettingsCC_MainPortOptions));
+}
+void HwSettingsCC_MainPortGet(HwSettingsCC_MainPortOptions *NewCC_MainPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewCC_MainPort, offsetof(HwSettingsData, CC_MainPort), sizeof(HwSettingsCC_MainPortOptions));
+}
+void HwSettingsCC_FlexiPortSet(HwSettingsCC_FlexiPortOptions *NewCC_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewCC_FlexiPort, offsetof(HwSettingsData, CC_FlexiPort), sizeof(HwSettingsCC_FlexiPortOptions));
+}
+void HwSettingsCC_FlexiPortGet(HwSettingsCC_FlexiPortOptions *NewCC_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewCC_FlexiPort, offsetof(HwSettingsData, CC_FlexiPort), sizeof(HwSettingsCC_FlexiPortOptions));
+}
+void HwSettingsRV_RcvrPortSet(HwSettingsRV_RcvrPortOptions *NewRV_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_RcvrPort, offsetof(HwSettingsData, RV_RcvrPort), sizeof(HwSettingsRV_RcvrPortOptions));
+}
+void HwSettingsRV_RcvrPortGet(HwSettingsRV_RcvrPortOptions *NewRV_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_RcvrPort, offsetof(HwSettingsData, RV_RcvrPort), sizeof(HwSettingsRV_RcvrPortOptions));
+}
+void HwSettingsRV_AuxPortSet(HwSettingsRV_AuxPortOptions *NewRV_AuxPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_AuxPort, offsetof(HwSettingsData, RV_AuxPort), sizeof(HwSettingsRV_AuxPortOptions));
+}
+void HwSettingsRV_AuxPortGet(HwSettingsRV_AuxPortOptions *NewRV_AuxPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_AuxPort, offsetof(HwSettingsData, RV_AuxPort), sizeof(HwSettingsRV_AuxPortOptions));
+}
+void HwSettingsRV_AuxSBusPortSet(HwSettingsRV_AuxSBusPortOptions *NewRV_AuxSBusPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_AuxSBusPort, offsetof(HwSettingsData, RV_AuxSBusPort), sizeof(HwSettingsRV_AuxSBusPortOptions));
+}
+void HwSettingsRV_AuxSBusPortGet(HwSettingsRV_AuxSBusPortOptions *NewRV_AuxSBusPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_AuxSBusPort, offsetof(HwSettingsData, RV_AuxSBusPort), sizeof(HwSettingsRV_AuxSBusPortOptions));
+}
+void HwSettingsRV_FlexiPortSet(HwSettingsRV_FlexiPortOptions *NewRV_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_FlexiPort, offsetof(HwSettingsData, RV_FlexiPort), sizeof(HwSettingsRV_FlexiPortOptions));
+}
+void HwSettingsRV_FlexiPortGet(HwSettingsRV_FlexiPortOptions *NewRV_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_FlexiPort, offsetof(HwSettingsData, RV_FlexiPort), sizeof(HwSettingsRV_FlexiPortOptions));
+}
+void HwSettingsRV_TelemetryPortSet(HwSettingsRV_TelemetryPortOptions *NewRV_TelemetryPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_TelemetryPort, offsetof(HwSettingsData, RV_TelemetryPort), sizeof(HwSettingsRV_TelemetryPortOptions));
+}
+void HwSettingsRV_TelemetryPortGet(HwSettingsRV_TelemetryPortOptions *NewRV_TelemetryPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_TelemetryPort, offsetof(HwSettingsData, RV_TelemetryPort), sizeof(HwSettingsRV_TelemetryPortOptions));
+}
+void HwSettingsRV_GPSPortSet(HwSettingsRV_GPSPortOptions *NewRV_GPSPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_GPSPort, offsetof(HwSettingsData, RV_GPSPort), sizeof(HwSettingsRV_GPSPortOptions));
+}
+void HwSettingsRV_GPSPortGet(HwSettingsRV_GPSPortOptions *NewRV_GPSPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_GPSPort, offsetof(HwSettingsData, RV_GPSPort), sizeof(HwSettingsRV_GPSPortOptions));
+}
+void HwSettingsRM_RcvrPortSet(HwSettingsRM_RcvrPortOptions *NewRM_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRM_RcvrPort, offsetof(HwSettingsData, RM_RcvrPort), sizeof(HwSettingsRM_RcvrPortOptions));
+}
+void HwSettingsRM_RcvrPortGet(HwSettingsRM_RcvrPortOptions *NewRM_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRM_RcvrPort, offsetof(HwSettingsData, RM_RcvrPort), sizeof(HwSettingsRM_RcvrPortOptions));
+}
+void HwSettingsRM_MainPortSet(HwSettingsRM_MainPortOptions *NewRM_MainPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRM_MainPort, offsetof(HwSettingsData, RM_MainPort), sizeof(HwSettingsRM_MainPortOptions));
+}
+void HwSettingsRM_MainPortGet(HwSettingsRM_MainPortOptions *NewRM_MainPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRM_MainPort, offsetof(HwSettingsData, RM_MainPort), sizeof(HwSettingsRM_MainPortOptions));
+}
+void HwSettingsRM_FlexiPortSet(HwSettingsRM_FlexiPortOptions *NewRM_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRM_FlexiPort, offsetof(HwSettingsData, RM_FlexiPort), sizeof(HwSettingsRM_FlexiPortOptions));
+}
+void HwSettingsRM_FlexiPortGet(HwSettingsRM_FlexiPortOptions *NewRM_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRM_FlexiPort, offsetof(HwSettingsData, RM_FlexiPort), sizeof(HwSettingsRM_FlexiPortOptions));
+}
+void HwSettingsSPK2_RcvrPortSet(HwSettingsSPK2_RcvrPortOptions *NewSPK2_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewSPK2_RcvrPort, offsetof(HwSettingsData, SPK2_RcvrPort), sizeof(HwSettingsSPK2_RcvrPortOptions));
+}
+void HwSettingsSPK2_RcvrPortGet(HwSettingsSPK2_RcvrPortOptions *NewSPK2_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewSPK2_RcvrPort, offsetof(HwSettingsData, SPK2_RcvrPort), sizeof(HwSettingsSPK2_RcvrPortOptions));
+}
+void HwSettingsSPK2_MainPortSet(HwSettingsSPK2_MainPortOptions *NewSPK2_MainPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewSPK2_MainPort, offsetof(HwSettingsData, SPK2_MainPort), sizeof(HwSettingsSPK2_MainPortOptions));
+}
+void HwSettingsSPK2_MainPortGet(HwSettingsSPK2_MainPortOptions *NewSPK2_MainPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewSPK2_MainPort, offsetof(HwSettingsData, SPK2_MainPort), sizeof(HwSettingsSPK2_MainPortOptions));
+}
+void HwSettingsSPK2_FlexiPortSet(HwSettingsSPK2_FlexiPortOptions *NewSPK2_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewSPK2_FlexiPort, offsetof(HwSettingsData, SPK2_FlexiPort), sizeof(HwSettingsSPK2_FlexiPortOptions));
+}
+void HwSettingsSPK2_FlexiPortGet(HwSettingsSPK2_FlexiPortOptions *NewSPK2_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewSPK2_FlexiPort, offsetof(HwSettingsData, SPK2_FlexiPort), sizeof(HwSettingsSPK2_FlexiPortOptions));
+}
+void HwSettingsSPK2_I2CPortSet(HwSettingsSPK2_I2CPortOptions *NewSPK2_I2CPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewSPK2_I2CPort, offsetof(HwSettingsData, SPK2_I2CPort), sizeof(HwSettingsSPK2_I2CPortOptions));
+}
+void HwSettingsSPK2_I2CPortGet(HwSettingsSPK2_I2CPortOptions *NewSPK2_I2CPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewSPK2_I2CPort, offsetof(HwSettingsData, SPK2_I2CPort), sizeof(HwSettingsSPK2_I2CPortOptions));
+}
+void HwSettingsTelemetrySpeedSet(HwSettingsTelemetrySpeedOptions *NewTelemetrySpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewTelemetrySpeed, offsetof(HwSettingsData, TelemetrySpeed), sizeof(HwSettingsTelemetrySpeedOptions));
+}
+void HwSettingsTelemetrySpeedGet(HwSettingsTelemetrySpeedOptions *NewTelemetrySpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewTelemetrySpeed, offsetof(HwSettingsData, TelemetrySpeed), sizeof(HwSettingsTelemetrySpeedOptions));
+}
+void HwSettingsGPSSpeedSet(HwSettingsGPSSpeedOptions *NewGPSSpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewGPSSpeed, offsetof(HwSettingsData, GPSSpeed), sizeof(HwSettingsGPSSpeedOptions));
+}
+void HwSettingsGPSSpeedGet(HwSettingsGPSSpeedOptions *NewGPSSpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewGPSSpeed, offsetof(HwSettingsData, GPSSpeed), sizeof(HwSettingsGPSSpeedOptions));
+}
+void HwSettingsDebugConsoleSpeedSet(HwSettingsDebugConsoleSpeedOptions *NewDebugConsoleSpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewDebugConsoleSpeed, offsetof(HwSettingsData, DebugConsoleSpeed), sizeof(HwSettingsDebugConsoleSpeedOptions));
+}
+void HwSettingsDebugConsoleSpeedGet(HwSettingsDebugConsoleSpeedOptions *NewDebugConsoleSpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewDebugConsoleSpeed, offsetof(HwSettingsData, DebugConsoleSpeed), sizeof(HwSettingsDebugConsoleSpeedOptions));
+}
+void HwSettingsMSPSpeedSet(HwSettingsMSPSpeedOptions *NewMSPSpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewMSPSpeed, offsetof(HwSettingsData, MSPSpeed), sizeof(HwSettingsMSPSpeedOptions));
+}
+void HwSettingsMSPSpeedGet(HwSettingsMSPSpeedOptions *NewMSPSpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewMSPSpeed, offsetof(HwSettingsData, MSPSpeed), sizeof(HwSettingsMSPSpeedOptions));
+}
+void HwSettingsMAVLinkSpeedSet(HwSettingsMAVLinkSpeedOptions *NewMAVLinkSpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewMAVLinkSpeed, offsetof(HwSettingsData, MAVLinkSpeed), sizeof(HwSettingsMAVLinkSpeedOptions));
+}
+void HwSettingsMAVLinkSpeedGet(HwSettingsMAVLinkSpeedOptions *NewMAVLinkSpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewMAVLinkSpeed, offsetof(HwSettingsData, MAVLinkSpeed), sizeof(HwSettingsMAVLinkSpeedOptions));
+}
+void HwSettingsUSB_HIDPortSet(HwSettingsUSB_HIDPortOptions *NewUSB_HIDPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewUSB_HIDPort, offsetof(HwSettingsData, USB_HIDPort), sizeof(HwSettingsUSB_HIDPortOptions));
+}
+void HwSettingsUSB_HIDPortGet(HwSettingsUSB_HIDPortOptions *NewUSB_HIDPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewUSB_HIDPort, offsetof(HwSettingsData, USB_HIDPort), sizeof(HwSettingsUSB_HIDPortOptions));
+}
+void HwSettingsUSB_VCPPortSet(HwSettingsUSB_VCPPortOptions *NewUSB_VCPPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewUSB_VCPPort, offsetof(HwSettingsData, USB_VCPPort), sizeof(HwSettingsUSB_VCPPortOptions));
+}
+void HwSettingsUSB_VCPPortGet(HwSettingsUSB_VCPPortOptions *NewUSB_VCPPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewUSB_VCPPort, offsetof(HwSettingsData, USB_VCPPort), sizeof(HwSettingsUSB_VCPPortOptions));
+}
+void HwSettingsRadioAuxStreamSet(HwSettingsRadioAuxStreamOptions *NewRadioAuxStream)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRadioAuxStream, offsetof(HwSettingsData, RadioAuxStream), sizeof(HwSettingsRadioAuxStreamOptions));
+}
+void HwSettingsRadioAuxStreamGet(HwSettingsRadioAuxStreamOptions *NewRadioAuxStream)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRadioAuxStream, offsetof(HwSettingsData, RadioAuxStream), sizeof(HwSettingsRadioAuxStreamOptions));
+}
+void HwSettingsOptionalModulesSet( HwSettingsOptionalModulesData *NewOptionalModules )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 12*sizeof(HwSettingsOptionalModulesOptions));
+}
+void HwSettingsOptionalModulesGet( HwSettingsOptionalModulesData *NewOptionalModules )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 12*sizeof(HwSettingsOptionalModulesOptions));
+}
+void HwSettingsOptionalModulesArraySet( HwSettingsOptionalModulesOptions *NewOptionalModules )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 12*sizeof(HwSettingsOptionalModulesOptions));
+}
+void HwSettingsOptionalModulesArrayGet( HwSettingsOptionalModulesOptions *NewOptionalModules )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 12*sizeof(HwSettingsOptionalModulesOptions));
+}
+void HwSettingsADCRoutingSet( HwSettingsADCRoutingData *NewADCRouting )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 8*sizeof(HwSettingsADCRoutingOptions));
+}
+void HwSettingsADCRoutingGet( HwSettingsADCRoutingData *NewADCRouting )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 8*sizeof(HwSettingsADCRoutingOptions));
+}
+void HwSettingsADCRoutingArraySet( HwSettingsADCRoutingOptions *NewADCRouting )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 8*sizeof(HwSettingsADCRoutingOptions));
+}
+void HwSettingsADCRoutingArrayGet( HwSettingsADCRoutingOptions *NewADCRouting )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 8*sizeof(HwSettingsADCRoutingOptions));
+}
+void HwSettingsDSMxBindSet(uint8_t *NewDSMxBind)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewDSMxBind, offsetof(HwSettingsData, DSMxBind), sizeof(uint8_t));
+}
+void HwSettingsDSMxBindGet(uint8_t *NewDSMxBind)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewDSMxBind, offsetof(HwSettingsData, DSMxBind), sizeof(uint8_t));
+}
+void HwSettingsSBusModeSet(HwSettingsSBusModeOptions *NewSBusMode)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewSBusMode, offsetof(HwSettingsData, SBusMode), sizeof(HwSettingsSBusModeOptions));
+}
+void HwSettingsSBusModeGet(HwSettingsSBusModeOptions *NewSBusMode)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewSBusMode, offsetof(HwSettingsData, SBusMode), sizeof(HwSettingsSBusModeOptions));
+}
+void HwSettingsWS2811LED_OutSet(HwSettingsWS2811LED_OutOptions *NewWS2811LED_Out)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewWS2811LED_Out, offsetof(HwSettingsData, WS2811LED_Out), sizeof(HwSettingsWS2811LED_OutOptions));
+}
+void HwSettingsWS2811LED_OutGet(HwSettingsWS2811LED_OutOptions *NewWS2811LED_Out)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewWS2811LED_Out, offsetof(HwSettingsData, WS2811LED_Out), sizeof(HwSettingsWS2811LED_OutOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,166 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HwSPRacingF3EVOSettings HwSPRacingF3EVOSettings
+ * @brief Seriously Pro SPRacingF3 EVO hardware configuration.
+ *
+ * Autogenerated files and functions for HwSPRacingF3EVOSettings Object
+ * @{ 
+ *
+ * @file       hwspracingf3evosettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HwSPRacingF3EVOSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwspracingf3evosettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hwspracingf3evosettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HWSPRACINGF3EVOSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(HwSPRacingF3EVOSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSPRacingF3EVOSettingsInitialize(void)
+{
+    // Compile time assertion that the HwSPRacingF3EVOSettingsDataPacked and HwSPRacingF3EVOSettingsData structs
+    // have the same size (though instances of HwSPRacingF3EVOSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HwSPRacingF3EVOSettingsDataPacked) == sizeof(HwSPRacingF3EVOSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HWSPRACINGF3EVOSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HWSPRACINGF3EVOSETTINGS_OBJID,
+       .instance_size = HWSPRACINGF3EVOSETTINGS_NUMBYTES,
+       .init_callback = &HwSPRacingF3EVOSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HWSPRACINGF3EVOSETTINGS_ISSINGLEINST, HWSPRACINGF3EVOSETTINGS_ISSETTINGS, HWSPRACINGF3EVOSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HwSPRacingF3EVOSettingsData * data) {}
+
+void HwSPRacingF3EVOSettingsDataOverrideDefaults(HwSPRacingF3EVOSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSPRacingF3EVOSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HwSPRacingF3EVOSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HwSPRacingF3EVOSettingsData));
+    data.UARTPort[0] = 0;
+    data.UARTPort[1] = 0;
+    data.UARTPort[2] = 0;
+    data.I2CPort = 0;
+    data.LEDPort = 0;
+
+    HwSPRacingF3EVOSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSPRacingF3EVOSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSPRacingF3EVOSettingsUARTPortSet( HwSPRacingF3EVOSettingsUARTPortOptions *NewUARTPort )
+{
+    UAVObjSetDataField(HwSPRacingF3EVOSettingsHandle(), (void *)NewUARTPort, offsetof(HwSPRacingF3EVOSettingsData, UARTPort), 3*sizeof(HwSPRacingF3EVOSettingsUARTPortOptions));
+}
+void HwSPRacingF3EVOSettingsUARTPortGet( HwSPRacingF3EVOSettingsUARTPortOptions *NewUARTPort )
+{
+    UAVObjGetDataField(HwSPRacingF3EVOSettingsHandle(), (void *)NewUARTPort, offsetof(HwSPRacingF3EVOSettingsData, UARTPort), 3*sizeof(HwSPRacingF3EVOSettingsUARTPortOptions));
+}
+void HwSPRacingF3EVOSettingsI2CPortSet(HwSPRacingF3EVOSettingsI2CPortOptions *NewI2CPort)
+{
+    UAVObjSetDataField(HwSPRacingF3EVOSettingsHandle(), (void *)NewI2CPort, offsetof(HwSPRacingF3EVOSettingsData, I2CPort), sizeof(HwSPRacingF3EVOSettingsI2CPortOptions));
+}
+void HwSPRacingF3EVOSettingsI2CPortGet(HwSPRacingF3EVOSettingsI2CPortOptions *NewI2CPort)
+{
+    UAVObjGetDataField(HwSPRacingF3EVOSettingsHandle(), (void *)NewI2CPort, offsetof(HwSPRacingF3EVOSettingsData, I2CPort), sizeof(HwSPRacingF3EVOSettingsI2CPortOptions));
+}
+void HwSPRacingF3EVOSettingsLEDPortSet(HwSPRacingF3EVOSettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjSetDataField(HwSPRacingF3EVOSettingsHandle(), (void *)NewLEDPort, offsetof(HwSPRacingF3EVOSettingsData, LEDPort), sizeof(HwSPRacingF3EVOSettingsLEDPortOptions));
+}
+void HwSPRacingF3EVOSettingsLEDPortGet(HwSPRacingF3EVOSettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjGetDataField(HwSPRacingF3EVOSettingsHandle(), (void *)NewLEDPort, offsetof(HwSPRacingF3EVOSettingsData, LEDPort), sizeof(HwSPRacingF3EVOSettingsLEDPortOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HwSPRacingF3Settings HwSPRacingF3Settings
+ * @brief Seriously Pro SPRacingF3 hardware configuration.
+ *
+ * Autogenerated files and functions for HwSPRacingF3Settings Object
+ * @{ 
+ *
+ * @file       hwspracingf3settings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HwSPRacingF3Settings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwspracingf3settings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hwspracingf3settings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HWSPRACINGF3SETTINGS_ISSETTINGS
+SETTINGS_INITCALL(HwSPRacingF3SettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSPRacingF3SettingsInitialize(void)
+{
+    // Compile time assertion that the HwSPRacingF3SettingsDataPacked and HwSPRacingF3SettingsData structs
+    // have the same size (though instances of HwSPRacingF3SettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HwSPRacingF3SettingsDataPacked) == sizeof(HwSPRacingF3SettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HWSPRACINGF3SETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HWSPRACINGF3SETTINGS_OBJID,
+       .instance_size = HWSPRACINGF3SETTINGS_NUMBYTES,
+       .init_callback = &HwSPRacingF3SettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HWSPRACINGF3SETTINGS_ISSINGLEINST, HWSPRACINGF3SETTINGS_ISSETTINGS, HWSPRACINGF3SETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HwSPRacingF3SettingsData * data) {}
+
+void HwSPRacingF3SettingsDataOverrideDefaults(HwSPRacingF3SettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSPRacingF3SettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HwSPRacingF3SettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HwSPRacingF3SettingsData));
+    data.UARTPort[0] = 0;
+    data.UARTPort[1] = 0;
+    data.UARTPort[2] = 0;
+    data.I2CPort = 0;
+    data.LEDPort = 0;
+    data.IOPorts = 0;
+
+    HwSPRacingF3SettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSPRacingF3SettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSPRacingF3SettingsUARTPortSet( HwSPRacingF3SettingsUARTPortOptions *NewUARTPort )
+{
+    UAVObjSetDataField(HwSPRacingF3SettingsHandle(), (void *)NewUARTPort, offsetof(HwSPRacingF3SettingsData, UARTPort), 3*sizeof(HwSPRacingF3SettingsUARTPortOptions));
+}
+void HwSPRacingF3SettingsUARTPortGet( HwSPRacingF3SettingsUARTPortOptions *NewUARTPort )
+{
+    UAVObjGetDataField(HwSPRacingF3SettingsHandle(), (void *)NewUARTPort, offsetof(HwSPRacingF3SettingsData, UARTPort), 3*sizeof(HwSPRacingF3SettingsUARTPortOptions));
+}
+void HwSPRacingF3SettingsI2CPortSet(HwSPRacingF3SettingsI2CPortOptions *NewI2CPort)
+{
+    UAVObjSetDataField(HwSPRacingF3SettingsHandle(), (void *)NewI2CPort, offsetof(HwSPRacingF3SettingsData, I2CPort), sizeof(HwSPRacingF3SettingsI2CPortOptions));
+}
+void HwSPRacingF3SettingsI2CPortGet(HwSPRacingF3SettingsI2CPortOptions *NewI2CPort)
+{
+    UAVObjGetDataField(HwSPRacingF3SettingsHandle(), (void *)NewI2CPort, offsetof(HwSPRacingF3SettingsData, I2CPort), sizeof(HwSPRacingF3SettingsI2CPortOptions));
+}
+void HwSPRacingF3SettingsLEDPortSet(HwSPRacingF3SettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjSetDataField(HwSPRacingF3SettingsHandle(), (void *)NewLEDPort, offsetof(HwSPRacingF3SettingsData, LEDPort), sizeof(HwSPRacingF3SettingsLEDPortOptions));
+}
+void HwSPRacingF3SettingsLEDPortGet(HwSPRacingF3SettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjGetDataField(HwSPRacingF3SettingsHandle(), (void *)NewLEDPort, offsetof(HwSPRacingF3SettingsData, LEDPort), sizeof(HwSPRacingF3SettingsLEDPortOptions));
+}
+void HwSPRacingF3SettingsIOPortsSet(HwSPRacingF3SettingsIOPortsOptions *NewIOPorts)
+{
+    UAVObjSetDataField(HwSPRacingF3SettingsHandle(), (void *)NewIOPorts, offsetof(HwSPRacingF3SettingsData, IOPorts), sizeof(HwSPRacingF3SettingsIOPortsOptions));
+}
+void HwSPRacingF3SettingsIOPortsGet(HwSPRacingF3SettingsIOPortsOptions *NewIOPorts)
+{
+    UAVObjGetDataField(HwSPRacingF3SettingsHandle(), (void *)NewIOPorts, offsetof(HwSPRacingF3SettingsData, IOPorts), sizeof(HwSPRacingF3SettingsIOPortsOptions));
+}
+
+
+/**
+ * @}
+ */
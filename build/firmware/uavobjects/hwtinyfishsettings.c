@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HwTinyFISHSettings HwTinyFISHSettings
+ * @brief fishpepper.de tinyFISH Flight Controller hardware configuration
+ *
+ * Autogenerated files and functions for HwTinyFISHSettings Object
+ * @{ 
+ *
+ * @file       hwtinyfishsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HwTinyFISHSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwtinyfishsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hwtinyfishsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if HWTINYFISHSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(HwTinyFISHSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwTinyFISHSettingsInitialize(void)
+{
+    // Compile time assertion that the HwTinyFISHSettingsDataPacked and HwTinyFISHSettingsData structs
+    // have the same size (though instances of HwTinyFISHSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HwTinyFISHSettingsDataPacked) == sizeof(HwTinyFISHSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HWTINYFISHSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = HWTINYFISHSETTINGS_OBJID,
+       .instance_size = HWTINYFISHSETTINGS_NUMBYTES,
+       .init_callback = &HwTinyFISHSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        HWTINYFISHSETTINGS_ISSINGLEINST, HWTINYFISHSETTINGS_ISSETTINGS, HWTINYFISHSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) HwTinyFISHSettingsData * data) {}
+
+void HwTinyFISHSettingsDataOverrideDefaults(HwTinyFISHSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwTinyFISHSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HwTinyFISHSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HwTinyFISHSettingsData));
+    data.UART1Port = 0;
+    data.UART3Port = 0;
+    data.LEDPort = 0;
+
+    HwTinyFISHSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwTinyFISHSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwTinyFISHSettingsUART1PortSet(HwTinyFISHSettingsUART1PortOptions *NewUART1Port)
+{
+    UAVObjSetDataField(HwTinyFISHSettingsHandle(), (void *)NewUART1Port, offsetof(HwTinyFISHSettingsData, UART1Port), sizeof(HwTinyFISHSettingsUART1PortOptions));
+}
+void HwTinyFISHSettingsUART1PortGet(HwTinyFISHSettingsUART1PortOptions *NewUART1Port)
+{
+    UAVObjGetDataField(HwTinyFISHSettingsHandle(), (void *)NewUART1Port, offsetof(HwTinyFISHSettingsData, UART1Port), sizeof(HwTinyFISHSettingsUART1PortOptions));
+}
+void HwTinyFISHSettingsUART3PortSet(HwTinyFISHSettingsUART3PortOptions *NewUART3Port)
+{
+    UAVObjSetDataField(HwTinyFISHSettingsHandle(), (void *)NewUART3Port, offsetof(HwTinyFISHSettingsData, UART3Port), sizeof(HwTinyFISHSettingsUART3PortOptions));
+}
+void HwTinyFISHSettingsUART3PortGet(HwTinyFISHSettingsUART3PortOptions *NewUART3Port)
+{
+    UAVObjGetDataField(HwTinyFISHSettingsHandle(), (void *)NewUART3Port, offsetof(HwTinyFISHSettingsData, UART3Port), sizeof(HwTinyFISHSettingsUART3PortOptions));
+}
+void HwTinyFISHSettingsLEDPortSet(HwTinyFISHSettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjSetDataField(HwTinyFISHSettingsHandle(), (void *)NewLEDPort, offsetof(HwTinyFISHSettingsData, LEDPort), sizeof(HwTinyFISHSettingsLEDPortOptions));
+}
+void HwTinyFISHSettingsLEDPortGet(HwTinyFISHSettingsLEDPortOptions *NewLEDPort)
+{
+    UAVObjGetDataField(HwTinyFISHSettingsHandle(), (void *)NewLEDPort, offsetof(HwTinyFISHSettingsData, LEDPort), sizeof(HwTinyFISHSettingsLEDPortOptions));
+}
+
+
+/**
+ * @}
+ */
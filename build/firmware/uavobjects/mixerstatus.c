@@ -0,0 +1,233 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup MixerStatus MixerStatus
+ * @brief Status for the matrix mixer showing the output of each mixer after all scaling
+ *
+ * Autogenerated files and functions for MixerStatus Object
+ * @{ 
+ *
+ * @file       mixerstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the MixerStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: mixerstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "mixerstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if MIXERSTATUS_ISSETTINGS
+SETTINGS_INITCALL(MixerStatusInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t MixerStatusInitialize(void)
+{
+    // Compile time assertion that the MixerStatusDataPacked and MixerStatusData structs
+    // have the same size (though instances of MixerStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(MixerStatusDataPacked) == sizeof(MixerStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(MIXERSTATUS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = MIXERSTATUS_OBJID,
+       .instance_size = MIXERSTATUS_NUMBYTES,
+       .init_callback = &MixerStatusSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        MIXERSTATUS_ISSINGLEINST, MIXERSTATUS_ISSETTINGS, MIXERSTATUS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) MixerStatusData * data) {}
+
+void MixerStatusDataOverrideDefaults(MixerStatusData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void MixerStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    MixerStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(MixerStatusData));
+
+    MixerStatusDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle MixerStatusHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void MixerStatusMixer1Set(float *NewMixer1)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer1, offsetof(MixerStatusData, Mixer1), sizeof(float));
+}
+void MixerStatusMixer1Get(float *NewMixer1)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer1, offsetof(MixerStatusData, Mixer1), sizeof(float));
+}
+void MixerStatusMixer2Set(float *NewMixer2)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer2, offsetof(MixerStatusData, Mixer2), sizeof(float));
+}
+void MixerStatusMixer2Get(float *NewMixer2)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer2, offsetof(MixerStatusData, Mixer2), sizeof(float));
+}
+void MixerStatusMixer3Set(float *NewMixer3)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer3, offsetof(MixerStatusData, Mixer3), sizeof(float));
+}
+void MixerStatusMixer3Get(float *NewMixer3)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer3, offsetof(MixerStatusData, Mixer3), sizeof(float));
+}
+void MixerStatusMixer4Set(float *NewMixer4)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer4, offsetof(MixerStatusData, Mixer4), sizeof(float));
+}
+void MixerStatusMixer4Get(float *NewMixer4)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer4, offsetof(MixerStatusData, Mixer4), sizeof(float));
+}
+void MixerStatusMixer5Set(float *NewMixer5)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer5, offsetof(MixerStatusData, Mixer5), sizeof(float));
+}
+void MixerStatusMixer5Get(float *NewMixer5)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer5, offsetof(MixerStatusData, Mixer5), sizeof(float));
+}
+void MixerStatusMixer6Set(float *NewMixer6)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer6, offsetof(MixerStatusData, Mixer6), sizeof(float));
+}
+void MixerStatusMixer6Get(float *NewMixer6)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer6, offsetof(MixerStatusData, Mixer6), sizeof(float));
+}
+void MixerStatusMixer7Set(float *NewMixer7)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer7, offsetof(MixerStatusData, Mixer7), sizeof(float));
+}
+void MixerStatusMixer7Get(float *NewMixer7)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer7, offsetof(MixerStatusData, Mixer7), sizeof(float));
+}
+void MixerStatusMixer8Set(float *NewMixer8)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer8, offsetof(MixerStatusData, Mixer8), sizeof(float));
+}
+void MixerStatusMixer8Get(float *NewMixer8)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer8, offsetof(MixerStatusData, Mixer8), sizeof(float));
+}
+void MixerStatusMixer9Set(float *NewMixer9)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer9, offsetof(MixerStatusData, Mixer9), sizeof(float));
+}
+void MixerStatusMixer9Get(float *NewMixer9)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer9, offsetof(MixerStatusData, Mixer9), sizeof(float));
+}
+void MixerStatusMixer10Set(float *NewMixer10)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer10, offsetof(MixerStatusData, Mixer10), sizeof(float));
+}
+void MixerStatusMixer10Get(float *NewMixer10)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer10, offsetof(MixerStatusData, Mixer10), sizeof(float));
+}
+void MixerStatusMixer11Set(float *NewMixer11)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer11, offsetof(MixerStatusData, Mixer11), sizeof(float));
+}
+void MixerStatusMixer11Get(float *NewMixer11)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer11, offsetof(MixerStatusData, Mixer11), sizeof(float));
+}
+void MixerStatusMixer12Set(float *NewMixer12)
+{
+    UAVObjSetDataField(MixerStatusHandle(), (void *)NewMixer12, offsetof(MixerStatusData, Mixer12), sizeof(float));
+}
+void MixerStatusMixer12Get(float *NewMixer12)
+{
+    UAVObjGetDataField(MixerStatusHandle(), (void *)NewMixer12, offsetof(MixerStatusData, Mixer12), sizeof(float));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup MPUGyroAccelSettings MPUGyroAccelSettings
+ * @brief Settings for the @ref MPU6000 and MPU9000 sensor series. Used in CC3D, Revolution and RevoBone. Reboot the board for this to takes effect
+ *
+ * Autogenerated files and functions for MPUGyroAccelSettings Object
+ * @{ 
+ *
+ * @file       mpugyroaccelsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the MPUGyroAccelSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: mpugyroaccelsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "mpugyroaccelsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if MPUGYROACCELSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(MPUGyroAccelSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t MPUGyroAccelSettingsInitialize(void)
+{
+    // Compile time assertion that the MPUGyroAccelSettingsDataPacked and MPUGyroAccelSettingsData structs
+    // have the same size (though instances of MPUGyroAccelSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(MPUGyroAccelSettingsDataPacked) == sizeof(MPUGyroAccelSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(MPUGYROACCELSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = MPUGYROACCELSETTINGS_OBJID,
+       .instance_size = MPUGYROACCELSETTINGS_NUMBYTES,
+       .init_callback = &MPUGyroAccelSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        MPUGYROACCELSETTINGS_ISSINGLEINST, MPUGYROACCELSETTINGS_ISSETTINGS, MPUGYROACCELSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) MPUGyroAccelSettingsData * data) {}
+
+void MPUGyroAccelSettingsDataOverrideDefaults(MPUGyroAccelSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void MPUGyroAccelSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    MPUGyroAccelSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(MPUGyroAccelSettingsData));
+    data.GyroScale = 3;
+    data.AccelScale = 2;
+    data.FilterSetting = 1;
+
+    MPUGyroAccelSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle MPUGyroAccelSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void MPUGyroAccelSettingsGyroScaleSet(MPUGyroAccelSettingsGyroScaleOptions *NewGyroScale)
+{
+    UAVObjSetDataField(MPUGyroAccelSettingsHandle(), (void *)NewGyroScale, offsetof(MPUGyroAccelSettingsData, GyroScale), sizeof(MPUGyroAccelSettingsGyroScaleOptions));
+}
+void MPUGyroAccelSettingsGyroScaleGet(MPUGyroAccelSettingsGyroScaleOptions *NewGyroScale)
+{
+    UAVObjGetDataField(MPUGyroAccelSettingsHandle(), (void *)NewGyroScale, offsetof(MPUGyroAccelSettingsData, GyroScale), sizeof(MPUGyroAccelSettingsGyroScaleOptions));
+}
+void MPUGyroAccelSettingsAccelScaleSet(MPUGyroAccelSettingsAccelScaleOptions *NewAccelScale)
+{
+    UAVObjSetDataField(MPUGyroAccelSettingsHandle(), (void *)NewAccelScale, offsetof(MPUGyroAccelSettingsData, AccelScale), sizeof(MPUGyroAccelSettingsAccelScaleOptions));
+}
+void MPUGyroAccelSettingsAccelScaleGet(MPUGyroAccelSettingsAccelScaleOptions *NewAccelScale)
+{
+    UAVObjGetDataField(MPUGyroAccelSettingsHandle(), (void *)NewAccelScale, offsetof(MPUGyroAccelSettingsData, AccelScale), sizeof(MPUGyroAccelSettingsAccelScaleOptions));
+}
+void MPUGyroAccelSettingsFilterSettingSet(MPUGyroAccelSettingsFilterSettingOptions *NewFilterSetting)
+{
+    UAVObjSetDataField(MPUGyroAccelSettingsHandle(), (void *)NewFilterSetting, offsetof(MPUGyroAccelSettingsData, FilterSetting), sizeof(MPUGyroAccelSettingsFilterSettingOptions));
+}
+void MPUGyroAccelSettingsFilterSettingGet(MPUGyroAccelSettingsFilterSettingOptions *NewFilterSetting)
+{
+    UAVObjGetDataField(MPUGyroAccelSettingsHandle(), (void *)NewFilterSetting, offsetof(MPUGyroAccelSettingsData, FilterSetting), sizeof(MPUGyroAccelSettingsFilterSettingOptions));
+}
+
+
+/**
+ * @}
+ */
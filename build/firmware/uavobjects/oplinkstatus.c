@@ -0,0 +1,366 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OPLinkStatus OPLinkStatus
+ * @brief OPLink device status.
+ *
+ * Autogenerated files and functions for OPLinkStatus Object
+ * @{ 
+ *
+ * @file       oplinkstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OPLinkStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: oplinkstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "oplinkstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if OPLINKSTATUS_ISSETTINGS
+SETTINGS_INITCALL(OPLinkStatusInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OPLinkStatusInitialize(void)
+{
+    // Compile time assertion that the OPLinkStatusDataPacked and OPLinkStatusData structs
+    // have the same size (though instances of OPLinkStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OPLinkStatusDataPacked) == sizeof(OPLinkStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OPLINKSTATUS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = OPLINKSTATUS_OBJID,
+       .instance_size = OPLINKSTATUS_NUMBYTES,
+       .init_callback = &OPLinkStatusSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        OPLINKSTATUS_ISSINGLEINST, OPLINKSTATUS_ISSETTINGS, OPLINKSTATUS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) OPLinkStatusData * data) {}
+
+void OPLinkStatusDataOverrideDefaults(OPLinkStatusData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OPLinkStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OPLinkStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OPLinkStatusData));
+    data.DeviceID = 0;
+    data.AFCCorrection = 0;
+    data.UAVTalkErrors = 0;
+    data.LinkQuality = 0;
+    data.TXRate = 0;
+    data.RXRate = 0;
+    data.TXSeq = 0;
+    data.RXSeq = 0;
+    data.TXPacketRate = 0;
+    data.RXPacketRate = 0;
+    data.RxGood = 0;
+    data.RxCorrected = 0;
+    data.RxErrors = 0;
+    data.RxMissed = 0;
+    data.RxFailure = 0;
+    data.TxDropped = 0;
+    data.TxFailure = 0;
+    data.Resets = 0;
+    data.Timeouts = 0;
+    data.RSSI = 0;
+    data.LinkState = 0;
+
+    OPLinkStatusDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 500;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OPLinkStatusHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OPLinkStatusDeviceIDSet(uint32_t *NewDeviceID)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewDeviceID, offsetof(OPLinkStatusData, DeviceID), sizeof(uint32_t));
+}
+void OPLinkStatusDeviceIDGet(uint32_t *NewDeviceID)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewDeviceID, offsetof(OPLinkStatusData, DeviceID), sizeof(uint32_t));
+}
+void OPLinkStatusAFCCorrectionSet(int32_t *NewAFCCorrection)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewAFCCorrection, offsetof(OPLinkStatusData, AFCCorrection), sizeof(int32_t));
+}
+void OPLinkStatusAFCCorrectionGet(int32_t *NewAFCCorrection)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewAFCCorrection, offsetof(OPLinkStatusData, AFCCorrection), sizeof(int32_t));
+}
+void OPLinkStatusBoardRevisionSet(uint16_t *NewBoardRevision)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewBoardRevision, offsetof(OPLinkStatusData, BoardRevision), sizeof(uint16_t));
+}
+void OPLinkStatusBoardRevisionGet(uint16_t *NewBoardRevision)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewBoardRevision, offsetof(OPLinkStatusData, BoardRevision), sizeof(uint16_t));
+}
+void OPLinkStatusHeapRemainingSet(uint16_t *NewHeapRemaining)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewHeapRemaining, offsetof(OPLinkStatusData, HeapRemaining), sizeof(uint16_t));
+}
+void OPLinkStatusHeapRemainingGet(uint16_t *NewHeapRemaining)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewHeapRemaining, offsetof(OPLinkStatusData, HeapRemaining), sizeof(uint16_t));
+}
+void OPLinkStatusUAVTalkErrorsSet(uint16_t *NewUAVTalkErrors)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewUAVTalkErrors, offsetof(OPLinkStatusData, UAVTalkErrors), sizeof(uint16_t));
+}
+void OPLinkStatusUAVTalkErrorsGet(uint16_t *NewUAVTalkErrors)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewUAVTalkErrors, offsetof(OPLinkStatusData, UAVTalkErrors), sizeof(uint16_t));
+}
+void OPLinkStatusLinkQualitySet(uint16_t *NewLinkQuality)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewLinkQuality, offsetof(OPLinkStatusData, LinkQuality), sizeof(uint16_t));
+}
+void OPLinkStatusLinkQualityGet(uint16_t *NewLinkQuality)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewLinkQuality, offsetof(OPLinkStatusData, LinkQuality), sizeof(uint16_t));
+}
+void OPLinkStatusTXRateSet(uint16_t *NewTXRate)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewTXRate, offsetof(OPLinkStatusData, TXRate), sizeof(uint16_t));
+}
+void OPLinkStatusTXRateGet(uint16_t *NewTXRate)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewTXRate, offsetof(OPLinkStatusData, TXRate), sizeof(uint16_t));
+}
+void OPLinkStatusRXRateSet(uint16_t *NewRXRate)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRXRate, offsetof(OPLinkStatusData, RXRate), sizeof(uint16_t));
+}
+void OPLinkStatusRXRateGet(uint16_t *NewRXRate)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRXRate, offsetof(OPLinkStatusData, RXRate), sizeof(uint16_t));
+}
+void OPLinkStatusTXSeqSet(uint16_t *NewTXSeq)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewTXSeq, offsetof(OPLinkStatusData, TXSeq), sizeof(uint16_t));
+}
+void OPLinkStatusTXSeqGet(uint16_t *NewTXSeq)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewTXSeq, offsetof(OPLinkStatusData, TXSeq), sizeof(uint16_t));
+}
+void OPLinkStatusRXSeqSet(uint16_t *NewRXSeq)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRXSeq, offsetof(OPLinkStatusData, RXSeq), sizeof(uint16_t));
+}
+void OPLinkStatusRXSeqGet(uint16_t *NewRXSeq)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRXSeq, offsetof(OPLinkStatusData, RXSeq), sizeof(uint16_t));
+}
+void OPLinkStatusTXPacketRateSet(uint16_t *NewTXPacketRate)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewTXPacketRate, offsetof(OPLinkStatusData, TXPacketRate), sizeof(uint16_t));
+}
+void OPLinkStatusTXPacketRateGet(uint16_t *NewTXPacketRate)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewTXPacketRate, offsetof(OPLinkStatusData, TXPacketRate), sizeof(uint16_t));
+}
+void OPLinkStatusRXPacketRateSet(uint16_t *NewRXPacketRate)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRXPacketRate, offsetof(OPLinkStatusData, RXPacketRate), sizeof(uint16_t));
+}
+void OPLinkStatusRXPacketRateGet(uint16_t *NewRXPacketRate)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRXPacketRate, offsetof(OPLinkStatusData, RXPacketRate), sizeof(uint16_t));
+}
+void OPLinkStatusDescriptionSet( uint8_t *NewDescription )
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewDescription, offsetof(OPLinkStatusData, Description), 40*sizeof(uint8_t));
+}
+void OPLinkStatusDescriptionGet( uint8_t *NewDescription )
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewDescription, offsetof(OPLinkStatusData, Description), 40*sizeof(uint8_t));
+}
+void OPLinkStatusCPUSerialSet( uint8_t *NewCPUSerial )
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewCPUSerial, offsetof(OPLinkStatusData, CPUSerial), 12*sizeof(uint8_t));
+}
+void OPLinkStatusCPUSerialGet( uint8_t *NewCPUSerial )
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewCPUSerial, offsetof(OPLinkStatusData, CPUSerial), 12*sizeof(uint8_t));
+}
+void OPLinkStatusBoardTypeSet(uint8_t *NewBoardType)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewBoardType, offsetof(OPLinkStatusData, BoardType), sizeof(uint8_t));
+}
+void OPLinkStatusBoardTypeGet(uint8_t *NewBoardType)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewBoardType, offsetof(OPLinkStatusData, BoardType), sizeof(uint8_t));
+}
+void OPLinkStatusRxGoodSet(uint8_t *NewRxGood)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRxGood, offsetof(OPLinkStatusData, RxGood), sizeof(uint8_t));
+}
+void OPLinkStatusRxGoodGet(uint8_t *NewRxGood)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRxGood, offsetof(OPLinkStatusData, RxGood), sizeof(uint8_t));
+}
+void OPLinkStatusRxCorrectedSet(uint8_t *NewRxCorrected)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRxCorrected, offsetof(OPLinkStatusData, RxCorrected), sizeof(uint8_t));
+}
+void OPLinkStatusRxCorrectedGet(uint8_t *NewRxCorrected)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRxCorrected, offsetof(OPLinkStatusData, RxCorrected), sizeof(uint8_t));
+}
+void OPLinkStatusRxErrorsSet(uint8_t *NewRxErrors)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRxErrors, offsetof(OPLinkStatusData, RxErrors), sizeof(uint8_t));
+}
+void OPLinkStatusRxErrorsGet(uint8_t *NewRxErrors)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRxErrors, offsetof(OPLinkStatusData, RxErrors), sizeof(uint8_t));
+}
+void OPLinkStatusRxMissedSet(uint8_t *NewRxMissed)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRxMissed, offsetof(OPLinkStatusData, RxMissed), sizeof(uint8_t));
+}
+void OPLinkStatusRxMissedGet(uint8_t *NewRxMissed)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRxMissed, offsetof(OPLinkStatusData, RxMissed), sizeof(uint8_t));
+}
+void OPLinkStatusRxFailureSet(uint8_t *NewRxFailure)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRxFailure, offsetof(OPLinkStatusData, RxFailure), sizeof(uint8_t));
+}
+void OPLinkStatusRxFailureGet(uint8_t *NewRxFailure)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRxFailure, offsetof(OPLinkStatusData, RxFailure), sizeof(uint8_t));
+}
+void OPLinkStatusTxDroppedSet(uint8_t *NewTxDropped)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewTxDropped, offsetof(OPLinkStatusData, TxDropped), sizeof(uint8_t));
+}
+void OPLinkStatusTxDroppedGet(uint8_t *NewTxDropped)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewTxDropped, offsetof(OPLinkStatusData, TxDropped), sizeof(uint8_t));
+}
+void OPLinkStatusTxFailureSet(uint8_t *NewTxFailure)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewTxFailure, offsetof(OPLinkStatusData, TxFailure), sizeof(uint8_t));
+}
+void OPLinkStatusTxFailureGet(uint8_t *NewTxFailure)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewTxFailure, offsetof(OPLinkStatusData, TxFailure), sizeof(uint8_t));
+}
+void OPLinkStatusResetsSet(uint8_t *NewResets)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewResets, offsetof(OPLinkStatusData, Resets), sizeof(uint8_t));
+}
+void OPLinkStatusResetsGet(uint8_t *NewResets)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewResets, offsetof(OPLinkStatusData, Resets), sizeof(uint8_t));
+}
+void OPLinkStatusTimeoutsSet(uint8_t *NewTimeouts)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewTimeouts, offsetof(OPLinkStatusData, Timeouts), sizeof(uint8_t));
+}
+void OPLinkStatusTimeoutsGet(uint8_t *NewTimeouts)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewTimeouts, offsetof(OPLinkStatusData, Timeouts), sizeof(uint8_t));
+}
+void OPLinkStatusRSSISet(int8_t *NewRSSI)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewRSSI, offsetof(OPLinkStatusData, RSSI), sizeof(int8_t));
+}
+void OPLinkStatusRSSIGet(int8_t *NewRSSI)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewRSSI, offsetof(OPLinkStatusData, RSSI), sizeof(int8_t));
+}
+void OPLinkStatusLinkStateSet(OPLinkStatusLinkStateOptions *NewLinkState)
+{
+    UAVObjSetDataField(OPLinkStatusHandle(), (void *)NewLinkState, offsetof(OPLinkStatusData, LinkState), sizeof(OPLinkStatusLinkStateOptions));
+}
+void OPLinkStatusLinkStateGet(OPLinkStatusLinkStateOptions *NewLinkState)
+{
+    UAVObjGetDataField(OPLinkStatusHandle(), (void *)NewLinkState, offsetof(OPLinkStatusData, LinkState), sizeof(OPLinkStatusLinkStateOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OveroSyncStats OveroSyncStats
+ * @brief Maintains statistics on transfer rate to and from over
+ *
+ * Autogenerated files and functions for OveroSyncStats Object
+ * @{ 
+ *
+ * @file       overosyncstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OveroSyncStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: overosyncstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "overosyncstats.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if OVEROSYNCSTATS_ISSETTINGS
+SETTINGS_INITCALL(OveroSyncStatsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OveroSyncStatsInitialize(void)
+{
+    // Compile time assertion that the OveroSyncStatsDataPacked and OveroSyncStatsData structs
+    // have the same size (though instances of OveroSyncStatsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OveroSyncStatsDataPacked) == sizeof(OveroSyncStatsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OVEROSYNCSTATS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = OVEROSYNCSTATS_OBJID,
+       .instance_size = OVEROSYNCSTATS_NUMBYTES,
+       .init_callback = &OveroSyncStatsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        OVEROSYNCSTATS_ISSINGLEINST, OVEROSYNCSTATS_ISSETTINGS, OVEROSYNCSTATS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) OveroSyncStatsData * data) {}
+
+void OveroSyncStatsDataOverrideDefaults(OveroSyncStatsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OveroSyncStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OveroSyncStatsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OveroSyncStatsData));
+
+    OveroSyncStatsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OveroSyncStatsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OveroSyncStatsSendSet(uint32_t *NewSend)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewSend, offsetof(OveroSyncStatsData, Send), sizeof(uint32_t));
+}
+void OveroSyncStatsSendGet(uint32_t *NewSend)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewSend, offsetof(OveroSyncStatsData, Send), sizeof(uint32_t));
+}
+void OveroSyncStatsReceivedSet(uint32_t *NewReceived)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewReceived, offsetof(OveroSyncStatsData, Received), sizeof(uint32_t));
+}
+void OveroSyncStatsReceivedGet(uint32_t *NewReceived)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewReceived, offsetof(OveroSyncStatsData, Received), sizeof(uint32_t));
+}
+void OveroSyncStatsFramesyncErrorsSet(uint32_t *NewFramesyncErrors)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewFramesyncErrors, offsetof(OveroSyncStatsData, FramesyncErrors), sizeof(uint32_t));
+}
+void OveroSyncStatsFramesyncErrorsGet(uint32_t *NewFramesyncErrors)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewFramesyncErrors, offsetof(OveroSyncStatsData, FramesyncErrors), sizeof(uint32_t));
+}
+void OveroSyncStatsUnderrunErrorsSet(uint32_t *NewUnderrunErrors)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewUnderrunErrors, offsetof(OveroSyncStatsData, UnderrunErrors), sizeof(uint32_t));
+}
+void OveroSyncStatsUnderrunErrorsGet(uint32_t *NewUnderrunErrors)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewUnderrunErrors, offsetof(OveroSyncStatsData, UnderrunErrors), sizeof(uint32_t));
+}
+void OveroSyncStatsDroppedUpdatesSet(uint32_t *NewDroppedUpdates)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewDroppedUpdates, offsetof(OveroSyncStatsData, DroppedUpdates), sizeof(uint32_t));
+}
+void OveroSyncStatsDroppedUpdatesGet(uint32_t *NewDroppedUpdates)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewDroppedUpdates, offsetof(OveroSyncStatsData, DroppedUpdates), sizeof(uint32_t));
+}
+void OveroSyncStatsPacketsSet(uint32_t *NewPackets)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewPackets, offsetof(OveroSyncStatsData, Packets), sizeof(uint32_t));
+}
+void OveroSyncStatsPacketsGet(uint32_t *NewPackets)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewPackets, offsetof(OveroSyncStatsData, Packets), sizeof(uint32_t));
+}
+void OveroSyncStatsConnectedSet(OveroSyncStatsConnectedOptions *NewConnected)
+{
+    UAVObjSetDataField(OveroSyncStatsHandle(), (void *)NewConnected, offsetof(OveroSyncStatsData, Connected), sizeof(OveroSyncStatsConnectedOptions));
+}
+void OveroSyncStatsConnectedGet(OveroSyncStatsConnectedOptions *NewConnected)
+{
+    UAVObjGetDataField(OveroSyncStatsHandle(), (void *)NewConnected, offsetof(OveroSyncStatsData, Connected), sizeof(OveroSyncStatsConnectedOptions));
+}
+
+
+/**
+ * @}
+ */
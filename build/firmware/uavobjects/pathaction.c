@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PathAction PathAction
+ * @brief A waypoint command the pathplanner is to use at a certain waypoint
+ *
+ * Autogenerated files and functions for PathAction Object
+ * @{ 
+ *
+ * @file       pathaction.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PathAction object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pathaction.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "pathaction.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if PATHACTION_ISSETTINGS
+SETTINGS_INITCALL(PathActionInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PathActionInitialize(void)
+{
+    // Compile time assertion that the PathActionDataPacked and PathActionData structs
+    // have the same size (though instances of PathActionData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PathActionDataPacked) == sizeof(PathActionData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PATHACTION_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = PATHACTION_OBJID,
+       .instance_size = PATHACTION_NUMBYTES,
+       .init_callback = &PathActionSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        PATHACTION_ISSINGLEINST, PATHACTION_ISSETTINGS, PATHACTION_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) PathActionData * data) {}
+
+void PathActionDataOverrideDefaults(PathActionData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PathActionSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PathActionData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PathActionData));
+
+    PathActionDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PathActionHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void PathActionModeParametersSet( float *NewModeParameters )
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewModeParameters, offsetof(PathActionData, ModeParameters), 4*sizeof(float));
+}
+void PathActionModeParametersGet( float *NewModeParameters )
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewModeParameters, offsetof(PathActionData, ModeParameters), 4*sizeof(float));
+}
+void PathActionConditionParametersSet( float *NewConditionParameters )
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewConditionParameters, offsetof(PathActionData, ConditionParameters), 4*sizeof(float));
+}
+void PathActionConditionParametersGet( float *NewConditionParameters )
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewConditionParameters, offsetof(PathActionData, ConditionParameters), 4*sizeof(float));
+}
+void PathActionJumpDestinationSet(int16_t *NewJumpDestination)
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewJumpDestination, offsetof(PathActionData, JumpDestination), sizeof(int16_t));
+}
+void PathActionJumpDestinationGet(int16_t *NewJumpDestination)
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewJumpDestination, offsetof(PathActionData, JumpDestination), sizeof(int16_t));
+}
+void PathActionErrorDestinationSet(int16_t *NewErrorDestination)
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewErrorDestination, offsetof(PathActionData, ErrorDestination), sizeof(int16_t));
+}
+void PathActionErrorDestinationGet(int16_t *NewErrorDestination)
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewErrorDestination, offsetof(PathActionData, ErrorDestination), sizeof(int16_t));
+}
+void PathActionModeSet(PathActionModeOptions *NewMode)
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewMode, offsetof(PathActionData, Mode), sizeof(PathActionModeOptions));
+}
+void PathActionModeGet(PathActionModeOptions *NewMode)
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewMode, offsetof(PathActionData, Mode), sizeof(PathActionModeOptions));
+}
+void PathActionEndConditionSet(PathActionEndConditionOptions *NewEndCondition)
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewEndCondition, offsetof(PathActionData, EndCondition), sizeof(PathActionEndConditionOptions));
+}
+void PathActionEndConditionGet(PathActionEndConditionOptions *NewEndCondition)
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewEndCondition, offsetof(PathActionData, EndCondition), sizeof(PathActionEndConditionOptions));
+}
+void PathActionCommandSet(PathActionCommandOptions *NewCommand)
+{
+    UAVObjSetDataField(PathActionHandle(), (void *)NewCommand, offsetof(PathActionData, Command), sizeof(PathActionCommandOptions));
+}
+void PathActionCommandGet(PathActionCommandOptions *NewCommand)
+{
+    UAVObjGetDataField(PathActionHandle(), (void *)NewCommand, offsetof(PathActionData, Command), sizeof(PathActionCommandOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PathSummary PathSummary
+ * @brief Summary of a completed path segment  Can come from any @ref PathFollower module
+ *
+ * Autogenerated files and functions for PathSummary Object
+ * @{ 
+ *
+ * @file       pathsummary.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PathSummary object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pathsummary.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "pathsummary.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if PATHSUMMARY_ISSETTINGS
+SETTINGS_INITCALL(PathSummaryInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PathSummaryInitialize(void)
+{
+    // Compile time assertion that the PathSummaryDataPacked and PathSummaryData structs
+    // have the same size (though instances of PathSummaryData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PathSummaryDataPacked) == sizeof(PathSummaryData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PATHSUMMARY_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = PATHSUMMARY_OBJID,
+       .instance_size = PATHSUMMARY_NUMBYTES,
+       .init_callback = &PathSummarySetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        PATHSUMMARY_ISSINGLEINST, PATHSUMMARY_ISSETTINGS, PATHSUMMARY_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) PathSummaryData * data) {}
+
+void PathSummaryDataOverrideDefaults(PathSummaryData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PathSummarySetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PathSummaryData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PathSummaryData));
+
+    PathSummaryDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PathSummaryHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void PathSummarybrake_distance_offsetSet(float *Newbrake_distance_offset)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)Newbrake_distance_offset, offsetof(PathSummaryData, brake_distance_offset), sizeof(float));
+}
+void PathSummarybrake_distance_offsetGet(float *Newbrake_distance_offset)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)Newbrake_distance_offset, offsetof(PathSummaryData, brake_distance_offset), sizeof(float));
+}
+void PathSummarytime_remainingSet(float *Newtime_remaining)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)Newtime_remaining, offsetof(PathSummaryData, time_remaining), sizeof(float));
+}
+void PathSummarytime_remainingGet(float *Newtime_remaining)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)Newtime_remaining, offsetof(PathSummaryData, time_remaining), sizeof(float));
+}
+void PathSummaryfractional_progressSet(float *Newfractional_progress)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)Newfractional_progress, offsetof(PathSummaryData, fractional_progress), sizeof(float));
+}
+void PathSummaryfractional_progressGet(float *Newfractional_progress)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)Newfractional_progress, offsetof(PathSummaryData, fractional_progress), sizeof(float));
+}
+void PathSummarydecelrateSet(float *Newdecelrate)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)Newdecelrate, offsetof(PathSummaryData, decelrate), sizeof(float));
+}
+void PathSummarydecelrateGet(float *Newdecelrate)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)Newdecelrate, offsetof(PathSummaryData, decelrate), sizeof(float));
+}
+void PathSummarybrakeRateActualDesiredRatioSet(float *NewbrakeRateActualDesiredRatio)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)NewbrakeRateActualDesiredRatio, offsetof(PathSummaryData, brakeRateActualDesiredRatio), sizeof(float));
+}
+void PathSummarybrakeRateActualDesiredRatioGet(float *NewbrakeRateActualDesiredRatio)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)NewbrakeRateActualDesiredRatio, offsetof(PathSummaryData, brakeRateActualDesiredRatio), sizeof(float));
+}
+void PathSummaryvelocityIntoHoldSet(float *NewvelocityIntoHold)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)NewvelocityIntoHold, offsetof(PathSummaryData, velocityIntoHold), sizeof(float));
+}
+void PathSummaryvelocityIntoHoldGet(float *NewvelocityIntoHold)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)NewvelocityIntoHold, offsetof(PathSummaryData, velocityIntoHold), sizeof(float));
+}
+void PathSummaryUIDSet(int16_t *NewUID)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)NewUID, offsetof(PathSummaryData, UID), sizeof(int16_t));
+}
+void PathSummaryUIDGet(int16_t *NewUID)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)NewUID, offsetof(PathSummaryData, UID), sizeof(int16_t));
+}
+void PathSummarybrake_exit_reasonSet(PathSummarybrake_exit_reasonOptions *Newbrake_exit_reason)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)Newbrake_exit_reason, offsetof(PathSummaryData, brake_exit_reason), sizeof(PathSummarybrake_exit_reasonOptions));
+}
+void PathSummarybrake_exit_reasonGet(PathSummarybrake_exit_reasonOptions *Newbrake_exit_reason)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)Newbrake_exit_reason, offsetof(PathSummaryData, brake_exit_reason), sizeof(PathSummarybrake_exit_reasonOptions));
+}
+void PathSummaryModeSet(PathSummaryModeOptions *NewMode)
+{
+    UAVObjSetDataField(PathSummaryHandle(), (void *)NewMode, offsetof(PathSummaryData, Mode), sizeof(PathSummaryModeOptions));
+}
+void PathSummaryModeGet(PathSummaryModeOptions *NewMode)
+{
+    UAVObjGetDataField(PathSummaryHandle(), (void *)NewMode, offsetof(PathSummaryData, Mode), sizeof(PathSummaryModeOptions));
+}
+
+
+/**
+ * @}
+ */
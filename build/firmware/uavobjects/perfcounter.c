@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PerfCounter PerfCounter
+ * @brief A single performance counter, used to instrument flight code
+ *
+ * Autogenerated files and functions for PerfCounter Object
+ * @{ 
+ *
+ * @file       perfcounter.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PerfCounter object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: perfcounter.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "perfcounter.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if PERFCOUNTER_ISSETTINGS
+SETTINGS_INITCALL(PerfCounterInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PerfCounterInitialize(void)
+{
+    // Compile time assertion that the PerfCounterDataPacked and PerfCounterData structs
+    // have the same size (though instances of PerfCounterData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PerfCounterDataPacked) == sizeof(PerfCounterData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PERFCOUNTER_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = PERFCOUNTER_OBJID,
+       .instance_size = PERFCOUNTER_NUMBYTES,
+       .init_callback = &PerfCounterSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        PERFCOUNTER_ISSINGLEINST, PERFCOUNTER_ISSETTINGS, PERFCOUNTER_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) PerfCounterData * data) {}
+
+void PerfCounterDataOverrideDefaults(PerfCounterData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PerfCounterSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PerfCounterData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PerfCounterData));
+
+    PerfCounterDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PerfCounterHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void PerfCounterIdSet(uint32_t *NewId)
+{
+    UAVObjSetDataField(PerfCounterHandle(), (void *)NewId, offsetof(PerfCounterData, Id), sizeof(uint32_t));
+}
+void PerfCounterIdGet(uint32_t *NewId)
+{
+    UAVObjGetDataField(PerfCounterHandle(), (void *)NewId, offsetof(PerfCounterData, Id), sizeof(uint32_t));
+}
+void PerfCounterCounterSet( PerfCounterCounterData *NewCounter )
+{
+    UAVObjSetDataField(PerfCounterHandle(), (void *)NewCounter, offsetof(PerfCounterData, Counter), 3*sizeof(int32_t));
+}
+void PerfCounterCounterGet( PerfCounterCounterData *NewCounter )
+{
+    UAVObjGetDataField(PerfCounterHandle(), (void *)NewCounter, offsetof(PerfCounterData, Counter), 3*sizeof(int32_t));
+}
+void PerfCounterCounterArraySet( int32_t *NewCounter )
+{
+    UAVObjSetDataField(PerfCounterHandle(), (void *)NewCounter, offsetof(PerfCounterData, Counter), 3*sizeof(int32_t));
+}
+void PerfCounterCounterArrayGet( int32_t *NewCounter )
+{
+    UAVObjGetDataField(PerfCounterHandle(), (void *)NewCounter, offsetof(PerfCounterData, Counter), 3*sizeof(int32_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,336 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup SystemIdentSettings SystemIdentSettings
+ * @brief The input to and results of the PID tuning.
+ *
+ * Autogenerated files and functions for SystemIdentSettings Object
+ * @{ 
+ *
+ * @file       systemidentsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the SystemIdentSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemidentsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "systemidentsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if SYSTEMIDENTSETTINGS_ISSETTINGS
+SETTINGS_INITCALL(SystemIdentSettingsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemIdentSettingsInitialize(void)
+{
+    // Compile time assertion that the SystemIdentSettingsDataPacked and SystemIdentSettingsData structs
+    // have the same size (though instances of SystemIdentSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(SystemIdentSettingsDataPacked) == sizeof(SystemIdentSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(SYSTEMIDENTSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = SYSTEMIDENTSETTINGS_OBJID,
+       .instance_size = SYSTEMIDENTSETTINGS_NUMBYTES,
+       .init_callback = &SystemIdentSettingsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        SYSTEMIDENTSETTINGS_ISSINGLEINST, SYSTEMIDENTSETTINGS_ISSETTINGS, SYSTEMIDENTSETTINGS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) SystemIdentSettingsData * data) {}
+
+void SystemIdentSettingsDataOverrideDefaults(SystemIdentSettingsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemIdentSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    SystemIdentSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(SystemIdentSettingsData));
+    data.Tau = -4.000000e+00f;
+    data.Beta.Roll = 1.000000e+01f;
+    data.Beta.Pitch = 1.000000e+01f;
+    data.Beta.Yaw = 7.000000e+00f;
+    data.YawToRollPitchPIDRatioMin = 1.000000e+00f;
+    data.YawToRollPitchPIDRatioMax = 2.500000e+00f;
+    data.DerivativeFactor = 1.000000e+00f;
+    data.OuterLoopKpSoftClamp = 6.500000e+00f;
+    data.SmoothQuickValue = 0.000000e+00f;
+    data.GyroReadTimeAverage = 1.000000e-03f;
+    data.DampMin = 90;
+    data.DampRate = 110;
+    data.DampMax = 150;
+    data.NoiseMin = 6;
+    data.NoiseRate = 10;
+    data.NoiseMax = 16;
+    data.CalculateYaw = 1;
+    data.DestinationPidBank = 2;
+    data.TuningDuration = 60;
+    data.ThrustControl = 0;
+    data.SmoothQuickSource = 6;
+    data.DisableSanityChecks = 0;
+    data.Complete = 0;
+
+    SystemIdentSettingsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemIdentSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SystemIdentSettingsTauSet(float *NewTau)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewTau, offsetof(SystemIdentSettingsData, Tau), sizeof(float));
+}
+void SystemIdentSettingsTauGet(float *NewTau)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewTau, offsetof(SystemIdentSettingsData, Tau), sizeof(float));
+}
+void SystemIdentSettingsBetaSet( SystemIdentSettingsBetaData *NewBeta )
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewBeta, offsetof(SystemIdentSettingsData, Beta), 3*sizeof(float));
+}
+void SystemIdentSettingsBetaGet( SystemIdentSettingsBetaData *NewBeta )
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewBeta, offsetof(SystemIdentSettingsData, Beta), 3*sizeof(float));
+}
+void SystemIdentSettingsBetaArraySet( float *NewBeta )
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewBeta, offsetof(SystemIdentSettingsData, Beta), 3*sizeof(float));
+}
+void SystemIdentSettingsBetaArrayGet( float *NewBeta )
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewBeta, offsetof(SystemIdentSettingsData, Beta), 3*sizeof(float));
+}
+void SystemIdentSettingsYawToRollPitchPIDRatioMinSet(float *NewYawToRollPitchPIDRatioMin)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewYawToRollPitchPIDRatioMin, offsetof(SystemIdentSettingsData, YawToRollPitchPIDRatioMin), sizeof(float));
+}
+void SystemIdentSettingsYawToRollPitchPIDRatioMinGet(float *NewYawToRollPitchPIDRatioMin)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewYawToRollPitchPIDRatioMin, offsetof(SystemIdentSettingsData, YawToRollPitchPIDRatioMin), sizeof(float));
+}
+void SystemIdentSettingsYawToRollPitchPIDRatioMaxSet(float *NewYawToRollPitchPIDRatioMax)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewYawToRollPitchPIDRatioMax, offsetof(SystemIdentSettingsData, YawToRollPitchPIDRatioMax), sizeof(float));
+}
+void SystemIdentSettingsYawToRollPitchPIDRatioMaxGet(float *NewYawToRollPitchPIDRatioMax)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewYawToRollPitchPIDRatioMax, offsetof(SystemIdentSettingsData, YawToRollPitchPIDRatioMax), sizeof(float));
+}
+void SystemIdentSettingsDerivativeFactorSet(float *NewDerivativeFactor)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewDerivativeFactor, offsetof(SystemIdentSettingsData, DerivativeFactor), sizeof(float));
+}
+void SystemIdentSettingsDerivativeFactorGet(float *NewDerivativeFactor)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewDerivativeFactor, offsetof(SystemIdentSettingsData, DerivativeFactor), sizeof(float));
+}
+void SystemIdentSettingsOuterLoopKpSoftClampSet(float *NewOuterLoopKpSoftClamp)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewOuterLoopKpSoftClamp, offsetof(SystemIdentSettingsData, OuterLoopKpSoftClamp), sizeof(float));
+}
+void SystemIdentSettingsOuterLoopKpSoftClampGet(float *NewOuterLoopKpSoftClamp)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewOuterLoopKpSoftClamp, offsetof(SystemIdentSettingsData, OuterLoopKpSoftClamp), sizeof(float));
+}
+void SystemIdentSettingsSmoothQuickValueSet(float *NewSmoothQuickValue)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewSmoothQuickValue, offsetof(SystemIdentSettingsData, SmoothQuickValue), sizeof(float));
+}
+void SystemIdentSettingsSmoothQuickValueGet(float *NewSmoothQuickValue)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewSmoothQuickValue, offsetof(SystemIdentSettingsData, SmoothQuickValue), sizeof(float));
+}
+void SystemIdentSettingsGyroReadTimeAverageSet(float *NewGyroReadTimeAverage)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewGyroReadTimeAverage, offsetof(SystemIdentSettingsData, GyroReadTimeAverage), sizeof(float));
+}
+void SystemIdentSettingsGyroReadTimeAverageGet(float *NewGyroReadTimeAverage)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewGyroReadTimeAverage, offsetof(SystemIdentSettingsData, GyroReadTimeAverage), sizeof(float));
+}
+void SystemIdentSettingsDampMinSet(uint8_t *NewDampMin)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewDampMin, offsetof(SystemIdentSettingsData, DampMin), sizeof(uint8_t));
+}
+void SystemIdentSettingsDampMinGet(uint8_t *NewDampMin)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewDampMin, offsetof(SystemIdentSettingsData, DampMin), sizeof(uint8_t));
+}
+void SystemIdentSettingsDampRateSet(uint8_t *NewDampRate)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewDampRate, offsetof(SystemIdentSettingsData, DampRate), sizeof(uint8_t));
+}
+void SystemIdentSettingsDampRateGet(uint8_t *NewDampRate)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewDampRate, offsetof(SystemIdentSettingsData, DampRate), sizeof(uint8_t));
+}
+void SystemIdentSettingsDampMaxSet(uint8_t *NewDampMax)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewDampMax, offsetof(SystemIdentSettingsData, DampMax), sizeof(uint8_t));
+}
+void SystemIdentSettingsDampMaxGet(uint8_t *NewDampMax)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewDampMax, offsetof(SystemIdentSettingsData, DampMax), sizeof(uint8_t));
+}
+void SystemIdentSettingsNoiseMinSet(uint8_t *NewNoiseMin)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewNoiseMin, offsetof(SystemIdentSettingsData, NoiseMin), sizeof(uint8_t));
+}
+void SystemIdentSettingsNoiseMinGet(uint8_t *NewNoiseMin)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewNoiseMin, offsetof(SystemIdentSettingsData, NoiseMin), sizeof(uint8_t));
+}
+void SystemIdentSettingsNoiseRateSet(uint8_t *NewNoiseRate)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewNoiseRate, offsetof(SystemIdentSettingsData, NoiseRate), sizeof(uint8_t));
+}
+void SystemIdentSettingsNoiseRateGet(uint8_t *NewNoiseRate)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewNoiseRate, offsetof(SystemIdentSettingsData, NoiseRate), sizeof(uint8_t));
+}
+void SystemIdentSettingsNoiseMaxSet(uint8_t *NewNoiseMax)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewNoiseMax, offsetof(SystemIdentSettingsData, NoiseMax), sizeof(uint8_t));
+}
+void SystemIdentSettingsNoiseMaxGet(uint8_t *NewNoiseMax)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewNoiseMax, offsetof(SystemIdentSettingsData, NoiseMax), sizeof(uint8_t));
+}
+void SystemIdentSettingsCalculateYawSet(SystemIdentSettingsCalculateYawOptions *NewCalculateYaw)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewCalculateYaw, offsetof(SystemIdentSettingsData, CalculateYaw), sizeof(SystemIdentSettingsCalculateYawOptions));
+}
+void SystemIdentSettingsCalculateYawGet(SystemIdentSettingsCalculateYawOptions *NewCalculateYaw)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewCalculateYaw, offsetof(SystemIdentSettingsData, CalculateYaw), sizeof(SystemIdentSettingsCalculateYawOptions));
+}
+void SystemIdentSettingsDestinationPidBankSet(SystemIdentSettingsDestinationPidBankOptions *NewDestinationPidBank)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewDestinationPidBank, offsetof(SystemIdentSettingsData, DestinationPidBank), sizeof(SystemIdentSettingsDestinationPidBankOptions));
+}
+void SystemIdentSettingsDestinationPidBankGet(SystemIdentSettingsDestinationPidBankOptions *NewDestinationPidBank)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewDestinationPidBank, offsetof(SystemIdentSettingsData, DestinationPidBank), sizeof(SystemIdentSettingsDestinationPidBankOptions));
+}
+void SystemIdentSettingsTuningDurationSet(uint8_t *NewTuningDuration)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewTuningDuration, offsetof(SystemIdentSettingsData, TuningDuration), sizeof(uint8_t));
+}
+void SystemIdentSettingsTuningDurationGet(uint8_t *NewTuningDuration)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewTuningDuration, offsetof(SystemIdentSettingsData, TuningDuration), sizeof(uint8_t));
+}
+void SystemIdentSettingsThrustControlSet(SystemIdentSettingsThrustControlOptions *NewThrustControl)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewThrustControl, offsetof(SystemIdentSettingsData, ThrustControl), sizeof(SystemIdentSettingsThrustControlOptions));
+}
+void SystemIdentSettingsThrustControlGet(SystemIdentSettingsThrustControlOptions *NewThrustControl)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewThrustControl, offsetof(SystemIdentSettingsData, ThrustControl), sizeof(SystemIdentSettingsThrustControlOptions));
+}
+void SystemIdentSettingsSmoothQuickSourceSet(SystemIdentSettingsSmoothQuickSourceOptions *NewSmoothQuickSource)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewSmoothQuickSource, offsetof(SystemIdentSettingsData, SmoothQuickSource), sizeof(SystemIdentSettingsSmoothQuickSourceOptions));
+}
+void SystemIdentSettingsSmoothQuickSourceGet(SystemIdentSettingsSmoothQuickSourceOptions *NewSmoothQuickSource)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewSmoothQuickSource, offsetof(SystemIdentSettingsData, SmoothQuickSource), sizeof(SystemIdentSettingsSmoothQuickSourceOptions));
+}
+void SystemIdentSettingsDisableSanityChecksSet(SystemIdentSettingsDisableSanityChecksOptions *NewDisableSanityChecks)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewDisableSanityChecks, offsetof(SystemIdentSettingsData, DisableSanityChecks), sizeof(SystemIdentSettingsDisableSanityChecksOptions));
+}
+void SystemIdentSettingsDisableSanityChecksGet(SystemIdentSettingsDisableSanityChecksOptions *NewDisableSanityChecks)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewDisableSanityChecks, offsetof(SystemIdentSettingsData, DisableSanityChecks), sizeof(SystemIdentSettingsDisableSanityChecksOptions));
+}
+void SystemIdentSettingsCompleteSet(SystemIdentSettingsCompleteOptions *NewComplete)
+{
+    UAVObjSetDataField(SystemIdentSettingsHandle(), (void *)NewComplete, offsetof(SystemIdentSettingsData, Complete), sizeof(SystemIdentSettingsCompleteOptions));
+}
+void SystemIdentSettingsCompleteGet(SystemIdentSettingsCompleteOptions *NewComplete)
+{
+    UAVObjGetDataField(SystemIdentSettingsHandle(), (void *)NewComplete, offsetof(SystemIdentSettingsData, Complete), sizeof(SystemIdentSettingsCompleteOptions));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,257 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup SystemStats SystemStats
+ * @brief CPU and memory usage from OpenPilot computer. 
+ *
+ * Autogenerated files and functions for SystemStats Object
+ * @{ 
+ *
+ * @file       systemstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the SystemStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "systemstats.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+#if SYSTEMSTATS_ISSETTINGS
+SETTINGS_INITCALL(SystemStatsInitialize);
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemStatsInitialize(void)
+{
+    // Compile time assertion that the SystemStatsDataPacked and SystemStatsData structs
+    // have the same size (though instances of SystemStatsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(SystemStatsDataPacked) == sizeof(SystemStatsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(SYSTEMSTATS_OBJID)) {
+        return -2;
+    }
+
+    static const UAVObjType objType = {
+       .id = SYSTEMSTATS_OBJID,
+       .instance_size = SYSTEMSTATS_NUMBYTES,
+       .init_callback = &SystemStatsSetDefaults,
+    };
+
+    // Register object with the object manager
+    handle = UAVObjRegister(&objType,
+        SYSTEMSTATS_ISSINGLEINST, SYSTEMSTATS_ISSETTINGS, SYSTEMSTATS_ISPRIORITY);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+static inline void DataOverrideDefaults(__attribute__((unused)) SystemStatsData * data) {}
+
+void SystemStatsDataOverrideDefaults(SystemStatsData * data) __attribute__((weak, alias("DataOverrideDefaults")));
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    SystemStatsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(SystemStatsData));
+
+    SystemStatsDataOverrideDefaults(&data);
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemStatsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SystemStatsFlightTimeSet(uint32_t *NewFlightTime)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewFlightTime, offsetof(SystemStatsData, FlightTime), sizeof(uint32_t));
+}
+void SystemStatsFlightTimeGet(uint32_t *NewFlightTime)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewFlightTime, offsetof(SystemStatsData, FlightTime), sizeof(uint32_t));
+}
+void SystemStatsHeapRemainingSet(uint32_t *NewHeapRemaining)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewHeapRemaining, offsetof(SystemStatsData, HeapRemaining), sizeof(uint32_t));
+}
+void SystemStatsHeapRemainingGet(uint32_t *NewHeapRemaining)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewHeapRemaining, offsetof(SystemStatsData, HeapRemaining), sizeof(uint32_t));
+}
+void SystemStatsCPUIdleTicksSet(uint32_t *NewCPUIdleTicks)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewCPUIdleTicks, offsetof(SystemStatsData, CPUIdleTicks), sizeof(uint32_t));
+}
+void SystemStatsCPUIdleTicksGet(uint32_t *NewCPUIdleTicks)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewCPUIdleTicks, offsetof(SystemStatsData, CPUIdleTicks), sizeof(uint32_t));
+}
+void SystemStatsCPUZeroLoadTicksSet(uint32_t *NewCPUZeroLoadTicks)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewCPUZeroLoadTicks, offsetof(SystemStatsData, CPUZeroLoadTicks), sizeof(uint32_t));
+}
+void SystemStatsCPUZeroLoadTicksGet(uint32_t *NewCPUZeroLoadTicks)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewCPUZeroLoadTicks, offsetof(SystemStatsData, CPUZeroLoadTicks), sizeof(uint32_t));
+}
+void SystemStatsEventSystemWarningIDSet(uint32_t *NewEventSystemWarningID)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewEventSystemWarningID, offsetof(SystemStatsData, EventSystemWarningID), sizeof(uint32_t));
+}
+void SystemStatsEventSystemWarningIDGet(uint32_t *NewEventSystemWarningID)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewEventSystemWarningID, offsetof(SystemStatsData, EventSystemWarningID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerCallbackIDSet(uint32_t *NewObjectManagerCallbackID)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewObjectManagerCallbackID, offsetof(SystemStatsData, ObjectManagerCallbackID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerCallbackIDGet(uint32_t *NewObjectManagerCallbackID)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewObjectManagerCallbackID, offsetof(SystemStatsData, ObjectManagerCallbackID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerQueueIDSet(uint32_t *NewObjectManagerQueueID)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewObjectManagerQueueID, offsetof(SystemStatsData, ObjectManagerQueueID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerQueueIDGet(uint32_t *NewObjectManagerQueueID)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewObjectManagerQueueID, offsetof(SystemStatsData, ObjectManagerQueueID), sizeof(uint32_t));
+}
+void SystemStatsIRQStackRemainingSet(uint16_t *NewIRQStackRemaining)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewIRQStackRemaining, offsetof(SystemStatsData, IRQStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsIRQStackRemainingGet(uint16_t *NewIRQStackRemaining)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewIRQStackRemaining, offsetof(SystemStatsData, IRQStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsSystemModStackRemainingSet(uint16_t *NewSystemModStackRemaining)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewSystemModStackRemaining, offsetof(SystemStatsData, SystemModStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsSystemModStackRemainingGet(uint16_t *NewSystemModStackRemaining)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewSystemModStackRemaining, offsetof(SystemStatsData, SystemModStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsFreeSet(uint16_t *NewSysSlotsFree)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewSysSlotsFree, offsetof(SystemStatsData, SysSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsFreeGet(uint16_t *NewSysSlotsFree)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewSysSlotsFree, offsetof(SystemStatsData, SysSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsActiveSet(uint16_t *NewSysSlotsActive)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewSysSlotsActive, offsetof(SystemStatsData, SysSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsActiveGet(uint16_t *NewSysSlotsActive)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewSysSlotsActive, offsetof(SystemStatsData, SysSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsFreeSet(uint16_t *NewUsrSlotsFree)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewUsrSlotsFree, offsetof(SystemStatsData, UsrSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsFreeGet(uint16_t *NewUsrSlotsFree)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewUsrSlotsFree, offsetof(SystemStatsData, UsrSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsActiveSet(uint16_t *NewUsrSlotsActive)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewUsrSlotsActive, offsetof(SystemStatsData, UsrSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsActiveGet(uint16_t *NewUsrSlotsActive)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewUsrSlotsActive, offsetof(SystemStatsData, UsrSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsCPULoadSet(uint8_t *NewCPULoad)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewCPULoad, offsetof(SystemStatsData, CPULoad), sizeof(uint8_t));
+}
+void SystemStatsCPULoadGet(uint8_t *NewCPULoad)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewCPULoad, offsetof(SystemStatsData, CPULoad), sizeof(uint8_t));
+}
+void SystemStatsCPUTempSet(int8_t *NewCPUTemp)
+{
+    UAVObjSetDataField(SystemStatsHandle(), (void *)NewCPUTemp, offsetof(SystemStatsData, CPUTemp), sizeof(int8_t));
+}
+void SystemStatsCPUTempGet(int8_t *NewCPUTemp)
+{
+    UAVObjGetDataField(SystemStatsHandle(), (void *)NewCPUTemp, offsetof(SystemStatsData, CPUTemp), sizeof(int8_t));
+}
+
+
+/**
+ * @}
+ */
@@ -31,6 +31,15 @@
 #include <pios_math.h>
 #include "inc/CoordinateConversions.h"
 
+#ifdef USE_FASTMATH
+#include <fastmath.h>
+#define RPY_ASINF  fast_asinf
+#define RPY_ATAN2F fast_atan2f
+#else
+#define RPY_ASINF  asinf
+#define RPY_ATAN2F atan2f
+#endif
+
 #define MIN_ALLOWABLE_MAGNITUDE 1e-30f
 
 // Equatorial Radius
@@ -138,9 +147,9 @@ void Quaternion2RPY(const float q[4], float rpy[3])
     R23    = 2.0f * (q[2] * q[3] + q[0] * q[1]);
     R33    = q0s - q1s - q2s + q3s;
 
-    rpy[1] = RAD2DEG(asinf(-R13)); // pitch always between -pi/2 to pi/2
-    rpy[2] = RAD2DEG(atan2f(R12, R11));
-    rpy[0] = RAD2DEG(atan2f(R23, R33));
+    rpy[1] = RAD2DEG(RPY_ASINF(-R13)); // pitch always between -pi/2 to pi/2
+    rpy[2] = RAD2DEG(RPY_ATAN2F(R12, R11));
+    rpy[0] = RAD2DEG(RPY_ATAN2F(R23, R33));
 
     // TODO: consider the cases where |R13| ~= 1, |pitch| ~= pi/2
 }
@@ -292,6 +301,110 @@ void Base2ECEF(const float NED[3], const float BaseECEF[3], float Rne[3][3], flo
 }
 
 
+// ****** sine and cosine of an angle difference, series for the usual small ones ********
+static void sincos_delta(double angle, double *sine, double *cosine)
+{
+    if (fabs(angle) < 0.1d) { // about 600 km, the next terms are below 1e-14
+        const double a2 = angle * angle;
+        *sine   = angle * (1.0d - a2 / 6.0d * (1.0d - a2 / 20.0d * (1.0d - a2 / 42.0d)));
+        *cosine = 1.0d - a2 / 2.0d * (1.0d - a2 / 12.0d * (1.0d - a2 / 30.0d * (1.0d - a2 / 56.0d)));
+    } else {
+        *sine   = sin(angle);
+        *cosine = cos(angle);
+    }
+}
+
+// ****** build the local tangent plane frame, returns 1 if the home location changed ********
+uint8_t LTPFrameFromLLA(const int32_t HomeLLAi[3], struct ltp_frame *ltp)
+{
+    if (ltp->valid && ltp->home[0] == HomeLLAi[0] && ltp->home[1] == HomeLLAi[1] && ltp->home[2] == HomeLLAi[2]) {
+        return 0;
+    }
+
+    const double lat = DEG2RAD_D(((double)HomeLLAi[0]) * 1e-7d);
+    const double alt = ((double)HomeLLAi[2]) * 1e-4d;
+
+    ltp->sinLat = sin(lat);
+    ltp->cosLat = cos(lat);
+
+    const double N = equatorial_radius / sqrt(1.0d - eccentricity_sq * ltp->sinLat * ltp->sinLat);
+    ltp->x0      = (N + alt) * ltp->cosLat;
+    ltp->z0      = ((1.0d - eccentricity_sq) * N + alt) * ltp->sinLat;
+
+    ltp->home[0] = HomeLLAi[0];
+    ltp->home[1] = HomeLLAi[1];
+    ltp->home[2] = HomeLLAi[2];
+    ltp->valid   = 1;
+    return 1;
+}
+
+// ****** express positions in the local tangent plane frame ********
+void LLA2LTP(const struct ltp_frame *ltp, const int32_t LLAi[][3], float NED[][3], uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++) {
+        // angles relative to home, the integer differences are exact
+        int64_t dLon = (int64_t)LLAi[i][1] - ltp->home[1];
+        if (dLon > 1800000000) {
+            dLon -= 3600000000LL;
+        } else if (dLon < -1800000000) {
+            dLon += 3600000000LL;
+        }
+        double sinDLat, cosDLat, sinDLon, cosDLon;
+        sincos_delta(DEG2RAD_D(((double)(LLAi[i][0] - ltp->home[0])) * 1e-7d), &sinDLat, &cosDLat);
+        sincos_delta(DEG2RAD_D(((double)dLon) * 1e-7d), &sinDLon, &cosDLon);
+
+        const double sinLat = ltp->sinLat * cosDLat + ltp->cosLat * sinDLat;
+        const double cosLat = ltp->cosLat * cosDLat - ltp->sinLat * sinDLat;
+        const double alt    = ((double)LLAi[i][2]) * 1e-4d;
+        const double N      = equatorial_radius / sqrt(1.0d - eccentricity_sq * sinLat * sinLat);
+
+        // ECEF relative to home, rotated to the home meridian
+        const double dx     = (N + alt) * cosLat * cosDLon - ltp->x0;
+        const double dy     = (N + alt) * cosLat * sinDLon;
+        const double dz     = ((1.0d - eccentricity_sq) * N + alt) * sinLat - ltp->z0;
+
+        NED[i][0] = (float)(-ltp->sinLat * dx + ltp->cosLat * dz);
+        NED[i][1] = (float)dy;
+        NED[i][2] = (float)(-ltp->cosLat * dx - ltp->sinLat * dz);
+    }
+}
+
+// ****** convert positions in the local tangent plane frame to Lat,Lon,Alt ********
+void LTP2LLA(const struct ltp_frame *ltp, const float NED[][3], int32_t LLAi[][3], uint16_t count)
+{
+    const double b   = sqrt(equatorial_radius_sq * (1 - eccentricity_sq));
+    const double bsq = b * b;
+    const double ep  = sqrt((equatorial_radius_sq - bsq) / bsq);
+
+    for (uint16_t i = 0; i < count; i++) {
+        // ECEF rotated to the home meridian, then the same closed form as ECEF2LLA
+        const double x   = ltp->x0 - ltp->sinLat * NED[i][0] - ltp->cosLat * NED[i][2];
+        const double y   = NED[i][1];
+        const double z   = ltp->z0 + ltp->cosLat * NED[i][0] - ltp->sinLat * NED[i][2];
+
+        const double p   = sqrt(x * x + y * y);
+        const double th  = atan2(equatorial_radius * z, b * p);
+        const double sth = sin(th);
+        const double cth = cos(th);
+
+        const double lat = atan2(z + ep * ep * b * sth * sth * sth, p - eccentricity_sq * equatorial_radius * cth * cth * cth);
+        const double sinLat = sin(lat);
+        const double N   = equatorial_radius / sqrt(1 - eccentricity_sq * sinLat * sinLat);
+        const double alt = p / cos(lat) - N;
+
+        int64_t lon = ltp->home[1] + (int64_t)lround(RAD2DEG_D(atan2(y, x)) * 1e7d);
+        if (lon > 1800000000) {
+            lon -= 3600000000LL;
+        } else if (lon < -1800000000) {
+            lon += 3600000000LL;
+        }
+
+        LLAi[i][0] = (int32_t)lround(RAD2DEG_D(lat) * 1e7d);
+        LLAi[i][1] = (int32_t)lon;
+        LLAi[i][2] = (int32_t)lround(alt * 1e4d);
+    }
+}
+
 // ****** convert Rotation Matrix to Quaternion ********
 // ****** if R converts from e to b, q is rotation from e to b ****
 void R2Quaternion(float R[3][3], float q[4])
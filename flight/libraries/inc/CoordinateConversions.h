@@ -30,6 +30,7 @@
 #ifndef COORDINATECONVERSIONS_H_
 #define COORDINATECONVERSIONS_H_
 #include <math.h>
+#include <stdint.h>
 
 // ****** convert Lat,Lon,Alt to ECEF  ************
 void LLA2ECEF(const int32_t LLAi[3], float ECEF[3]);
@@ -43,6 +44,22 @@ void RneFromLLA(const int32_t LLAi[3], float Rne[3][3]);
 void LLA2Base(const int32_t LLAi[3], const float BaseECEF[3], float Rne[3][3], float NED[3]);
 void Base2LLA(const float NED[3], const float BaseECEF[3], float Rne[3][3], int32_t LLAi[3]);
 
+// ****** Local tangent plane (NED) frame around a home location ********
+// The home terms are computed once, so converting a position takes a few
+// multiply-adds in double precision and stays precise far from home.
+struct ltp_frame {
+    int32_t home[3]; // home LLA the frame was built for, deg * 1e7 and m * 1e4
+    uint8_t valid;
+    double  sinLat; // sine and cosine of the home latitude
+    double  cosLat;
+    double  x0; // home in ECEF rotated to the home meridian, y0 = 0
+    double  z0;
+};
+
+uint8_t LTPFrameFromLLA(const int32_t HomeLLAi[3], struct ltp_frame *ltp);
+void LLA2LTP(const struct ltp_frame *ltp, const int32_t LLAi[][3], float NED[][3], uint16_t count);
+void LTP2LLA(const struct ltp_frame *ltp, const float NED[][3], int32_t LLAi[][3], uint16_t count);
+
 // ****** Express ECEF in a local NED Base Frame and back ********
 void ECEF2Base(const float ECEF[3], const float BaseECEF[3], float Rne[3][3], float NED[3]);
 void Base2ECEF(const float NED[3], const float BaseECEF[3], float Rne[3][3], float ECEF[3]);
@@ -36,6 +36,9 @@
 #define NUMTERMS                                91             // ((WMM_MAX_MODEL_DEGREES+1)*(WMM_MAX_MODEL_DEGREES+2)/2);
 #define NUMPCUP                                 92              // NUMTERMS +1
 #define NUMPCUPS                                13             // WMM_MAX_MODEL_DEGREES +1
+#define WMM_CACHE_TOLERANCE_DEG                 0.001f         // position change up to which the Legendre and longitude terms are reused
+#define WMM_GRID_SPACING_DEG                    1.0f           // cell size of the interpolation grid
+#define WMM_GRID_ALTITUDE_TOLERANCE             1000.0f        // altitude change in m up to which the grid cell is reused
 
 // internal structure definitions
 typedef struct {
@@ -96,6 +99,32 @@ typedef struct {
     float sin_mlambda[WMM_MAX_MODEL_DEGREES + 1]; // sp(m)  - sine of (m*spherical coord. longitude)
 } WMMtype_SphericalHarmonicVariables;
 
+// terms kept during a call, and between calls after WMM_KeepCache(true), the coefficients
+// only depend on the date and the Legendre and longitude terms only depend on one coordinate each
+typedef struct {
+    float    CoeffDate; // decimal year the time adjusted coefficients are valid for
+    float    MainFieldCoeffG[NUMTERMS]; // Gauss coefficients at CoeffDate (nT)
+    float    MainFieldCoeffH[NUMTERMS];
+    float    phig; // geocentric latitude the Legendre functions were computed for
+    WMMtype_LegendreFunction LegendreFunction;
+    float    lambda; // longitude the cos and sin terms were computed for
+    float    cos_mlambda[WMM_MAX_MODEL_DEGREES + 1];
+    float    sin_mlambda[WMM_MAX_MODEL_DEGREES + 1];
+    uint16_t CoeffValid;
+    uint16_t LegendreValid;
+    uint16_t LambdaValid;
+} WMMtype_Cache;
+
+// field at the corners of the interpolation grid cell used by WMM_GetMagVectorApprox()
+typedef struct {
+    float    Lat; // south west corner of the cell
+    float    Lon;
+    float    Alt;
+    float    Date;
+    float    B[2][2][3]; // [lat][lon][axis]
+    uint16_t Valid;
+} WMMtype_Grid;
+
 typedef struct {
     float Decl; /* 1. Angle between the magnetic field vector and true north, positive east */
     float Incl; /*2. Angle between the magnetic field vector and the horizontal plane, positive down */
@@ -117,6 +146,7 @@ typedef struct {
 
 // Internal Function Prototypes
 void WMM_Set_Coeff_Array();
+int WMM_TimelyModifyMagneticModel();
 int WMM_GeodeticToSpherical(WMMtype_CoordGeodetic *CoordGeodetic, WMMtype_CoordSpherical *CoordSpherical);
 int WMM_DateToYear(uint16_t month, uint16_t day, uint16_t year);
 int WMM_Geomag(WMMtype_CoordSpherical *CoordSpherical,
@@ -30,5 +30,7 @@
 // Exposed Function Prototypes
 int WMM_Initialize();
 int WMM_GetMagVector(float Lat, float Lon, float AltEllipsoid, uint16_t Month, uint16_t Day, uint16_t Year, float B[3]);
+int WMM_GetMagVectorApprox(float Lat, float Lon, float AltEllipsoid, uint16_t Month, uint16_t Day, uint16_t Year, float B[3]);
+void WMM_KeepCache(bool keep);
 
 #endif /* WORLDMAGMODEL_H_ */
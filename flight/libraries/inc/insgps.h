@@ -70,6 +70,7 @@ void INSSetGyroBiasVar(const float gyro_bias_var[3]);
 void INSSetMagNorth(const float B[3]);
 void INSSetMagVar(const float scaled_mag_var[3]);
 void INSSetBaroVar(const float baro_var);
+void INSSetCovariancePredictionDivider(uint8_t divider);
 void INSSetArmed(bool armed);
 void INSPosVelReset(const float pos[3], const float vel[3]);
 
@@ -79,7 +80,7 @@ void MagVelBaroCorrection(float mag_data[3], float Vel[3], float BaroAlt);
 void FullCorrection(float mag_data[3], float Pos[3], float Vel[3],
                     float BaroAlt);
 void GpsBaroCorrection(float Pos[3], float Vel[3], float BaroAlt);
-void GpsMagCorrection(float mag_data[3], float Pos[3], float Vel[2]);
+void GpsMagCorrection(float mag_data[3], float Pos[3], float Vel[3]);
 void VelBaroCorrection(float Vel[3], float BaroAlt);
 
 uint16_t ins_get_num_states();
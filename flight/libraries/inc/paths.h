@@ -34,6 +34,23 @@ struct path_status {
     float correction_vector[3];
 };
 
+// geometry of a PathDesired segment, everything that does not depend on the current position
+struct path_segment {
+    uint8_t type; // which progress function applies
+    bool    mode3D;
+    bool    clockwise;
+    float   start[3];
+    float   end[3];
+    float   path_vector[3]; // end - start, no down component unless mode3D
+    float   dist_path; // length of path_vector
+    float   starting_velocity;
+    float   ending_velocity;
+    float   radius; // circle radius, horizontal distance from end to start
+    float   a_radius; // direction of start seen from the circle center, 0 to 2 pi
+};
+
 void path_progress(PathDesiredData *path, float *cur_point, struct path_status *status, bool mode3D);
+void path_segment_init(struct path_segment *segment, PathDesiredData *path, bool mode3D);
+void path_segment_progress(const struct path_segment *segment, float *cur_point, struct path_status *status);
 
 #endif
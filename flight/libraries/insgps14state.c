@@ -53,6 +53,7 @@ static void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
                          uint16_t SensorsUsed);
 static void RungeKutta(float X[NUMX], float U[NUMU], float dT);
 static void StateEq(float X[NUMX], float U[NUMU], float Xdot[NUMX]);
+static void IntegratedCovariancePrediction(void);
 static void LinearizeFG(float X[NUMX], float U[NUMU], float F[NUMX][NUMX],
                         float G[NUMX][NUMW]);
 static void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV]);
@@ -101,6 +102,13 @@ static struct EKFData {
     float Q[NUMW];
     float R[NUMV]; // input noise and measurement noise variances
     float K[NUMX][NUMV]; // feedback gain matrix
+    // inputs and time accumulated between two covariance predictions
+    float   Uint[NUMU];
+    float   dTU;
+    float   dTint;
+    float   dT2int;
+    uint8_t covarianceSteps;
+    uint8_t covarianceDivider;
 } ekf;
 
 // Global variables
@@ -168,6 +176,8 @@ void INSGPSInit()
     ekf.R[5]  = 0.004f;              // High freq GPS vertical velocity noise variance (m/s)^2
     ekf.R[6]  = ekf.R[7] = ekf.R[8] = 0.005f;        // magnetometer unit vector noise variance
     ekf.R[9]  = .05f;                // High freq altimeter noise variance (m^2)
+
+    INSSetCovariancePredictionDivider(1);
 }
 
 // ! Set the current flight state
@@ -345,6 +355,19 @@ void INSSetBaroVar(const float baro_var)
     ekf.R[9] = baro_var;
 }
 
+// ! Propagate the covariance only once every divider state predictions, 1 to propagate on every one
+void INSSetCovariancePredictionDivider(uint8_t divider)
+{
+    ekf.covarianceDivider = divider ? divider : 1;
+    ekf.covarianceSteps   = 0;
+    ekf.dTU    = 0.0f;
+    ekf.dTint  = 0.0f;
+    ekf.dT2int = 0.0f;
+    for (int i = 0; i < NUMU; i++) {
+        ekf.Uint[i] = 0.0f;
+    }
+}
+
 void INSSetMagNorth(const float B[3])
 {
     ekf.Be[0] = B[0];
@@ -390,7 +413,15 @@ void INSStatePrediction(const float gyro_data[3], const float accel_data[3], flo
     U[5] = accel_data[2];
 
     // EKF prediction step
-    LinearizeFG(ekf.X, U, ekf.F, ekf.G);
+    if (ekf.covarianceDivider > 1) {
+        // F and G are linearized once per covariance prediction, about the mean inputs
+        for (int i = 0; i < NUMU; i++) {
+            ekf.Uint[i] += U[i] * dT;
+        }
+        ekf.dTU += dT;
+    } else {
+        LinearizeFG(ekf.X, U, ekf.F, ekf.G);
+    }
     RungeKutta(ekf.X, U, dT);
     invqmag    = invsqrtf(ekf.X[6] * ekf.X[6] + ekf.X[7] * ekf.X[7] + ekf.X[8] * ekf.X[8] + ekf.X[9] * ekf.X[9]);
     ekf.X[6]  *= invqmag;
@@ -419,7 +450,50 @@ void INSStatePrediction(const float gyro_data[3], const float accel_data[3], flo
 
 void INSCovariancePrediction(float dT)
 {
-    CovariancePrediction(ekf.F, ekf.G, ekf.Q, dT, ekf.P);
+    if (ekf.covarianceDivider <= 1) {
+        CovariancePrediction(ekf.F, ekf.G, ekf.Q, dT, ekf.P);
+        return;
+    }
+
+    ekf.dTint  += dT;
+    ekf.dT2int += dT * dT;
+    if (++ekf.covarianceSteps >= ekf.covarianceDivider) {
+        IntegratedCovariancePrediction();
+    }
+}
+
+// Propagates the covariance over all steps accumulated since the last call in one go.
+// CovariancePrediction() adds T^2*G*Q*G' of process noise, so Q is scaled to add as much
+// noise as the individual steps would have. The transition (I+F*T) drops the second order
+// terms of the product of the individual steps, which is the accuracy given up for speed.
+static void IntegratedCovariancePrediction(void)
+{
+    float U[NUMU];
+    float Q[NUMW];
+
+    if (!ekf.covarianceSteps || ekf.dTU <= 0.0f || ekf.dTint <= 0.0f) {
+        return;
+    }
+
+    const float invdTU  = 1.0f / ekf.dTU;
+    const float invdT   = 1.0f / ekf.dTint;
+    const float Q_scale = ekf.dT2int * invdT * invdT;
+
+    for (int i = 0; i < NUMU; i++) {
+        U[i] = ekf.Uint[i] * invdTU;
+        ekf.Uint[i] = 0.0f;
+    }
+    for (int i = 0; i < NUMW; i++) {
+        Q[i] = ekf.Q[i] * Q_scale;
+    }
+
+    LinearizeFG(ekf.X, U, ekf.F, ekf.G);
+    CovariancePrediction(ekf.F, ekf.G, Q, ekf.dTint, ekf.P);
+
+    ekf.covarianceSteps = 0;
+    ekf.dTU    = 0.0f;
+    ekf.dTint  = 0.0f;
+    ekf.dT2int = 0.0f;
 }
 
 void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[3],
@@ -428,6 +502,9 @@ void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[
     float Z[10], Y[10];
     float invqmag;
 
+    // the correction needs the covariance of the current state
+    IntegratedCovariancePrediction();
+
     // GPS Position in meters and in local NED frame
     Z[0] = Pos[0];
     Z[1] = Pos[1];
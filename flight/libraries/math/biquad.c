@@ -0,0 +1,205 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilot Math Utilities
+ * @{
+ * @addtogroup Biquad filter bank
+ * @{
+ *
+ * @file       biquad.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Cascaded biquad filters applied to several channels at once
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "openpilot.h"
+#include "math.h"
+#include "biquad.h"
+
+/**
+ * Set the normalised coefficients of a biquad section from the analog prototype
+ * terms of the bilinear transform, see the Audio EQ Cookbook by R. Bristow-Johnson
+ */
+static void biquad_set(struct biquad_coeffs *coeffs, float b0, float b1, float b2, float a0, float a1, float a2)
+{
+    coeffs->b0 = b0 / a0;
+    coeffs->b1 = b1 / a0;
+    coeffs->b2 = b2 / a0;
+    // the feedback terms are stored negated, so the section only adds
+    coeffs->a1 = -a1 / a0;
+    coeffs->a2 = -a2 / a0;
+}
+
+/**
+ * Design a first order low pass section, the exponential smoothing
+ * y = alpha * y + (1 - alpha) * x used by the flight code
+ * @param[out] coeffs Pointer to section coefficients
+ * @param[in]  alpha Smoothing factor, 0 passes the input through
+ * @returns Nothing
+ */
+void biquad_first_order(struct biquad_coeffs *coeffs, float alpha)
+{
+    coeffs->b0 = 1.0f - alpha;
+    coeffs->b1 = 0.0f;
+    coeffs->b2 = 0.0f;
+    coeffs->a1 = alpha;
+    coeffs->a2 = 0.0f;
+}
+
+/**
+ * Design a second order low pass section.
+ * With q = 1/sqrt(2) this is the same Butterworth filter as InitButterWorthDF2Filter().
+ * @param[out] coeffs Pointer to section coefficients
+ * @param[in]  ff Cut-off frequency ratio, cut-off frequency divided by sample rate
+ * @param[in]  q Quality factor
+ * @returns Nothing
+ */
+void biquad_lowpass(struct biquad_coeffs *coeffs, float ff, float q)
+{
+    const float omega = 2.0f * M_PI_F * ff;
+    const float cs    = cosf(omega);
+    const float alpha = sinf(omega) / (2.0f * q);
+
+    biquad_set(coeffs, (1.0f - cs) * 0.5f, 1.0f - cs, (1.0f - cs) * 0.5f, 1.0f + alpha, -2.0f * cs, 1.0f - alpha);
+}
+
+/**
+ * Design a second order notch section with unity gain away from the notch.
+ * @param[out] coeffs Pointer to section coefficients
+ * @param[in]  ff Center frequency ratio, center frequency divided by sample rate
+ * @param[in]  q Quality factor, center frequency divided by the -3dB bandwidth
+ * @returns Nothing
+ */
+void biquad_notch(struct biquad_coeffs *coeffs, float ff, float q)
+{
+    const float omega = 2.0f * M_PI_F * ff;
+    const float cs    = cosf(omega);
+    const float alpha = sinf(omega) / (2.0f * q);
+
+    biquad_set(coeffs, 1.0f, -2.0f * cs, 1.0f, 1.0f + alpha, -2.0f * cs, 1.0f - alpha);
+}
+
+/**
+ * Initialise a filter bank and reset its state to zero
+ * @param[out] bank The filter bank
+ * @param[in]  channels Number of independent channels filtered
+ * @param[in]  stages Number of cascaded sections applied to each channel
+ * @param[in]  coeffs Coefficients of each section, in the order they are applied
+ * @returns 0 on success or -1 if the bank does not support that many channels or sections
+ */
+int32_t biquad_bank_init(struct biquad_bank *bank, uint8_t channels, uint8_t stages, const struct biquad_coeffs *coeffs)
+{
+    if (channels > BIQUAD_BANK_MAX_CHANNELS || stages > BIQUAD_BANK_MAX_STAGES) {
+        return -1;
+    }
+
+    bank->channels = channels;
+    bank->stages   = stages;
+    for (uint8_t s = 0; s < stages; s++) {
+        bank->coeffs[s] = coeffs[s];
+    }
+
+    biquad_bank_reset(bank, NULL);
+
+    return 0;
+}
+
+/**
+ * Reset the state of a filter bank as if each channel had settled on a constant input
+ * @param[in]  bank The filter bank
+ * @param[in]  values The constant input of each channel, NULL to reset all channels to zero
+ * @returns Nothing
+ */
+void biquad_bank_reset(struct biquad_bank *bank, const float *values)
+{
+    for (uint8_t c = 0; c < bank->channels; c++) {
+        float x = values ? values[c] : 0.0f;
+
+        for (uint8_t s = 0; s < bank->stages; s++) {
+            const struct biquad_coeffs *k = &bank->coeffs[s];
+            // constant output of the section for a constant input, which is the input of the next one
+            float y = x * (k->b0 + k->b1 + k->b2) / (1.0f - k->a1 - k->a2);
+
+            bank->s2[s][c] = k->b2 * x + k->a2 * y;
+            bank->s1[s][c] = k->b1 * x + k->a1 * y + bank->s2[s][c];
+            x = y;
+        }
+    }
+}
+
+/**
+ * Filter one sample of every channel
+ * @param[in]  bank The filter bank
+ * @param[in,out] samples One new sample per channel, replaced by the filtered values
+ * @returns Nothing
+ */
+void biquad_bank_apply(struct biquad_bank *bank, float *samples)
+{
+    const uint8_t channels = bank->channels;
+
+    // sections in the outer loop, so the inner loop runs over the state arrays of all channels
+    for (uint8_t s = 0; s < bank->stages; s++) {
+        const struct biquad_coeffs k = bank->coeffs[s];
+        float *s1 = bank->s1[s];
+        float *s2 = bank->s2[s];
+
+        for (uint8_t c = 0; c < channels; c++) {
+            const float x = samples[c];
+            const float y = k.b0 * x + s1[c];
+
+            s1[c] = k.b1 * x + k.a1 * y + s2[c];
+            s2[c] = k.b2 * x + k.a2 * y;
+            samples[c] = y;
+        }
+    }
+}
+
+/**
+ * Filter consecutive samples of one channel, for example a FIFO burst of a sensor
+ * @param[in]  bank The filter bank
+ * @param[in]  channel The channel the samples belong to
+ * @param[in,out] samples The new samples, replaced by the filtered values
+ * @param[in]  count Number of samples
+ * @returns Nothing
+ */
+void biquad_bank_apply_block(struct biquad_bank *bank, uint8_t channel, float *samples, uint16_t count)
+{
+    for (uint8_t s = 0; s < bank->stages; s++) {
+        const struct biquad_coeffs k = bank->coeffs[s];
+        float s1 = bank->s1[s][channel];
+        float s2 = bank->s2[s][channel];
+
+        for (uint16_t n = 0; n < count; n++) {
+            const float x = samples[n];
+            const float y = k.b0 * x + s1;
+
+            s1 = k.b1 * x + k.a1 * y + s2;
+            s2 = k.b2 * x + k.a2 * y;
+            samples[n] = y;
+        }
+
+        bank->s1[s][channel] = s1;
+        bank->s2[s][channel] = s2;
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
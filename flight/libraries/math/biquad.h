@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilot Math Utilities
+ * @{
+ * @addtogroup Biquad filter bank
+ * @{
+ *
+ * @file       biquad.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Cascaded biquad filters applied to several channels at once
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef BIQUAD_H
+#define BIQUAD_H
+
+#include <stdint.h>
+
+// ! Maximum number of channels and cascaded sections of a biquad_bank
+#define BIQUAD_BANK_MAX_CHANNELS 6
+#define BIQUAD_BANK_MAX_STAGES   4
+
+// Coefficients of one biquad section, normalised to a0 = 1 and with the feedback terms negated:
+// y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+struct biquad_coeffs {
+    float b0;
+    float b1;
+    float b2;
+    float a1;
+    float a2;
+};
+
+// biquad_bank structure, the same cascade of biquad sections applied to each channel
+struct biquad_bank {
+    uint8_t channels;
+    uint8_t stages;
+    struct biquad_coeffs coeffs[BIQUAD_BANK_MAX_STAGES];
+    // transposed direct form 2 state per section as arrays over the channels
+    float s1[BIQUAD_BANK_MAX_STAGES][BIQUAD_BANK_MAX_CHANNELS];
+    float s2[BIQUAD_BANK_MAX_STAGES][BIQUAD_BANK_MAX_CHANNELS];
+};
+
+// Filter designs
+void biquad_first_order(struct biquad_coeffs *coeffs, float alpha);
+void biquad_lowpass(struct biquad_coeffs *coeffs, float ff, float q);
+void biquad_notch(struct biquad_coeffs *coeffs, float ff, float q);
+
+// Methods for use with biquad_bank structure
+int32_t biquad_bank_init(struct biquad_bank *bank, uint8_t channels, uint8_t stages, const struct biquad_coeffs *coeffs);
+void biquad_bank_reset(struct biquad_bank *bank, const float *values);
+void biquad_bank_apply(struct biquad_bank *bank, float *samples);
+void biquad_bank_apply_block(struct biquad_bank *bank, uint8_t channel, float *samples, uint16_t count);
+
+#endif /* BIQUAD_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,206 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilot Math Utilities
+ * @{
+ * @addtogroup Fast approximate math functions
+ * @{
+ *
+ * @file       fastmath.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Polynomial approximations of libm functions with a known maximum error
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <math.h>
+#include <stdint.h>
+
+/*
+ * The maximum errors below are measured over the whole input range by the
+ * math unit tests, which fail if an approximation gets worse.
+ * The table based sine and cosine are in sin_lookup.h.
+ */
+
+// ! Maximum relative error of fast_invsqrtf() and fast_sqrtf()
+#define FASTMATH_INVSQRT_MAX_REL_ERROR 5e-6f
+// ! Maximum absolute error in radians of fast_atanf() and fast_atan2f()
+#define FASTMATH_ATAN_MAX_ERROR        1.5e-5f
+// ! Maximum absolute error in radians of fast_asinf() and fast_acosf()
+#define FASTMATH_ASIN_MAX_ERROR        5e-7f
+// ! Maximum absolute error of fast_sinf() and fast_cosf() for |x| <= 100 pi
+#define FASTMATH_SIN_MAX_ERROR         5e-7f
+
+#define FASTMATH_PI                    3.14159265358979323846f
+#define FASTMATH_PI_2                  1.57079632679489661923f
+
+/**
+ * Inverse square root, bit level initial guess refined by two Newton steps
+ * @param[in] x Positive number
+ * @returns 1 / sqrt(x)
+ */
+static inline float fast_invsqrtf(float x)
+{
+    union {
+        float    f;
+        uint32_t i;
+    } u = { x };
+    const float half = 0.5f * x;
+
+    u.i = 0x5f375a86 - (u.i >> 1);
+    u.f = u.f * (1.5f - half * u.f * u.f);
+    u.f = u.f * (1.5f - half * u.f * u.f);
+    return u.f;
+}
+
+/**
+ * Square root through fast_invsqrtf()
+ * @param[in] x Number
+ * @returns sqrt(x), 0 for x <= 0
+ */
+static inline float fast_sqrtf(float x)
+{
+    return x > 0.0f ? x * fast_invsqrtf(x) : 0.0f;
+}
+
+/* arc tangent for |x| <= 1, minimax polynomial in x^2 (Abramowitz and Stegun 4.4.49) */
+static inline float fast_atan_unit(float x)
+{
+    const float x2 = x * x;
+
+    return x * (0.9998660f + x2 * (-0.3302995f + x2 * (0.1801410f + x2 * (-0.0851330f + x2 * 0.0208351f))));
+}
+
+/**
+ * Arc tangent
+ * @param[in] x Number
+ * @returns atan(x) in radians
+ */
+static inline float fast_atanf(float x)
+{
+    if (x > 1.0f) {
+        return FASTMATH_PI_2 - fast_atan_unit(1.0f / x);
+    } else if (x < -1.0f) {
+        return -FASTMATH_PI_2 - fast_atan_unit(1.0f / x);
+    }
+    return fast_atan_unit(x);
+}
+
+/**
+ * Arc tangent of y/x using the signs of both to find the quadrant
+ * @param[in] y Number
+ * @param[in] x Number
+ * @returns atan2(y, x) in radians between -pi and pi, 0 if x and y are 0
+ */
+static inline float fast_atan2f(float y, float x)
+{
+    const float ax = fabsf(x);
+    const float ay = fabsf(y);
+    float angle;
+
+    if (ax >= ay) {
+        if (ax == 0.0f) {
+            return 0.0f;
+        }
+        angle = fast_atan_unit(ay / ax);
+    } else {
+        angle = FASTMATH_PI_2 - fast_atan_unit(ax / ay);
+    }
+    if (x < 0.0f) {
+        angle = FASTMATH_PI - angle;
+    }
+    return y < 0.0f ? -angle : angle;
+}
+
+/**
+ * Arc sine, polynomial in |x| times sqrt(1 - |x|) (Abramowitz and Stegun 4.4.46)
+ * @param[in] x Number, clamped to -1 .. 1
+ * @returns asin(x) in radians
+ */
+static inline float fast_asinf(float x)
+{
+    float ax = fabsf(x);
+
+    // rounding can take the sine of an angle computed from a unit quaternion slightly past 1
+    if (ax > 1.0f) {
+        ax = 1.0f;
+    }
+    const float p = 1.5707963050f + ax * (-0.2145988016f + ax * (0.0889789874f + ax * (-0.0501743046f + ax * (0.0308918810f
+                                                                                                                + ax * (-0.0170881256f + ax * (0.0066700901f + ax * -0.0012624911f))))));
+    const float angle = FASTMATH_PI_2 - sqrtf(1.0f - ax) * p;
+
+    return x < 0.0f ? -angle : angle;
+}
+
+/**
+ * Arc cosine
+ * @param[in] x Number, clamped to -1 .. 1
+ * @returns acos(x) in radians
+ */
+static inline float fast_acosf(float x)
+{
+    return FASTMATH_PI_2 - fast_asinf(x);
+}
+
+/* sine for |x| <= pi/2, minimax polynomial of degree 9 */
+static inline float fast_sin_unit(float x)
+{
+    const float x2 = x * x;
+
+    return x * (1.0f + x2 * (-1.6666657414e-1f + x2 * (8.3330251061e-3f + x2 * (-1.9807418155e-4f + x2 * 2.6019030677e-6f))));
+}
+
+/**
+ * Sine, reduced by the nearest multiple of pi to -pi/2 .. pi/2
+ * @param[in] x Angle in radians
+ * @returns sin(x)
+ */
+static inline float fast_sinf(float x)
+{
+    const float k = floorf(x * (1.0f / FASTMATH_PI) + 0.5f);
+    // pi split in two parts, the first one exact in a few bits, so the reduction keeps its precision
+    const float r = (x - k * 3.140625f) - k * 9.67653589793e-4f;
+
+    // sin(x) = (-1)^k sin(x - k pi)
+    return ((int32_t)k & 1) ? -fast_sin_unit(r) : fast_sin_unit(r);
+}
+
+/**
+ * Cosine, reduced by the nearest odd multiple of pi/2 to -pi/2 .. pi/2
+ * @param[in] x Angle in radians
+ * @returns cos(x)
+ */
+static inline float fast_cosf(float x)
+{
+    // k = m + 1/2
+    const float k = floorf(x * (1.0f / FASTMATH_PI)) + 0.5f;
+    const float r = (x - k * 3.140625f) - k * 9.67653589793e-4f;
+
+    // with x = r + (m + 1/2) pi, cos(x) = -sin(r + m pi) = (-1)^(m + 1) sin(r)
+    return ((int32_t)(k + 0.5f) & 1) ? -fast_sin_unit(r) : fast_sin_unit(r);
+}
+
+#endif /* FASTMATH_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -34,6 +34,9 @@
 
 #include <math.h>
 #include <stdint.h>
+#ifdef USE_FASTMATH
+#include "fastmath.h"
+#endif
 
 typedef struct {
     float p1;
@@ -155,10 +158,15 @@ static inline float y_on_curve(float x, const pointf points[], int num_points)
 
 static inline float invsqrtf(float number)
 {
+#ifdef USE_FASTMATH
+    // used for the quaternion and vector normalisations in the attitude filters
+    return fast_invsqrtf(number);
+#else
     float y;
 
     y = 1.0f / sqrtf(number);
     return y;
+#endif
 }
 
 /**
@@ -148,6 +148,91 @@ void pid_configure(struct pid *pid, float p, float i, float d, float iLim)
     pid->iLim = iLim;
 }
 
+/**
+ * Update the PID computation with setpoint weighting on the derivative for all loops of a bank
+ * @param[in] bank The PID bank which stores temporary information
+ * @param[in] scaler Dynamic factors to scale the pid's of each loop by
+ * @param[in] setpoint The setpoint of each loop
+ * @param[in] measured The measured value of each loop
+ * @param[out] output The computed controller value of each loop
+ * @param[in] active Bit mask of the loops to update, the state and output of the other loops are left unchanged
+ * @param[in] dT  The time step
+ *
+ * Computes the same result as pid_apply_setpoint() on each loop, but works on the
+ * arrays of the bank in a fixed width loop that uses selects instead of branches,
+ * and the terms shared by all loops are computed once.
+ */
+void pid_bank_apply_setpoint(struct pid_bank *bank, const pid_bank_scaler *scaler, const float *setpoint, const float *measured, float *output, uint8_t active, float dT, bool meas_based_d_term)
+{
+    // terms shared by all loops, the derivative is disabled entirely without a valid time step
+    const float gamma  = meas_based_d_term ? 0.0f : deriv_gamma;
+    const bool dValid  = (dT > 0.0f);
+    const float alpha  = dValid ? dT / (dT + deriv_tau) : 0.0f;
+    const float dTsafe  = dValid ? dT : 1.0f;
+
+    for (int n = 0; n < PID_BANK_LOOPS; n++) {
+        const bool update = (active >> n) & 1;
+        float err = setpoint[n] - measured[n];
+
+        // Scale up accumulator by 1000 while computing to avoid losing precision
+        // and bound it to the limit with selects, this gives the same result as boundf()
+        float iLim = fabsf(bank->iLim[n]) * 1000.0f;
+        float iAccumulator = bank->iAccumulator[n] + err * (scaler->i[n] * bank->i[n] * dT * 1000.0f);
+        iAccumulator = (iAccumulator >= -iLim) ? ((iAccumulator <= iLim) ? iAccumulator : iLim) : -iLim;
+
+        // Calculate DT1 term, low pass filtered as in pid_apply_setpoint()
+        float derr    = gamma * setpoint[n] - measured[n];
+        float diff    = derr - bank->lastErr[n];
+        bool dEnabled = dValid & (bank->d[n] > 0.0f);
+        float dterm   = bank->lastDer[n] + alpha * ((scaler->d[n] * diff * bank->d[n] / dTsafe) - bank->lastDer[n]);
+        dterm = dEnabled ? dterm : 0.0f;
+
+        float out = (err * scaler->p[n] * bank->p[n]) + iAccumulator / 1000.0f + dterm;
+
+        bank->iAccumulator[n] = update ? iAccumulator : bank->iAccumulator[n];
+        bank->lastErr[n]      = update ? derr : bank->lastErr[n];
+        bank->lastDer[n]      = (update & dEnabled) ? dterm : bank->lastDer[n];
+        output[n] = update ? out : output[n];
+    }
+}
+
+/**
+ * Reset all loops of a pid bank
+ * @param[in] bank The pid bank to reset
+ */
+void pid_bank_zero(struct pid_bank *bank)
+{
+    if (!bank) {
+        return;
+    }
+
+    for (int n = 0; n < PID_BANK_LOOPS; n++) {
+        bank->iAccumulator[n] = 0;
+        bank->lastErr[n] = 0;
+        bank->lastDer[n] = 0;
+    }
+}
+
+/**
+ * Configure the settings of one loop of a pid bank
+ * @param[out] bank The PID bank to configure
+ * @param[in] loop The loop within the bank
+ * @param[in] p The proportional term
+ * @param[in] i The integral term
+ * @param[in] d The derivative term
+ */
+void pid_bank_configure(struct pid_bank *bank, uint8_t loop, float p, float i, float d, float iLim)
+{
+    if (!bank || loop >= PID_BANK_LOOPS) {
+        return;
+    }
+
+    bank->p[loop]    = p;
+    bank->i[loop]    = i;
+    bank->d[loop]    = d;
+    bank->iLim[loop] = iLim;
+}
+
 
 /**
  * Configure the settings for a pid2 structure
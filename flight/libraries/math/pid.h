@@ -64,6 +64,26 @@ typedef struct pid_scaler_s {
     float d;
 } pid_scaler;
 
+// ! Number of loops in a pid_bank, roll, pitch and yaw
+#define PID_BANK_LOOPS 3
+
+// pid_bank structure, the pid state of several loops stored as arrays so all loops are updated in one pass
+struct pid_bank {
+    float p[PID_BANK_LOOPS];
+    float i[PID_BANK_LOOPS];
+    float d[PID_BANK_LOOPS];
+    float iLim[PID_BANK_LOOPS];
+    float iAccumulator[PID_BANK_LOOPS];
+    float lastErr[PID_BANK_LOOPS];
+    float lastDer[PID_BANK_LOOPS];
+};
+
+typedef struct pid_bank_scaler_s {
+    float p[PID_BANK_LOOPS];
+    float i[PID_BANK_LOOPS];
+    float d[PID_BANK_LOOPS];
+} pid_bank_scaler;
+
 // ! Methods to use the pid structures
 float pid_apply(struct pid *pid, const float err, float dT);
 float pid_apply_setpoint(struct pid *pid, const pid_scaler *scaler, const float setpoint, const float measured, float dT, bool meas_based_d_term);
@@ -71,6 +91,11 @@ void pid_zero(struct pid *pid);
 void pid_configure(struct pid *pid, float p, float i, float d, float iLim);
 void pid_configure_derivative(float cutoff, float gamma);
 
+// Methods for use with pid_bank structure
+void pid_bank_apply_setpoint(struct pid_bank *bank, const pid_bank_scaler *scaler, const float *setpoint, const float *measured, float *output, uint8_t active, float dT, bool meas_based_d_term);
+void pid_bank_zero(struct pid_bank *bank);
+void pid_bank_configure(struct pid_bank *bank, uint8_t loop, float p, float i, float d, float iLim);
+
 // Methods for use with pid2 structure
 void pid2_configure(struct pid2 *pid, float kp, float ki, float kd, float Tf, float kt, float dT, float beta, float u0, float va, float vb);
 void pid2_transfer(struct pid2 *pid, float u0);
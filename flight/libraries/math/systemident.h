@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilot Math Utilities
+ * @{
+ * @addtogroup System identification
+ * @{
+ *
+ * @file       systemident.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016-2017.
+ *             dRonin, http://dRonin.org/, Copyright (C) 2015-2016
+ *             Tau Labs, http://taulabs.org, Copyright (C) 2013-2014
+ * @brief      System identification EKF and the PIDs derived from it, used by AutoTune
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SYSTEMIDENT_H
+#define SYSTEMIDENT_H
+
+#include <stdint.h>
+
+// ! Size of the state and of the (sparse) covariance of the system identification EKF
+#define SYSTEMIDENT_NUMX                       13
+#define SYSTEMIDENT_NUMP                       43
+
+// systemident_check() error bits
+#define SYSTEMIDENT_TAU_NAN                    1
+#define SYSTEMIDENT_BETA_NAN                   2
+#define SYSTEMIDENT_ROLL_BETA_LOW              4
+#define SYSTEMIDENT_PITCH_BETA_LOW             8
+#define SYSTEMIDENT_YAW_BETA_LOW               16
+#define SYSTEMIDENT_TAU_TOO_LONG               32
+#define SYSTEMIDENT_TAU_TOO_SHORT              64
+#define SYSTEMIDENT_CPU_TOO_SLOW               128
+
+// Yaw options of systemident_compute_pids(), same order as SystemIdentSettings.CalculateYaw
+#define SYSTEMIDENT_CALCULATEYAW_FALSE         0
+#define SYSTEMIDENT_CALCULATEYAW_LIMITTORATIO  1
+#define SYSTEMIDENT_CALCULATEYAW_IGNORELIMIT   2
+
+// systemident structure, the EKF state and what is measured along with it
+// X: roll, pitch and yaw rate, scaled torque, ln(gain) (beta), ln(time constant) (tau), torque bias
+struct systemident {
+    float    X[SYSTEMIDENT_NUMX];
+    float    P[SYSTEMIDENT_NUMP];
+    float    noise[3];            // gyro variance around the predicted rates
+    uint32_t predicts;            // number of samples processed
+    uint32_t throttleAccumulator; // sum of the throttle of all samples, times 10000
+};
+
+// Settings that turn the identified system into PIDs, the fields of SystemIdentSettings
+// and of the destination stabilization bank with the same names
+struct systemident_pid_settings {
+    float    smoothQuickValue; // -1 smoothest to +1 quickest
+    uint8_t  dampMin;
+    uint8_t  dampRate;
+    uint8_t  dampMax;
+    uint8_t  noiseMin;
+    uint8_t  noiseRate;
+    uint8_t  noiseMax;
+    uint8_t  calculateYaw;
+    float    yawToRollPitchPIDRatioMin;
+    float    yawToRollPitchPIDRatioMax;
+    float    derivativeFactor;
+    float    outerLoopKpSoftClamp;
+    float    gyroReadTimeAverage;
+    uint16_t maximumRate[2]; // roll, pitch
+};
+
+// PIDs computed by systemident_compute_pids()
+struct systemident_pids {
+    float rate[3][3]; // Kp, Ki, Kd of the roll, pitch and yaw rate loops
+    float outer[2];   // Kp, Ki of the roll and pitch attitude loops
+};
+
+// Methods for use with systemident structure
+void systemident_init(struct systemident *si, const float beta[3], float tau);
+void systemident_predict(struct systemident *si, const float u_in[3], const float gyro[3], float throttle, float dT_s);
+float systemident_hover_throttle(const struct systemident *si);
+
+// Checks and PIDs from the identified ln(time constant) tau and ln(gains) beta
+uint8_t systemident_check(float tau, const float beta[3], float gyroReadTimeAverage, float sensorRate);
+int systemident_compute_pids(float tau_ln, const float beta_ln[3], const struct systemident_pid_settings *settings, struct systemident_pids *pids);
+
+#endif /* SYSTEMIDENT_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -36,10 +36,17 @@
 #include "paths.h"
 // no direct UAVObject usage allowed in this file
 
+// private types
+enum path_segment_type {
+    PATH_SEGMENT_ENDPOINT = 0,
+    PATH_SEGMENT_VECTOR,
+    PATH_SEGMENT_CIRCLE,
+};
+
 // private functions
-static void path_endpoint(PathDesiredData *path, float *cur_point, struct path_status *status, bool mode);
-static void path_vector(PathDesiredData *path, float *cur_point, struct path_status *status, bool mode);
-static void path_circle(PathDesiredData *path, float *cur_point, struct path_status *status, bool clockwise);
+static void path_endpoint(const struct path_segment *segment, float *cur_point, struct path_status *status, bool mode3D);
+static void path_vector(const struct path_segment *segment, float *cur_point, struct path_status *status);
+static void path_circle(const struct path_segment *segment, float *cur_point, struct path_status *status);
 
 /**
  * @brief Compute progress along path and deviation from it
@@ -48,59 +55,108 @@ static void path_circle(PathDesiredData *path, float *cur_point, struct path_sta
  * @param[out] status Structure containing progress along path and deviation
  */
 void path_progress(PathDesiredData *path, float *cur_point, struct path_status *status, bool mode3D)
+{
+    struct path_segment segment;
+
+    path_segment_init(&segment, path, mode3D);
+    path_segment_progress(&segment, cur_point, status);
+}
+
+/**
+ * @brief Precompute the geometry of a path, to be done again whenever PathDesired changes
+ * @param[out] segment Path segment
+ * @param[in] path PathDesired structure
+ * @param[in] mode3D set true to include altitude in distance and progress calculation
+ */
+void path_segment_init(struct path_segment *segment, PathDesiredData *path, bool mode3D)
 {
     switch (path->Mode) {
     case PATHDESIRED_MODE_BRAKE:
     case PATHDESIRED_MODE_FOLLOWVECTOR:
-        return path_vector(path, cur_point, status, mode3D);
-
+        segment->type = PATH_SEGMENT_VECTOR;
         break;
     case PATHDESIRED_MODE_CIRCLERIGHT:
-        return path_circle(path, cur_point, status, true);
-
-        break;
     case PATHDESIRED_MODE_CIRCLELEFT:
-        return path_circle(path, cur_point, status, false);
-
+        segment->type = PATH_SEGMENT_CIRCLE;
         break;
     case PATHDESIRED_MODE_GOTOENDPOINT:
     case PATHDESIRED_MODE_AUTOTAKEOFF: // needed for pos hold at end of takeoff
-        return path_endpoint(path, cur_point, status, mode3D);
-
+        segment->type = PATH_SEGMENT_ENDPOINT;
         break;
     case PATHDESIRED_MODE_LAND:
     default:
         // use the endpoint as default failsafe if called in unknown modes
-        return path_endpoint(path, cur_point, status, false);
+        segment->type = PATH_SEGMENT_ENDPOINT;
+        mode3D = false;
+        break;
+    }
+    segment->mode3D    = mode3D;
+    segment->clockwise = (path->Mode == PATHDESIRED_MODE_CIRCLERIGHT);
+
+    segment->start[0]  = path->Start.North;
+    segment->start[1]  = path->Start.East;
+    segment->start[2]  = path->Start.Down;
+    segment->end[0]    = path->End.North;
+    segment->end[1]    = path->End.East;
+    segment->end[2]    = path->End.Down;
+    segment->starting_velocity = path->StartingVelocity;
+    segment->ending_velocity   = path->EndingVelocity;
 
+    // Distance to go
+    segment->path_vector[0] = path->End.North - path->Start.North;
+    segment->path_vector[1] = path->End.East - path->Start.East;
+    segment->path_vector[2] = mode3D ? path->End.Down - path->Start.Down : 0.0f;
+    segment->dist_path = vector_lengthf(segment->path_vector, 3);
+
+    // Circle radius and the direction of the start point seen from the center
+    segment->radius    = sqrtf(squaref(segment->path_vector[0]) + squaref(segment->path_vector[1]));
+    segment->a_radius  = atan2f(segment->path_vector[0], segment->path_vector[1]);
+    if (segment->a_radius < 0) {
+        segment->a_radius += 2.0f * M_PI_F;
+    }
+}
+
+/**
+ * @brief Compute progress along a precomputed path segment and deviation from it
+ * @param[in] segment Path segment
+ * @param[in] cur_point Current location
+ * @param[out] status Structure containing progress along path and deviation
+ */
+void path_segment_progress(const struct path_segment *segment, float *cur_point, struct path_status *status)
+{
+    switch (segment->type) {
+    case PATH_SEGMENT_VECTOR:
+        path_vector(segment, cur_point, status);
+        break;
+    case PATH_SEGMENT_CIRCLE:
+        path_circle(segment, cur_point, status);
+        break;
+    case PATH_SEGMENT_ENDPOINT:
+    default:
+        path_endpoint(segment, cur_point, status, segment->mode3D);
         break;
     }
 }
 
 /**
  * @brief Compute progress towards endpoint. Deviation equals distance
- * @param[in] path PathDesired
+ * @param[in] segment Path segment
  * @param[in] cur_point Current location
  * @param[out] status Structure containing progress along path and deviation
  * @param[in] mode3D set true to include altitude in distance and progress calculation
  */
-static void path_endpoint(PathDesiredData *path, float *cur_point, struct path_status *status, bool mode3D)
+static void path_endpoint(const struct path_segment *segment, float *cur_point, struct path_status *status, bool mode3D)
 {
     float diff[3];
     float dist_path, dist_diff;
 
-    // Distance to go
-    status->path_vector[0] = path->End.North - path->Start.North;
-    status->path_vector[1] = path->End.East - path->Start.East;
-    status->path_vector[2] = mode3D ? path->End.Down - path->Start.Down : 0.0f;
-
     // Current progress location relative to end
-    diff[0]   = path->End.North - cur_point[0];
-    diff[1]   = path->End.East - cur_point[1];
-    diff[2]   = mode3D ? path->End.Down - cur_point[2] : 0.0f;
+    diff[0]   = segment->end[0] - cur_point[0];
+    diff[1]   = segment->end[1] - cur_point[1];
+    diff[2]   = mode3D ? segment->end[2] - cur_point[2] : 0.0f;
 
     dist_diff = vector_lengthf(diff, 3);
-    dist_path = vector_lengthf(status->path_vector, 3);
+    dist_path = segment->dist_path;
 
     if (dist_diff < 1e-6f) {
         status->fractional_progress  = 1;
@@ -125,19 +181,18 @@ static void path_endpoint(PathDesiredData *path, float *cur_point, struct path_s
     status->correction_vector[2] = diff[2];
 
     // base movement direction in this mode is a constant velocity offset on top of correction in the same direction
-    status->path_vector[0] = path->EndingVelocity * status->correction_vector[0] / dist_diff;
-    status->path_vector[1] = path->EndingVelocity * status->correction_vector[1] / dist_diff;
-    status->path_vector[2] = path->EndingVelocity * status->correction_vector[2] / dist_diff;
+    status->path_vector[0] = segment->ending_velocity * status->correction_vector[0] / dist_diff;
+    status->path_vector[1] = segment->ending_velocity * status->correction_vector[1] / dist_diff;
+    status->path_vector[2] = segment->ending_velocity * status->correction_vector[2] / dist_diff;
 }
 
 /**
  * @brief Compute progress along path and deviation from it
- * @param[in] path PathDesired
+ * @param[in] segment Path segment
  * @param[in] cur_point Current location
  * @param[out] status Structure containing progress along path and deviation
- * @param[in] mode3D set true to include altitude in distance and progress calculation
  */
-static void path_vector(PathDesiredData *path, float *cur_point, struct path_status *status, bool mode3D)
+static void path_vector(const struct path_segment *segment, float *cur_point, struct path_status *status)
 {
     float diff[3];
     float dist_path;
@@ -145,33 +200,29 @@ static void path_vector(PathDesiredData *path, float *cur_point, struct path_sta
     float velocity;
     float track_point[3];
 
-    // Distance to go
-    status->path_vector[0] = path->End.North - path->Start.North;
-    status->path_vector[1] = path->End.East - path->Start.East;
-    status->path_vector[2] = mode3D ? path->End.Down - path->Start.Down : 0.0f;
-
-    // Current progress location relative to start
-    diff[0]   = cur_point[0] - path->Start.North;
-    diff[1]   = cur_point[1] - path->Start.East;
-    diff[2]   = mode3D ? cur_point[2] - path->Start.Down : 0.0f;
-
-    dot       = status->path_vector[0] * diff[0] + status->path_vector[1] * diff[1] + status->path_vector[2] * diff[2];
-    dist_path = vector_lengthf(status->path_vector, 3);
-
-    if (dist_path > 1e-6f) {
-        // Compute direction to travel & progress
-        status->fractional_progress = dot / (dist_path * dist_path);
-    } else {
+    dist_path = segment->dist_path;
+    if (!(dist_path > 1e-6f)) {
         // Fly towards the endpoint to prevent flying away,
         // but assume progress=1 either way.
-        path_endpoint(path, cur_point, status, mode3D);
+        path_endpoint(segment, cur_point, status, segment->mode3D);
         status->fractional_progress = 1;
         return;
     }
+
+    // Current progress location relative to start
+    diff[0] = cur_point[0] - segment->start[0];
+    diff[1] = cur_point[1] - segment->start[1];
+    diff[2] = segment->mode3D ? cur_point[2] - segment->start[2] : 0.0f;
+
+    dot     = segment->path_vector[0] * diff[0] + segment->path_vector[1] * diff[1] + segment->path_vector[2] * diff[2];
+
+    // Compute direction to travel & progress
+    status->fractional_progress = dot / (dist_path * dist_path);
+
     // Compute point on track that is closest to our current position.
-    track_point[0] = status->fractional_progress * status->path_vector[0] + path->Start.North;
-    track_point[1] = status->fractional_progress * status->path_vector[1] + path->Start.East;
-    track_point[2] = status->fractional_progress * status->path_vector[2] + path->Start.Down;
+    track_point[0] = status->fractional_progress * segment->path_vector[0] + segment->start[0];
+    track_point[1] = status->fractional_progress * segment->path_vector[1] + segment->start[1];
+    track_point[2] = status->fractional_progress * segment->path_vector[2] + segment->start[2];
 
     status->correction_vector[0] = track_point[0] - cur_point[0];
     status->correction_vector[1] = track_point[1] - cur_point[1];
@@ -180,53 +231,48 @@ static void path_vector(PathDesiredData *path, float *cur_point, struct path_sta
     status->error = vector_lengthf(status->correction_vector, 3);
 
     // correct movement vector to current velocity
-    velocity = path->StartingVelocity + boundf(status->fractional_progress, 0.0f, 1.0f) * (path->EndingVelocity - path->StartingVelocity);
-    status->path_vector[0] = velocity * status->path_vector[0] / dist_path;
-    status->path_vector[1] = velocity * status->path_vector[1] / dist_path;
-    status->path_vector[2] = velocity * status->path_vector[2] / dist_path;
+    velocity = segment->starting_velocity + boundf(status->fractional_progress, 0.0f, 1.0f) * (segment->ending_velocity - segment->starting_velocity);
+    status->path_vector[0] = velocity * segment->path_vector[0] / dist_path;
+    status->path_vector[1] = velocity * segment->path_vector[1] / dist_path;
+    status->path_vector[2] = velocity * segment->path_vector[2] / dist_path;
 }
 
 /**
  * @brief Compute progress along circular path and deviation from it
- * @param[in] path PathDesired
+ * @param[in] segment Path segment
  * @param[in] cur_point Current location
  * @param[out] status Structure containing progress along path and deviation
  */
-static void path_circle(PathDesiredData *path, float *cur_point, struct path_status *status, bool clockwise)
+static void path_circle(const struct path_segment *segment, float *cur_point, struct path_status *status)
 {
-    float radius_north, radius_east, diff_north, diff_east, diff_down;
-    float radius, cradius;
+    float diff_north, diff_east, diff_down;
+    float cradius;
     float normal[2];
     float progress;
-    float a_diff, a_radius;
-
-    // Radius
-    radius_north = path->End.North - path->Start.North;
-    radius_east  = path->End.East - path->Start.East;
+    float a_diff;
 
     // Current location relative to center
-    diff_north   = cur_point[0] - path->End.North;
-    diff_east    = cur_point[1] - path->End.East;
-    diff_down    = cur_point[2] - path->End.Down;
+    diff_north = cur_point[0] - segment->end[0];
+    diff_east  = cur_point[1] - segment->end[1];
+    diff_down  = cur_point[2] - segment->end[2];
 
-    radius  = sqrtf(squaref(radius_north) + squaref(radius_east));
-    cradius = sqrtf(squaref(diff_north) + squaref(diff_east));
+    cradius    = sqrtf(squaref(diff_north) + squaref(diff_east));
 
     // circles are always horizontal (for now - TODO: allow 3d circles - problem: clockwise/counterclockwise does no longer apply)
     status->path_vector[2] = 0.0f;
 
     // error is current radius minus wanted radius - positive if too close
-    status->error = radius - cradius;
+    status->error = segment->radius - cradius;
 
     if (cradius < 1e-6f) {
         // cradius is zero, just fly somewhere
         status->fractional_progress  = 1;
         status->correction_vector[0] = 0;
         status->correction_vector[1] = 0;
-        status->path_vector[0] = path->EndingVelocity;
+        status->path_vector[0] = segment->ending_velocity;
         status->path_vector[1] = 0;
     } else {
-        if (clockwise) {
+        if (segment->clockwise) {
             // Compute the normal to the radius clockwise
             normal[0] = -diff_east / cradius;
             normal[1] = diff_north / cradius;
@@ -237,17 +283,13 @@ static void path_circle(PathDesiredData *path, float *cur_point, struct path_sta
         }
 
         // normalize progress to 0..1
-        a_diff   = atan2f(diff_north, diff_east);
-        a_radius = atan2f(radius_north, radius_east);
+        a_diff = atan2f(diff_north, diff_east);
 
         if (a_diff < 0) {
             a_diff += 2.0f * M_PI_F;
         }
-        if (a_radius < 0) {
-            a_radius += 2.0f * M_PI_F;
-        }
 
-        progress = (a_diff - a_radius + M_PI_F) / (2.0f * M_PI_F);
+        progress = (a_diff - segment->a_radius + M_PI_F) / (2.0f * M_PI_F);
 
         if (progress < 0.0f) {
             progress += 1.0f;
@@ -255,15 +297,15 @@ static void path_circle(PathDesiredData *path, float *cur_point, struct path_sta
             progress -= 1.0f;
         }
 
-        if (clockwise) {
+        if (segment->clockwise) {
             progress = 1.0f - progress;
         }
 
         status->fractional_progress = progress;
 
         // Compute direction to travel
-        status->path_vector[0] = normal[0] * path->EndingVelocity;
-        status->path_vector[1] = normal[1] * path->EndingVelocity;
+        status->path_vector[0] = normal[0] * segment->ending_velocity;
+        status->path_vector[1] = normal[1] * segment->ending_velocity;
 
         // Compute direction to correct error
         status->correction_vector[0] = status->error * diff_north / cradius;
@@ -65,6 +65,14 @@ extern int pBytes[MAXDEG];
 /* Decoder syndrome bytes */
 extern int synBytes[MAXDEG];
 
+/* generator polynomial */
+extern int genPoly[MAXDEG*2];
+
+#if RS_ECC_NPARITY == 4
+/* generator polynomial multiplication table of the encoder */
+extern const uint32_t genPolyMult[256];
+#endif
+
 /* print debugging info */
 //extern int DEBUG;
 
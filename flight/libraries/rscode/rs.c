@@ -38,6 +38,53 @@ int synBytes[MAXDEG];
 /* generator polynomial */
 int genPoly[MAXDEG*2];
 
+#if RS_ECC_NPARITY == 4
+/* The products genPoly[j] * d for every byte d, packed with j = 3 in the
+ * most significant byte, so that one lookup per message byte advances the
+ * whole encoder LFSR held in a 32 bit word.  The table is for the
+ * generator of the 4 byte code over the field of galois.c,
+ * (x + a^1)(x + a^2)(x + a^3)(x + a^4) = x^4 + 30x^3 + 216x^2 + 231x + 116,
+ * and is checked against gmult() by the unit test.
+ */
+const uint32_t genPolyMult[256] = {
+	0x00000000, 0x1ed8e774, 0x3cadd3e8, 0x2275349c, 0x7847bbcd, 0x669f5cb9, 0x44ea6825, 0x5a328f51,
+	0xf08e6b87, 0xee568cf3, 0xcc23b86f, 0xd2fb5f1b, 0x88c9d04a, 0x9611373e, 0xb46403a2, 0xaabce4d6,
+	0xfd01d613, 0xe3d93167, 0xc1ac05fb, 0xdf74e28f, 0x85466dde, 0x9b9e8aaa, 0xb9ebbe36, 0xa7335942,
+	0x0d8fbd94, 0x13575ae0, 0x31226e7c, 0x2ffa8908, 0x75c80659, 0x6b10e12d, 0x4965d5b1, 0x57bd32c5,
+	0xe702b126, 0xf9da5652, 0xdbaf62ce, 0xc57785ba, 0x9f450aeb, 0x819ded9f, 0xa3e8d903, 0xbd303e77,
+	0x178cdaa1, 0x09543dd5, 0x2b210949, 0x35f9ee3d, 0x6fcb616c, 0x71138618, 0x5366b284, 0x4dbe55f0,
+	0x1a036735, 0x04db8041, 0x26aeb4dd, 0x387653a9, 0x6244dcf8, 0x7c9c3b8c, 0x5ee90f10, 0x4031e864,
+	0xea8d0cb2, 0xf455ebc6, 0xd620df5a, 0xc8f8382e, 0x92cab77f, 0x8c12500b, 0xae676497, 0xb0bf83e3,
+	0xd3047f4c, 0xcddc9838, 0xefa9aca4, 0xf1714bd0, 0xab43c481, 0xb59b23f5, 0x97ee1769, 0x8936f01d,
+	0x238a14cb, 0x3d52f3bf, 0x1f27c723, 0x01ff2057, 0x5bcdaf06, 0x45154872, 0x67607cee, 0x79b89b9a,
+	0x2e05a95f, 0x30dd4e2b, 0x12a87ab7, 0x0c709dc3, 0x56421292, 0x489af5e6, 0x6aefc17a, 0x7437260e,
+	0xde8bc2d8, 0xc05325ac, 0xe2261130, 0xfcfef644, 0xa6cc7915, 0xb8149e61, 0x9a61aafd, 0x84b94d89,
+	0x3406ce6a, 0x2ade291e, 0x08ab1d82, 0x1673faf6, 0x4c4175a7, 0x529992d3, 0x70eca64f, 0x6e34413b,
+	0xc488a5ed, 0xda504299, 0xf8257605, 0xe6fd9171, 0xbccf1e20, 0xa217f954, 0x8062cdc8, 0x9eba2abc,
+	0xc9071879, 0xd7dfff0d, 0xf5aacb91, 0xeb722ce5, 0xb140a3b4, 0xaf9844c0, 0x8ded705c, 0x93359728,
+	0x398973fe, 0x2751948a, 0x0524a016, 0x1bfc4762, 0x41cec833, 0x5f162f47, 0x7d631bdb, 0x63bbfcaf,
+	0xbb08fe98, 0xa5d019ec, 0x87a52d70, 0x997dca04, 0xc34f4555, 0xdd97a221, 0xffe296bd, 0xe13a71c9,
+	0x4b86951f, 0x555e726b, 0x772b46f7, 0x69f3a183, 0x33c12ed2, 0x2d19c9a6, 0x0f6cfd3a, 0x11b41a4e,
+	0x4609288b, 0x58d1cfff, 0x7aa4fb63, 0x647c1c17, 0x3e4e9346, 0x20967432, 0x02e340ae, 0x1c3ba7da,
+	0xb687430c, 0xa85fa478, 0x8a2a90e4, 0x94f27790, 0xcec0f8c1, 0xd0181fb5, 0xf26d2b29, 0xecb5cc5d,
+	0x5c0a4fbe, 0x42d2a8ca, 0x60a79c56, 0x7e7f7b22, 0x244df473, 0x3a951307, 0x18e0279b, 0x0638c0ef,
+	0xac842439, 0xb25cc34d, 0x9029f7d1, 0x8ef110a5, 0xd4c39ff4, 0xca1b7880, 0xe86e4c1c, 0xf6b6ab68,
+	0xa10b99ad, 0xbfd37ed9, 0x9da64a45, 0x837ead31, 0xd94c2260, 0xc794c514, 0xe5e1f188, 0xfb3916fc,
+	0x5185f22a, 0x4f5d155e, 0x6d2821c2, 0x73f0c6b6, 0x29c249e7, 0x371aae93, 0x156f9a0f, 0x0bb77d7b,
+	0x680c81d4, 0x76d466a0, 0x54a1523c, 0x4a79b548, 0x104b3a19, 0x0e93dd6d, 0x2ce6e9f1, 0x323e0e85,
+	0x9882ea53, 0x865a0d27, 0xa42f39bb, 0xbaf7decf, 0xe0c5519e, 0xfe1db6ea, 0xdc688276, 0xc2b06502,
+	0x950d57c7, 0x8bd5b0b3, 0xa9a0842f, 0xb778635b, 0xed4aec0a, 0xf3920b7e, 0xd1e73fe2, 0xcf3fd896,
+	0x65833c40, 0x7b5bdb34, 0x592eefa8, 0x47f608dc, 0x1dc4878d, 0x031c60f9, 0x21695465, 0x3fb1b311,
+	0x8f0e30f2, 0x91d6d786, 0xb3a3e31a, 0xad7b046e, 0xf7498b3f, 0xe9916c4b, 0xcbe458d7, 0xd53cbfa3,
+	0x7f805b75, 0x6158bc01, 0x432d889d, 0x5df56fe9, 0x07c7e0b8, 0x191f07cc, 0x3b6a3350, 0x25b2d424,
+	0x720fe6e1, 0x6cd70195, 0x4ea23509, 0x507ad27d, 0x0a485d2c, 0x1490ba58, 0x36e58ec4, 0x283d69b0,
+	0x82818d66, 0x9c596a12, 0xbe2c5e8e, 0xa0f4b9fa, 0xfac636ab, 0xe41ed1df, 0xc66be543, 0xd8b30237,
+};
+
+static uint32_t
+lfsr_remainder (unsigned char data[], int nbytes);
+#endif
+
 //int DEBUG = FALSE;
 
 static void
@@ -93,7 +140,8 @@ build_codeword (unsigned char msg[], int nbytes, unsigned char dst[])
 {
   int i;
 	
-  for (i = 0; i < nbytes; i++) dst[i] = msg[i];
+  if (dst != msg)
+    for (i = 0; i < nbytes; i++) dst[i] = msg[i];
 	
   for (i = 0; i < RS_ECC_NPARITY; i++) {
     dst[i+nbytes] = pBytes[RS_ECC_NPARITY-1-i];
@@ -111,10 +159,23 @@ void
 decode_data(unsigned char data[], int nbytes)
 {
   int i, j, sum;
+
+#if RS_ECC_NPARITY == 4
+  /* A codeword without errors is a multiple of the generator polynomial,
+   * all its syndromes are zero.  That is much cheaper to find out with the
+   * encoder LFSR than by evaluating the syndromes, and it is the common case.
+   */
+  if (lfsr_remainder(data, nbytes) == 0) {
+    for (j = 0; j < RS_ECC_NPARITY; j++) synBytes[j] = 0;
+    return;
+  }
+#endif
+
   for (j = 0; j < RS_ECC_NPARITY;  j++) {
     sum	= 0;
     for (i = 0; i < nbytes; i++) {
-      sum = data[i] ^ gmult(gexp[j+1], sum);
+      /* sum = data[i] ^ gmult(gexp[j+1], sum) */
+      sum = data[i] ^ (sum ? gexp[glog[sum] + j + 1] : 0);
     }
     synBytes[j]  = sum;
   }
@@ -184,6 +245,35 @@ compute_genpoly (int nbytes, int genpoly[])
  * 
  */
 
+#if RS_ECC_NPARITY == 4
+/* The LFSR of the encoder with the register bytes packed into a word,
+ * LFSR[3] in the most significant byte.  Returns the register after
+ * shifting in nbytes of data.
+ */
+static uint32_t
+lfsr_remainder (unsigned char data[], int nbytes)
+{
+  uint32_t lfsr = 0;
+  int i;
+
+  for (i = 0; i < nbytes; i++) {
+    lfsr = (lfsr << 8) ^ genPolyMult[data[i] ^ (lfsr >> 24)];
+  }
+  return lfsr;
+}
+
+void
+encode_data (unsigned char msg[], int nbytes, unsigned char dst[])
+{
+  uint32_t lfsr = lfsr_remainder(msg, nbytes);
+  int i;
+
+  for (i = 0; i < RS_ECC_NPARITY; i++)
+    pBytes[i] = (lfsr >> (8 * i)) & 0xff;
+
+  build_codeword(msg, nbytes, dst);
+}
+#else
 void
 encode_data (unsigned char msg[], int nbytes, unsigned char dst[])
 {
@@ -205,3 +295,4 @@ encode_data (unsigned char msg[], int nbytes, unsigned char dst[])
   build_codeword(msg, nbytes, dst);
 }
 
+#endif /* RS_ECC_NPARITY == 4 */
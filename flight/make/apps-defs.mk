@@ -115,6 +115,9 @@ SRC += $(MATHLIB)/sin_lookup.c
 SRC += $(MATHLIB)/pid.c
 CPPSRC += $(PIDLIB)/pidcontroldown.cpp
 
+## System identification for AutoTune
+SRC += $(MATHLIB)/systemident.c
+
 ## PIOS Hardware (Common)
 SRC += $(PIOSCOMMON)/pios_debuglog.c
 endif
@@ -145,6 +148,7 @@ SRC += $(FLIGHTLIB)/fifo_buffer.c
 
 SRC += $(MATHLIB)/mathmisc.c
 SRC += $(MATHLIB)/butterworth.c
+SRC += $(MATHLIB)/biquad.c
 SRC += $(FLIGHTLIB)/printf-stdarg.c
 SRC += $(FLIGHTLIB)/optypes.c
 
@@ -73,6 +73,11 @@ ifeq ($(ENABLE_AUX_UART), YES)
     CDEFS += -DPIOS_ENABLE_AUX_UART
 endif
 
+# Approximate atan2, asin and inverse square root in the attitude code, see fastmath.h
+ifeq ($(ENABLE_FASTMATH), YES)
+    CDEFS += -DUSE_FASTMATH
+endif
+
 # The following Makefile command, ifneq (,$(filter) $(A), $(B) $(C))
 #    is equivalent to the pseudocode `if (A == B || A == C)`
 ifneq (,$(filter YES,$(DIAG_STACK) $(DIAG_ALL)))
@@ -61,6 +61,9 @@ CPPFLAGS += -DUNIT_TEST
 # Common compiler flags
 CFLAGS += -O0 -g
 CFLAGS += -Wall -Werror
+
+# Helpers shared by the test suites
+EXTRAINCDIRS += $(FLIGHT_ROOT_DIR)/tests/common
 CFLAGS += $(patsubst %,-I%,$(EXTRAINCDIRS))
 
 # Google Test needs the pthread library
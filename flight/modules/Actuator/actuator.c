@@ -80,8 +80,31 @@ static int8_t counter;
 #define ACTUATOR_ONESHOT42_PULSE_FACTOR  0.5f
 #define ACTUATOR_MULTISHOT_PULSE_FACTOR  0.24f
 #define ACTUATOR_PWM_CLOCK               1000000
+#define MIXER_CURVE_ELEMENTS             MIXERSETTINGS_THROTTLECURVE1_NUMELEM
+
+#if MIXERSETTINGS_THROTTLECURVE1_NUMELEM != MIXERSETTINGS_THROTTLECURVE2_NUMELEM
+#error "Compiled mixer curves assume both throttle curves have the same number of points"
+#endif
+
 // Private types
 
+// inputs of the compiled mixer matrix, roll is split by sign to apply the roll differential
+typedef enum {
+    MIXERINPUT_CURVE1 = 0,
+    MIXERINPUT_CURVE2,
+    MIXERINPUT_ROLLPOSITIVE,
+    MIXERINPUT_ROLLNEGATIVE,
+    MIXERINPUT_PITCH,
+    MIXERINPUT_YAW,
+    MIXERINPUT_NUMELEM
+} MixerInput_t;
+
+// throttle curve as value and slope per segment, a passthrough curve maps input to output
+typedef struct {
+    float value[MIXER_CURVE_ELEMENTS];
+    float slope[MIXER_CURVE_ELEMENTS];
+    bool  passthrough;
+} MixerCurve_t;
 
 // Private variables
 static xQueueHandle queue;
@@ -95,26 +118,39 @@ static uint8_t pinsMode[MAX_MIX_ACTUATORS];
 // used to inform the actuator thread that actuator update rate is changed
 static ActuatorSettingsData actuatorSettings;
 static bool spinWhileArmed;
+static portTickType lastSysTime;
+
+// set while the stabilization rate loop drives the outputs directly
+static volatile bool fastPathActive;
+static volatile uint32_t fastPathLastUpdate;
+// serializes actuatorUpdate() and the handover between the Actuator task and the fast path
+static xSemaphoreHandle updateLock;
 
 // used to inform the actuator thread that mixer settings are changed
 static MixerSettingsData mixerSettings;
 static int mixer_settings_count = 2;
 
+// mixer compiled from mixerSettings, rebuilt whenever mixer or frame settings change
+static float mixerMatrix[MAX_MIX_ACTUATORS][MIXERINPUT_NUMELEM];
+static MixerCurve_t throttleCurve1;
+static MixerCurve_t throttleCurve2;
+
 // Private functions
 static void actuatorTask(void *parameters);
+static void actuatorUpdate(const ActuatorDesiredData *desiredIn);
+static bool fastPathDriving(void);
 static int16_t scaleChannel(float value, int16_t max, int16_t min, int16_t neutral);
 static int16_t scaleMotor(float value, int16_t max, int16_t min, int16_t neutral, float maxMotor, float minMotor, bool armed, bool alwaysStabilizeWhenArmed, float throttleDesired);
 static void setFailsafe();
-static float MixerCurveFullRangeProportional(const float input, const float *curve, uint8_t elements, bool multirotor);
-static float MixerCurveFullRangeAbsolute(const float input, const float *curve, uint8_t elements, bool multirotor);
+static float MixerCurveFullRangeProportional(const float input, const MixerCurve_t *curve, bool multirotor);
+static float MixerCurveFullRangeAbsolute(const float input, const MixerCurve_t *curve, bool multirotor);
+static void compileMixer();
 static bool set_channel(uint8_t mixer_channel, uint16_t value);
 static void actuator_update_rate_if_changed(bool force_update);
 static void MixerSettingsUpdatedCb(UAVObjEvent *ev);
 static void ActuatorSettingsUpdatedCb(UAVObjEvent *ev);
 static void SettingsUpdatedCb(UAVObjEvent *ev);
-float ProcessMixer(const int index, const float curve1, const float curve2,
-                   ActuatorDesiredData *desired,
-                   bool multirotor, bool fixedwing);
+static float ProcessMixer(const int index, const float *inputs);
 
 // this structure is equivalent to the UAVObjects for one mixer.
 typedef struct {
@@ -156,6 +192,7 @@ int32_t ActuatorInitialize()
     ActuatorDesiredInitialize();
     queue = xQueueCreate(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
     ActuatorDesiredConnectQueue(queue);
+    updateLock = xSemaphoreCreateMutex();
 
     // Register AccessoryDesired (Secondary input to this module)
     AccessoryDesiredInitialize();
@@ -198,17 +235,7 @@ MODULE_INITCALL(ActuatorInitialize, ActuatorStart);
 static void actuatorTask(__attribute__((unused)) void *parameters)
 {
     UAVObjEvent ev;
-    portTickType lastSysTime;
-    portTickType thisSysTime;
-    uint32_t dTMilliseconds;
-
-    ActuatorCommandData command;
     ActuatorDesiredData desired;
-    MixerStatusData mixerStatus;
-    FlightModeSettingsData settings;
-    FlightStatusData flightStatus;
-    float throttleDesired;
-    float collectiveDesired;
 
 #ifdef PIOS_INCLUDE_INSTRUMENTATION
     counter = PIOS_Instrumentation_CreateCounter(0xAC700001);
@@ -219,6 +246,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
 
     /* Read initial values of MixerSettings */
     MixerSettingsGet(&mixerSettings);
+    compileMixer();
 
     /* Force an initial configuration of the actuator update rates */
     actuator_update_rate_if_changed(true);
@@ -235,375 +263,458 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
 
         // Wait until the ActuatorDesired object is updated
         uint8_t rc = xQueueReceive(queue, &ev, FAILSAFE_TIMEOUT_MS / portTICK_RATE_MS);
-#ifdef PIOS_INCLUDE_INSTRUMENTATION
-        PIOS_Instrumentation_TimeStart(counter);
-#endif
 
-        if (rc != pdTRUE) {
+        xSemaphoreTake(updateLock, portMAX_DELAY);
+        if (fastPathDriving()) {
+            // outputs are driven from the stabilization rate loop, only the failsafe timeout or an update
+            // queued before it took over gets here
+        } else if (rc != pdTRUE) {
             /* Update of ActuatorDesired timed out.  Go to failsafe */
             setFailsafe();
-            continue;
-        }
-
-        // Check how long since last update
-        thisSysTime    = xTaskGetTickCount();
-        dTMilliseconds = (thisSysTime == lastSysTime) ? 1 : (thisSysTime - lastSysTime) * portTICK_RATE_MS;
-        lastSysTime    = thisSysTime;
-
-        FlightStatusGet(&flightStatus);
-        FlightModeSettingsGet(&settings);
-        ActuatorDesiredGet(&desired);
-        ActuatorCommandGet(&command);
-
-        // read in throttle and collective -demultiplex thrust
-        switch (thrustType) {
-        case SYSTEMSETTINGS_THRUSTCONTROL_THROTTLE:
-            throttleDesired = desired.Thrust;
-            ManualControlCommandCollectiveGet(&collectiveDesired);
-            break;
-        case SYSTEMSETTINGS_THRUSTCONTROL_COLLECTIVE:
-            ManualControlCommandThrottleGet(&throttleDesired);
-            collectiveDesired = desired.Thrust;
-            break;
-        default:
-            ManualControlCommandThrottleGet(&throttleDesired);
-            ManualControlCommandCollectiveGet(&collectiveDesired);
+        } else {
+            ActuatorDesiredGet(&desired);
+            actuatorUpdate(&desired);
         }
+        xSemaphoreGive(updateLock);
+    }
+}
 
-        bool armed = flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED;
-        bool activeThrottle   = (throttleDesired < -0.001f || throttleDesired > 0.001f); // for ground and reversible motors
-        bool positiveThrottle = (throttleDesired > 0.00f);
-        bool multirotor  = (GetCurrentFrameType() == FRAME_TYPE_MULTIROTOR); // check if frame is a multirotor.
-        bool fixedwing   = (GetCurrentFrameType() == FRAME_TYPE_FIXED_WING); // check if frame is a fixedwing.
-        bool alwaysArmed = settings.Arming == FLIGHTMODESETTINGS_ARMING_ALWAYSARMED;
-        bool alwaysStabilizeWhenArmed = flightStatus.AlwaysStabilizeWhenArmed == FLIGHTSTATUS_ALWAYSSTABILIZEWHENARMED_TRUE;
-
-        if (alwaysArmed) {
-            alwaysStabilizeWhenArmed = false; // Do not allow always stabilize when alwaysArmed is active. This is dangerous.
-        }
-        // safety settings
-        if (!armed) {
-            throttleDesired = 0.00f; // this also happens in scaleMotors as a per axis check
-        }
+/**
+ * Mix one ActuatorDesired update and drive the outputs
+ */
+static void actuatorUpdate(const ActuatorDesiredData *desiredIn)
+{
+    portTickType thisSysTime;
+    uint32_t dTMilliseconds;
 
-        if ((frameType == FRAME_TYPE_GROUND && !activeThrottle) || (frameType != FRAME_TYPE_GROUND && throttleDesired <= 0.00f) || !armed) {
-            // throttleDesired should never be 0 or go below 0.
-            // force set all other controls to zero if throttle is cut (previously set in Stabilization)
-            // todo: can probably remove this
-            if (!(multirotor && alwaysStabilizeWhenArmed && armed)) { // we don't do this if this is a multirotor AND AlwaysStabilizeWhenArmed is true and the model is armed
-                if (actuatorSettings.LowThrottleZeroAxis.Roll == ACTUATORSETTINGS_LOWTHROTTLEZEROAXIS_TRUE) {
-                    desired.Roll = 0.00f;
-                }
-                if (actuatorSettings.LowThrottleZeroAxis.Pitch == ACTUATORSETTINGS_LOWTHROTTLEZEROAXIS_TRUE) {
-                    desired.Pitch = 0.00f;
-                }
-                if (actuatorSettings.LowThrottleZeroAxis.Yaw == ACTUATORSETTINGS_LOWTHROTTLEZEROAXIS_TRUE) {
-                    desired.Yaw = 0.00f;
-                }
-            }
-        }
+    ActuatorCommandData command;
+    ActuatorDesiredData desired = *desiredIn;
+    MixerStatusData mixerStatus;
+    FlightModeSettingsData settings;
+    FlightStatusData flightStatus;
+    float throttleDesired;
+    float collectiveDesired;
 
-#ifdef DIAG_MIXERSTATUS
-        MixerStatusGet(&mixerStatus);
+#ifdef PIOS_INCLUDE_INSTRUMENTATION
+    PIOS_Instrumentation_TimeStart(counter);
 #endif
 
-        if ((mixer_settings_count < 2) && !ActuatorCommandReadOnly()) { // Nothing can fly with less than two mixers.
-            setFailsafe();
-            continue;
-        }
-
-        AlarmsClear(SYSTEMALARMS_ALARM_ACTUATOR);
+    // Check how long since last update
+    thisSysTime    = xTaskGetTickCount();
+    dTMilliseconds = (thisSysTime == lastSysTime) ? 1 : (thisSysTime - lastSysTime) * portTICK_RATE_MS;
+    lastSysTime    = thisSysTime;
+
+    FlightStatusGet(&flightStatus);
+    FlightModeSettingsGet(&settings);
+    ActuatorCommandGet(&command);
+
+    // read in throttle and collective -demultiplex thrust
+    switch (thrustType) {
+    case SYSTEMSETTINGS_THRUSTCONTROL_THROTTLE:
+        throttleDesired = desired.Thrust;
+        ManualControlCommandCollectiveGet(&collectiveDesired);
+        break;
+    case SYSTEMSETTINGS_THRUSTCONTROL_COLLECTIVE:
+        ManualControlCommandThrottleGet(&throttleDesired);
+        collectiveDesired = desired.Thrust;
+        break;
+    default:
+        ManualControlCommandThrottleGet(&throttleDesired);
+        ManualControlCommandCollectiveGet(&collectiveDesired);
+    }
 
-        float curve1 = 0.0f; // curve 1 is the throttle curve applied to all motors.
-        float curve2 = 0.0f;
+    bool armed = flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED;
+    bool activeThrottle   = (throttleDesired < -0.001f || throttleDesired > 0.001f); // for ground and reversible motors
+    bool positiveThrottle = (throttleDesired > 0.00f);
+    bool multirotor  = (GetCurrentFrameType() == FRAME_TYPE_MULTIROTOR); // check if frame is a multirotor.
+    bool alwaysArmed = settings.Arming == FLIGHTMODESETTINGS_ARMING_ALWAYSARMED;
+    bool alwaysStabilizeWhenArmed = flightStatus.AlwaysStabilizeWhenArmed == FLIGHTSTATUS_ALWAYSSTABILIZEWHENARMED_TRUE;
 
-        // Interpolate curve 1 from throttleDesired as input.
-        // assume reversible motor/mixer initially. We can later reverse this. The difference is simply that -ve throttleDesired values
-        // map differently
-        curve1 = MixerCurveFullRangeProportional(throttleDesired, mixerSettings.ThrottleCurve1, MIXERSETTINGS_THROTTLECURVE1_NUMELEM, multirotor);
+    if (alwaysArmed) {
+        alwaysStabilizeWhenArmed = false; // Do not allow always stabilize when alwaysArmed is active. This is dangerous.
+    }
+    // safety settings
+    if (!armed) {
+        throttleDesired = 0.00f; // this also happens in scaleMotors as a per axis check
+    }
 
-        // The source for the secondary curve is selectable
-        AccessoryDesiredData accessory;
-        uint8_t curve2Source = mixerSettings.Curve2Source;
-        switch (curve2Source) {
-        case MIXERSETTINGS_CURVE2SOURCE_THROTTLE:
-            // assume reversible motor/mixer initially
-            curve2 = MixerCurveFullRangeProportional(throttleDesired, mixerSettings.ThrottleCurve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
-            break;
-        case MIXERSETTINGS_CURVE2SOURCE_ROLL:
-            // Throttle curve contribution the same for +ve vs -ve roll
-            if (multirotor) {
-                curve2 = MixerCurveFullRangeProportional(desired.Roll, mixerSettings.ThrottleCurve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
-            } else {
-                curve2 = MixerCurveFullRangeAbsolute(desired.Roll, mixerSettings.ThrottleCurve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
+    if ((frameType == FRAME_TYPE_GROUND && !activeThrottle) || (frameType != FRAME_TYPE_GROUND && throttleDesired <= 0.00f) || !armed) {
+        // throttleDesired should never be 0 or go below 0.
+        // force set all other controls to zero if throttle is cut (previously set in Stabilization)
+        // todo: can probably remove this
+        if (!(multirotor && alwaysStabilizeWhenArmed && armed)) { // we don't do this if this is a multirotor AND AlwaysStabilizeWhenArmed is true and the model is armed
+            if (actuatorSettings.LowThrottleZeroAxis.Roll == ACTUATORSETTINGS_LOWTHROTTLEZEROAXIS_TRUE) {
+                desired.Roll = 0.00f;
             }
-            break;
-        case MIXERSETTINGS_CURVE2SOURCE_PITCH:
-            // Throttle curve contribution the same for +ve vs -ve pitch
-            if (multirotor) {
-                curve2 = MixerCurveFullRangeProportional(desired.Pitch, mixerSettings.ThrottleCurve2,
-                                                         MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
-            } else {
-                curve2 = MixerCurveFullRangeAbsolute(desired.Pitch, mixerSettings.ThrottleCurve2,
-                                                     MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
+            if (actuatorSettings.LowThrottleZeroAxis.Pitch == ACTUATORSETTINGS_LOWTHROTTLEZEROAXIS_TRUE) {
+                desired.Pitch = 0.00f;
             }
-            break;
-        case MIXERSETTINGS_CURVE2SOURCE_YAW:
-            // Throttle curve contribution the same for +ve vs -ve yaw
-            if (multirotor) {
-                curve2 = MixerCurveFullRangeProportional(desired.Yaw, mixerSettings.ThrottleCurve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
-            } else {
-                curve2 = MixerCurveFullRangeAbsolute(desired.Yaw, mixerSettings.ThrottleCurve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
+            if (actuatorSettings.LowThrottleZeroAxis.Yaw == ACTUATORSETTINGS_LOWTHROTTLEZEROAXIS_TRUE) {
+                desired.Yaw = 0.00f;
             }
-            break;
-        case MIXERSETTINGS_CURVE2SOURCE_COLLECTIVE:
-            // assume reversible motor/mixer initially
-            curve2 = MixerCurveFullRangeProportional(collectiveDesired, mixerSettings.ThrottleCurve2,
-                                                     MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
-            break;
-        case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY0:
-        case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY1:
-        case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY2:
-        case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY3:
-        case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY4:
-        case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY5:
-            if (AccessoryDesiredInstGet(mixerSettings.Curve2Source - MIXERSETTINGS_CURVE2SOURCE_ACCESSORY0, &accessory) == 0) {
-                // Throttle curve contribution the same for +ve vs -ve accessory....maybe not want we want.
-                curve2 = MixerCurveFullRangeAbsolute(accessory.AccessoryVal, mixerSettings.ThrottleCurve2, MIXERSETTINGS_THROTTLECURVE2_NUMELEM, multirotor);
-            } else {
-                curve2 = 0.0f;
-            }
-            break;
-        default:
+        }
+    }
+
+#ifdef DIAG_MIXERSTATUS
+    MixerStatusGet(&mixerStatus);
+#endif
+
+    if ((mixer_settings_count < 2) && !ActuatorCommandReadOnly()) { // Nothing can fly with less than two mixers.
+        setFailsafe();
+        return;
+    }
+
+    AlarmsClear(SYSTEMALARMS_ALARM_ACTUATOR);
+
+    float curve1 = 0.0f; // curve 1 is the throttle curve applied to all motors.
+    float curve2 = 0.0f;
+
+    // Interpolate curve 1 from throttleDesired as input.
+    // assume reversible motor/mixer initially. We can later reverse this. The difference is simply that -ve throttleDesired values
+    // map differently
+    curve1 = MixerCurveFullRangeProportional(throttleDesired, &throttleCurve1, multirotor);
+
+    // The source for the secondary curve is selectable
+    AccessoryDesiredData accessory;
+    uint8_t curve2Source = mixerSettings.Curve2Source;
+    switch (curve2Source) {
+    case MIXERSETTINGS_CURVE2SOURCE_THROTTLE:
+        // assume reversible motor/mixer initially
+        curve2 = MixerCurveFullRangeProportional(throttleDesired, &throttleCurve2, multirotor);
+        break;
+    case MIXERSETTINGS_CURVE2SOURCE_ROLL:
+        // Throttle curve contribution the same for +ve vs -ve roll
+        if (multirotor) {
+            curve2 = MixerCurveFullRangeProportional(desired.Roll, &throttleCurve2, multirotor);
+        } else {
+            curve2 = MixerCurveFullRangeAbsolute(desired.Roll, &throttleCurve2, multirotor);
+        }
+        break;
+    case MIXERSETTINGS_CURVE2SOURCE_PITCH:
+        // Throttle curve contribution the same for +ve vs -ve pitch
+        if (multirotor) {
+            curve2 = MixerCurveFullRangeProportional(desired.Pitch, &throttleCurve2, multirotor);
+        } else {
+            curve2 = MixerCurveFullRangeAbsolute(desired.Pitch, &throttleCurve2, multirotor);
+        }
+        break;
+    case MIXERSETTINGS_CURVE2SOURCE_YAW:
+        // Throttle curve contribution the same for +ve vs -ve yaw
+        if (multirotor) {
+            curve2 = MixerCurveFullRangeProportional(desired.Yaw, &throttleCurve2, multirotor);
+        } else {
+            curve2 = MixerCurveFullRangeAbsolute(desired.Yaw, &throttleCurve2, multirotor);
+        }
+        break;
+    case MIXERSETTINGS_CURVE2SOURCE_COLLECTIVE:
+        // assume reversible motor/mixer initially
+        curve2 = MixerCurveFullRangeProportional(collectiveDesired, &throttleCurve2, multirotor);
+        break;
+    case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY0:
+    case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY1:
+    case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY2:
+    case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY3:
+    case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY4:
+    case MIXERSETTINGS_CURVE2SOURCE_ACCESSORY5:
+        if (AccessoryDesiredInstGet(mixerSettings.Curve2Source - MIXERSETTINGS_CURVE2SOURCE_ACCESSORY0, &accessory) == 0) {
+            // Throttle curve contribution the same for +ve vs -ve accessory....maybe not want we want.
+            curve2 = MixerCurveFullRangeAbsolute(accessory.AccessoryVal, &throttleCurve2, multirotor);
+        } else {
             curve2 = 0.0f;
-            break;
         }
+        break;
+    default:
+        curve2 = 0.0f;
+        break;
+    }
 
-        float *status   = (float *)&mixerStatus; // access status objects as an array of floats
-        Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
-        float maxMotor  = -1.0f; // highest motor value. Addition method needs this to be -1.0f, division method needs this to be 1.0f
-        float minMotor  = 1.0f; // lowest motor value Addition method needs this to be 1.0f, division method needs this to be -1.0f
+    // motors use non reversible curves, everything else the curves as they are
+    float inputs[MIXERINPUT_NUMELEM] = {
+        [MIXERINPUT_CURVE1]       = curve1,
+        [MIXERINPUT_CURVE2]       = curve2,
+        [MIXERINPUT_ROLLPOSITIVE] = desired.Roll > 0.0f ? desired.Roll : 0.0f,
+        [MIXERINPUT_ROLLNEGATIVE] = desired.Roll < 0.0f ? desired.Roll : 0.0f,
+        [MIXERINPUT_PITCH]        = desired.Pitch,
+        [MIXERINPUT_YAW]          = desired.Yaw,
+    };
+    float motorInputs[MIXERINPUT_NUMELEM];
+    memcpy(motorInputs, inputs, sizeof(inputs));
+    if (motorInputs[MIXERINPUT_CURVE1] < 0.0f) {
+        motorInputs[MIXERINPUT_CURVE1] = 0.0f;
+    }
+    if (motorInputs[MIXERINPUT_CURVE2] < 0.0f && !multirotor) { // allow negative throttle if multirotor. function scaleMotors handles the sanity checks.
+        motorInputs[MIXERINPUT_CURVE2] = 0.0f;
+    }
 
-        for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
-            // During boot all camera actuators should be completely disabled (PWM pulse = 0).
-            // command.Channel[i] is reused below as a channel PWM activity flag:
-            // 0 - PWM disabled, >0 - PWM set to real mixer value using scaleChannel() later.
-            // Setting it to 1 by default means "Rescale this channel and enable PWM on its output".
-            command.Channel[ct] = 1;
+    float *status   = (float *)&mixerStatus; // access status objects as an array of floats
+    Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type;
+    float maxMotor  = -1.0f; // highest motor value. Addition method needs this to be -1.0f, division method needs this to be 1.0f
+    float minMotor  = 1.0f; // lowest motor value Addition method needs this to be 1.0f, division method needs this to be -1.0f
 
-            uint8_t mixer_type = mixers[ct].type;
+    for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+        // During boot all camera actuators should be completely disabled (PWM pulse = 0).
+        // command.Channel[i] is reused below as a channel PWM activity flag:
+        // 0 - PWM disabled, >0 - PWM set to real mixer value using scaleChannel() later.
+        // Setting it to 1 by default means "Rescale this channel and enable PWM on its output".
+        command.Channel[ct] = 1;
 
-            if (mixer_type == MIXERSETTINGS_MIXER1TYPE_DISABLED) {
-                // Set to minimum if disabled.  This is not the same as saying PWM pulse = 0 us
-                status[ct] = -1;
-                continue;
-            }
+        uint8_t mixer_type = mixers[ct].type;
 
-            if ((mixer_type == MIXERSETTINGS_MIXER1TYPE_MOTOR)) {
-                float nonreversible_curve1 = curve1;
-                float nonreversible_curve2 = curve2;
-                if (nonreversible_curve1 < 0.0f) {
-                    nonreversible_curve1 = 0.0f;
-                }
-                if (nonreversible_curve2 < 0.0f) {
-                    if (!multirotor) { // allow negative throttle if multirotor. function scaleMotors handles the sanity checks.
-                        nonreversible_curve2 = 0.0f;
-                    }
-                }
-                status[ct] = ProcessMixer(ct, nonreversible_curve1, nonreversible_curve2, &desired, multirotor, fixedwing);
-                // If not armed or motors aren't meant to spin all the time
-                if (!armed ||
-                    (!spinWhileArmed && !positiveThrottle)) {
-                    status[ct] = -1; // force min throttle
-                }
-                // If armed meant to keep spinning,
-                else if ((spinWhileArmed && !positiveThrottle) ||
-                         (status[ct] < 0)) {
-                    if (!multirotor) {
-                        status[ct] = 0;
-                        // allow throttle values lower than 0 if multirotor.
-                        // Values will be scaled to 0 if they need to be in the scaleMotor function
-                    }
-                }
-            } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR) {
-                status[ct] = ProcessMixer(ct, curve1, curve2, &desired, multirotor, fixedwing);
-                // Reversable Motors are like Motors but go to neutral instead of minimum
-                // If not armed or motor is inactive - no "spinwhilearmed" for this engine type
-                if (!armed || !activeThrottle) {
-                    status[ct] = 0; // force neutral throttle
+        if (mixer_type == MIXERSETTINGS_MIXER1TYPE_DISABLED) {
+            // Set to minimum if disabled.  This is not the same as saying PWM pulse = 0 us
+            status[ct] = -1;
+            continue;
+        }
+
+        if ((mixer_type == MIXERSETTINGS_MIXER1TYPE_MOTOR)) {
+            status[ct] = ProcessMixer(ct, motorInputs);
+            if (!multirotor && status[ct] < 0.0f) { // we allow negative throttle with a multirotor
+                status[ct] = 0.0f;
+            }
+            // If not armed or motors aren't meant to spin all the time
+            if (!armed ||
+                (!spinWhileArmed && !positiveThrottle)) {
+                status[ct] = -1; // force min throttle
+            }
+            // If armed meant to keep spinning,
+            else if ((spinWhileArmed && !positiveThrottle) ||
+                     (status[ct] < 0)) {
+                if (!multirotor) {
+                    status[ct] = 0;
+                    // allow throttle values lower than 0 if multirotor.
+                    // Values will be scaled to 0 if they need to be in the scaleMotor function
                 }
-            } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_SERVO) {
-                status[ct] = ProcessMixer(ct, curve1, curve2, &desired, multirotor, fixedwing);
-            } else {
-                status[ct] = -1;
-
-                // If an accessory channel is selected for direct bypass mode
-                // In this configuration the accessory channel is scaled and mapped
-                // directly to output.  Note: THERE IS NO SAFETY CHECK HERE FOR ARMING
-                // these also will not be updated in failsafe mode.  I'm not sure what
-                // the correct behavior is since it seems domain specific.  I don't love
-                // this code
-                if ((mixer_type >= MIXERSETTINGS_MIXER1TYPE_ACCESSORY0) &&
-                    (mixer_type <= MIXERSETTINGS_MIXER1TYPE_ACCESSORY5)) {
-                    if (AccessoryDesiredInstGet(mixer_type - MIXERSETTINGS_MIXER1TYPE_ACCESSORY0, &accessory) == 0) {
-                        status[ct] = accessory.AccessoryVal;
-                    } else {
-                        status[ct] = -1;
-                    }
+            }
+        } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_REVERSABLEMOTOR) {
+            status[ct] = ProcessMixer(ct, inputs);
+            // Reversable Motors are like Motors but go to neutral instead of minimum
+            // If not armed or motor is inactive - no "spinwhilearmed" for this engine type
+            if (!armed || !activeThrottle) {
+                status[ct] = 0; // force neutral throttle
+            }
+        } else if (mixer_type == MIXERSETTINGS_MIXER1TYPE_SERVO) {
+            status[ct] = ProcessMixer(ct, inputs);
+        } else {
+            status[ct] = -1;
+
+            // If an accessory channel is selected for direct bypass mode
+            // In this configuration the accessory channel is scaled and mapped
+            // directly to output.  Note: THERE IS NO SAFETY CHECK HERE FOR ARMING
+            // these also will not be updated in failsafe mode.  I'm not sure what
+            // the correct behavior is since it seems domain specific.  I don't love
+            // this code
+            if ((mixer_type >= MIXERSETTINGS_MIXER1TYPE_ACCESSORY0) &&
+                (mixer_type <= MIXERSETTINGS_MIXER1TYPE_ACCESSORY5)) {
+                if (AccessoryDesiredInstGet(mixer_type - MIXERSETTINGS_MIXER1TYPE_ACCESSORY0, &accessory) == 0) {
+                    status[ct] = accessory.AccessoryVal;
+                } else {
+                    status[ct] = -1;
                 }
+            }
 
-                if ((mixer_type >= MIXERSETTINGS_MIXER1TYPE_CAMERAROLLORSERVO1) &&
-                    (mixer_type <= MIXERSETTINGS_MIXER1TYPE_CAMERAYAW)) {
-                    if (camStabEnabled) {
-                        CameraDesiredData cameraDesired;
-                        CameraDesiredGet(&cameraDesired);
-                        switch (mixer_type) {
-                        case MIXERSETTINGS_MIXER1TYPE_CAMERAROLLORSERVO1:
-                            status[ct] = cameraDesired.RollOrServo1;
-                            break;
-                        case MIXERSETTINGS_MIXER1TYPE_CAMERAPITCHORSERVO2:
-                            status[ct] = cameraDesired.PitchOrServo2;
-                            break;
-                        case MIXERSETTINGS_MIXER1TYPE_CAMERAYAW:
-                            status[ct] = cameraDesired.Yaw;
-                            break;
-                        default:
-                            break;
-                        }
-                    } else {
-                        status[ct] = -1;
-                    }
-
-                    // Disable camera actuators for CAMERA_BOOT_DELAY_MS after boot
-                    if (thisSysTime < (CAMERA_BOOT_DELAY_MS / portTICK_RATE_MS)) {
-                        command.Channel[ct] = 0;
+            if ((mixer_type >= MIXERSETTINGS_MIXER1TYPE_CAMERAROLLORSERVO1) &&
+                (mixer_type <= MIXERSETTINGS_MIXER1TYPE_CAMERAYAW)) {
+                if (camStabEnabled) {
+                    CameraDesiredData cameraDesired;
+                    CameraDesiredGet(&cameraDesired);
+                    switch (mixer_type) {
+                    case MIXERSETTINGS_MIXER1TYPE_CAMERAROLLORSERVO1:
+                        status[ct] = cameraDesired.RollOrServo1;
+                        break;
+                    case MIXERSETTINGS_MIXER1TYPE_CAMERAPITCHORSERVO2:
+                        status[ct] = cameraDesired.PitchOrServo2;
+                        break;
+                    case MIXERSETTINGS_MIXER1TYPE_CAMERAYAW:
+                        status[ct] = cameraDesired.Yaw;
+                        break;
+                    default:
+                        break;
                     }
+                } else {
+                    status[ct] = -1;
                 }
 
-                if (mixer_type == MIXERSETTINGS_MIXER1TYPE_CAMERATRIGGER) {
-                    if (camControlEnabled) {
-                        CameraDesiredTriggerGet(&status[ct]);
-                    } else {
-                        status[ct] = 0;
-                    }
+                // Disable camera actuators for CAMERA_BOOT_DELAY_MS after boot
+                if (thisSysTime < (CAMERA_BOOT_DELAY_MS / portTICK_RATE_MS)) {
+                    command.Channel[ct] = 0;
                 }
             }
 
-            // If mixer type is motor we need to find which motor has the highest value and which motor has the lowest value.
-            // For use in function scaleMotor
-            if (mixers[ct].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
-                if (maxMotor < status[ct]) {
-                    maxMotor = status[ct];
-                }
-                if (minMotor > status[ct]) {
-                    minMotor = status[ct];
+            if (mixer_type == MIXERSETTINGS_MIXER1TYPE_CAMERATRIGGER) {
+                if (camControlEnabled) {
+                    CameraDesiredTriggerGet(&status[ct]);
+                } else {
+                    status[ct] = 0;
                 }
             }
         }
 
-        // Set real actuator output values scaling them from mixers. All channels
-        // will be set except explicitly disabled (which will have PWM pulse = 0).
-        for (int i = 0; i < MAX_MIX_ACTUATORS; i++) {
-            if (command.Channel[i]) {
-                if (mixers[i].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) { // If mixer is for a motor we need to find the highest value of all motors
-                    command.Channel[i] = scaleMotor(status[i],
-                                                    actuatorSettings.ChannelMax[i],
-                                                    actuatorSettings.ChannelMin[i],
-                                                    actuatorSettings.ChannelNeutral[i],
-                                                    maxMotor,
-                                                    minMotor,
-                                                    armed,
-                                                    alwaysStabilizeWhenArmed,
-                                                    throttleDesired);
-                } else { // else we scale the channel
-                    command.Channel[i] = scaleChannel(status[i],
-                                                      actuatorSettings.ChannelMax[i],
-                                                      actuatorSettings.ChannelMin[i],
-                                                      actuatorSettings.ChannelNeutral[i]);
-                }
+        // If mixer type is motor we need to find which motor has the highest value and which motor has the lowest value.
+        // For use in function scaleMotor
+        if (mixers[ct].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+            if (maxMotor < status[ct]) {
+                maxMotor = status[ct];
+            }
+            if (minMotor > status[ct]) {
+                minMotor = status[ct];
             }
         }
+    }
 
-        // Store update time
-        command.UpdateTime = dTMilliseconds;
-        if (command.UpdateTime > command.MaxUpdateTime) {
-            command.MaxUpdateTime = command.UpdateTime;
+    // Set real actuator output values scaling them from mixers. All channels
+    // will be set except explicitly disabled (which will have PWM pulse = 0).
+    for (int i = 0; i < MAX_MIX_ACTUATORS; i++) {
+        if (command.Channel[i]) {
+            if (mixers[i].type == MIXERSETTINGS_MIXER1TYPE_MOTOR) { // If mixer is for a motor we need to find the highest value of all motors
+                command.Channel[i] = scaleMotor(status[i],
+                                                actuatorSettings.ChannelMax[i],
+                                                actuatorSettings.ChannelMin[i],
+                                                actuatorSettings.ChannelNeutral[i],
+                                                maxMotor,
+                                                minMotor,
+                                                armed,
+                                                alwaysStabilizeWhenArmed,
+                                                throttleDesired);
+            } else { // else we scale the channel
+                command.Channel[i] = scaleChannel(status[i],
+                                                  actuatorSettings.ChannelMax[i],
+                                                  actuatorSettings.ChannelMin[i],
+                                                  actuatorSettings.ChannelNeutral[i]);
+            }
         }
-        // Update output object
-        ActuatorCommandSet(&command);
-        // Update in case read only (eg. during servo configuration)
-        ActuatorCommandGet(&command);
+    }
+
+    // Store update time
+    command.UpdateTime = dTMilliseconds;
+    if (command.UpdateTime > command.MaxUpdateTime) {
+        command.MaxUpdateTime = command.UpdateTime;
+    }
+    // Update output object
+    ActuatorCommandSet(&command);
+    // Update in case read only (eg. during servo configuration)
+    ActuatorCommandGet(&command);
 
 #ifdef DIAG_MIXERSTATUS
-        MixerStatusSet(&mixerStatus);
+    MixerStatusSet(&mixerStatus);
 #endif
 
 
-        // Update servo outputs
-        bool success = true;
+    // Update servo outputs
+    bool success = true;
 
-        for (int n = 0; n < ACTUATORCOMMAND_CHANNEL_NUMELEM; ++n) {
-            success &= set_channel(n, command.Channel[n]);
-        }
+    for (int n = 0; n < ACTUATORCOMMAND_CHANNEL_NUMELEM; ++n) {
+        success &= set_channel(n, command.Channel[n]);
+    }
 
-        PIOS_Servo_Update();
+    PIOS_Servo_Update();
 
-        if (!success) {
-            command.NumFailedUpdates++;
-            ActuatorCommandSet(&command);
-            AlarmsSet(SYSTEMALARMS_ALARM_ACTUATOR, SYSTEMALARMS_ALARM_CRITICAL);
-        }
+    if (!success) {
+        command.NumFailedUpdates++;
+        ActuatorCommandSet(&command);
+        AlarmsSet(SYSTEMALARMS_ALARM_ACTUATOR, SYSTEMALARMS_ALARM_CRITICAL);
+    }
 #ifdef PIOS_INCLUDE_INSTRUMENTATION
-        PIOS_Instrumentation_TimeEnd(counter);
+    PIOS_Instrumentation_TimeEnd(counter);
 #endif
+}
+
+/**
+ * Rate loop fast path, mix and drive the outputs right away from the calling context.
+ * The Actuator task stops listening to ActuatorDesired until ActuatorFastPathRelease(),
+ * it only wakes for the failsafe timeout should the calls stop.
+ */
+void ActuatorFastPathUpdate(const ActuatorDesiredData *desired)
+{
+    xSemaphoreTake(updateLock, portMAX_DELAY);
+    if (!fastPathActive) {
+        UAVObjDisconnectQueue(ActuatorDesiredHandle(), queue);
+    }
+    fastPathLastUpdate = PIOS_DELAY_GetRaw();
+    fastPathActive     = true;
+    actuatorUpdate(desired);
+    xSemaphoreGive(updateLock);
+}
+
+/**
+ * Hand the outputs back to the Actuator task, i.e. when stabilization is no longer in the control chain
+ */
+void ActuatorFastPathRelease(void)
+{
+    xSemaphoreTake(updateLock, portMAX_DELAY);
+    if (fastPathActive) {
+        fastPathActive = false;
+        ActuatorDesiredConnectQueue(queue);
     }
+    xSemaphoreGive(updateLock);
+}
+
+static bool fastPathDriving(void)
+{
+    return fastPathActive && PIOS_DELAY_DiffuS(fastPathLastUpdate) < FAILSAFE_TIMEOUT_MS * 1000;
 }
 
 
 /**
- * Process mixing for one actuator
+ * Process mixing for one actuator, a row of the compiled mixer matrix times the mixer inputs
  */
-float ProcessMixer(const int index, const float curve1, const float curve2,
-                   ActuatorDesiredData *desired, bool multirotor, bool fixedwing)
+static float ProcessMixer(const int index, const float *inputs)
 {
-    const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type; // pointer to array of mixers in UAVObjects
-    const Mixer_t *mixer  = &mixers[index];
-    float differential    = 1.0f;
-
-    // Apply differential only for fixedwing and Roll servos
-    if (fixedwing && (mixerSettings.FirstRollServo > 0) &&
-        (mixer->type == MIXERSETTINGS_MIXER1TYPE_SERVO) &&
-        (mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] != 0)) {
-        // Positive differential
-        if (mixerSettings.RollDifferential > 0) {
-            // Check for first Roll servo (should be left aileron or elevon) and Roll desired (positive/negative)
-            if (((index == mixerSettings.FirstRollServo - 1) && (desired->Roll > 0.0f))
-                || ((index != mixerSettings.FirstRollServo - 1) && (desired->Roll < 0.0f))) {
-                differential -= (mixerSettings.RollDifferential * 0.01f);
-            }
-        } else if (mixerSettings.RollDifferential < 0) {
-            if (((index == mixerSettings.FirstRollServo - 1) && (desired->Roll < 0.0f))
-                || ((index != mixerSettings.FirstRollServo - 1) && (desired->Roll > 0.0f))) {
-                differential -= (-mixerSettings.RollDifferential * 0.01f);
-            }
-        }
+    const float *row = mixerMatrix[index];
+    float result     = 0.0f;
+
+    for (int i = 0; i < MIXERINPUT_NUMELEM; i++) {
+        result += row[i] * inputs[i];
     }
+    return result;
+}
 
-    float result = ((((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1]) * curve1) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2]) * curve2) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL]) * desired->Roll * differential) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_PITCH]) * desired->Pitch) +
-                    (((float)mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_YAW]) * desired->Yaw)) / 128.0f;
+/**
+ * Compile mixerSettings into the mixer matrix and curve tables used by ProcessMixer
+ * The roll differential and the /128 scaling of the mixer vectors are folded into the matrix
+ */
+static void compileMixer()
+{
+    const Mixer_t *mixers = (Mixer_t *)&mixerSettings.Mixer1Type; // pointer to array of mixers in UAVObjects
+    bool fixedwing        = (GetCurrentFrameType() == FRAME_TYPE_FIXED_WING);
+    float differential    = 1.0f - (abs(mixerSettings.RollDifferential) * 0.01f);
 
-    if (mixer->type == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
-        if (!multirotor) { // we allow negative throttle with a multirotor
-            if (result < 0.0f) { // zero throttle
-                result = 0.0f;
+    for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+        const Mixer_t *mixer = &mixers[ct];
+        float rollPositive   = 1.0f;
+        float rollNegative   = 1.0f;
+
+        // Apply differential only for fixedwing and Roll servos
+        if (fixedwing && (mixerSettings.FirstRollServo > 0) &&
+            (mixer->type == MIXERSETTINGS_MIXER1TYPE_SERVO) &&
+            (mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] != 0)) {
+            bool firstRollServo = (ct == mixerSettings.FirstRollServo - 1);
+            // Positive differential reduces the first Roll servo (should be left aileron or elevon) on positive roll
+            // and the others on negative roll, negative differential the other way around
+            if ((mixerSettings.RollDifferential > 0 && firstRollServo) || (mixerSettings.RollDifferential < 0 && !firstRollServo)) {
+                rollPositive = differential;
+            } else if (mixerSettings.RollDifferential != 0) {
+                rollNegative = differential;
             }
         }
+
+        float *row = mixerMatrix[ct];
+        row[MIXERINPUT_CURVE1]       = mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1] / 128.0f;
+        row[MIXERINPUT_CURVE2]       = mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2] / 128.0f;
+        row[MIXERINPUT_ROLLPOSITIVE] = mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] * rollPositive / 128.0f;
+        row[MIXERINPUT_ROLLNEGATIVE] = mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_ROLL] * rollNegative / 128.0f;
+        row[MIXERINPUT_PITCH]        = mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_PITCH] / 128.0f;
+        row[MIXERINPUT_YAW]          = mixer->matrix[MIXERSETTINGS_MIXER1VECTOR_YAW] / 128.0f;
     }
 
-    return result;
+    const float *curves[2] = { mixerSettings.ThrottleCurve1, mixerSettings.ThrottleCurve2 };
+    MixerCurve_t *compiled[2] = { &throttleCurve1, &throttleCurve2 };
+    for (int c = 0; c < 2; c++) {
+        for (int i = 0; i < MIXER_CURVE_ELEMENTS; i++) {
+            compiled[c]->value[i] = curves[c][i];
+            compiled[c]->slope[i] = (i < MIXER_CURVE_ELEMENTS - 1) ? curves[c][i + 1] - curves[c][i] : 0.0f;
+        }
+        compiled[c]->passthrough = (curves[c][0] < -1);
+    }
 }
 
 
@@ -616,9 +727,9 @@ float ProcessMixer(const int index, const float curve1, const float curve2,
  * Input of 0  ->  lookup(0)
  * Input of 1  ->  lookup(1)
  */
-static float MixerCurveFullRangeProportional(const float input, const float *curve, uint8_t elements, bool multirotor)
+static float MixerCurveFullRangeProportional(const float input, const MixerCurve_t *curve, bool multirotor)
 {
-    float unsigned_value = MixerCurveFullRangeAbsolute(input, curve, elements, multirotor);
+    float unsigned_value = MixerCurveFullRangeAbsolute(input, curve, multirotor);
 
     if (input < 0.0f) {
         return -unsigned_value;
@@ -636,36 +747,31 @@ static float MixerCurveFullRangeProportional(const float input, const float *cur
  * Input of 0  -> lookup(0)
  * Input of 1  -> lookup(1)
  */
-static float MixerCurveFullRangeAbsolute(const float input, const float *curve, uint8_t elements, bool multirotor)
+static float MixerCurveFullRangeAbsolute(const float input, const MixerCurve_t *curve, bool multirotor)
 {
     float abs_input = fabsf(input);
-    float scale     = abs_input * (float)(elements - 1);
-    int idx1 = scale;
 
-    scale -= (float)idx1; // remainder
-    if (curve[0] < -1) {
+    if (curve->passthrough) {
         return abs_input;
     }
-    int idx2 = idx1 + 1;
-    if (idx2 >= elements) {
-        idx2 = elements - 1; // clamp to highest entry in table
-        if (idx1 >= elements) {
-            if (multirotor) {
-                // if multirotor frame we can return throttle values higher than 100%.
-                // Since the we don't have elements in the curve higher than 100% we return
-                // the last element multiplied by the throttle float
-                if (input < 2.0f) { // this limits positive throttle to 200% of max value in table (Maybe this is too much allowance)
-                    return curve[idx2] * input;
-                } else {
-                    return curve[idx2] * 2.0f; // return 200% of max value in table
-                }
+    float scale = abs_input * (float)(MIXER_CURVE_ELEMENTS - 1);
+    int idx     = scale;
+    if (idx >= MIXER_CURVE_ELEMENTS) {
+        if (multirotor) {
+            // if multirotor frame we can return throttle values higher than 100%.
+            // Since the we don't have elements in the curve higher than 100% we return
+            // the last element multiplied by the throttle float
+            if (input < 2.0f) { // this limits positive throttle to 200% of max value in table (Maybe this is too much allowance)
+                return curve->value[MIXER_CURVE_ELEMENTS - 1] * input;
+            } else {
+                return curve->value[MIXER_CURVE_ELEMENTS - 1] * 2.0f; // return 200% of max value in table
             }
-            idx1 = elements - 1;
         }
+        return curve->value[MIXER_CURVE_ELEMENTS - 1]; // clamp to highest entry in table
     }
 
-    float unsigned_value = curve[idx1] * (1.0f - scale) + curve[idx2] * scale;
-    return unsigned_value;
+    // the slope of the last entry is 0, so this also clamps inputs between 100% and the next table step
+    return curve->value[idx] + curve->slope[idx] * (scale - (float)idx);
 }
 
 
@@ -1098,6 +1204,7 @@ static void MixerSettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
             mixer_settings_count++;
         }
     }
+    compileMixer();
 
     update_servo_active();
 }
@@ -1124,6 +1231,9 @@ static void SettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 #endif
 
     SystemSettingsThrustControlGet(&thrustType);
+
+    // the roll differential depends on the frame type
+    compileMixer();
 }
 
 /**
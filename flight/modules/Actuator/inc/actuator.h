@@ -33,8 +33,15 @@
 #define ACTUATOR_H
 
 #include <stdbool.h>
+#include <actuatordesired.h>
+
+// additional stack the mixer needs when it runs in the stabilization rate loop context,
+// measured 720 bytes deep on simposix -Os (64 bit) plus an exception frame of 104 bytes
+#define ACTUATOR_FASTPATH_STACK_BYTES 832
 
 int32_t ActuatorInitialize();
+void ActuatorFastPathUpdate(const ActuatorDesiredData *desired);
+void ActuatorFastPathRelease(void);
 
 #endif // ACTUATOR_H
 
@@ -64,8 +64,7 @@ static struct CameraControl_data {
     CameraStatus lastManualInput;
     bool autoTriggerEnabled;
     uint16_t     ImageId;
-    float HomeECEF[3];
-    float HomeRne[3][3];
+    struct ltp_frame home;
 } *ccd;
 
 #define CALLBACK_PRIORITY   CALLBACK_PRIORITY_REGULAR
@@ -308,17 +307,15 @@ static void FillActivityInfo()
     {
         PositionStateData position;
         PositionStateGet(&position);
-        int32_t LLAi[3];
-        const float pos[3] = {
-            position.North,
-            position.East,
-            position.Down
+        int32_t LLAi[1][3];
+        const float pos[1][3] = {
+            { position.North, position.East, position.Down }
         };
-        Base2LLA(pos, ccd->HomeECEF, ccd->HomeRne, LLAi);
+        LTP2LLA(&ccd->home, pos, LLAi, 1);
 
-        activity->Latitude  = LLAi[0];
-        activity->Longitude = LLAi[1];
-        activity->Altitude  = ((float)LLAi[2]) * 1e-4f;
+        activity->Latitude  = LLAi[0][0];
+        activity->Longitude = LLAi[0][1];
+        activity->Altitude  = ((float)LLAi[0][2]) * 1e-4f;
     }
     {
         GPSTimeData time;
@@ -354,8 +351,8 @@ static void HomeLocationUpdateCb(__attribute__((unused)) UAVObjEvent *ev)
     int32_t LLAi[3] = {
         home.Latitude,
         home.Longitude,
-        home.Altitude
+        (int32_t)(home.Altitude * 1e4f)
     };
-    LLA2ECEF(LLAi, ccd->HomeECEF);
-    RneFromLLA(LLAi, ccd->HomeRne);
+    // only rebuilt if the location itself changed
+    LTPFrameFromLLA(LLAi, &ccd->home);
 }
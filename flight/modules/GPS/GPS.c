@@ -304,6 +304,8 @@ static void gpsTask(__attribute__((unused)) void *parameters)
 
 #ifdef PIOS_GPS_SETS_HOMELOCATION
     portTickType homelocationSetDelay = 0;
+    // the home location and Be are recomputed whenever HomeLocation.Set is cleared, keep the WMM terms for that
+    WMM_KeepCache(true);
 #endif
     GPSPositionSensorData gpspositionsensor;
 
@@ -61,11 +61,15 @@
 #endif
 
 #define MAX_NB_PARAMS 20
+
+// sentence type after the talker ID (GP, GN, GL...) packed into an integer, e.g. NMEA_ID('G', 'G', 'A')
+#define NMEA_ID(a, b, c) (((uint32_t)(a) << 16) | ((uint32_t)(b) << 8) | (uint32_t)(c))
+
 /* NMEA sentence parsers */
 
 struct nmea_parser {
-    const char *prefix;
-    bool (*handler)(GPSPositionSensorData *GpsData, bool *gpsDataUpdated, char *param[], uint8_t nbParam);
+    uint32_t id;
+    bool     (*handler)(GPSPositionSensorData *GpsData, bool *gpsDataUpdated, char *param[], uint8_t nbParam);
 };
 
 static bool nmeaProcessGxGGA(GPSPositionSensorData *GpsData, bool *gpsDataUpdated, char *param[], uint8_t nbParam);
@@ -77,30 +81,33 @@ static bool nmeaProcessGxZDA(GPSPositionSensorData *GpsData, bool *gpsDataUpdate
 static bool nmeaProcessGxGSV(GPSPositionSensorData *GpsData, bool *gpsDataUpdated, char *param[], uint8_t nbParam);
 #endif // PIOS_GPS_MINIMAL
 
+static bool NMEA_split(char *nmea_sentence, char *params[], uint8_t *nbParams, uint32_t *id);
+static bool NMEA_dispatch(uint32_t id, char *params[], uint8_t nbParams, GPSPositionSensorData *GpsData);
+
 static const struct nmea_parser nmea_parsers[] = {
     {
-        .prefix  = "GGA",
+        .id      = NMEA_ID('G', 'G', 'A'),
         .handler = nmeaProcessGxGGA,
     },
     {
-        .prefix  = "VTG",
+        .id      = NMEA_ID('V', 'T', 'G'),
         .handler = nmeaProcessGxVTG,
     },
     {
-        .prefix  = "GSA",
+        .id      = NMEA_ID('G', 'S', 'A'),
         .handler = nmeaProcessGxGSA,
     },
     {
-        .prefix  = "RMC",
+        .id      = NMEA_ID('R', 'M', 'C'),
         .handler = nmeaProcessGxRMC,
     },
 #if !defined(PIOS_GPS_MINIMAL)
     {
-        .prefix  = "ZDA",
+        .id      = NMEA_ID('Z', 'D', 'A'),
         .handler = nmeaProcessGxZDA,
     },
     {
-        .prefix  = "GSV",
+        .id      = NMEA_ID('G', 'S', 'V'),
         .handler = nmeaProcessGxGSV,
     },
 #endif // PIOS_GPS_MINIMAL
@@ -110,86 +117,86 @@ int parse_nmea_stream(uint8_t *rx, uint8_t len, char *gps_rx_buffer, GPSPosition
 {
     static uint8_t rx_count = 0;
     static bool start_flag  = false;
-    static bool found_cr    = false;
     bool goodParse = false;
-    uint8_t c;
     int i = 0;
 
     while (i < len) {
-        c = rx[i++];
-        // detect start while acquiring stream
+        if (!start_flag) { // if no NMEA identifier ('$') found yet
+            // find a likely candidate for a NMEA string
+            // skip over some e.g. uBlox packets
+            uint8_t *p = memchr(&rx[i], '$', len - i);
+            if (!p) {
+                break;
+            }
+            i = p - rx + 1;
+            start_flag = true;
+            gps_rx_buffer[0] = '$';
+            rx_count   = 1;
+            continue;
+        }
+
+        // take the bytes up to the end of the line at once
         // if we find a $ in the middle it was a bad packet (e.g. maybe UBX binary),
         // and this may be the start of another packet
         // silently cancel the current sentence
-        if (c == '$') { // NMEA identifier found
+        uint8_t *end   = memchr(&rx[i], '\n', len - i);
+        int count      = end ? end - &rx[i] + 1 : len - i;
+        uint8_t *start = memchr(&rx[i], '$', count);
+        if (start) {
+            count = start - &rx[i];
+            end   = NULL;
             start_flag = false;
         }
-        if (!start_flag) { // if no NMEA identifier ('$') found yet
-            if (c == '$') { // NMEA identifier found
-                start_flag = true;
-                found_cr   = false;
-                rx_count   = 0;
-            } else {
-                // find a likely candidate for a NMEA string
-                // skip over some e.g. uBlox packets
-                uint8_t *p;
-                p = memchr(&rx[i], '$', len - i);
-                if (p) {
-                    i += p - &rx[i];
-                } else {
-                    i = len;
-                }
-                // loop to restart at the $ if there is one
-                continue;
-            }
-        }
-        if (rx_count >= NMEA_MAX_PACKET_LENGTH) {
-            // The buffer is already full and we haven't found a valid NMEA sentence.
-            // Flush the buffer and note the overflow event.
+
+        if (rx_count + count > NMEA_MAX_PACKET_LENGTH) {
+            // The buffer is full and we haven't found a valid NMEA sentence.
+            // Flush the buffer and note the overflow event, the byte that did not fit is dropped
             gpsRxStats->gpsRxOverflow++;
             start_flag = false;
+            i += NMEA_MAX_PACKET_LENGTH - rx_count + 1;
             continue;
-        } else {
-            gps_rx_buffer[rx_count++] = c;
         }
+        memcpy(&gps_rx_buffer[rx_count], &rx[i], count);
+        rx_count += count;
+        i += count;
+
+        // look for ending '\r\n' sequence, each '\r' cancels the one before it like in the byte by byte parser
+        uint8_t crs = 0;
+        while (end && crs + 2 < rx_count && gps_rx_buffer[rx_count - 2 - crs] == '\r') {
+            crs++;
+        }
+        if (crs & 1) {
+            // The NMEA functions require a zero-terminated string
+            // As we detected \r\n, the string as for sure 2 bytes long, we will also strip the \r\n
+            gps_rx_buffer[rx_count - 2] = 0;
 
-        // look for ending '\r\n' sequence
-        if (!found_cr && (c == '\r')) {
-            found_cr = true;
-        } else if (found_cr) {
-            if (c != '\n') {
-                found_cr = false; // false end flag
-            } else {
-                // The NMEA functions require a zero-terminated string
-                // As we detected \r\n, the string as for sure 2 bytes long, we will also strip the \r\n
-                gps_rx_buffer[rx_count - 2] = 0;
-
-                // prepare to parse next sentence
-                start_flag = false;
-                // Our rxBuffer must look like this now:
-                // [0]           = '$'
-                // ...           = zero or more bytes of sentence payload
-                // [end_pos - 1] = '\r'
-                // [end_pos]     = '\n'
-                //
-                // Prepare to consume the sentence from the buffer
-
-                // Validate the checksum over the sentence
-                if (!NMEA_checksum(&gps_rx_buffer[1])) { // Invalid checksum.  May indicate dropped characters on Rx.
+            // prepare to parse next sentence
+            start_flag = false;
+            // Our rxBuffer must look like this now:
+            // [0]           = '$'
+            // ...           = zero or more bytes of sentence payload
+            // [end_pos - 1] = '\r'
+            // [end_pos]     = '\n'
+            //
+            // Prepare to consume the sentence from the buffer
+
+            // Split the sentence into its parameters and validate the checksum over it in one go
+            char *params[MAX_NB_PARAMS];
+            uint8_t nbParams;
+            uint32_t id;
+            if (!NMEA_split(&gps_rx_buffer[1], params, &nbParams, &id)) { // Invalid checksum.  May indicate dropped characters on Rx.
+                // PIOS_DEBUG_PinHigh(2);
+                gpsRxStats->gpsRxChkSumError++;
+                // PIOS_DEBUG_PinLow(2);
+            } else { // Valid checksum, use this packet to update the GPS position
+                if (!NMEA_dispatch(id, params, nbParams, GpsData)) {
                     // PIOS_DEBUG_PinHigh(2);
-                    gpsRxStats->gpsRxChkSumError++;
+                    gpsRxStats->gpsRxParserError++;
                     // PIOS_DEBUG_PinLow(2);
-                } else { // Valid checksum, use this packet to update the GPS position
-                    if (!NMEA_update_position(&gps_rx_buffer[1], GpsData)) {
-                        // PIOS_DEBUG_PinHigh(2);
-                        gpsRxStats->gpsRxParserError++;
-                        // PIOS_DEBUG_PinLow(2);
-                    } else {
-                        gpsRxStats->gpsRxReceived++;
-                        goodParse = true;
-                    }
+                } else {
+                    gpsRxStats->gpsRxReceived++;
+                    goodParse = true;
                 }
-                continue;
             }
         }
     }
@@ -204,23 +211,16 @@ int parse_nmea_stream(uint8_t *rx, uint8_t len, char *gps_rx_buffer, GPSPosition
     }
 }
 
-static const struct nmea_parser *NMEA_find_parser_by_prefix(const char *prefix)
+static const struct nmea_parser *NMEA_find_parser_by_id(uint32_t id)
 {
-    if (!prefix) {
-        return NULL;
-    }
-
     for (uint8_t i = 0; i < NELEMENTS(nmea_parsers); i++) {
-        const struct nmea_parser *parser = &nmea_parsers[i];
-
-        /* Use strcmp to check for exact equality over the entire prefix */
-        if (!strcmp(prefix, parser->prefix)) {
+        if (nmea_parsers[i].id == id) {
             /* Found an appropriate parser */
-            return parser;
+            return &nmea_parsers[i];
         }
     }
 
-    /* No matching parser for this prefix */
+    /* No matching parser for this sentence */
     return NULL;
 }
 
@@ -254,115 +254,160 @@ bool NMEA_checksum(char *nmea_sentence)
     return checksum_computed == checksum_received;
 }
 
+/**
+ * Splits an NMEA sentence into its parameters, separated by ",", in place
+ * and computes its checksum in the same pass
+ * \param[in] Buffer for the nmea sentence, without the '$'
+ * \param[out] params the parameters, the first one is the message name without the talker ID
+ * \param[out] nbParams number of parameters
+ * \param[out] id the message name packed by NMEA_ID(), 0 if it is not three characters
+ * \return false checksum missing or not valid
+ * \return true checksum valid
+ */
+static bool NMEA_split(char *nmea_sentence, char *params[], uint8_t *nbParams, uint32_t *id)
+{
+    // Sample NMEA message: "GPRMC,000131.736,V,,,,,0.00,0.00,060180,,,N*43"
+    char *p = nmea_sentence;
+    uint8_t checksum_computed = 0;
+    uint8_t checksum_received = 0;
+
+    params[0]  = p;
+    *nbParams  = 1;
+    while (*p != '\0' && *p != '*') {
+        checksum_computed ^= *p;
+        if (*p == ',') {
+            // This is the end of this parameter
+            *p = '\0';
+            // Start new parameter, the ones beyond MAX_NB_PARAMS are dropped but still checksummed
+            if (*nbParams < MAX_NB_PARAMS) {
+                params[(*nbParams)++] = p + 1;
+            }
+        }
+        p++;
+    }
+
+    // The first parameter is the message name, pack it without the talker ID to allow GL, GN, GP...
+    char *name = params[0];
+    uint8_t nameLength = (*nbParams > 1 ? params[1] - 1 : p) - name;
+    if (nameLength == 5) {
+        *id = NMEA_ID(name[2], name[3], name[4]);
+    } else {
+        *id = 0;
+    }
+    if (nameLength >= 2) {
+        params[0] = name + 2;
+    }
+
+    if (*p == '\0') {
+        /* Buffer ran out before we found a checksum marker */
+        return false;
+    }
+
+    // After the * comes the checksum, we are done
+    *p++ = '\0';
+    for (;; p++) {
+        if (*p >= '0' && *p <= '9') {
+            checksum_received = (checksum_received << 4) | (*p - '0');
+        } else if ((*p | 0x20) >= 'a' && (*p | 0x20) <= 'f') {
+            checksum_received = (checksum_received << 4) | ((*p | 0x20) - 'a' + 10);
+        } else {
+            break;
+        }
+    }
+
+    return checksum_computed == checksum_received;
+}
+
 /*
- * This function only exists to deal with a linking
- * failure in the stdlib function strtof().  This
- * implementation does not rely on the _sbrk() syscall
- * like strtof() does.
+ * The numbers are parsed with integer arithmetic only, strtof() and powf()
+ * are slow and strtof() needs the _sbrk() syscall.
  */
 
+#define NMEA_FLOAT_DECIMALS 4 // fraction digits kept by NMEA_real_to_float()
+
+static const uint32_t nmea_pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+
 /* Parse a number encoded in a string of the format:
  *   [-]NN.nnnnn
- * into a signed whole part and an unsigned fractional part.
- * The fract_units field indicates the units of the fractional part as
- *   1 whole = 10^fract_units fract
+ * into its sign, its whole part and its fractional part in units of 10^-decimals.
+ * Fraction digits beyond that are dropped.
+ * Returns false if the field holds no digits.
  */
-static bool NMEA_parse_real(int32_t *whole, uint32_t *fract, uint8_t *fract_units, char *field)
+static bool NMEA_parse_real(bool *negative, uint32_t *whole, uint32_t *fract, uint8_t decimals, const char *field)
 {
-    char *s = field;
-    char *field_w;
-    char *field_f;
-
-    PIOS_DEBUG_Assert(whole);
-    PIOS_DEBUG_Assert(fract);
-    PIOS_DEBUG_Assert(fract_units);
-    PIOS_DEBUG_Assert(field);
+    const char *s = field;
+    uint8_t units = 0;
+    bool digits   = false;
 
-    field_w = strsep(&s, ".");
-    field_f = s;
+    *negative = (*s == '-');
+    if (*negative) {
+        s++;
+    }
 
-    *whole  = strtol(field_w, NULL, 10);
+    *whole = 0;
+    while (*s >= '0' && *s <= '9') {
+        *whole = *whole * 10 + (*s++ - '0');
+        digits = true;
+    }
 
-    if (field_w) {
-        /* decimal was found so we may have a fractional part */
-        *fract = strtoul(field_f, NULL, 10);
-        *fract_units = strlen(field_f);
-    } else {
-        /* no decimal was found, fractional part is zero */
-        *fract = 0;
-        *fract_units = 0;
+    *fract = 0;
+    if (*s == '.') {
+        s++;
+        while (*s >= '0' && *s <= '9') {
+            if (units < decimals) {
+                *fract = *fract * 10 + (*s - '0');
+                units++;
+            }
+            s++;
+            digits = true;
+        }
     }
+    /* scale up the fraction apropriately depending on # of digits */
+    *fract *= nmea_pow10[decimals - units];
 
-    return true;
+    return digits;
 }
 
-static float NMEA_real_to_float(char *nmea_real)
+static float NMEA_real_to_float(const char *nmea_real)
 {
-    int32_t whole;
+    bool negative;
+    uint32_t whole;
     uint32_t fract;
-    uint8_t fract_units;
 
-    if (!NMEA_parse_real(&whole, &fract, &fract_units, nmea_real)) {
-        return false;
-    }
+    NMEA_parse_real(&negative, &whole, &fract, NMEA_FLOAT_DECIMALS, nmea_real);
 
     /* Convert to float */
-    return ((float)whole) + fract * powf(10.0f, -fract_units);
+    float value = (float)(whole * nmea_pow10[NMEA_FLOAT_DECIMALS] + fract) / nmea_pow10[NMEA_FLOAT_DECIMALS];
+    return negative ? -value : value;
+}
+
+static int32_t NMEA_real_to_int(const char *nmea_real)
+{
+    bool negative;
+    uint32_t whole;
+    uint32_t fract;
+
+    NMEA_parse_real(&negative, &whole, &fract, 0, nmea_real);
+
+    return negative ? -(int32_t)whole : (int32_t)whole;
 }
 
 /*
  * Parse a field in the format:
- *    DD[D]MM.mmmm[mm]
+ *    DD[D]MM.mmmm[mmm]
  * into a fixed-point representation in units of (degrees * 1e-7)
  */
-static bool NMEA_latlon_to_fixed_point(int32_t *latlon, char *nmea_latlon, bool negative)
+static bool NMEA_latlon_to_fixed_point(int32_t *latlon, const char *nmea_latlon, bool negative)
 {
-    int32_t num_DDDMM;
+    bool minus;
+    uint32_t num_DDDMM;
     uint32_t num_m;
-    uint8_t units;
-
-    /* Sanity checks */
-    PIOS_DEBUG_Assert(nmea_latlon);
-    PIOS_DEBUG_Assert(latlon);
 
-    if (*nmea_latlon == '\0') { /* empty lat/lon field */
+    /* minutes in units of 1e-7 */
+    if (!NMEA_parse_real(&minus, &num_DDDMM, &num_m, 7, nmea_latlon)) { /* empty lat/lon field */
         return false;
     }
 
-    if (!NMEA_parse_real(&num_DDDMM, &num_m, &units, nmea_latlon)) {
-        return false;
-    }
-
-    /* scale up the mmmm[mm] field apropriately depending on # of digits */
-    /* not using 1eN notation because that forces fixed point and lost precision */
-    switch (units) {
-    case 0:
-        /* no digits, value is zero so no scaling */
-        break;
-    case 1: /* m       */
-        num_m *= 1000000; /* m000000 */
-        break;
-    case 2: /* mm      */
-        num_m *= 100000; /* mm00000 */
-        break;
-    case 3: /* mmm     */
-        num_m *= 10000; /* mmm0000 */
-        break;
-    case 4: /* mmmm    */
-        num_m *= 1000; /* mmmm000 */
-        break;
-    case 5: /* mmmmm   */
-        num_m *= 100; /* mmmmm00 */
-        break;
-    case 6: /* mmmmmm  */
-        num_m *= 10; /* mmmmmm0 */
-        break;
-    default:
-        /* unhandled format */
-        num_m = 0.0f;
-        break;
-    }
-
     *latlon  = (num_DDDMM / 100) * 10000000;        /* scale the whole degrees */
     *latlon += (num_DDDMM % 100) * 10000000 / 60; /* add in the scaled decimal whole minutes */
     *latlon += num_m / 60; /* add in the scaled decimal fractional minutes */
@@ -374,7 +419,6 @@ static bool NMEA_latlon_to_fixed_point(int32_t *latlon, char *nmea_latlon, bool
     return true;
 }
 
-
 /**
  * Parses a complete NMEA sentence and updates the GPSPositionSensor UAVObject
  * \param[in] An NMEA sentence with a valid checksum
@@ -383,41 +427,27 @@ static bool NMEA_latlon_to_fixed_point(int32_t *latlon, char *nmea_latlon, bool
  */
 bool NMEA_update_position(char *nmea_sentence, GPSPositionSensorData *GpsData)
 {
-    char *p = nmea_sentence;
     char *params[MAX_NB_PARAMS];
     uint8_t nbParams;
+    uint32_t id;
 
 #ifdef DEBUG_MSG_IN
     DEBUG_MSG("\"%s\"\n", nmea_sentence);
 #endif
 
-    // Split the nmea sentence it its parameters, separated by ","
-    // Sample NMEA message: "GPRMC,000131.736,V,,,,,0.00,0.00,060180,,,N*43"
-
-    // The first parameter starts at the beginning of the message
-    // Skip first two character, allow GL, GN, GP...
-    p += 2;
-    params[0] = p;
-    nbParams  = 1;
-    while (*p != 0) {
-        if (*p == '*') {
-            // After the * comes the "CRC", we are done,
-            *p = 0; // Zero-terminate this parameter
-            break;
-        } else if (*p == ',') {
-            // This is the end of this parameter
-            *p = 0; // Zero-terminate this parameter
-            // Start new parameter
-            if (nbParams == MAX_NB_PARAMS) {
-                break;
-            }
-            params[nbParams] = p + 1; // For sure there is something at p+1 because at p there is ","
-            nbParams++;
-        }
-        p++;
-    }
+    // The checksum has been validated by the caller
+    NMEA_split(nmea_sentence, params, &nbParams, &id);
 
+    return NMEA_dispatch(id, params, nbParams, GpsData);
+}
 
+/**
+ * Hands a sentence split by NMEA_split() to its parser and updates the GPSPositionSensor UAVObject
+ * \return true if the sentence was successfully parsed
+ * \return false if any errors were encountered with the parsing
+ */
+static bool NMEA_dispatch(uint32_t id, char *params[], uint8_t nbParams, GPSPositionSensorData *GpsData)
+{
 #ifdef DEBUG_PARAMS
     int i;
     for (i = 0; i < nbParams; i++) {
@@ -427,7 +457,7 @@ bool NMEA_update_position(char *nmea_sentence, GPSPositionSensorData *GpsData)
 
     // The first parameter is the message name, lets see if we find a parser for it
     const struct nmea_parser *parser;
-    parser = NMEA_find_parser_by_prefix(params[0]);
+    parser = NMEA_find_parser_by_id(id);
     if (!parser) {
         // No parser found
                 #ifdef DEBUG_MSGID_IN
@@ -519,7 +549,7 @@ static bool nmeaProcessGxGGA(GPSPositionSensorData *GpsData, bool *gpsDataUpdate
     }
 
     // get number of satellites used in GPS solution
-    GpsData->Satellites = atoi(param[7]);
+    GpsData->Satellites = NMEA_real_to_int(param[7]);
 
     // get altitude (in meters mm.m)
     GpsData->Altitude   = NMEA_real_to_float(param[9]);
@@ -557,10 +587,10 @@ static bool nmeaProcessGxRMC(GPSPositionSensorData *GpsData, bool *gpsDataUpdate
     GPSTimeGet(&gpst);
 
     // get UTC time [hhmmss.sss]
-    float hms = NMEA_real_to_float(param[1]);
-    gpst.Second = (int)hms % 100;
-    gpst.Minute = (((int)hms - gpst.Second) / 100) % 100;
-    gpst.Hour   = (int)hms / 10000;
+    int32_t hms = NMEA_real_to_int(param[1]);
+    gpst.Second = hms % 100;
+    gpst.Minute = (hms / 100) % 100;
+    gpst.Hour   = hms / 10000;
 #endif // PIOS_GPS_MINIMAL
 
     // don't process void sentences
@@ -585,12 +615,11 @@ static bool nmeaProcessGxRMC(GPSPositionSensorData *GpsData, bool *gpsDataUpdate
     GpsData->Heading     = NMEA_real_to_float(param[8]);
 
 #if !defined(PIOS_GPS_MINIMAL)
-    // get Date of fix
-    // TODO: Should really not use a float here to be safe
-    float date = NMEA_real_to_float(param[9]);
-    gpst.Year  = (int)date % 100;
-    gpst.Month = (((int)date - gpst.Year) / 100) % 100;
-    gpst.Day   = (int)(date / 10000);
+    // get Date of fix [ddmmyy]
+    int32_t date = NMEA_real_to_int(param[9]);
+    gpst.Year  = date % 100;
+    gpst.Month = (date / 100) % 100;
+    gpst.Day   = date / 10000;
     gpst.Year += 2000;
     GPSTimeSet(&gpst);
 #endif // PIOS_GPS_MINIMAL
@@ -646,15 +675,15 @@ static bool nmeaProcessGxZDA(__attribute__((unused)) GPSPositionSensorData *GpsD
     GPSTimeGet(&gpst);
 
     // get UTC time [hhmmss.sss]
-    float hms = NMEA_real_to_float(param[1]);
-    gpst.Second = (int)hms % 100;
-    gpst.Minute = (((int)hms - gpst.Second) / 100) % 100;
-    gpst.Hour   = (int)hms / 10000;
+    int32_t hms = NMEA_real_to_int(param[1]);
+    gpst.Second = hms % 100;
+    gpst.Minute = (hms / 100) % 100;
+    gpst.Hour   = hms / 10000;
 
     // Get Date
-    gpst.Day    = atoi(param[2]);
-    gpst.Month  = atoi(param[3]);
-    gpst.Year   = atoi(param[4]);
+    gpst.Day    = NMEA_real_to_int(param[2]);
+    gpst.Month  = NMEA_real_to_int(param[3]);
+    gpst.Year   = NMEA_real_to_int(param[4]);
 
     GPSTimeSet(&gpst);
     return true;
@@ -679,8 +708,8 @@ static bool nmeaProcessGxGSV(__attribute__((unused)) GPSPositionSensorData *GpsD
     DEBUG_MSG(" Sats=%s\n", param[3]);
 #endif
 
-    uint8_t nbSentences  = atoi(param[1]);
-    uint8_t currSentence = atoi(param[2]);
+    uint8_t nbSentences  = NMEA_real_to_int(param[1]);
+    uint8_t currSentence = NMEA_real_to_int(param[2]);
 
     *gpsDataUpdated = false;
 
@@ -688,7 +717,7 @@ static bool nmeaProcessGxGSV(__attribute__((unused)) GPSPositionSensorData *GpsD
         return false;
     }
 
-    gsv_partial.SatsInView = atoi(param[3]);
+    gsv_partial.SatsInView = NMEA_real_to_int(param[3]);
 
     // Find out if this is the first sentence in the GSV set
     if (currSentence == 1) {
@@ -723,10 +752,10 @@ static bool nmeaProcessGxGSV(__attribute__((unused)) GPSPositionSensorData *GpsD
             uint8_t sat_index = ((currSentence - 1) * 4) + i;
 
             // Get sat info
-            gsv_partial.PRN[sat_index]       = atoi(param[parIdx++]);
-            gsv_partial.Elevation[sat_index] = atoi(param[parIdx++]);
-            gsv_partial.Azimuth[sat_index]   = atoi(param[parIdx++]);
-            gsv_partial.SNR[sat_index]       = atoi(param[parIdx++]);
+            gsv_partial.PRN[sat_index]       = NMEA_real_to_int(param[parIdx++]);
+            gsv_partial.Elevation[sat_index] = NMEA_real_to_int(param[parIdx++]);
+            gsv_partial.Azimuth[sat_index]   = NMEA_real_to_int(param[parIdx++]);
+            gsv_partial.SNR[sat_index]       = NMEA_real_to_int(param[parIdx++]);
 #ifdef NMEA_DEBUG_GSV
             DEBUG_MSG(" %d", gsv_partial.PRN[sat_index]);
 #endif
@@ -770,7 +799,7 @@ static bool nmeaProcessGxGSA(GPSPositionSensorData *GpsData, bool *gpsDataUpdate
 
     *gpsDataUpdated = false;
 
-    switch (atoi(param[2])) {
+    switch (NMEA_real_to_int(param[2])) {
     case 1:
         GpsData->Status = GPSPOSITIONSENSOR_STATUS_NOFIX;
         break;
@@ -40,6 +40,7 @@
 #include "inc/UBX.h"
 #include "inc/GPS.h"
 #include <string.h>
+#include <stddef.h>
 
 #if !defined(PIOS_GPS_MINIMAL)
 #include <auxmagsupport.h>
@@ -55,43 +56,44 @@ static uint32_t lastPvtTime = 0;
 
 // parse table item
 typedef struct {
-    uint8_t msgClass;
-    uint8_t msgID;
-    void (*handler)(struct UBXPacket *, GPSPositionSensorData *GpsPosition);
+    uint8_t  msgClass;
+    uint8_t  msgID;
+    uint16_t minLength; // shorter messages are dropped, the payload may be read in place from the rx buffer
+    void     (*handler)(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
 } ubx_message_handler;
 
 // parsing functions, roughly ordered by reception rate (higher rate messages on top)
-static void parse_ubx_nav_posllh(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_nav_velned(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_nav_sol(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_nav_dop(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_posllh(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_velned(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_sol(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_dop(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
 #if !defined(PIOS_GPS_MINIMAL)
-static void parse_ubx_nav_pvt(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_nav_timeutc(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_nav_svinfo(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_op_sys(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_op_mag(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_ack_ack(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_ack_nak(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
-static void parse_ubx_mon_ver(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_pvt(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_timeutc(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_nav_svinfo(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_op_sys(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_op_mag(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_ack_ack(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_ack_nak(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
+static void parse_ubx_mon_ver(UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
 #endif /* !defined(PIOS_GPS_MINIMAL) */
 
 const ubx_message_handler ubx_handler_table[] = {
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_POSLLH,  .handler = &parse_ubx_nav_posllh  },
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_VELNED,  .handler = &parse_ubx_nav_velned  },
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_SOL,     .handler = &parse_ubx_nav_sol     },
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_DOP,     .handler = &parse_ubx_nav_dop     },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_POSLLH, .minLength = sizeof(struct UBX_NAV_POSLLH), .handler = &parse_ubx_nav_posllh },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_VELNED, .minLength = sizeof(struct UBX_NAV_VELNED), .handler = &parse_ubx_nav_velned },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_SOL, .minLength = sizeof(struct UBX_NAV_SOL), .handler = &parse_ubx_nav_sol },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_DOP, .minLength = sizeof(struct UBX_NAV_DOP), .handler = &parse_ubx_nav_dop },
 #if !defined(PIOS_GPS_MINIMAL)
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_PVT,     .handler = &parse_ubx_nav_pvt     },
-    { .msgClass = UBX_CLASS_OP_CUST, .msgID = UBX_ID_OP_MAG,      .handler = &parse_ubx_op_mag      },
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_SVINFO,  .handler = &parse_ubx_nav_svinfo  },
-    { .msgClass = UBX_CLASS_NAV,     .msgID = UBX_ID_NAV_TIMEUTC, .handler = &parse_ubx_nav_timeutc },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_PVT, .minLength = sizeof(struct UBX_NAV_PVT), .handler = &parse_ubx_nav_pvt },
+    { .msgClass = UBX_CLASS_OP_CUST, .msgID = UBX_ID_OP_MAG, .minLength = sizeof(struct UBX_OP_MAG), .handler = &parse_ubx_op_mag },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_SVINFO, .minLength = offsetof(struct UBX_NAV_SVINFO, sv), .handler = &parse_ubx_nav_svinfo },
+    { .msgClass = UBX_CLASS_NAV, .msgID = UBX_ID_NAV_TIMEUTC, .minLength = sizeof(struct UBX_NAV_TIMEUTC), .handler = &parse_ubx_nav_timeutc },
 
-    { .msgClass = UBX_CLASS_OP_CUST, .msgID = UBX_ID_OP_SYS,      .handler = &parse_ubx_op_sys      },
-    { .msgClass = UBX_CLASS_ACK,     .msgID = UBX_ID_ACK_ACK,     .handler = &parse_ubx_ack_ack     },
-    { .msgClass = UBX_CLASS_ACK,     .msgID = UBX_ID_ACK_NAK,     .handler = &parse_ubx_ack_nak     },
+    { .msgClass = UBX_CLASS_OP_CUST, .msgID = UBX_ID_OP_SYS, .minLength = sizeof(struct UBX_OP_SYSINFO), .handler = &parse_ubx_op_sys },
+    { .msgClass = UBX_CLASS_ACK, .msgID = UBX_ID_ACK_ACK, .minLength = sizeof(struct UBX_ACK_ACK), .handler = &parse_ubx_ack_ack },
+    { .msgClass = UBX_CLASS_ACK, .msgID = UBX_ID_ACK_NAK, .minLength = sizeof(struct UBX_ACK_NAK), .handler = &parse_ubx_ack_nak },
 
-    { .msgClass = UBX_CLASS_MON,     .msgID = UBX_ID_MON_VER,     .handler = &parse_ubx_mon_ver     },
+    { .msgClass = UBX_CLASS_MON, .msgID = UBX_ID_MON_VER, .minLength = offsetof(struct UBX_MON_VER, extension), .handler = &parse_ubx_mon_ver },
 #endif /* !defined(PIOS_GPS_MINIMAL) */
 };
 #define UBX_HANDLER_TABLE_SIZE NELEMENTS(ubx_handler_table)
@@ -104,7 +106,13 @@ struct UBX_ACK_ACK ubxLastAck;
 struct UBX_ACK_NAK ubxLastNak;
 
 // If a PVT sentence is received in the last UBX_PVT_TIMEOUT (ms) timeframe it disables VELNED/POSLLH/SOL/TIMEUTC
-#define UBX_PVT_TIMEOUT (1000)
+#define UBX_PVT_TIMEOUT    (1000)
+
+// sync chars, class, id, length and checksum around the payload of a UBX frame
+#define UBX_FRAME_OVERHEAD 8
+
+static void ubx_checksum_update(const uint8_t *data, uint16_t len, uint8_t *ck_a, uint8_t *ck_b);
+static uint32_t dispatch_ubx_message(uint8_t class, uint8_t id, UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition);
 
 // parse incoming character stream for messages in UBX binary format
 int parse_ubx_stream(uint8_t *rx, uint16_t len, char *gps_rx_buffer, GPSPositionSensorData *GpsData, struct GPS_RX_STATS *gpsRxStats)
@@ -137,6 +145,43 @@ int parse_ubx_stream(uint8_t *rx, uint16_t len, char *gps_rx_buffer, GPSPosition
     // switch continue is the normal condition and comes back to here for another byte
     // switch break is the error state that branches to the end and restarts the scan at the byte after the first sync byte
     while (i < len) {
+        if (proto_state == START) {
+            // between messages, frames that are complete in the rx buffer are checked and decoded where they are
+            // only a frame split across two reads goes through the state machine and gps_rx_buffer
+            uint8_t *frame = memchr(&rx[i], UBX_SYNC1, len - i);
+            if (frame == NULL) {
+                break;
+            }
+            i = frame - rx;
+            if (len - i >= 2 && frame[1] != UBX_SYNC2) {
+                // restart at the byte after SYNC1
+                i++;
+                continue;
+            }
+            if (len - i >= UBX_FRAME_OVERHEAD) {
+                uint16_t payloadLen = frame[4] | (frame[5] << 8);
+                if (payloadLen <= sizeof(UBXPayload) && len - i >= payloadLen + UBX_FRAME_OVERHEAD) {
+                    uint8_t ck_a = 0, ck_b = 0;
+                    // class, id, length and payload are contiguous
+                    ubx_checksum_update(&frame[2], payloadLen + 4, &ck_a, &ck_b);
+                    if (frame[payloadLen + 6] == ck_a && frame[payloadLen + 7] == ck_b) {
+                        gpsRxStats->gpsRxReceived++;
+                        // see UBX_CHK2 below
+                        if (dispatch_ubx_message(frame[2], frame[3], (UBXPayload *)&frame[6], payloadLen, GpsData) == GPSPOSITIONSENSOR_OBJID
+                            && ret == PARSER_INCOMPLETE) {
+                            ret = PARSER_COMPLETE;
+                        }
+                        i += payloadLen + UBX_FRAME_OVERHEAD;
+                    } else {
+                        gpsRxStats->gpsRxChkSumError++;
+                        ret = PARSER_ERROR;
+                        i++;
+                    }
+                    continue;
+                }
+            }
+            // the frame continues in the next read (or is too large), the state machine takes it from here
+        }
         c = rx[i++];
         switch (proto_state) {
         case START: // detect protocol
@@ -213,12 +258,16 @@ int parse_ubx_stream(uint8_t *rx, uint16_t len, char *gps_rx_buffer, GPSPosition
             }
             continue;
         case UBX_PAYLOAD:
-            if (rx_count < ubx->header.len) {
-                ubx->payload.payload[rx_count] = c;
-                if (++rx_count == ubx->header.len) {
-                    proto_state = UBX_CHK1;
-                }
+        {
+            // copy as much of the payload as this read holds at once, c is its first byte
+            uint16_t count = MIN(ubx->header.len - rx_count, len - i + 1);
+            memcpy(&ubx->payload.payload[rx_count], &rx[i - 1], count);
+            rx_count += count;
+            i += count - 1;
+            if (rx_count == ubx->header.len) {
+                proto_state = UBX_CHK1;
             }
+        }
             continue;
         case UBX_CHK1:
             ubx->header.ck_a = c;
@@ -302,9 +351,22 @@ bool check_msgtracker(uint32_t tow, uint8_t msg_flag)
     return true;
 }
 
+// Fletcher checksum of a span of a UBX frame
+static void ubx_checksum_update(const uint8_t *data, uint16_t len, uint8_t *ck_a, uint8_t *ck_b)
+{
+    uint8_t a = *ck_a;
+    uint8_t b = *ck_b;
+
+    for (uint16_t i = 0; i < len; i++) {
+        a += data[i];
+        b += a;
+    }
+    *ck_a = a;
+    *ck_b = b;
+}
+
 bool checksum_ubx_message(struct UBXPacket *ubx)
 {
-    int i;
     uint8_t ck_a, ck_b;
 
     ck_a  = ubx->header.class;
@@ -319,10 +381,7 @@ bool checksum_ubx_message(struct UBXPacket *ubx)
     ck_a += ubx->header.len >> 8;
     ck_b += ck_a;
 
-    for (i = 0; i < ubx->header.len; i++) {
-        ck_a += ubx->payload.payload[i];
-        ck_b += ck_a;
-    }
+    ubx_checksum_update(ubx->payload.payload, ubx->header.len, &ck_a, &ck_b);
 
     if (ubx->header.ck_a == ck_a &&
         ubx->header.ck_b == ck_b) {
@@ -332,12 +391,12 @@ bool checksum_ubx_message(struct UBXPacket *ubx)
     }
 }
 
-static void parse_ubx_nav_posllh(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_posllh(UBXPayload *payload, __attribute__((unused)) uint16_t len, GPSPositionSensorData *GpsPosition)
 {
     if (usePvt) {
         return;
     }
-    struct UBX_NAV_POSLLH *posllh = &ubx->payload.nav_posllh;
+    struct UBX_NAV_POSLLH *posllh = &payload->nav_posllh;
 
     if (check_msgtracker(posllh->iTOW, POSLLH_RECEIVED)) {
         if (GpsPosition->Status != GPSPOSITIONSENSOR_STATUS_NOFIX) {
@@ -349,12 +408,12 @@ static void parse_ubx_nav_posllh(struct UBXPacket *ubx, GPSPositionSensorData *G
     }
 }
 
-static void parse_ubx_nav_sol(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_sol(UBXPayload *payload, __attribute__((unused)) uint16_t len, GPSPositionSensorData *GpsPosition)
 {
     if (usePvt) {
         return;
     }
-    struct UBX_NAV_SOL *sol = &ubx->payload.nav_sol;
+    struct UBX_NAV_SOL *sol = &payload->nav_sol;
     if (check_msgtracker(sol->iTOW, SOL_RECEIVED)) {
         GpsPosition->Satellites = sol->numSV;
 
@@ -374,9 +433,9 @@ static void parse_ubx_nav_sol(struct UBXPacket *ubx, GPSPositionSensorData *GpsP
     }
 }
 
-static void parse_ubx_nav_dop(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_dop(UBXPayload *payload, __attribute__((unused)) uint16_t len, GPSPositionSensorData *GpsPosition)
 {
-    struct UBX_NAV_DOP *dop = &ubx->payload.nav_dop;
+    struct UBX_NAV_DOP *dop = &payload->nav_dop;
 
     if (check_msgtracker(dop->iTOW, DOP_RECEIVED)) {
         GpsPosition->HDOP = (float)dop->hDOP * 0.01f;
@@ -385,13 +444,13 @@ static void parse_ubx_nav_dop(struct UBXPacket *ubx, GPSPositionSensorData *GpsP
     }
 }
 
-static void parse_ubx_nav_velned(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_velned(UBXPayload *payload, __attribute__((unused)) uint16_t len, GPSPositionSensorData *GpsPosition)
 {
     if (usePvt) {
         return;
     }
     GPSVelocitySensorData GpsVelocity;
-    struct UBX_NAV_VELNED *velned = &ubx->payload.nav_velned;
+    struct UBX_NAV_VELNED *velned = &payload->nav_velned;
     if (check_msgtracker(velned->iTOW, VELNED_RECEIVED)) {
         if (GpsPosition->Status != GPSPOSITIONSENSOR_STATUS_NOFIX) {
             GpsVelocity.North        = (float)velned->velN / 100.0f;
@@ -405,12 +464,12 @@ static void parse_ubx_nav_velned(struct UBXPacket *ubx, GPSPositionSensorData *G
 }
 
 #if !defined(PIOS_GPS_MINIMAL)
-static void parse_ubx_nav_pvt(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_pvt(UBXPayload *payload, __attribute__((unused)) uint16_t len, GPSPositionSensorData *GpsPosition)
 {
     lastPvtTime = PIOS_DELAY_GetuS();
 
     GPSVelocitySensorData GpsVelocity;
-    struct UBX_NAV_PVT *pvt = &ubx->payload.nav_pvt;
+    struct UBX_NAV_PVT *pvt = &payload->nav_pvt;
     check_msgtracker(pvt->iTOW, (ALL_RECEIVED));
 
     GpsVelocity.North = (float)pvt->velN * 0.001f;
@@ -456,13 +515,13 @@ static void parse_ubx_nav_pvt(struct UBXPacket *ubx, GPSPositionSensorData *GpsP
     }
 }
 
-static void parse_ubx_nav_timeutc(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_timeutc(UBXPayload *payload, __attribute__((unused)) uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
     if (usePvt) {
         return;
     }
 
-    struct UBX_NAV_TIMEUTC *timeutc = &ubx->payload.nav_timeutc;
+    struct UBX_NAV_TIMEUTC *timeutc = &payload->nav_timeutc;
     // Test if time is valid
     if ((timeutc->valid & TIMEUTC_VALIDTOW) && (timeutc->valid & TIMEUTC_VALIDWKN)) {
         // Time is valid, set GpsTime
@@ -482,16 +541,18 @@ static void parse_ubx_nav_timeutc(struct UBXPacket *ubx, __attribute__((unused))
     }
 }
 
-static void parse_ubx_nav_svinfo(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_nav_svinfo(UBXPayload *payload, uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
     uint8_t chan;
     GPSSatellitesData svdata;
-    struct UBX_NAV_SVINFO *svinfo = &ubx->payload.nav_svinfo;
+    struct UBX_NAV_SVINFO *svinfo = &payload->nav_svinfo;
+    // never read past the end of the message, it may be in the rx buffer
+    uint8_t numCh = MIN(svinfo->numCh, (len - offsetof(struct UBX_NAV_SVINFO, sv)) / sizeof(struct UBX_NAV_SVINFO_SV));
 
     svdata.SatsInView = 0;
 
     // First, use slots for SVs actually being received
-    for (chan = 0; chan < svinfo->numCh; chan++) {
+    for (chan = 0; chan < numCh; chan++) {
         if (svdata.SatsInView < GPSSATELLITES_PRN_NUMELEM && svinfo->sv[chan].cno > 0) {
             svdata.Azimuth[svdata.SatsInView]   = svinfo->sv[chan].azim;
             svdata.Elevation[svdata.SatsInView] = svinfo->sv[chan].elev;
@@ -502,7 +563,7 @@ static void parse_ubx_nav_svinfo(struct UBXPacket *ubx, __attribute__((unused))
     }
 
     // Now try to add the rest
-    for (chan = 0; chan < svinfo->numCh; chan++) {
+    for (chan = 0; chan < numCh; chan++) {
         if (svdata.SatsInView < GPSSATELLITES_PRN_NUMELEM && 0 == svinfo->sv[chan].cno) {
             svdata.Azimuth[svdata.SatsInView]   = svinfo->sv[chan].azim;
             svdata.Elevation[svdata.SatsInView] = svinfo->sv[chan].elev;
@@ -523,23 +584,23 @@ static void parse_ubx_nav_svinfo(struct UBXPacket *ubx, __attribute__((unused))
     GPSSatellitesSet(&svdata);
 }
 
-static void parse_ubx_ack_ack(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_ack_ack(UBXPayload *payload, __attribute__((unused)) uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
-    struct UBX_ACK_ACK *ack_ack = &ubx->payload.ack_ack;
+    struct UBX_ACK_ACK *ack_ack = &payload->ack_ack;
 
     ubxLastAck = *ack_ack;
 }
 
-static void parse_ubx_ack_nak(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_ack_nak(UBXPayload *payload, __attribute__((unused)) uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
-    struct UBX_ACK_NAK *ack_nak = &ubx->payload.ack_nak;
+    struct UBX_ACK_NAK *ack_nak = &payload->ack_nak;
 
     ubxLastNak = *ack_nak;
 }
 
-static void parse_ubx_mon_ver(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_mon_ver(UBXPayload *payload, __attribute__((unused)) uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
-    struct UBX_MON_VER *mon_ver = &ubx->payload.mon_ver;
+    struct UBX_MON_VER *mon_ver = &payload->mon_ver;
 
     ubxHwVersion  = atoi(mon_ver->hwVersion);
     ubxSensorType = (ubxHwVersion >= UBX_HW_VERSION_8) ? GPSPOSITIONSENSOR_SENSORTYPE_UBX8 :
@@ -549,9 +610,9 @@ static void parse_ubx_mon_ver(struct UBXPacket *ubx, __attribute__((unused)) GPS
     GPSPositionSensorSensorTypeSet((uint8_t *)&ubxSensorType);
 }
 
-static void parse_ubx_op_sys(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_op_sys(UBXPayload *payload, __attribute__((unused)) uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
-    struct UBX_OP_SYSINFO *sysinfo = &ubx->payload.op_sysinfo;
+    struct UBX_OP_SYSINFO *sysinfo = &payload->op_sysinfo;
     GPSExtendedStatusData data;
 
     data.FlightTime   = sysinfo->flightTime;
@@ -564,12 +625,12 @@ static void parse_ubx_op_sys(struct UBXPacket *ubx, __attribute__((unused)) GPSP
     GPSExtendedStatusSet(&data);
 }
 
-static void parse_ubx_op_mag(struct UBXPacket *ubx, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
+static void parse_ubx_op_mag(UBXPayload *payload, __attribute__((unused)) uint16_t len, __attribute__((unused)) GPSPositionSensorData *GpsPosition)
 {
     if (!useMag) {
         return;
     }
-    struct UBX_OP_MAG *mag = &ubx->payload.op_mag;
+    struct UBX_OP_MAG *mag = &payload->op_mag;
     float mags[3] = { mag->x, mag->y, mag->z };
     auxmagsupport_publish_samples(mags, AUXMAGSENSOR_STATUS_OK);
 }
@@ -579,7 +640,13 @@ static void parse_ubx_op_mag(struct UBXPacket *ubx, __attribute__((unused)) GPSP
 // returns UAVObjectID if a UAVObject structure is ready for further processing
 uint32_t parse_ubx_message(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosition)
 {
-    uint32_t id = 0;
+    return dispatch_ubx_message(ubx->header.class, ubx->header.id, &ubx->payload, ubx->header.len, GpsPosition);
+}
+
+// same as parse_ubx_message() for a payload that may still be in the rx buffer
+static uint32_t dispatch_ubx_message(uint8_t class, uint8_t id, UBXPayload *payload, uint16_t len, GPSPositionSensorData *GpsPosition)
+{
+    uint32_t objId = 0;
     static bool ubxInitialized = false;
 
     if (!ubxInitialized) {
@@ -593,8 +660,10 @@ uint32_t parse_ubx_message(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosi
     usePvt = (lastPvtTime) && (PIOS_DELAY_GetuSSince(lastPvtTime) < UBX_PVT_TIMEOUT * 1000);
     for (uint8_t i = 0; i < UBX_HANDLER_TABLE_SIZE; i++) {
         const ubx_message_handler *handler = &ubx_handler_table[i];
-        if (handler->msgClass == ubx->header.class && handler->msgID == ubx->header.id) {
-            handler->handler(ubx, GpsPosition);
+        if (handler->msgClass == class && handler->msgID == id) {
+            if (len >= handler->minLength) {
+                handler->handler(payload, len, GpsPosition);
+            }
             break;
         }
     }
@@ -606,7 +675,7 @@ uint32_t parse_ubx_message(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosi
         GPSPositionSensorBaudRateGet(&GpsPosition->BaudRate);
         GPSPositionSensorSet(GpsPosition);
         msgtracker.msg_received = NONE_RECEIVED;
-        id = GPSPOSITIONSENSOR_OBJID;
+        objId = GPSPOSITIONSENSOR_OBJID;
     } else {
         uint8_t status;
         GPSPositionSensorStatusGet(&status);
@@ -620,7 +689,7 @@ uint32_t parse_ubx_message(struct UBXPacket *ubx, GPSPositionSensorData *GpsPosi
             GPSPositionSensorStatusSet(&status);
         }
     }
-    return id;
+    return objId;
 }
 
 #if !defined(PIOS_GPS_MINIMAL)
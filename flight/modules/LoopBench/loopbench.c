@@ -0,0 +1,328 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup LoopBenchModule LoopBench Module
+ * @brief Measures the control loop latency on the simposix target
+ * @{
+ *
+ * @file       loopbench.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Control loop latency benchmark
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/**
+ * Input objects: @ref GyroSensor @ref GyroState @ref ActuatorDesired @ref ActuatorCommand
+ * Output objects: None, prints a JSON report to stdout and exits
+ *
+ * Follows each gyro sample of the simulated sensors through
+ * Sensors -> StateEstimation -> Stabilization -> Actuator.
+ * Every stage is timestamped with PIOS_DELAY from a fast (synchronous) callback
+ * on its output object, so the measured latency includes the queueing and
+ * task switches between the modules but not the benchmark itself.
+ *
+ * Build with "make fw_simposix BENCHMARK=YES" and run without --lockstep,
+ * in lockstep mode PIOS_DELAY reports simulated rather than host time.
+ * Compare runs with StabilizationSettings.RateLoopFastPath set to False and True,
+ * the report states which one was used. With the fast path the whole rate loop
+ * runs from within the GyroState update, so only the end to end figure and
+ * sensors_to_state, which then covers all of it, mean anything.
+ */
+
+#include <openpilot.h>
+#include <time.h>
+
+#include "inc/loopbench.h"
+
+#include <gyrosensor.h>
+#include <gyrostate.h>
+#include <actuatordesired.h>
+#include <actuatorcommand.h>
+#include <stabilizationsettings.h>
+
+// Private constants
+#define STACK_SIZE_BYTES 2048
+#define TASK_PRIORITY    (tskIDLE_PRIORITY + 1)
+#define REPORT_PERIOD_MS 100
+
+#ifndef LOOPBENCH_WARMUP
+#define LOOPBENCH_WARMUP  500
+#endif
+#ifndef LOOPBENCH_SAMPLES
+#define LOOPBENCH_SAMPLES 5000
+#endif
+
+// Private types
+enum loopbench_stage {
+    STAGE_STATEESTIMATION = 0,
+    STAGE_STABILIZATION,
+    STAGE_ACTUATOR,
+    STAGE_ENDTOEND,
+    STAGE_COUNT
+};
+
+static const char *const stage_names[STAGE_COUNT] = {
+    "sensors_to_state",
+    "state_to_desired",
+    "desired_to_command",
+    "sensors_to_command",
+};
+
+/* time and sequence number of the gyro sample an object update originated from */
+struct loopbench_origin {
+    uint32_t time;
+    uint32_t seq;
+    uint32_t stamp;
+};
+
+// Private variables
+static xTaskHandle taskHandle;
+
+static struct loopbench_origin sensor;
+static struct loopbench_origin state;
+static struct loopbench_origin desired;
+
+static uint32_t updates[STAGE_COUNT];
+static uint32_t latency[STAGE_COUNT][LOOPBENCH_SAMPLES];
+static uint32_t backlog_max;
+static uint32_t backlog_sum;
+static volatile uint32_t samples;
+
+static struct timespec cpu_start;
+static struct timespec cpu_end;
+static uint32_t wall_start;
+static uint32_t wall_end;
+static uint32_t sensor_seq_start;
+static bool fastPath;
+
+// Private functions
+static void gyroSensorUpdatedCb(UAVObjEvent *ev);
+static void gyroStateUpdatedCb(UAVObjEvent *ev);
+static void actuatorDesiredUpdatedCb(UAVObjEvent *ev);
+static void actuatorCommandUpdatedCb(UAVObjEvent *ev);
+static void loopBenchTask(void *parameters);
+static void printReport(void);
+
+/**
+ * Initialise the module, called on startup
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t LoopBenchInitialize(void)
+{
+    GyroSensorInitialize();
+    GyroStateInitialize();
+    ActuatorDesiredInitialize();
+    ActuatorCommandInitialize();
+    StabilizationSettingsInitialize();
+
+    StabilizationSettingsRateLoopFastPathOptions fastPathSetting;
+    StabilizationSettingsRateLoopFastPathGet(&fastPathSetting);
+    fastPath = (fastPathSetting == STABILIZATIONSETTINGS_RATELOOPFASTPATH_TRUE);
+
+    GyroSensorConnectFastCallback(gyroSensorUpdatedCb);
+    GyroStateConnectFastCallback(gyroStateUpdatedCb);
+    ActuatorDesiredConnectFastCallback(actuatorDesiredUpdatedCb);
+    ActuatorCommandConnectFastCallback(actuatorCommandUpdatedCb);
+
+    return 0;
+}
+
+/**
+ * Start the module, called on startup
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t LoopBenchStart(void)
+{
+    xTaskCreate(loopBenchTask, "LoopBench", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &taskHandle);
+
+    return 0;
+}
+
+MODULE_INITCALL(LoopBenchInitialize, LoopBenchStart);
+
+/**
+ * Record a latency sample, the first LOOPBENCH_WARMUP loops are discarded
+ */
+static void record(enum loopbench_stage stage, uint32_t since, uint32_t now)
+{
+    if (updates[STAGE_ENDTOEND] >= LOOPBENCH_WARMUP && samples < LOOPBENCH_SAMPLES) {
+        latency[stage][samples] = PIOS_DELAY_DiffuS2(since, now);
+    }
+}
+
+static void gyroSensorUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    sensor.time  = PIOS_DELAY_GetRaw();
+    sensor.stamp = sensor.time;
+    sensor.seq++;
+}
+
+/**
+ * The gyro sample got to GyroState, once per sample
+ */
+static void stateReached(uint32_t now)
+{
+    if (state.seq == sensor.seq) {
+        return;
+    }
+    record(STAGE_STATEESTIMATION, sensor.stamp, now);
+    updates[STAGE_STATEESTIMATION]++;
+    state.time  = sensor.time;
+    state.seq   = sensor.seq;
+    state.stamp = now;
+}
+
+/**
+ * The gyro sample got to the mixer input, once per sample
+ */
+static void desiredReached(uint32_t now)
+{
+    if (desired.seq == state.seq) {
+        return;
+    }
+    record(STAGE_STABILIZATION, state.stamp, now);
+    updates[STAGE_STABILIZATION]++;
+    desired.time  = state.time;
+    desired.seq   = state.seq;
+    desired.stamp = now;
+}
+
+static void gyroStateUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    stateReached(PIOS_DELAY_GetRaw());
+}
+
+static void actuatorDesiredUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    uint32_t now = PIOS_DELAY_GetRaw();
+
+    if (fastPath) {
+        // the rate loop runs from within the GyroState update, before the callback above
+        stateReached(now);
+    }
+    desiredReached(now);
+}
+
+static void actuatorCommandUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    uint32_t now = PIOS_DELAY_GetRaw();
+
+    if (samples >= LOOPBENCH_SAMPLES) {
+        return;
+    }
+
+    if (fastPath) {
+        // the rate loop drives the outputs before it sets ActuatorDesired
+        stateReached(now);
+        desiredReached(now);
+    }
+    record(STAGE_ACTUATOR, desired.stamp, now);
+    record(STAGE_ENDTOEND, desired.time, now);
+    if (updates[STAGE_ENDTOEND] == LOOPBENCH_WARMUP) {
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+        wall_start = now;
+        sensor_seq_start = sensor.seq;
+    }
+    if (updates[STAGE_ENDTOEND] >= LOOPBENCH_WARMUP) {
+        /* gyro samples produced after the one this command was computed from */
+        uint32_t backlog = sensor.seq - desired.seq;
+
+        backlog_sum += backlog;
+        if (backlog > backlog_max) {
+            backlog_max = backlog;
+        }
+        if (++samples == LOOPBENCH_SAMPLES) {
+            clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_end);
+            wall_end = now;
+        }
+    }
+    updates[STAGE_ACTUATOR]++;
+    updates[STAGE_ENDTOEND]++;
+}
+
+/**
+ * Wait for enough samples, then report and end the simulation
+ */
+static void loopBenchTask(__attribute__((unused)) void *parameters)
+{
+    while (samples < LOOPBENCH_SAMPLES) {
+        vTaskDelay(REPORT_PERIOD_MS / portTICK_RATE_MS);
+    }
+    printReport();
+    fflush(stdout);
+    exit(0);
+}
+
+static int compareU32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void printReport(void)
+{
+    uint32_t wall_us = PIOS_DELAY_DiffuS2(wall_start, wall_end);
+    uint32_t sensor_updates = sensor.seq - sensor_seq_start;
+    UAVObjStats objStats;
+    EventStats eventStats;
+
+    uint64_t cpu_us = (uint64_t)(cpu_end.tv_sec - cpu_start.tv_sec) * 1000000 + (cpu_end.tv_nsec - cpu_start.tv_nsec) / 1000;
+    UAVObjGetStats(&objStats);
+    EventGetStats(&eventStats);
+
+    printf("{\n");
+    printf("  \"loops\": %u,\n", LOOPBENCH_SAMPLES);
+    printf("  \"rate_loop_fast_path\": %s,\n", fastPath ? "true" : "false");
+    printf("  \"wall_us\": %u,\n", wall_us);
+    printf("  \"sensor_rate_hz\": %.1f,\n", sensor_updates * 1e6 / wall_us);
+    printf("  \"loop_rate_hz\": %.1f,\n", LOOPBENCH_SAMPLES * 1e6 / wall_us);
+    printf("  \"cpu_us_per_loop\": %.2f,\n", (double)cpu_us / LOOPBENCH_SAMPLES);
+    printf("  \"latency_us\": {\n");
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        uint32_t *l = latency[stage];
+        uint64_t sum = 0;
+
+        qsort(l, LOOPBENCH_SAMPLES, sizeof(uint32_t), compareU32);
+        for (int i = 0; i < LOOPBENCH_SAMPLES; i++) {
+            sum += l[i];
+        }
+        printf("    \"%s\": { \"min\": %u, \"mean\": %.1f, \"p50\": %u, \"p90\": %u, \"p99\": %u, \"max\": %u }%s\n",
+               stage_names[stage], l[0], (double)sum / LOOPBENCH_SAMPLES,
+               l[LOOPBENCH_SAMPLES / 2], l[LOOPBENCH_SAMPLES * 9 / 10], l[LOOPBENCH_SAMPLES * 99 / 100], l[LOOPBENCH_SAMPLES - 1],
+               stage < STAGE_COUNT - 1 ? "," : "");
+    }
+    printf("  },\n");
+    printf("  \"updates\": { \"%s\": %u, \"%s\": %u, \"%s\": %u },\n",
+           stage_names[STAGE_STATEESTIMATION], updates[STAGE_STATEESTIMATION],
+           stage_names[STAGE_STABILIZATION], updates[STAGE_STABILIZATION],
+           stage_names[STAGE_ACTUATOR], updates[STAGE_ACTUATOR]);
+    printf("  \"queues\": { \"backlog_mean\": %.2f, \"backlog_max\": %u, \"event_queue_errors\": %u, \"event_callback_errors\": %u, \"event_dispatch_errors\": %u }\n",
+           (double)backlog_sum / LOOPBENCH_SAMPLES, backlog_max,
+           objStats.eventQueueErrors, objStats.eventCallbackErrors, eventStats.eventErrors);
+    printf("}\n");
+}
+
+/**
+ * @}
+ * @}
+ */
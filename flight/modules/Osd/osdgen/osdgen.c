@@ -116,6 +116,377 @@ struct splashEntry splash[3] = {
       llama_mask_bits }
 };
 
+// ****************
+// Dirty tiles
+//
+// The draw buffers are split into tiles of OSD_TILE_BYTES x OSD_TILE_LINES.
+// Instead of clearing a whole draw buffer before every frame, the primitives
+// mark the tiles they write. A tile that was drawn in the previous frame of
+// the same buffer is cleared the first time it is touched again, the tiles
+// nothing touched are cleared at the end of the frame. Each tile also records
+// who drew it, so an element whose inputs did not change since the previous
+// frame of the buffer can keep the pixels it left there instead of drawing
+// them again.
+
+#define OSD_TILE_BYTES      4
+#define OSD_TILE_LINES      8
+#define OSD_TILE_COLS       ((GRAPHICS_WIDTH + OSD_TILE_BYTES - 1) / OSD_TILE_BYTES)
+#define OSD_TILE_ROWS       ((GRAPHICS_HEIGHT + OSD_TILE_LINES - 1) / OSD_TILE_LINES)
+#define OSD_TILES           (OSD_TILE_COLS * OSD_TILE_ROWS)
+#define OSD_TILE_SET_WORDS  ((OSD_TILES + 31) / 32)
+
+// Tile owners: clean, drawn by element n (n + 1), or drawn by several
+#define OSD_TILE_CLEAN      0x00
+#define OSD_TILE_SHARED     0xff
+// Owner outside of updateOnceEveryFrame(), never stored in a tile
+#define OSD_TILE_UNTRACKED  0xfe
+
+#define OSD_ELEMENT_KEY_LEN 6
+
+// The blitter accesses the draw buffers a word at a time
+#define OSD_BUFFER_WORDS    ((GRAPHICS_WIDTH * GRAPHICS_HEIGHT) / 4)
+#if (GRAPHICS_WIDTH * GRAPHICS_HEIGHT) % 4
+#error "the OSD blitter needs the draw buffers to be a whole number of words"
+#endif
+
+// Pixels are stored most significant bit first, so the first pixel of a
+// buffer word is in its lowest byte on these little endian MCUs.
+#define OSD_WORD(bits)      __builtin_bswap32(bits)
+
+enum osd_element {
+    OSD_ELEMENT_TIME,
+    OSD_ELEMENT_HOME_ARROW,
+    OSD_ELEMENT_BATTERY,
+
+    OSD_ELEMENT_NUM_ELEMENTS // Must be last
+};
+
+struct osd_element_state {
+    bool    valid;
+    int32_t key[OSD_ELEMENT_KEY_LEN];
+    // tiles the element drew in, one bit each
+    uint32_t tiles[OSD_TILE_SET_WORDS];
+};
+
+struct osd_buffer_state {
+    // level buffer of the draw buffer pair this belongs to
+    uint8_t *level;
+    // tile owners after the last frame drawn in this buffer
+    uint8_t tiles[OSD_TILES];
+    struct osd_element_state elements[OSD_ELEMENT_NUM_ELEMENTS];
+};
+
+static struct osd_buffer_state osd_buffers[2];
+// buffer of the frame being drawn, NULL outside of updateOnceEveryFrame()
+static struct osd_buffer_state *osd_drawing;
+// tile owners of the frame being drawn
+static uint8_t osd_tiles[OSD_TILES];
+static uint8_t osd_owner = OSD_TILE_UNTRACKED;
+// element being drawn, if any
+static struct osd_element_state *osd_element;
+static bool osd_element_seen[OSD_ELEMENT_NUM_ELEMENTS];
+#ifdef UNIT_TEST
+// elements left in place instead of drawn again
+uint32_t osd_elements_kept;
+#endif
+
+static void osd_reset_buffer(struct osd_buffer_state *state)
+{
+    memset(state->tiles, OSD_TILE_SHARED, sizeof(state->tiles));
+    for (int e = 0; e < OSD_ELEMENT_NUM_ELEMENTS; e++) {
+        state->elements[e].valid = false;
+    }
+}
+
+static void osd_clear_tile(unsigned int col, unsigned int row)
+{
+    unsigned int y     = row * OSD_TILE_LINES;
+    unsigned int lines = MIN(OSD_TILE_LINES, GRAPHICS_HEIGHT - y);
+    unsigned int bytes = MIN(OSD_TILE_BYTES, GRAPHICS_WIDTH - col * OSD_TILE_BYTES);
+    unsigned int addr  = y * GRAPHICS_WIDTH + col * OSD_TILE_BYTES;
+
+    while (lines--) {
+        memset(draw_buffer_level + addr, 0, bytes);
+        memset(draw_buffer_mask + addr, 0, bytes);
+        addr += GRAPHICS_WIDTH;
+    }
+}
+
+static void osd_touch_tile(unsigned int col, unsigned int row)
+{
+    unsigned int tile = row * OSD_TILE_COLS + col;
+
+    if (osd_drawing == NULL) {
+        // Drawn outside of a tracked frame, forget what the buffer holds.
+        for (int i = 0; i < 2; i++) {
+            if (osd_buffers[i].level == draw_buffer_level) {
+                osd_buffers[i].level = NULL;
+            }
+        }
+        return;
+    }
+    if (osd_tiles[tile] == OSD_TILE_CLEAN) {
+        if (osd_drawing->tiles[tile] != OSD_TILE_CLEAN) {
+            osd_clear_tile(col, row);
+        }
+        osd_tiles[tile] = osd_owner;
+    } else if (osd_tiles[tile] != osd_owner) {
+        osd_tiles[tile] = OSD_TILE_SHARED;
+    }
+    if (osd_element) {
+        osd_element->tiles[tile / 32] |= 1u << (tile % 32);
+    }
+}
+
+// Mark a pixel about to be written.
+#define OSD_MARK_PIXEL(x, y) \
+    { unsigned int _col = (x) / (8 * OSD_TILE_BYTES), _row = (y) / OSD_TILE_LINES; \
+      if (osd_tiles[_row * OSD_TILE_COLS + _col] != osd_owner) { osd_touch_tile(_col, _row); } }
+
+/**
+ * osd_mark: Mark the bytes byte0..byte1 of lines y0..y1 as about to be written.
+ * Runs past the end of a line continue at the start of the next one, like the
+ * addresses do.
+ */
+static void osd_mark(unsigned int byte0, unsigned int byte1, unsigned int y0, unsigned int y1)
+{
+    if (byte1 >= GRAPHICS_WIDTH) {
+        osd_mark(0, byte1 - GRAPHICS_WIDTH, y0 + 1, y1 + 1);
+        byte1 = GRAPHICS_WIDTH - 1;
+    }
+    y1 = MIN(y1, GRAPHICS_HEIGHT - 1);
+    if (byte0 > byte1 || y0 > y1) {
+        return;
+    }
+    for (unsigned int row = y0 / OSD_TILE_LINES; row <= y1 / OSD_TILE_LINES; row++) {
+        for (unsigned int col = byte0 / OSD_TILE_BYTES; col <= byte1 / OSD_TILE_BYTES; col++) {
+            if (osd_tiles[row * OSD_TILE_COLS + col] != osd_owner) {
+                osd_touch_tile(col, row);
+            }
+        }
+    }
+}
+
+/**
+ * osd_frame_begin: Start tracking a frame drawn in the current draw buffers.
+ */
+static void osd_frame_begin(void)
+{
+    struct osd_buffer_state *state = NULL;
+
+    for (int i = 0; i < 2; i++) {
+        if (osd_buffers[i].level == draw_buffer_level) {
+            state = &osd_buffers[i];
+        }
+    }
+    if (state == NULL) {
+        // First tracked frame in this buffer, nothing is known about its contents.
+        state = (osd_buffers[0].level == NULL) ? &osd_buffers[0] : &osd_buffers[1];
+        osd_reset_buffer(state);
+        state->level = draw_buffer_level;
+    }
+    memset(osd_tiles, OSD_TILE_CLEAN, sizeof(osd_tiles));
+    memset(osd_element_seen, 0, sizeof(osd_element_seen));
+    osd_drawing = state;
+    osd_owner   = OSD_TILE_SHARED;
+}
+
+/**
+ * osd_frame_end: Clear what is left of the previous frame and remember what was drawn.
+ */
+static void osd_frame_end(void)
+{
+    struct osd_buffer_state *state = osd_drawing;
+
+    for (unsigned int row = 0; row < OSD_TILE_ROWS; row++) {
+        for (unsigned int col = 0; col < OSD_TILE_COLS; col++) {
+            unsigned int tile = row * OSD_TILE_COLS + col;
+            if (osd_tiles[tile] == OSD_TILE_CLEAN && state->tiles[tile] != OSD_TILE_CLEAN) {
+                osd_clear_tile(col, row);
+            }
+        }
+    }
+    memcpy(state->tiles, osd_tiles, sizeof(state->tiles));
+    for (int e = 0; e < OSD_ELEMENT_NUM_ELEMENTS; e++) {
+        if (!osd_element_seen[e]) {
+            state->elements[e].valid = false;
+        }
+    }
+    osd_drawing = NULL;
+    osd_owner   = OSD_TILE_UNTRACKED;
+
+    if (state->level != draw_buffer_level) {
+        // The buffers were swapped while drawing, the frame went partly to
+        // the other buffer.
+        osd_reset_buffer(&osd_buffers[0]);
+        osd_reset_buffer(&osd_buffers[1]);
+    }
+}
+
+/**
+ * osd_element_begin: Start drawing an element which only depends on key.
+ *
+ * @param       element element id
+ * @param       key             values the pixels of the element depend on, positions included
+ * @param       len             number of values in key (up to OSD_ELEMENT_KEY_LEN)
+ * @return      false if the pixels of the last frame are still valid and the
+ * element must not be drawn, true if it must be drawn and closed with osd_element_end()
+ */
+static bool osd_element_begin(enum osd_element element, const int32_t *key, int len)
+{
+    if (osd_drawing == NULL) {
+        return true;
+    }
+    struct osd_element_state *state = &osd_drawing->elements[element];
+    bool seen = osd_element_seen[element];
+    osd_element_seen[element] = true;
+    if (seen) {
+        // Drawn twice in a frame, don't try to follow that.
+        state->valid = false;
+        return true;
+    }
+
+    if (state->valid && memcmp(state->key, key, len * sizeof(int32_t)) == 0) {
+        // The pixels are still there if nothing else drew in the tiles of
+        // the element in the last frame, and nothing did so far in this one.
+        uint8_t owner = element + 1;
+        bool keep     = true;
+        for (unsigned int tile = 0; tile < OSD_TILES && keep; tile++) {
+            if ((state->tiles[tile / 32] & (1u << (tile % 32)))
+                && (osd_drawing->tiles[tile] != owner || osd_tiles[tile] != OSD_TILE_CLEAN)) {
+                keep = false;
+            }
+        }
+        if (keep) {
+            for (unsigned int tile = 0; tile < OSD_TILES; tile++) {
+                if (state->tiles[tile / 32] & (1u << (tile % 32))) {
+                    osd_tiles[tile] = owner;
+                }
+            }
+#ifdef UNIT_TEST
+            osd_elements_kept++;
+#endif
+            return false;
+        }
+    }
+
+    state->valid = false;
+    memset(state->key, 0, sizeof(state->key));
+    memcpy(state->key, key, len * sizeof(int32_t));
+    memset(state->tiles, 0, sizeof(state->tiles));
+    osd_element  = state;
+    osd_owner    = element + 1;
+    return true;
+}
+
+/**
+ * osd_element_end: Done drawing the element started with osd_element_begin().
+ */
+static void osd_element_end(void)
+{
+    if (osd_element) {
+        osd_element->valid = true;
+        osd_element = NULL;
+        osd_owner   = OSD_TILE_SHARED;
+    }
+}
+
+/**
+ * write_bits32: write up to 32 pixels of a line with aligned word accesses.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       bits    pixels to write, the first one in the most significant bit
+ * @param       pos             position of the first pixel, in pixels from the start of the buffer
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+static void write_bits32(uint8_t *buff, uint32_t bits, unsigned int pos, int mode)
+{
+    uint32_t *words    = (uint32_t *)buff;
+    unsigned int addr  = pos / 32;
+    unsigned int shift = pos % 32;
+
+    if (addr >= OSD_BUFFER_WORDS) {
+        return;
+    }
+    uint32_t first = OSD_WORD(bits >> shift);
+    WRITE_WORD_MODE(words, addr, first, mode);
+    if (shift && (bits << (32 - shift)) && addr + 1 < OSD_BUFFER_WORDS) {
+        uint32_t second = OSD_WORD(bits << (32 - shift));
+        WRITE_WORD_MODE(words, addr + 1, second, mode);
+    }
+}
+
+/**
+ * write_span: write the pixels start..end - 1 with aligned word accesses.
+ *
+ * @param       buff    pointer to buffer to write in
+ * @param       start   position of the first pixel, in pixels from the start of the buffer
+ * @param       end             position after the last pixel
+ * @param       mode    0 = clear, 1 = set, 2 = toggle
+ */
+static void write_span(uint8_t *buff, unsigned int start, unsigned int end, int mode)
+{
+    uint32_t *words = (uint32_t *)buff;
+
+    end = MIN(end, OSD_BUFFER_WORDS * 32);
+    if (start >= end) {
+        return;
+    }
+    unsigned int addr0  = start / 32;
+    unsigned int addr1  = (end - 1) / 32;
+    uint32_t mask_l     = OSD_WORD(0xffffffff >> (start % 32));
+    uint32_t mask_r     = OSD_WORD(0xffffffff << (31 - (end - 1) % 32));
+
+    if (addr0 == addr1) {
+        uint32_t mask = mask_l & mask_r;
+        WRITE_WORD_MODE(words, addr0, mask, mode);
+        return;
+    }
+    WRITE_WORD_MODE(words, addr0, mask_l, mode);
+    WRITE_WORD_MODE(words, addr1, mask_r, mode);
+    switch (mode) {
+    case 0:
+        memset(&words[addr0 + 1], 0x00, (addr1 - addr0 - 1) * 4);
+        break;
+    case 1:
+        memset(&words[addr0 + 1], 0xff, (addr1 - addr0 - 1) * 4);
+        break;
+    case 2:
+        for (unsigned int i = addr0 + 1; i < addr1; i++) {
+            words[i] = ~words[i];
+        }
+        break;
+    }
+}
+
+/**
+ * write_glyph_line: write one line of a glyph in both draw buffers. The mask
+ * pixels are set, then the level pixels of set are set and those of clear cleared.
+ *
+ * @param       pos             position of the first pixel, in pixels from the start of the buffer
+ * @param       mask    mask pixels, the first one in the most significant bit
+ * @param       set             level pixels to set
+ * @param       clear   level pixels to clear
+ */
+static void write_glyph_line(unsigned int pos, uint32_t mask, uint32_t set, uint32_t clear)
+{
+    uint32_t *mask_words  = (uint32_t *)draw_buffer_mask;
+    uint32_t *level_words = (uint32_t *)draw_buffer_level;
+    unsigned int addr     = pos / 32;
+    unsigned int shift    = pos % 32;
+
+    if (addr >= OSD_BUFFER_WORDS) {
+        return;
+    }
+    mask_words[addr]  |= OSD_WORD(mask >> shift);
+    level_words[addr]  = (level_words[addr] | OSD_WORD(set >> shift)) & ~OSD_WORD(clear >> shift);
+    if (shift && ((mask | set | clear) << (32 - shift)) && addr + 1 < OSD_BUFFER_WORDS) {
+        shift = 32 - shift;
+        mask_words[addr + 1] |= OSD_WORD(mask << shift);
+        level_words[addr + 1] = (level_words[addr + 1] | OSD_WORD(set << shift)) & ~OSD_WORD(clear << shift);
+    }
+}
+
 uint16_t mirror(uint16_t source)
 {
     int result = ((source & 0x8000) >> 7) | ((source & 0x4000) >> 5) | ((source & 0x2000) >> 3) | ((source & 0x1000) >> 1) | ((source & 0x0800) << 1)
@@ -130,6 +501,13 @@ void clearGraphics()
 {
     memset((uint8_t *)draw_buffer_mask, 0, GRAPHICS_WIDTH * GRAPHICS_HEIGHT);
     memset((uint8_t *)draw_buffer_level, 0, GRAPHICS_WIDTH * GRAPHICS_HEIGHT);
+    // Nothing of the last frame drawn in this buffer is left.
+    for (int i = 0; i < 2; i++) {
+        if (osd_buffers[i].level == draw_buffer_level) {
+            osd_reset_buffer(&osd_buffers[i]);
+            memset(osd_buffers[i].tiles, OSD_TILE_CLEAN, sizeof(osd_buffers[i].tiles));
+        }
+    }
 }
 
 void copyimage(uint16_t offsetx, uint16_t offsety, int image)
@@ -141,7 +519,8 @@ void copyimage(uint16_t offsetx, uint16_t offsety, int image)
     struct splashEntry splash_info;
     splash_info = splash[image];
     offsetx     = offsetx / 8;
-    for (uint16_t y = offsety; y < ((splash_info.height) + offsety); y++) {
+    osd_mark(offsetx, offsetx + splash_info.width / 8 - 1, offsety, offsety + splash_info.height - 1);
+    for (uint16_t y = offsety; y < ((splash_info.height) + offsety) && y < GRAPHICS_HEIGHT; y++) {
         uint16_t x1 = offsetx;
         for (uint16_t x = offsetx; x < (((splash_info.width) / 16) + offsetx); x++) {
             draw_buffer_level[y * GRAPHICS_WIDTH + x1 + 1] = (uint8_t)(
@@ -348,6 +727,7 @@ void drawBox(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 void write_pixel(uint8_t *buff, unsigned int x, unsigned int y, int mode)
 {
     CHECK_COORDS(x, y);
+    OSD_MARK_PIXEL(x, y);
     // Determine the bit in the word to be set and the word
     // index to set it in.
     int bitnum    = CALC_BIT_IN_WORD(x);
@@ -369,6 +749,7 @@ void write_pixel(uint8_t *buff, unsigned int x, unsigned int y, int mode)
 void write_pixel_lm(unsigned int x, unsigned int y, int mmode, int lmode)
 {
     CHECK_COORDS(x, y);
+    OSD_MARK_PIXEL(x, y);
     // Determine the bit in the word to be set and the word
     // index to set it in.
     int bitnum    = CALC_BIT_IN_WORD(x);
@@ -398,30 +779,15 @@ void write_hline(uint8_t *buff, unsigned int x0, unsigned int x1, unsigned int y
     if (x0 == x1) {
         return;
     }
-    /* This is an optimised algorithm for writing horizontal lines.
-    * We begin by finding the addresses of the x0 and x1 points. */
-    int addr0     = CALC_BUFF_ADDR(x0, y);
-    int addr1     = CALC_BUFF_ADDR(x1, y);
-    int addr0_bit = CALC_BIT_IN_WORD(x0);
-    int addr1_bit = CALC_BIT_IN_WORD(x1);
-    int mask, mask_l, mask_r, i;
-    /* If the addresses are equal, we only need to write one word
-     * which is an island. */
-    if (addr0 == addr1) {
-        mask = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
-        WRITE_WORD_MODE(buff, addr0, mask, mode);
-    } else {
-        /* Otherwise we need to write the edges and then the middle. */
-        mask_l = COMPUTE_HLINE_EDGE_L_MASK(addr0_bit);
-        mask_r = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
-        WRITE_WORD_MODE(buff, addr0, mask_l, mode);
-        WRITE_WORD_MODE(buff, addr1, mask_r, mode);
-        // Now write 0xffff words from start+1 to end-1.
-        for (i = addr0 + 1; i <= addr1 - 1; i++) {
-            uint8_t m = 0xff;
-            WRITE_WORD_MODE(buff, i, m, mode);
-        }
+    CHECK_COORD_Y(y);
+    /* A line within one byte ends before x1, a longer one includes it. */
+    if (x0 / 8 != x1 / 8) {
+        x1++;
     }
+    /* The pixels of a line are consecutive bits of the buffer, a line
+     * clipped to the right edge even spills over to the next line. */
+    osd_mark(x0 / 8, (x1 - 1) / 8, y, y);
+    write_span(buff, y * GRAPHICS_WIDTH_REAL + x0, y * GRAPHICS_WIDTH_REAL + x1, mode);
 }
 
 /**
@@ -491,6 +857,16 @@ void write_vline(uint8_t *buff, unsigned int x, unsigned int y0, unsigned int y1
     if (y0 == y1) {
         return;
     }
+    if (x == GRAPHICS_WIDTH_REAL) {
+        /* Clipped to the right edge, the column continues at the start
+         * of the next line. */
+        x = 0;
+        y0++;
+        y1++;
+    }
+    CHECK_COORD_Y(y0);
+    y1 = MIN(y1, GRAPHICS_HEIGHT_REAL - 1);
+    osd_mark(x / 8, x / 8, y0, y1);
     /* This is an optimised algorithm for writing vertical lines.
      * We begin by finding the addresses of the x,y0 and x,y1 points. */
     unsigned int addr0  = CALC_BUFF_ADDR(x, y0);
@@ -567,8 +943,6 @@ void write_vline_outlined(unsigned int x, unsigned int y0, unsigned int y1, int
  */
 void write_filled_rectangle(uint8_t *buff, unsigned int x, unsigned int y, unsigned int width, unsigned int height, int mode)
 {
-    unsigned int yy, addr0_old, addr1_old;
-
     CHECK_COORDS(x, y);
     CHECK_COORD_X(x + width);
     CHECK_COORD_Y(y + height);
@@ -576,47 +950,32 @@ void write_filled_rectangle(uint8_t *buff, unsigned int x, unsigned int y, unsig
         return;
     }
     // Calculate as if the rectangle was only a horizontal line. We then
-    // step these addresses through each row until we iterate `height` times.
-    unsigned int addr0     = CALC_BUFF_ADDR(x, y);
-    unsigned int addr1     = CALC_BUFF_ADDR(x + width, y);
-    unsigned int addr0_bit = CALC_BIT_IN_WORD(x);
-    unsigned int addr1_bit = CALC_BIT_IN_WORD(x + width);
-    unsigned int mask, mask_l, mask_r, i;
-    // If the addresses are equal, we need to write one word vertically.
-    if (addr0 == addr1) {
-        mask = COMPUTE_HLINE_ISLAND_MASK(addr0_bit, addr1_bit);
-        while (height--) {
-            WRITE_WORD_MODE(buff, addr0, mask, mode);
-            addr0 += GRAPHICS_WIDTH_REAL / 8;
-        }
+    // step it through each row until we iterate `height` times. Like a
+    // horizontal line, the rectangle includes x + width unless it is all
+    // in one byte.
+    unsigned int x1 = x + width;
+    unsigned int start0, end0, start1 = 0, end1 = 0;
+    if (x / 8 == x1 / 8) {
+        start0 = MIN(x, x1);
+        end0   = MAX(x, x1);
+    } else if (x1 > x) {
+        start0 = x;
+        end0   = x1 + 1;
     } else {
-        // Otherwise we need to write the edges and then the middle repeatedly.
-        mask_l    = COMPUTE_HLINE_EDGE_L_MASK(addr0_bit);
-        mask_r    = COMPUTE_HLINE_EDGE_R_MASK(addr1_bit);
-        // Write edges first.
-        yy        = 0;
-        addr0_old = addr0;
-        addr1_old = addr1;
-        while (yy < height) {
-            WRITE_WORD_MODE(buff, addr0, mask_l, mode);
-            WRITE_WORD_MODE(buff, addr1, mask_r, mode);
-            addr0 += GRAPHICS_WIDTH_REAL / 8;
-            addr1 += GRAPHICS_WIDTH_REAL / 8;
-            yy++;
-        }
-        // Now write 0xffff words from start+1 to end-1 for each row.
-        yy    = 0;
-        addr0 = addr0_old;
-        addr1 = addr1_old;
-        while (yy < height) {
-            for (i = addr0 + 1; i <= addr1 - 1; i++) {
-                uint8_t m = 0xff;
-                WRITE_WORD_MODE(buff, i, m, mode);
-            }
-            addr0 += GRAPHICS_WIDTH_REAL / 8;
-            addr1 += GRAPHICS_WIDTH_REAL / 8;
-            yy++;
-        }
+        // A negative width wrapped around. The bytes at both ends are
+        // filled up to the byte boundaries, and nothing between them.
+        start0 = x;
+        end0   = (x | 7) + 1;
+        start1 = x1 & ~7;
+        end1   = x1 + 1;
+        osd_mark(start1 / 8, (end1 - 1) / 8, y, y + height - 1);
+    }
+    osd_mark(start0 / 8, (end0 - 1) / 8, y, y + height - 1);
+    unsigned int pos = y * GRAPHICS_WIDTH_REAL;
+    while (height--) {
+        write_span(buff, pos + start0, pos + end0, mode);
+        write_span(buff, pos + start1, pos + end1, mode);
+        pos += GRAPHICS_WIDTH_REAL;
     }
 }
 
@@ -954,14 +1313,11 @@ void write_line_outlined(unsigned int x0, unsigned int y0, unsigned int x1, unsi
  */
 void write_word_misaligned(uint8_t *buff, uint16_t word, unsigned int addr, unsigned int xoff, int mode)
 {
-    int16_t firstmask = word >> xoff;
-    int16_t lastmask  = word << (16 - xoff);
+    // Pixels shifted past the third byte are dropped.
+    uint32_t bits = (((uint32_t)word << 16) >> xoff) & 0xffffff00;
 
-    WRITE_WORD_MODE(buff, addr + 1, firstmask && 0x00ff, mode);
-    WRITE_WORD_MODE(buff, addr, (firstmask & 0xff00) >> 8, mode);
-    if (xoff > 0) {
-        WRITE_WORD_MODE(buff, addr + 2, (lastmask & 0xff00) >> 8, mode);
-    }
+    osd_mark(addr % GRAPHICS_WIDTH, addr % GRAPHICS_WIDTH + 2, addr / GRAPHICS_WIDTH, addr / GRAPHICS_WIDTH);
+    write_bits32(buff, bits, addr * 8, mode);
 }
 
 /**
@@ -975,20 +1331,11 @@ void write_word_misaligned(uint8_t *buff, uint16_t word, unsigned int addr, unsi
  * @param       addr    address of first word
  * @param       xoff    x offset (0-15)
  *
- * This is identical to calling write_word_misaligned with a mode of 0 but
- * it doesn't go through a lot of switch logic which slows down text writing
- * a lot.
+ * This is identical to calling write_word_misaligned with a mode of 0.
  */
 void write_word_misaligned_NAND(uint8_t *buff, uint16_t word, unsigned int addr, unsigned int xoff)
 {
-    uint16_t firstmask = word >> xoff;
-    uint16_t lastmask  = word << (16 - xoff);
-
-    WRITE_WORD_NAND(buff, addr + 1, firstmask & 0x00ff);
-    WRITE_WORD_NAND(buff, addr, (firstmask & 0xff00) >> 8);
-    if (xoff > 0) {
-        WRITE_WORD_NAND(buff, addr + 2, (lastmask & 0xff00) >> 8);
-    }
+    write_word_misaligned(buff, word, addr, xoff, 0);
 }
 
 /**
@@ -1002,20 +1349,11 @@ void write_word_misaligned_NAND(uint8_t *buff, uint16_t word, unsigned int addr,
  * @param       addr    address of first word
  * @param       xoff    x offset (0-15)
  *
- * This is identical to calling write_word_misaligned with a mode of 1 but
- * it doesn't go through a lot of switch logic which slows down text writing
- * a lot.
+ * This is identical to calling write_word_misaligned with a mode of 1.
  */
 void write_word_misaligned_OR(uint8_t *buff, uint16_t word, unsigned int addr, unsigned int xoff)
 {
-    uint16_t firstmask = word >> xoff;
-    uint16_t lastmask  = word << (16 - xoff);
-
-    WRITE_WORD_OR(buff, addr + 1, firstmask & 0x00ff);
-    WRITE_WORD_OR(buff, addr, (firstmask & 0xff00) >> 8);
-    if (xoff > 0) {
-        WRITE_WORD_OR(buff, addr + 2, (lastmask & 0xff00) >> 8);
-    }
+    write_word_misaligned(buff, word, addr, xoff, 1);
 }
 
 /**
@@ -1073,19 +1411,19 @@ int fetch_font_info(uint8_t ch, int font, struct FontEntry *font_info, char *loo
  */
 void write_char16(char ch, unsigned int x, unsigned int y, int font)
 {
-    unsigned int yy, addr_temp, row, row_temp, xshift;
+    unsigned int yy, row, xshift;
     uint16_t and_mask, or_mask, levels;
     struct FontEntry font_info;
 
     // char lookup = 0;
     fetch_font_info(0, font, &font_info, NULL);
 
-    // Compute starting address (for x,y) of character.
-    int addr = CALC_BUFF_ADDR(x, y);
+    // Compute starting position (for x,y) of character.
+    unsigned int pos = y * GRAPHICS_WIDTH_REAL + x;
     int wbit = CALC_BIT_IN_WORD(x);
     // If font only supports lowercase or uppercase, make the letter
     // lowercase or uppercase.
-    // How big is the character? We handle characters up to 8 pixels
+    // How big is the character? We handle characters up to 16 pixels
     // wide for now. Support for large characters may be added in future.
     {
         // Ensure we don't overflow.
@@ -1093,27 +1431,15 @@ void write_char16(char ch, unsigned int x, unsigned int y, int font)
             return;
         }
         // Load data pointer.
-        row       = ch * font_info.height;
-        row_temp  = row;
-        addr_temp = addr;
-        xshift    = 16 - font_info.width;
-        // We can write mask words easily.
-        for (yy = y; yy < y + font_info.height; yy++) {
-            if (font == 3) {
-                write_word_misaligned_OR(draw_buffer_mask, font_mask12x18[row] << xshift, addr, wbit);
-            } else {
-                write_word_misaligned_OR(draw_buffer_mask, font_mask8x10[row] << xshift, addr, wbit);
-            }
-            addr += GRAPHICS_WIDTH_REAL / 8;
-            row++;
-        }
+        row    = (uint8_t)ch * font_info.height; // char is unsigned on the target
+        xshift = 16 - font_info.width;
+        osd_mark(x / 8, x / 8 + 2, y, y + font_info.height - 1);
         // Level bits are more complicated. We need to set or clear
         // level bits, but only where the mask bit is set; otherwise,
-        // we need to leave them alone. To do this, for each word, we
-        // construct an AND mask and an OR mask, and apply each individually.
-        row  = row_temp;
-        addr = addr_temp;
-        for (yy = y; yy < y + font_info.height; yy++) {
+        // we need to leave them alone. To do this, for each line, we
+        // construct an OR mask and an AND mask, and apply them with the
+        // mask line in one go.
+        for (yy = y; yy < y + font_info.height && yy < GRAPHICS_HEIGHT_REAL; yy++) {
             if (font == 3) {
                 levels   = font_frame12x18[row];
                 // if(!(flags & FONT_INVERT)) // data is normally inverted
@@ -1127,11 +1453,10 @@ void write_char16(char ch, unsigned int x, unsigned int y, int font)
                 or_mask  = font_mask8x10[row] << xshift;
                 and_mask = (font_mask8x10[row] & levels) << xshift;
             }
-            write_word_misaligned_OR(draw_buffer_level, or_mask, addr, wbit);
             // If we're not bold write the AND mask.
             // if(!(flags & FONT_BOLD))
-            write_word_misaligned_NAND(draw_buffer_level, and_mask, addr, wbit);
-            addr += GRAPHICS_WIDTH_REAL / 8;
+            write_glyph_line(pos, (uint32_t)or_mask << 16, (uint32_t)or_mask << 16, (uint32_t)and_mask << 16);
+            pos += GRAPHICS_WIDTH_REAL;
             row++;
         }
     }
@@ -1150,14 +1475,14 @@ void write_char16(char ch, unsigned int x, unsigned int y, int font)
  */
 void write_char(char ch, unsigned int x, unsigned int y, int flags, int font)
 {
-    unsigned int yy, addr_temp, row, row_temp, xshift;
+    unsigned int yy, row, xshift;
     uint16_t and_mask, or_mask, levels;
     struct FontEntry font_info;
     char lookup = 0;
 
     fetch_font_info(ch, font, &font_info, &lookup);
-    // Compute starting address (for x,y) of character.
-    unsigned int addr = CALC_BUFF_ADDR(x, y);
+    // Compute starting position (for x,y) of character.
+    unsigned int pos  = y * GRAPHICS_WIDTH_REAL + x;
     unsigned int wbit = CALC_BIT_IN_WORD(x);
     // If font only supports lowercase or uppercase, make the letter
     // lowercase or uppercase.
@@ -1174,23 +1499,15 @@ void write_char(char ch, unsigned int x, unsigned int y, int flags, int font)
             return;
         }
         // Load data pointer.
-        row       = lookup * font_info.height * 2;
-        row_temp  = row;
-        addr_temp = addr;
-        xshift    = 16 - font_info.width;
-        // We can write mask words easily.
-        for (yy = y; yy < y + font_info.height; yy++) {
-            write_word_misaligned_OR(draw_buffer_mask, font_info.data[row] << xshift, addr, wbit);
-            addr += GRAPHICS_WIDTH_REAL / 8;
-            row++;
-        }
+        row    = lookup * font_info.height * 2;
+        xshift = 16 - font_info.width;
+        osd_mark(x / 8, x / 8 + 2, y, y + font_info.height - 1);
         // Level bits are more complicated. We need to set or clear
         // level bits, but only where the mask bit is set; otherwise,
-        // we need to leave them alone. To do this, for each word, we
-        // construct an AND mask and an OR mask, and apply each individually.
-        row  = row_temp;
-        addr = addr_temp;
-        for (yy = y; yy < y + font_info.height; yy++) {
+        // we need to leave them alone. To do this, for each line, we
+        // construct an OR mask and an AND mask, and apply them with the
+        // mask line in one go.
+        for (yy = y; yy < y + font_info.height && yy < GRAPHICS_HEIGHT_REAL; yy++) {
             levels = font_info.data[row + font_info.height];
             if (!(flags & FONT_INVERT)) {
                 // data is normally inverted
@@ -1198,11 +1515,10 @@ void write_char(char ch, unsigned int x, unsigned int y, int flags, int font)
             }
             or_mask  = font_info.data[row] << xshift;
             and_mask = (font_info.data[row] & levels) << xshift;
-            write_word_misaligned_OR(draw_buffer_level, or_mask, addr, wbit);
             // If we're not bold write the AND mask.
             // if(!(flags & FONT_BOLD))
-            write_word_misaligned_NAND(draw_buffer_level, and_mask, addr, wbit);
-            addr += GRAPHICS_WIDTH_REAL / 8;
+            write_glyph_line(pos, (uint32_t)or_mask << 16, (uint32_t)or_mask << 16, (uint32_t)and_mask << 16);
+            pos += GRAPHICS_WIDTH_REAL;
             row++;
         }
     }
@@ -1554,7 +1870,11 @@ void drawBattery(uint16_t x, uint16_t y, uint8_t battery, uint16_t size)
 {
     int i = 0;
     int batteryLines;
+    const int32_t key[] = { x, y, battery, size };
 
+    if (!osd_element_begin(OSD_ELEMENT_BATTERY, key, SIZEOF_ARRAY(key))) {
+        return;
+    }
     // top
     /*drawLine((x)-1+(size/2-size/4), (y)-1, (x)-1 + (size/2+size/4), (y)-1);
        drawLine((x)-1+(size/2-size/4), (y)-1+1, (x)-1 + (size/2+size/4), (y)-1+1);
@@ -1579,16 +1899,22 @@ void drawBattery(uint16_t x, uint16_t y, uint8_t battery, uint16_t size)
     for (i = 0; i < batteryLines; i++) {
         write_hline_lm((x) - 1, (x) - 1 + size, (y) - 1 + size * 3 - i, 1, 1);
     }
+    osd_element_end();
 }
 
 void printTime(uint16_t x, uint16_t y)
 {
-    char temp[9] =
+    char temp[12] =
     { 0 };
+    const int32_t key[] = { x, y, timex.hour, timex.min, timex.sec };
 
+    if (!osd_element_begin(OSD_ELEMENT_TIME, key, SIZEOF_ARRAY(key))) {
+        return;
+    }
     sprintf(temp, "%02d:%02d:%02d", timex.hour, timex.min, timex.sec);
     // printTextFB(x,y,temp);
     write_string(temp, x, y, 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, 3);
+    osd_element_end();
 }
 
 /*
@@ -2095,6 +2421,12 @@ void calcHomeArrow(int16_t m_yaw)
     }
     // ! TODO: sanity check
 
+    // Only what is printed matters, the inputs change a lot more often.
+    const int32_t key[] = { (int)brng, (int)elevation, (int)d, (int)u2g, (int)(u2g / 22.5f) };
+    if (!osd_element_begin(OSD_ELEMENT_HOME_ARROW, key, SIZEOF_ARRAY(key))) {
+        return;
+    }
+
     char temp[50] =
     { 0 };
     sprintf(temp, "hea:%d", (int)brng);
@@ -2108,6 +2440,7 @@ void calcHomeArrow(int16_t m_yaw)
 
     sprintf(temp, "%c%c", (int)(u2g / 22.5f) * 2 + 0x90, (int)(u2g / 22.5f) * 2 + 0x91);
     write_string(temp, APPLY_HDEADBAND(250), APPLY_VDEADBAND(40 + 10 + 10), 0, 0, TEXT_VA_TOP, TEXT_HA_LEFT, 0, 3);
+    osd_element_end();
 }
 
 int lama = 10;
@@ -2389,8 +2722,9 @@ void updateGraphics()
 
 void updateOnceEveryFrame()
 {
-    clearGraphics();
+    osd_frame_begin();
     updateGraphics();
+    osd_frame_end();
 }
 
 // ****************
@@ -54,7 +54,7 @@ static bool overoEnabled;
 
 // Private functions
 static void overoSyncTask(void *parameters);
-static int32_t packData(uint8_t *data, int32_t length);
+static int32_t packData(const struct pios_com_iovec *iov, uint8_t iovcnt);
 static void registerObject(UAVObjHandle obj);
 
 // External variables
@@ -202,14 +202,16 @@ static void overoSyncTask(__attribute__((unused)) void *parameters)
 
 /**
  * Transmit data buffer to the modem or USB port.
- * \param[in] data Data buffer to send
- * \param[in] length Length of buffer
+ * \param[in] iov Segments of the frame to send
+ * \param[in] iovcnt Number of segments
  * \return -1 on failure
  * \return number of bytes transmitted on success
  */
-static int32_t packData(uint8_t *data, int32_t length)
+static int32_t packData(const struct pios_com_iovec *iov, uint8_t iovcnt)
 {
-    if (PIOS_COM_SendBufferNonBlocking(pios_com_overo_id, data, length) < 0) {
+    int32_t length = PIOS_COM_SendBufferVNonBlocking(pios_com_overo_id, iov, iovcnt);
+
+    if (length < 0) {
         goto fail;
     }
 
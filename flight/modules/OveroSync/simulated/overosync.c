@@ -56,7 +56,7 @@ FILE *fid;
 
 // Private functions
 static void overoSyncTask(void *parameters);
-static int32_t packData(uint8_t *data, int32_t length);
+static int32_t packData(const struct pios_com_iovec *iov, uint8_t iovcnt);
 static void registerObject(UAVObjHandle obj);
 
 struct dma_transaction {
@@ -212,21 +212,27 @@ static void overoSyncTask(__attribute__((unused)) void *parameters)
 
 /**
  * Transmit data buffer to the modem or USB port.
- * \param[in] data Data buffer to send
- * \param[in] length Length of buffer
+ * \param[in] iov Segments of the frame to send
+ * \param[in] iovcnt Number of segments
  * \return -1 on failure
  * \return number of bytes transmitted on success
  */
-static int32_t packData(uint8_t *data, int32_t length)
+static int32_t packData(const struct pios_com_iovec *iov, uint8_t iovcnt)
 {
+    int32_t length = 0;
+
     // Get the lock for manipulating the buffer
     xSemaphoreTake(overosync->buffer_lock, portMAX_DELAY);
 
     portTickType tickTime = xTaskGetTickCount();
-    uint64_t packetSize   = data[2] + (data[3] << 8);
+    // the header is always the first segment
+    uint64_t packetSize   = iov[0].base[2] + (iov[0].base[3] << 8);
     fwrite((void *)&tickTime, 1, sizeof(tickTime), fid);
     fwrite((void *)&packetSize, sizeof(packetSize), 1, fid);
-    fwrite((void *)data, 1, length, fid);
+    for (uint8_t i = 0; i < iovcnt; i++) {
+        fwrite((const void *)iov[i].base, 1, iov[i].len, fid);
+        length += iov[i].len;
+    }
     overosync->sent_bytes += length;
     overosync->sent_objects++;
 
@@ -32,6 +32,7 @@ extern "C" {
 #include <pid.h>
 #include <sin_lookup.h>
 #include <pathdesired.h>
+#include <paths.h>
 #include <fixedwingpathfollowersettings.h>
 #include <flightstatus.h>
 #include <pathstatus.h>
@@ -66,6 +66,7 @@ void FixedWingFlyController::Activate(void)
         SettingsUpdated();
         resetGlobals();
         mMode   = pathDesired->Mode;
+        path_segment_init(&pathSegment, pathDesired, true);
         lastAirspeedUpdate = 0;
     }
 }
@@ -82,7 +83,9 @@ uint8_t FixedWingFlyController::Mode(void)
 
 // Objective updated in pathdesired
 void FixedWingFlyController::ObjectiveUpdated(void)
-{}
+{
+    path_segment_init(&pathSegment, pathDesired, true);
+}
 
 void FixedWingFlyController::Deactivate(void)
 {
@@ -179,7 +182,7 @@ void FixedWingFlyController::updatePathVelocity(float kFF, bool limited)
                        positionState.East + (velocityState.East * kFF),
                        positionState.Down + (velocityState.Down * kFF) };
     struct path_status progress;
-    path_progress(pathDesired, cur, &progress, true);
+    path_segment_progress(&pathSegment, cur, &progress);
 
     // calculate velocity - can be zero if waypoints are too close
     velocityDesired.North = progress.path_vector[0];
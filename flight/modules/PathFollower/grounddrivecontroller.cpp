@@ -78,6 +78,7 @@ void GroundDriveController::Activate(void)
         SettingsUpdated();
         controlNE.Activate();
         mMode   = pathDesired->Mode;
+        path_segment_init(&pathSegment, pathDesired, false);
     }
 }
 
@@ -93,7 +94,9 @@ uint8_t GroundDriveController::Mode(void)
 
 // Objective updated in pathdesired
 void GroundDriveController::ObjectiveUpdated(void)
-{}
+{
+    path_segment_init(&pathSegment, pathDesired, false);
+}
 
 void GroundDriveController::Deactivate(void)
 {
@@ -178,7 +181,7 @@ void GroundDriveController::updatePathVelocity(float kFF)
                      positionState.East + (velocityState.East * kFF),
                      positionState.Down + (velocityState.Down * kFF) };
     struct path_status progress;
-    path_progress(pathDesired, cur, &progress, false);
+    path_segment_progress(&pathSegment, cur, &progress);
 
     // GOTOENDPOINT: correction_vector is distance array to endpoint, path_vector is velocity vector
     // FOLLOWVECTOR:  correct_vector is distance to vector path, path_vector is the desired velocity vector
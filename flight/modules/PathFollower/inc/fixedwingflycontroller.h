@@ -63,6 +63,7 @@ protected:
 
     uint8_t mActive;
     uint8_t mMode;
+    struct path_segment pathSegment; // PathDesired geometry, rebuilt when the objective changes
     // correct speed by measured airspeed
     float indicatedAirspeedStateBias;
 private:
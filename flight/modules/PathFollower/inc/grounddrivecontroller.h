@@ -65,6 +65,7 @@ private:
     GroundPathFollowerSettingsData *groundSettings;
     uint8_t mActive;
     uint8_t mMode;
+    struct path_segment pathSegment; // PathDesired geometry, rebuilt when the objective changes
     PIDControlNE controlNE;
 };
 
@@ -77,6 +77,7 @@ private:
     uint8_t mActive;
     uint8_t mManualThrust;
     uint8_t mMode;
+    struct path_segment pathSegment; // PathDesired geometry, rebuilt when the objective changes
     float vtolEmergencyFallback;
     bool vtolEmergencyFallbackSwitch;
 };
@@ -85,6 +85,7 @@ void VtolFlyController::Activate(void)
         controlNE.UpdateVelocitySetpoint(0.0f, 0.0f);
         controlNE.Activate();
         mMode = pathDesired->Mode;
+        path_segment_init(&pathSegment, pathDesired, true);
 
         vtolEmergencyFallback = 0.0f;
         vtolEmergencyFallbackSwitch = false;
@@ -103,7 +104,9 @@ uint8_t VtolFlyController::Mode(void)
 
 // Objective updated in pathdesired
 void VtolFlyController::ObjectiveUpdated(void)
-{}
+{
+    path_segment_init(&pathSegment, pathDesired, true);
+}
 
 
 void VtolFlyController::Deactivate(void)
@@ -182,7 +185,7 @@ void VtolFlyController::UpdateVelocityDesired()
                      positionState.East + (velocityState.East * vtolPathFollowerSettings->CourseFeedForward),
                      positionState.Down + (velocityState.Down * vtolPathFollowerSettings->CourseFeedForward) };
     struct path_status progress;
-    path_progress(pathDesired, cur, &progress, true);
+    path_segment_progress(&pathSegment, cur, &progress);
 
     controlNE.ControlPositionWithPath(&progress);
     if (!mManualThrust) {
@@ -508,7 +511,7 @@ float VtolFlyController::updatePathBearing()
                      positionState.Down };
     struct path_status progress;
 
-    path_progress(pathDesired, cur, &progress, true);
+    path_segment_progress(&pathSegment, cur, &progress);
 
     // atan2f always returns in between + and - 180 degrees
     return RAD2DEG(atan2f(progress.path_vector[1], progress.path_vector[0]));
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @addtogroup LibrePilotModules LibrePilot Modules
+ * @{
+ * @addtogroup PathPlanner Path Planner Module
+ * @{
+ *
+ * @file       missiontable.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Validated legs of the path plan
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MISSIONTABLE_H
+#define MISSIONTABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// compact copy of a path action, the fields the planner needs on every step
+struct mission_action {
+    float   modeParameters[4];
+    float   conditionParameters[4];
+    int16_t jumpDestination;
+    int16_t errorDestination;
+    uint8_t mode;
+    uint8_t endCondition;
+    uint8_t command;
+};
+
+// compact copy of a waypoint together with its path action
+struct mission_leg {
+    float   position[3]; // North, East, Down
+    float   velocity;
+    float   nextCourse; // horizontal direction of the leg to the following waypoint, as atan2f(north, east)
+    struct mission_action action;
+    uint8_t actionId; // PathAction instance the action was copied from
+};
+
+// the validated path plan, rebuilt from the Waypoint and PathAction instances whenever they change
+struct mission_table {
+    struct mission_leg *legs;
+    uint16_t capacity;
+    uint16_t legCount;
+    uint16_t actionCount;
+    bool     valid;
+};
+
+bool mission_table_begin(struct mission_table *mission, uint16_t legCount, uint16_t actionCount);
+bool mission_table_set_leg(struct mission_table *mission, uint16_t index, const float position[3], float velocity, uint8_t actionId);
+bool mission_table_set_action(struct mission_table *mission, uint8_t actionId, const struct mission_action *action);
+void mission_table_finish(struct mission_table *mission);
+uint16_t mission_table_wrap(const struct mission_table *mission, uint16_t index);
+uint16_t mission_table_jump(const struct mission_table *mission, uint16_t index, int16_t jumpDestination);
+
+#endif // MISSIONTABLE_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @addtogroup LibrePilotModules LibrePilot Modules
+ * @{
+ * @addtogroup PathPlanner Path Planner Module
+ * @{
+ *
+ * @file       missiontable.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Validated legs of the path plan
+ *
+ * The table keeps what the planner needs of each waypoint on every step, the
+ * position, the velocity, the course to the next waypoint and a compact copy
+ * of its path action. It is only rebuilt when a Waypoint, PathAction or
+ * PathPlan instance changes, so the planner does not read any of them while
+ * it steps through the plan.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <stddef.h>
+#include <math.h>
+#include <pios_mem.h>
+
+#include "missiontable.h"
+
+/**
+ * Start a rebuild, the table is invalid until mission_table_finish()
+ * \return false if there is no memory for the legs
+ */
+bool mission_table_begin(struct mission_table *mission, uint16_t legCount, uint16_t actionCount)
+{
+    mission->valid = false;
+
+    // the table only grows, so switching between plans does not fragment the heap
+    if (legCount > mission->capacity) {
+        if (mission->legs) {
+            pios_free(mission->legs);
+        }
+        mission->legs     = (struct mission_leg *)pios_malloc(legCount * sizeof(struct mission_leg));
+        mission->capacity = mission->legs ? legCount : 0;
+    }
+    if (legCount > mission->capacity) {
+        return false;
+    }
+
+    mission->legCount    = legCount;
+    mission->actionCount = actionCount;
+    return true;
+}
+
+/**
+ * Copy a waypoint into the table
+ * \return false if its path action is out of range
+ */
+bool mission_table_set_leg(struct mission_table *mission, uint16_t index, const float position[3], float velocity, uint8_t actionId)
+{
+    if (index >= mission->legCount || actionId >= mission->actionCount) {
+        return false;
+    }
+
+    struct mission_leg *leg = &mission->legs[index];
+    leg->position[0] = position[0];
+    leg->position[1] = position[1];
+    leg->position[2] = position[2];
+    leg->velocity    = velocity;
+    leg->actionId    = actionId;
+    return true;
+}
+
+/**
+ * Copy a path action into the legs that use it, once all legs are set
+ * \return false if one of its destinations is out of range, negative ones are relative or disabled
+ */
+bool mission_table_set_action(struct mission_table *mission, uint8_t actionId, const struct mission_action *action)
+{
+    if (action->errorDestination >= mission->legCount || action->jumpDestination >= mission->legCount) {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < mission->legCount; i++) {
+        if (mission->legs[i].actionId == actionId) {
+            mission->legs[i].action = *action;
+        }
+    }
+    return true;
+}
+
+/**
+ * Complete a rebuild once all legs are set
+ */
+void mission_table_finish(struct mission_table *mission)
+{
+    // the plan wraps around like mission_table_wrap() does
+    for (uint16_t i = 0; i < mission->legCount; i++) {
+        const struct mission_leg *next = &mission->legs[mission_table_wrap(mission, i + 1)];
+        mission->legs[i].nextCourse = atan2f(next->position[0] - mission->legs[i].position[0],
+                                             next->position[1] - mission->legs[i].position[1]);
+    }
+
+    mission->valid = true;
+}
+
+/**
+ * Path plans wrap around, a leg past the end is the first one
+ */
+uint16_t mission_table_wrap(const struct mission_table *mission, uint16_t index)
+{
+    return (index < mission->legCount) ? index : 0;
+}
+
+/**
+ * The leg a jump of a path action leads to, waypoint ids < 0 code relative jumps
+ */
+uint16_t mission_table_jump(const struct mission_table *mission, uint16_t index, int16_t jumpDestination)
+{
+    if (jumpDestination < 0) {
+        return mission_table_wrap(mission, index - jumpDestination);
+    }
+    return mission_table_wrap(mission, jumpDestination);
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -50,6 +50,7 @@
 #include <sanitycheck.h>
 #include <vtolpathfollowersettings.h>
 #include <manualcontrolcommand.h>
+#include "missiontable.h"
 
 // Private constants
 #define STACK_SIZE_BYTES            1024
@@ -57,16 +58,16 @@
 #define MAX_QUEUE_SIZE              2
 #define PATH_PLANNER_UPDATE_RATE_MS 100 // can be slow, since we listen to status updates as well
 
-// Private types
-
 // Private functions
 static void pathPlannerTask();
 static void commandUpdated(UAVObjEvent *ev);
 static void statusUpdated(UAVObjEvent *ev);
+static void missionUpdated(UAVObjEvent *ev);
 static void updatePathDesired();
 static void setWaypoint(uint16_t num);
 
 static uint8_t checkPathPlan();
+static uint8_t buildMissionTable(uint16_t waypointCount, uint16_t actionCount);
 static uint8_t pathConditionCheck();
 static uint8_t conditionNone();
 static uint8_t conditionTimeOut();
@@ -85,8 +86,10 @@ static void SettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev);
 static DelayedCallbackInfo *pathPlannerHandle;
 static DelayedCallbackInfo *pathDesiredUpdaterHandle;
 static WaypointActiveData waypointActive;
-static WaypointData waypoint;
-static PathActionData pathAction;
+static const struct mission_leg *waypoint;
+static const struct mission_action *pathAction;
+static struct mission_table mission;
+static volatile bool missionChanged = true;
 static bool pathplanner_active = false;
 static FrameType_t frameType;
 static bool mode3D;
@@ -100,9 +103,10 @@ int32_t PathPlannerStart()
 {
     plan_initialize();
     // when the active waypoint changes, update pathDesired
-    WaypointConnectCallback(commandUpdated);
+    WaypointConnectCallback(missionUpdated);
     WaypointActiveConnectCallback(commandUpdated);
-    PathActionConnectCallback(commandUpdated);
+    PathActionConnectCallback(missionUpdated);
+    PathPlanConnectCallback(missionUpdated);
     PathStatusConnectCallback(statusUpdated);
     SettingsUpdatedCb(NULL);
     SystemSettingsConnectCallback(&SettingsUpdatedCb);
@@ -237,8 +241,14 @@ static void pathPlannerTask()
         return;
     }
 
-    WaypointInstGet(waypointActive.Index, &waypoint);
-    PathActionInstGet(waypoint.Action, &pathAction);
+    // the active waypoint can be set from outside, past the end of the plan
+    if (waypointActive.Index >= mission.legCount) {
+        setWaypoint(waypointActive.Index);
+        return;
+    }
+
+    waypoint   = &mission.legs[waypointActive.Index];
+    pathAction = &waypoint->action;
     PathStatusData pathStatus;
     PathStatusGet(&pathStatus);
 
@@ -248,8 +258,8 @@ static void pathPlannerTask()
     }
 
     // negative destinations DISABLE this feature
-    if (pathStatus.Status == PATHSTATUS_STATUS_CRITICAL && waypointActive.Index != pathAction.ErrorDestination && pathAction.ErrorDestination >= 0) {
-        setWaypoint(pathAction.ErrorDestination);
+    if (pathStatus.Status == PATHSTATUS_STATUS_CRITICAL && waypointActive.Index != pathAction->errorDestination && pathAction->errorDestination >= 0) {
+        setWaypoint(pathAction->errorDestination);
         return;
     }
 
@@ -257,7 +267,7 @@ static void pathPlannerTask()
     // check if condition has been met
     endCondition = pathConditionCheck();
     // decide what to do
-    switch (pathAction.Command) {
+    switch (pathAction->command) {
     case PATHACTION_COMMAND_ONNOTCONDITIONNEXTWAYPOINT:
         endCondition = !endCondition;
     case PATHACTION_COMMAND_ONCONDITIONNEXTWAYPOINT:
@@ -269,22 +279,12 @@ static void pathPlannerTask()
         endCondition = !endCondition;
     case PATHACTION_COMMAND_ONCONDITIONJUMPWAYPOINT:
         if (endCondition) {
-            if (pathAction.JumpDestination < 0) {
-                // waypoint ids <0 code relative jumps
-                setWaypoint(waypointActive.Index - pathAction.JumpDestination);
-            } else {
-                setWaypoint(pathAction.JumpDestination);
-            }
+            setWaypoint(mission_table_jump(&mission, waypointActive.Index, pathAction->jumpDestination));
         }
         break;
     case PATHACTION_COMMAND_IFCONDITIONJUMPWAYPOINTELSENEXTWAYPOINT:
         if (endCondition) {
-            if (pathAction.JumpDestination < 0) {
-                // waypoint ids <0 code relative jumps
-                setWaypoint(waypointActive.Index - pathAction.JumpDestination);
-            } else {
-                setWaypoint(pathAction.JumpDestination);
-            }
+            setWaypoint(mission_table_jump(&mission, waypointActive.Index, pathAction->jumpDestination));
         } else {
             setWaypoint(waypointActive.Index + 1);
         }
@@ -300,23 +300,30 @@ void updatePathDesired()
         return;
     }
 
+    // the mission table is refreshed here as well, this can run before the planner task saw a change
+    if (!checkPathPlan()) {
+        return;
+    }
+
     // find out current waypoint
     WaypointActiveGet(&waypointActive);
-    WaypointInstGet(waypointActive.Index, &waypoint);
-
-    PathActionInstGet(waypoint.Action, &pathAction);
+    if (waypointActive.Index >= mission.legCount) {
+        return;
+    }
+    waypoint   = &mission.legs[waypointActive.Index];
+    pathAction = &waypoint->action;
 
     PathDesiredData pathDesired;
 
-    pathDesired.End.North = waypoint.Position.North;
-    pathDesired.End.East  = waypoint.Position.East;
-    pathDesired.End.Down  = waypoint.Position.Down;
-    pathDesired.EndingVelocity    = waypoint.Velocity;
-    pathDesired.Mode = pathAction.Mode;
-    pathDesired.ModeParameters[0] = pathAction.ModeParameters[0];
-    pathDesired.ModeParameters[1] = pathAction.ModeParameters[1];
-    pathDesired.ModeParameters[2] = pathAction.ModeParameters[2];
-    pathDesired.ModeParameters[3] = pathAction.ModeParameters[3];
+    pathDesired.End.North = waypoint->position[0];
+    pathDesired.End.East  = waypoint->position[1];
+    pathDesired.End.Down  = waypoint->position[2];
+    pathDesired.EndingVelocity    = waypoint->velocity;
+    pathDesired.Mode = pathAction->mode;
+    pathDesired.ModeParameters[0] = pathAction->modeParameters[0];
+    pathDesired.ModeParameters[1] = pathAction->modeParameters[1];
+    pathDesired.ModeParameters[2] = pathAction->modeParameters[2];
+    pathDesired.ModeParameters[3] = pathAction->modeParameters[3];
     pathDesired.UID = waypointActive.Index;
 
 
@@ -336,20 +343,19 @@ void updatePathDesired()
         pathDesired.StartingVelocity = pathDesired.EndingVelocity;
     } else {
         // Get previous waypoint as start point
-        WaypointData waypointPrev;
-        WaypointInstGet(waypointActive.Index - 1, &waypointPrev);
+        const struct mission_leg *waypointPrev = &mission.legs[waypointActive.Index - 1];
 
-        pathDesired.Start.North = waypointPrev.Position.North;
-        pathDesired.Start.East  = waypointPrev.Position.East;
-        pathDesired.Start.Down  = waypointPrev.Position.Down;
-        pathDesired.StartingVelocity = waypointPrev.Velocity;
+        pathDesired.Start.North = waypointPrev->position[0];
+        pathDesired.Start.East  = waypointPrev->position[1];
+        pathDesired.Start.Down  = waypointPrev->position[2];
+        pathDesired.StartingVelocity = waypointPrev->velocity;
     }
 
     PathDesiredSet(&pathDesired);
 }
 
 
-// safety checks for path plan integrity
+// safety checks for path plan integrity, rebuilds the mission table if the plan changed
 static uint8_t checkPathPlan()
 {
     uint16_t i;
@@ -358,14 +364,19 @@ static uint8_t checkPathPlan()
     uint8_t pathCrc;
     PathPlanData pathPlan;
 
-    // WaypointData waypoint; // using global instead (?)
-    // PathActionData action; // using global instead (?)
+    // the table only changes with a Waypoint, PathAction or PathPlan update
+    if (!missionChanged) {
+        return mission.valid;
+    }
+    // cleared before reading the instances, a change while copying them triggers another rebuild
+    missionChanged = false;
 
     PathPlanGet(&pathPlan);
 
     waypointCount = pathPlan.WaypointCount;
     if (waypointCount == 0) {
         // an empty path plan is invalid
+        mission.valid = false;
         return false;
     }
     actionCount = pathPlan.PathActionCount;
@@ -373,10 +384,12 @@ static uint8_t checkPathPlan()
     // check count consistency
     if (waypointCount > UAVObjGetNumInstances(WaypointHandle())) {
         // PIOS_DEBUGLOG_Printf("PathPlan : waypoint count error!");
+        mission.valid = false;
         return false;
     }
     if (actionCount > UAVObjGetNumInstances(PathActionHandle())) {
         // PIOS_DEBUGLOG_Printf("PathPlan : path action count error!");
+        mission.valid = false;
         return false;
     }
 
@@ -391,32 +404,54 @@ static uint8_t checkPathPlan()
     if (pathCrc != pathPlan.Crc) {
         // failed crc check
         // PIOS_DEBUGLOG_Printf("PathPlan : bad CRC (%d / %d)!", pathCrc, pathPlan.Crc);
+        mission.valid = false;
+        return false;
+    }
+
+    return buildMissionTable(waypointCount, actionCount);
+}
+
+// copy and check the path plan into the mission table
+static uint8_t buildMissionTable(uint16_t waypointCount, uint16_t actionCount)
+{
+    uint16_t i;
+    WaypointData waypointData;
+    PathActionData pathActionData;
+    struct mission_action action;
+
+    if (!mission_table_begin(&mission, waypointCount, actionCount)) {
+        // out of memory
         return false;
     }
 
     // waypoint consistency
     for (i = 0; i < waypointCount; i++) {
-        WaypointInstGet(i, &waypoint);
-        if (waypoint.Action >= actionCount) {
+        WaypointInstGet(i, &waypointData);
+        const float position[3] = { waypointData.Position.North, waypointData.Position.East, waypointData.Position.Down };
+        if (!mission_table_set_leg(&mission, i, position, waypointData.Velocity, waypointData.Action)) {
             // path action id is out of range
             return false;
         }
     }
 
-    // path action consistency
+    // path action consistency, the legs get a copy of their action
     for (i = 0; i < actionCount; i++) {
-        PathActionInstGet(i, &pathAction);
-        if (pathAction.ErrorDestination >= waypointCount) {
-            // waypoint id is out of range
-            return false;
-        }
-        if (pathAction.JumpDestination >= waypointCount) {
+        PathActionInstGet(i, &pathActionData);
+        action.mode = pathActionData.Mode;
+        action.endCondition     = pathActionData.EndCondition;
+        action.command = pathActionData.Command;
+        action.jumpDestination  = pathActionData.JumpDestination;
+        action.errorDestination = pathActionData.ErrorDestination;
+        memcpy(action.modeParameters, pathActionData.ModeParameters, sizeof(action.modeParameters));
+        memcpy(action.conditionParameters, pathActionData.ConditionParameters, sizeof(action.conditionParameters));
+        if (!mission_table_set_action(&mission, i, &action)) {
             // waypoint id is out of range
             return false;
         }
     }
 
     // path plan passed checks
+    mission_table_finish(&mission);
 
     return true;
 }
@@ -427,6 +462,13 @@ void commandUpdated(__attribute__((unused)) UAVObjEvent *ev)
     PIOS_CALLBACKSCHEDULER_Dispatch(pathDesiredUpdaterHandle);
 }
 
+// callback function when the path plan changed, rebuild the mission table before updating pathDesired
+static void missionUpdated(__attribute__((unused)) UAVObjEvent *ev)
+{
+    missionChanged = true;
+    PIOS_CALLBACKSCHEDULER_Dispatch(pathDesiredUpdaterHandle);
+}
+
 // callback function when waypoints changed in any way, update pathDesired
 void statusUpdated(__attribute__((unused)) UAVObjEvent *ev)
 {
@@ -437,17 +479,8 @@ void statusUpdated(__attribute__((unused)) UAVObjEvent *ev)
 // helper function to go to a specific waypoint
 static void setWaypoint(uint16_t num)
 {
-    PathPlanData pathPlan;
-
-    PathPlanGet(&pathPlan);
-
-    // here it is assumed that the path plan has been validated (waypoint count is consistent)
-    if (num >= pathPlan.WaypointCount) {
-        // path plans wrap around
-        num = 0;
-    }
-
-    waypointActive.Index = num;
+    // here it is assumed that the path plan has been validated (mission table is up to date)
+    waypointActive.Index = mission_table_wrap(&mission, num);
     WaypointActiveSet(&waypointActive);
 }
 
@@ -455,7 +488,7 @@ static void setWaypoint(uint16_t num)
 static uint8_t pathConditionCheck()
 {
     // i thought about a lookup table, but a switch is safer considering there could be invalid EndCondition ID's
-    switch (pathAction.EndCondition) {
+    switch (pathAction->endCondition) {
     case PATHACTION_ENDCONDITION_NONE:
         return conditionNone();
 
@@ -524,7 +557,7 @@ static uint8_t conditionTimeOut()
         toWaypoint  = waypointActive.Index;
         toStarttime = PIOS_DELAY_GetRaw();
     }
-    if (PIOS_DELAY_DiffuS(toStarttime) >= 1e6f * pathAction.ConditionParameters[0]) {
+    if (PIOS_DELAY_DiffuS(toStarttime) >= 1e6f * pathAction->conditionParameters[0]) {
         // make sure we reinitialize even if the same waypoint comes twice
         toWaypoint = 0xFFFF;
         return true;
@@ -544,16 +577,16 @@ static uint8_t conditionDistanceToTarget()
     PositionStateData positionState;
 
     PositionStateGet(&positionState);
-    if (pathAction.ConditionParameters[1] > 0.5f) {
-        distance = sqrtf(powf(waypoint.Position.North - positionState.North, 2)
-                         + powf(waypoint.Position.East - positionState.East, 2)
-                         + powf(waypoint.Position.Down - positionState.Down, 2));
+    if (pathAction->conditionParameters[1] > 0.5f) {
+        distance = sqrtf(powf(waypoint->position[0] - positionState.North, 2)
+                         + powf(waypoint->position[1] - positionState.East, 2)
+                         + powf(waypoint->position[2] - positionState.Down, 2));
     } else {
-        distance = sqrtf(powf(waypoint.Position.North - positionState.North, 2)
-                         + powf(waypoint.Position.East - positionState.East, 2));
+        distance = sqrtf(powf(waypoint->position[0] - positionState.North, 2)
+                         + powf(waypoint->position[1] - positionState.East, 2));
     }
 
-    if (distance <= pathAction.ConditionParameters[0]) {
+    if (distance <= pathAction->conditionParameters[0]) {
         return true;
     }
     return false;
@@ -571,7 +604,7 @@ static uint8_t conditionLegRemaining()
 
     PathStatusGet(&pathStatus);
 
-    if (pathStatus.fractional_progress >= (1.0f - pathAction.ConditionParameters[0])) {
+    if (pathStatus.fractional_progress >= (1.0f - pathAction->conditionParameters[0])) {
         return true;
     }
     return false;
@@ -595,7 +628,7 @@ static uint8_t conditionBelowError()
 
     path_progress(&pathDesired,
                   cur, &progress, mode3D);
-    if (progress.error <= pathAction.ConditionParameters[0]) {
+    if (progress.error <= pathAction->conditionParameters[0]) {
         return true;
     }
     return false;
@@ -612,7 +645,7 @@ static uint8_t conditionAboveAltitude()
 
     PositionStateGet(&positionState);
 
-    if (-positionState.Down >= pathAction.ConditionParameters[0]) {
+    if (-positionState.Down >= pathAction->conditionParameters[0]) {
         return true;
     }
     return false;
@@ -632,13 +665,13 @@ static uint8_t conditionAboveSpeed()
     float velocity = sqrtf(velocityState.North * velocityState.North + velocityState.East * velocityState.East + velocityState.Down * velocityState.Down);
 
     // use airspeed if requested and available
-    if (pathAction.ConditionParameters[1] > 0.5f) {
+    if (pathAction->conditionParameters[1] > 0.5f) {
         AirspeedStateData airspeed;
         AirspeedStateGet(&airspeed);
         velocity = airspeed.CalibratedAirspeed;
     }
 
-    if (velocity >= pathAction.ConditionParameters[0]) {
+    if (velocity >= pathAction->conditionParameters[0]) {
         return true;
     }
     return false;
@@ -654,15 +687,8 @@ static uint8_t conditionAboveSpeed()
  */
 static uint8_t conditionPointingTowardsNext()
 {
-    uint16_t nextWaypointId = waypointActive.Index + 1;
-
-    if (nextWaypointId >= UAVObjGetNumInstances(WaypointHandle())) {
-        nextWaypointId = 0;
-    }
-    WaypointData nextWaypoint;
-    WaypointInstGet(nextWaypointId, &nextWaypoint);
-
-    float angle1 = atan2f((nextWaypoint.Position.North - waypoint.Position.North), (nextWaypoint.Position.East - waypoint.Position.East));
+    // the direction to the next waypoint is precomputed in the mission table
+    float angle1 = waypoint->nextCourse;
 
     VelocityStateData velocity;
     VelocityStateGet(&velocity);
@@ -674,7 +700,7 @@ static uint8_t conditionPointingTowardsNext()
         angle1 -= 360;
     }
 
-    if (angle1 <= pathAction.ConditionParameters[0]) {
+    if (angle1 <= pathAction->conditionParameters[0]) {
         return true;
     }
     return false;
@@ -94,8 +94,8 @@ static void telemetryRxTask(void *parameters);
 static void telemRadioTxTask(void *parameters);
 static void telemRadioRxTask(void *parameters);
 static void PPMInputTask(void *parameters);
-static int32_t UAVTalkSendHandler(uint8_t *buf, int32_t length);
-static int32_t RadioSendHandler(uint8_t *buf, int32_t length);
+static int32_t UAVTalkSendHandler(const struct pios_com_iovec *iov, uint8_t iovcnt);
+static int32_t RadioSendHandler(const struct pios_com_iovec *iov, uint8_t iovcnt);
 static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t *rxbuffer, uint8_t count);
 static void ProcessRadioStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t *rxbuffer, uint8_t count);
 static void objectPersistenceUpdatedCb(UAVObjEvent *objEv);
@@ -474,12 +474,12 @@ static void telemetryRxTask(__attribute__((unused)) void *parameters)
 /**
  * @brief Send data from the Radio->GCS telemetry stream to the GCS port.
  *
- * @param[in] buf Data buffer to send
- * @param[in] length Length of buffer
+ * @param[in] iov Segments of the frame to send
+ * @param[in] iovcnt Number of segments
  * @return -1 on failure
  * @return number of bytes transmitted on success
  */
-static int32_t UAVTalkSendHandler(uint8_t *buf, int32_t length)
+static int32_t UAVTalkSendHandler(const struct pios_com_iovec *iov, uint8_t iovcnt)
 {
     int32_t ret;
     uint32_t outputPort = PIOS_COM_GCS;
@@ -496,7 +496,7 @@ static int32_t UAVTalkSendHandler(uint8_t *buf, int32_t length)
         ret = -2;
         uint8_t count = 5;
         while (count-- > 0 && ret < -1) {
-            ret = PIOS_COM_SendBufferNonBlocking(outputPort, buf, length);
+            ret = PIOS_COM_SendBufferVNonBlocking(outputPort, iov, iovcnt);
         }
     } else {
         ret = -1;
@@ -507,12 +507,12 @@ static int32_t UAVTalkSendHandler(uint8_t *buf, int32_t length)
 /**
  * @brief Send data from the GCS telemetry stream to the Radio->GCS port.
  *
- * @param[in] buf Data buffer to send
- * @param[in] length Length of buffer
+ * @param[in] iov Segments of the frame to send
+ * @param[in] iovcnt Number of segments
  * @return -1 on failure
  * @return number of bytes transmitted on success
  */
-static int32_t RadioSendHandler(uint8_t *buf, int32_t length)
+static int32_t RadioSendHandler(const struct pios_com_iovec *iov, uint8_t iovcnt)
 {
     uint32_t outputPort = PIOS_COM_GCS_OUT;
 
@@ -523,7 +523,7 @@ static int32_t RadioSendHandler(uint8_t *buf, int32_t length)
         int32_t ret   = -2;
         uint8_t count = 5;
         while (count-- > 0 && ret < -1) {
-            ret = PIOS_COM_SendBufferNonBlocking(outputPort, buf, length);
+            ret = PIOS_COM_SendBufferVNonBlocking(outputPort, iov, iovcnt);
         }
         return ret;
     } else {
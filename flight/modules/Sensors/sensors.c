@@ -121,6 +121,8 @@ typedef union {
     PIOS_SENSORS_1Axis_SensorsWithTemp sensorSample1Axis;
 } sensor_data;
 
+#define MAX_SENSOR_BLOCK_SIZE (sizeof(PIOS_SENSORS_3Axis_SensorsBlock) + MAX_SENSORS_PER_INSTANCE * sizeof(Vector3i32))
+
 #define PIOS_INSTRUMENT_MODULE
 #include <pios_instrumentation_helper.h>
 
@@ -140,6 +142,7 @@ static void SensorsTask(void *parameters);
 static void settingsUpdatedCb(UAVObjEvent *objEv);
 
 static void accumulateSamples(sensor_fetch_context *sensor_context, sensor_data *sample);
+static void accumulateBlock(sensor_fetch_context *sensor_context, PIOS_SENSORS_3Axis_SensorsBlock *block);
 static void processSamples3d(sensor_fetch_context *sensor_context, const PIOS_SENSORS_Instance *sensor);
 static void processSamples1d(PIOS_SENSORS_1Axis_SensorsWithTemp *sample, const PIOS_SENSORS_Instance *sensor);
 
@@ -156,9 +159,11 @@ static void handleBaro(float sample, float temperature);
 static void updateAccelTempBias(float temperature);
 static void updateGyroTempBias(float temperature);
 static void updateBaroTempBias(float temperature);
+static void updateTransforms(void);
 
 // Private variables
 static sensor_data *source_data;
+static PIOS_SENSORS_3Axis_SensorsBlock *block_data;
 static xTaskHandle sensorsTaskHandle;
 RevoCalibrationData cal;
 AccelGyroSettingsData agcal;
@@ -185,6 +190,13 @@ static float R[3][3] = {
     { 0 }
 };
 
+// Calibration, temperature bias and rotation folded into out = transform * in + offset
+static float accel_transform[3][3];
+static float accel_offset[3];
+static float gyro_transform[3][3];
+static float gyro_offset[3];
+static volatile bool transforms_updated = true;
+
 // Variables used to handle baro temperature bias
 static RevoSettingsBaroTempCorrectionPolynomialData baroCorrection;
 static RevoSettingsBaroTempCorrectionExtentData baroCorrectionExtent;
@@ -206,6 +218,7 @@ static bool useAuxMag = false;
 int32_t SensorsInitialize(void)
 {
     source_data = (sensor_data *)pios_malloc(MAX_SENSOR_DATA_SIZE);
+    block_data  = (PIOS_SENSORS_3Axis_SensorsBlock *)pios_malloc(MAX_SENSOR_BLOCK_SIZE);
     GyroSensorInitialize();
     AccelSensorInitialize();
     MagSensorInitialize();
@@ -327,7 +340,26 @@ static void SensorsTask(__attribute__((unused)) void *parameters)
                     error = true;
                 }
             } else {
-                if (PIOS_SENSORS_Poll(sensor)) {
+                if (sensor->driver->fetch_block) {
+                    // FIFO sensor: everything sampled since the last loop in a single burst,
+                    // the primary sensor gets a period for its first sample like a queued one
+                    TickType_t waitStart = xTaskGetTickCount();
+                    bool fetched = PIOS_SENSORS_Poll(sensor) && PIOS_SENSORS_FetchBlock(sensor, block_data, MAX_SENSORS_PER_INSTANCE);
+                    while (!fetched && is_primary && (xTaskGetTickCount() - waitStart) < sensor_period_ticks) {
+                        vTaskDelay(1);
+                        fetched = PIOS_SENSORS_Poll(sensor) && PIOS_SENSORS_FetchBlock(sensor, block_data, MAX_SENSORS_PER_INSTANCE);
+                    }
+                    if (fetched) {
+                        accumulateBlock(&sensor_context, block_data);
+                        processSamples3d(&sensor_context, sensor);
+                        clearContext(&sensor_context);
+                    } else if (is_primary) {
+                        PIOS_SENSOR_Reset(sensor);
+                        reset_counter++;
+                        PERF_TRACK_VALUE(counterSensorResets, reset_counter);
+                        error = true;
+                    }
+                } else if (PIOS_SENSORS_Poll(sensor)) {
                     PIOS_SENSOR_Fetch(sensor, (void *)source_data, MAX_SENSORS_PER_INSTANCE);
                     if (sensor->type & PIOS_SENSORS_TYPE_3D) {
                         accumulateSamples(&sensor_context, source_data);
@@ -378,6 +410,19 @@ static void accumulateSamples(sensor_fetch_context *sensor_context, sensor_data
     sensor_context->count++;
 }
 
+static void accumulateBlock(sensor_fetch_context *sensor_context, PIOS_SENSORS_3Axis_SensorsBlock *block)
+{
+    for (uint32_t i = 0; (i < MAX_SENSORS_PER_INSTANCE) && (i < block->count); i++) {
+        sensor_context->accum[i].x += block->sum[i].x;
+        sensor_context->accum[i].y += block->sum[i].y;
+        sensor_context->accum[i].z += block->sum[i].z;
+    }
+    sensor_context->temperature += block->temperature;
+    // the block carries a single timestamp for all of its samples
+    sensor_context->timestamp   += (uint64_t)block->timestamp * block->samples;
+    sensor_context->count += block->samples;
+}
+
 static void processSamples3d(sensor_fetch_context *sensor_context, const PIOS_SENSORS_Instance *sensor)
 {
     float samples[3];
@@ -453,14 +498,15 @@ static void handleAccel(float *samples, float temperature)
     AccelSensorData accelSensorData;
 
     updateAccelTempBias(temperature);
-    float accels_out[3] = { (samples[0] - agcal.accel_bias.X) * agcal.accel_scale.X - accel_temp_bias[0],
-                            (samples[1] - agcal.accel_bias.Y) * agcal.accel_scale.Y - accel_temp_bias[1],
-                            (samples[2] - agcal.accel_bias.Z) * agcal.accel_scale.Z - accel_temp_bias[2] };
-
-    rot_mult(R, accels_out, samples);
-    accelSensorData.x = samples[0];
-    accelSensorData.y = samples[1];
-    accelSensorData.z = samples[2];
+    if (transforms_updated) {
+        updateTransforms();
+    }
+
+    float accels_out[3];
+    rot_mult(accel_transform, samples, accels_out);
+    accelSensorData.x = accels_out[0] + accel_offset[0];
+    accelSensorData.y = accels_out[1] + accel_offset[1];
+    accelSensorData.z = accels_out[2] + accel_offset[2];
     accelSensorData.temperature = temperature;
 
     AccelSensorSet(&accelSensorData);
@@ -471,14 +517,15 @@ static void handleGyro(float *samples, float temperature, uint32_t timestamp)
     GyroSensorData gyroSensorData;
 
     updateGyroTempBias(temperature);
-    float gyros_out[3] = { samples[0] * agcal.gyro_scale.X - agcal.gyro_bias.X - gyro_temp_bias[0],
-                           samples[1] * agcal.gyro_scale.Y - agcal.gyro_bias.Y - gyro_temp_bias[1],
-                           samples[2] * agcal.gyro_scale.Z - agcal.gyro_bias.Z - gyro_temp_bias[2] };
-
-    rot_mult(R, gyros_out, samples);
-    gyroSensorData.x = samples[0];
-    gyroSensorData.y = samples[1];
-    gyroSensorData.z = samples[2];
+    if (transforms_updated) {
+        updateTransforms();
+    }
+
+    float gyros_out[3];
+    rot_mult(gyro_transform, samples, gyros_out);
+    gyroSensorData.x = gyros_out[0] + gyro_offset[0];
+    gyroSensorData.y = gyros_out[1] + gyro_offset[1];
+    gyroSensorData.z = gyros_out[2] + gyro_offset[2];
     gyroSensorData.temperature = temperature;
     gyroSensorData.SensorReadTimestamp = timestamp;
 
@@ -545,6 +592,7 @@ static void updateAccelTempBias(float temperature)
             accel_temp_bias[0] = agcal.accel_temp_coeff.X * ctemp;
             accel_temp_bias[1] = agcal.accel_temp_coeff.Y * ctemp;
             accel_temp_bias[2] = agcal.accel_temp_coeff.Z * ctemp;
+            transforms_updated = true;
         }
     }
     accel_temp_calibration_count--;
@@ -566,6 +614,7 @@ static void updateGyroTempBias(float temperature)
             gyro_temp_bias[0] = (agcal.gyro_temp_coeff.X + agcal.gyro_temp_coeff.X2 * ctemp) * ctemp;
             gyro_temp_bias[1] = (agcal.gyro_temp_coeff.Y + agcal.gyro_temp_coeff.Y2 * ctemp) * ctemp;
             gyro_temp_bias[2] = (agcal.gyro_temp_coeff.Z + agcal.gyro_temp_coeff.Z2 * ctemp) * ctemp;
+            transforms_updated = true;
         }
     }
     gyro_temp_calibration_count--;
@@ -589,6 +638,37 @@ static void updateBaroTempBias(float temperature)
     baro_temp_calibration_count--;
 }
 
+/**
+ * Fold scale, bias, temperature bias and board rotation of accel and gyro into
+ * one affine transform each: out = R * ((in - bias) * scale - temp_bias) for the accel,
+ * out = R * (in * scale - bias - temp_bias) for the gyro
+ */
+static void updateTransforms(void)
+{
+    const float accel_scale[3] = { agcal.accel_scale.X, agcal.accel_scale.Y, agcal.accel_scale.Z };
+    const float gyro_scale[3]  = { agcal.gyro_scale.X, agcal.gyro_scale.Y, agcal.gyro_scale.Z };
+    const float accel_bias[3]  = { agcal.accel_bias.X * agcal.accel_scale.X + accel_temp_bias[0],
+                                   agcal.accel_bias.Y * agcal.accel_scale.Y + accel_temp_bias[1],
+                                   agcal.accel_bias.Z * agcal.accel_scale.Z + accel_temp_bias[2] };
+    const float gyro_bias[3]   = { agcal.gyro_bias.X + gyro_temp_bias[0],
+                                   agcal.gyro_bias.Y + gyro_temp_bias[1],
+                                   agcal.gyro_bias.Z + gyro_temp_bias[2] };
+
+    transforms_updated = false;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            accel_transform[i][j] = R[i][j] * accel_scale[j];
+            gyro_transform[i][j]  = R[i][j] * gyro_scale[j];
+        }
+    }
+    rot_mult(R, accel_bias, accel_offset);
+    rot_mult(R, gyro_bias, gyro_offset);
+    for (uint8_t i = 0; i < 3; i++) {
+        accel_offset[i] = -accel_offset[i];
+        gyro_offset[i]  = -gyro_offset[i];
+    }
+}
+
 /**
  * Locally cache some variables from the AttitudeSettings object
  */
@@ -630,6 +710,7 @@ static void settingsUpdatedCb(__attribute__((unused)) UAVObjEvent *objEv)
     // mag_transform is only a scaling
     // so add the scaling, and store the result in mag_transform for run time use
     matrix_mult_3x3f((float(*)[3])RevoCalibrationmag_transformToArray(cal.mag_transform), R, mag_transform);
+    transforms_updated = true;
 
     RevoSettingsBaroTempCorrectionPolynomialGet(&baroCorrection);
     RevoSettingsBaroTempCorrectionExtentGet(&baroCorrectionExtent);
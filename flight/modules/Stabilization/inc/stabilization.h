@@ -60,7 +60,8 @@ typedef struct {
         int8_t rateupdates;
     }     monitor;
     float rattitude_mode_transition_stick_position;
-    struct pid innerPids[3], outerPids[3];
+    struct pid_bank innerPids;
+    struct pid outerPids[3];
     // TPS [Roll,Pitch,Yaw][P,I,D]
     bool  thrust_pid_scaling_enabled[3][3];
     float feedForward_alpha[3];
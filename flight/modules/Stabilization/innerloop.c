@@ -34,6 +34,7 @@
 
 #include <openpilot.h>
 #include <pid.h>
+#include <biquad.h>
 #include <sin_lookup.h>
 #include <callbackinfo.h>
 #include <ratedesired.h>
@@ -48,6 +49,14 @@
 #include <actuatordesired.h>
 
 #include <stabilization.h>
+#ifdef MODULE_ACTUATOR_BUILTIN
+#include <actuator.h>
+#else
+// the fast path mixes in the Actuator module, without it the setting is ignored
+#define ACTUATOR_FASTPATH_STACK_BYTES 0
+#define ActuatorFastPathUpdate(desired)
+#define ActuatorFastPathRelease()
+#endif
 #include <virtualflybar.h>
 #include <cruisecontrol.h>
 #include <sanitycheck.h>
@@ -77,12 +86,15 @@
 // Private variables
 static DelayedCallbackInfo *callbackHandle;
 static float gyro_filtered[3] = { 0, 0, 0 };
+static struct biquad_bank gyroFilter;
+static float gyroFilterAlpha = -1.0f;
 static float axis_lock_accum[3] = { 0, 0, 0 };
 static uint8_t previous_mode[AXES] = { 255, 255, 255, 255 };
 static PiOSDeltatimeConfig timeval;
 static float speedScaleFactor = 1.0f;
 static bool frame_is_multirotor;
 static bool measuredDterm_enabled;
+static bool fastPath_enabled;
 #if !defined(PIOS_EXCLUDE_ADVANCED_FEATURES)
 static uint32_t systemIdentTimeVal = 0;
 #endif /* !defined(PIOS_EXCLUDE_ADVANCED_FEATURES) */
@@ -113,8 +125,23 @@ void stabilizationInnerloopInit()
 #endif
     PIOS_DELTATIME_Init(&timeval, UPDATE_EXPECTED, UPDATE_MIN, UPDATE_MAX, UPDATE_ALPHA);
 
-    callbackHandle = PIOS_CALLBACKSCHEDULER_Create(&stabilizationInnerloopTask, CALLBACK_PRIORITY, CBTASK_PRIORITY, CALLBACKINFO_RUNNING_STABILIZATION1, STACK_SIZE_BYTES);
-    GyroStateConnectCallback(GyroStateUpdatedCb);
+    // with the rate loop fast path, the inner loop is dispatched straight from the GyroState update
+    // and mixes the outputs itself instead of waiting for the Actuator task
+    // stabSettings is only loaded in StabilizationStart(), read the setting itself
+    StabilizationSettingsRateLoopFastPathOptions fastPath;
+    StabilizationSettingsRateLoopFastPathGet(&fastPath);
+#ifdef MODULE_ACTUATOR_BUILTIN
+    fastPath_enabled = (fastPath == STABILIZATIONSETTINGS_RATELOOPFASTPATH_TRUE);
+#else
+    fastPath_enabled = false;
+#endif
+    if (fastPath_enabled) {
+        callbackHandle = PIOS_CALLBACKSCHEDULER_Create(&stabilizationInnerloopTask, CALLBACK_PRIORITY, CBTASK_PRIORITY, CALLBACKINFO_RUNNING_STABILIZATION1, STACK_SIZE_BYTES + ACTUATOR_FASTPATH_STACK_BYTES);
+        GyroStateConnectFastCallback(GyroStateUpdatedCb);
+    } else {
+        callbackHandle = PIOS_CALLBACKSCHEDULER_Create(&stabilizationInnerloopTask, CALLBACK_PRIORITY, CBTASK_PRIORITY, CALLBACKINFO_RUNNING_STABILIZATION1, STACK_SIZE_BYTES);
+        GyroStateConnectCallback(GyroStateUpdatedCb);
+    }
 
     // schedule dead calls every FAILSAFE_TIMEOUT_MS to have the watchdog cleared
     PIOS_CALLBACKSCHEDULER_Schedule(callbackHandle, FAILSAFE_TIMEOUT_MS, CALLBACK_UPDATEMODE_LATER);
@@ -165,12 +192,10 @@ static float pid_curve_value(const pid_curve_scaler *scaler)
     return 1.0f + (IS_REAL(y) ? y : 0.0f);
 }
 
-static pid_scaler create_pid_scaler(int axis)
+static void create_pid_scaler(pid_bank_scaler *scaler, int axis)
 {
-    pid_scaler scaler;
-
     // Always scaled with the this.
-    scaler.p = scaler.i = scaler.d = speedScaleFactor;
+    scaler->p[axis] = scaler->i[axis] = scaler->d[axis] = speedScaleFactor;
 
     if (stabSettings.thrust_pid_scaling_enabled[axis][0]
         || stabSettings.thrust_pid_scaling_enabled[axis][1]
@@ -189,17 +214,15 @@ static pid_scaler create_pid_scaler(int axis)
         float curve_value = pid_curve_value(&curve_scaler);
 
         if (stabSettings.thrust_pid_scaling_enabled[axis][0]) {
-            scaler.p *= curve_value;
+            scaler->p[axis] *= curve_value;
         }
         if (stabSettings.thrust_pid_scaling_enabled[axis][1]) {
-            scaler.i *= curve_value;
+            scaler->i[axis] *= curve_value;
         }
         if (stabSettings.thrust_pid_scaling_enabled[axis][2]) {
-            scaler.d *= curve_value;
+            scaler->d[axis] *= curve_value;
         }
     }
-
-    return scaler;
 }
 
 /**
@@ -275,6 +298,13 @@ static void stabilizationInnerloopTask()
     StabilizationStatusOuterLoopGet(&outerLoop);
     bool allowPiroComp = true;
 
+    // the rate pids of all axes are updated together once every axis has been set up,
+    // the output of an axis is then feedForward + (1 - blend) * pid output
+    pid_bank_scaler pidScaler = { { 0 }, { 0 }, { 0 } };
+    float pidOutput[PID_BANK_LOOPS]      = { 0 };
+    float pidFeedForward[PID_BANK_LOOPS] = { 0 };
+    float pidBlend[PID_BANK_LOOPS]       = { 0 };
+    uint8_t pidActive = 0;
 
     for (t = 0; t < AXES; t++) {
         bool reinit = (StabilizationStatusInnerLoopToArray(enabled)[t] != previous_mode[t]);
@@ -282,7 +312,7 @@ static void stabilizationInnerloopTask()
 
         if (t < STABILIZATIONSTATUS_INNERLOOP_THRUST) {
             if (reinit) {
-                stabSettings.innerPids[t].iAccumulator = 0;
+                stabSettings.innerPids.iAccumulator[t] = 0;
                 if (frame_is_multirotor) {
                     // Multirotors should dump axis lock accumulators when unarmed or throttle is low.
                     // Fixed wing or ground vehicles can fly/drive with low throttle.
@@ -316,8 +346,8 @@ static void stabilizationInnerloopTask()
                                  -StabilizationBankMaximumRateToArray(stabSettings.stabBank.MaximumRate)[t],
                                  StabilizationBankMaximumRateToArray(stabSettings.stabBank.MaximumRate)[t]
                                  );
-                pid_scaler scaler = create_pid_scaler(t);
-                actuatorDesiredAxis[t] = pid_apply_setpoint(&stabSettings.innerPids[t], &scaler, rate[t], gyro_filtered[t], dT, measuredDterm_enabled);
+                create_pid_scaler(&pidScaler, t);
+                pidActive |= 1 << t;
             }
             break;
             case STABILIZATIONSTATUS_INNERLOOP_ACRO:
@@ -331,11 +361,12 @@ static void stabilizationInnerloopTask()
                                  StabilizationBankMaximumRateToArray(stabSettings.stabBank.MaximumRate)[t]
                                  );
 
-                pid_scaler ascaler = create_pid_scaler(t);
-                ascaler.i *= boundf(1.0f - (1.5f * fabsf(stickinput[t])), 0.0f, 1.0f); // this prevents Integral from getting too high while controlled manually
-                float arate  = pid_apply_setpoint(&stabSettings.innerPids[t], &ascaler, rate[t], gyro_filtered[t], dT, measuredDterm_enabled);
+                create_pid_scaler(&pidScaler, t);
+                pidScaler.i[t] *= boundf(1.0f - (1.5f * fabsf(stickinput[t])), 0.0f, 1.0f); // this prevents Integral from getting too high while controlled manually
+                pidActive |= 1 << t;
                 float factor = fabsf(stickinput[t]) * stabSettings.acroInsanityFactors[t];
-                actuatorDesiredAxis[t] = factor * stickinput[t] + (1.0f - factor) * arate;
+                pidFeedForward[t] = factor * stickinput[t];
+                pidBlend[t] = factor;
             }
             break;
 
@@ -392,9 +423,9 @@ static void stabilizationInnerloopTask()
                                  -StabilizationBankMaximumRateToArray(stabSettings.stabBank.MaximumRate)[t],
                                  StabilizationBankMaximumRateToArray(stabSettings.stabBank.MaximumRate)[t]
                                  );
-                pid_scaler scaler = create_pid_scaler(t);
-                actuatorDesiredAxis[t]  = pid_apply_setpoint(&stabSettings.innerPids[t], &scaler, rate[t], gyro_filtered[t], dT, measuredDterm_enabled);
-                actuatorDesiredAxis[t] += identOffsets[t];
+                create_pid_scaler(&pidScaler, t);
+                pidActive |= 1 << t;
+                pidFeedForward[t] = identOffsets[t];
             }
             break;
 #endif /* !defined(PIOS_EXCLUDE_ADVANCED_FEATURES) */
@@ -415,6 +446,14 @@ static void stabilizationInnerloopTask()
                 break;
             }
         }
+    }
+
+    pid_bank_apply_setpoint(&stabSettings.innerPids, &pidScaler, rate, gyro_filtered, pidOutput, pidActive, dT, measuredDterm_enabled);
+
+    for (t = 0; t < AXES; t++) {
+        if (t < PID_BANK_LOOPS && (pidActive & (1 << t))) {
+            actuatorDesiredAxis[t] = pidFeedForward[t] + (1.0f - pidBlend[t]) * pidOutput[t];
+        }
 
         if (!multirotor) {
             // we only need to clamp the desired axis to a sane range if the frame is not a multirotor type
@@ -427,23 +466,30 @@ static void stabilizationInnerloopTask()
     actuator.UpdateTime = dT * 1000;
 
     if (cchain.Stabilization == FLIGHTSTATUS_CONTROLCHAIN_TRUE) {
+        // drive the outputs first, the ActuatorDesired update is only for the other listeners then
+        if (fastPath_enabled) {
+            ActuatorFastPathUpdate(&actuator);
+        }
         ActuatorDesiredSet(&actuator);
     } else {
+        if (fastPath_enabled) {
+            ActuatorFastPathRelease();
+        }
         // Force all axes to reinitialize when engaged
         for (t = 0; t < AXES; t++) {
             previous_mode[t] = 255;
         }
     }
 
-    if (allowPiroComp && stabSettings.stabBank.EnablePiroComp == STABILIZATIONBANK_ENABLEPIROCOMP_TRUE && stabSettings.innerPids[0].iLim > 1e-3f && stabSettings.innerPids[1].iLim > 1e-3f) {
+    if (allowPiroComp && stabSettings.stabBank.EnablePiroComp == STABILIZATIONBANK_ENABLEPIROCOMP_TRUE && stabSettings.innerPids.iLim[0] > 1e-3f && stabSettings.innerPids.iLim[1] > 1e-3f) {
         // attempted piro compensation - rotate pitch and yaw integrals (experimental)
         float angleYaw = DEG2RAD(gyro_filtered[2] * dT);
         float sinYaw   = sinf(angleYaw);
         float cosYaw   = cosf(angleYaw);
-        float rollAcc  = stabSettings.innerPids[0].iAccumulator / stabSettings.innerPids[0].iLim;
-        float pitchAcc = stabSettings.innerPids[1].iAccumulator / stabSettings.innerPids[1].iLim;
-        stabSettings.innerPids[0].iAccumulator = stabSettings.innerPids[0].iLim * (cosYaw * rollAcc + sinYaw * pitchAcc);
-        stabSettings.innerPids[1].iAccumulator = stabSettings.innerPids[1].iLim * (cosYaw * pitchAcc - sinYaw * rollAcc);
+        float rollAcc  = stabSettings.innerPids.iAccumulator[0] / stabSettings.innerPids.iLim[0];
+        float pitchAcc = stabSettings.innerPids.iAccumulator[1] / stabSettings.innerPids.iLim[1];
+        stabSettings.innerPids.iAccumulator[0] = stabSettings.innerPids.iLim[0] * (cosYaw * rollAcc + sinYaw * pitchAcc);
+        stabSettings.innerPids.iAccumulator[1] = stabSettings.innerPids.iLim[1] * (cosYaw * pitchAcc - sinYaw * rollAcc);
     }
 
     {
@@ -474,9 +520,19 @@ static void GyroStateUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 
     GyroStateGet(&gyroState);
 
-    gyro_filtered[0] = gyro_filtered[0] * stabSettings.gyro_alpha + gyroState.x * (1 - stabSettings.gyro_alpha);
-    gyro_filtered[1] = gyro_filtered[1] * stabSettings.gyro_alpha + gyroState.y * (1 - stabSettings.gyro_alpha);
-    gyro_filtered[2] = gyro_filtered[2] * stabSettings.gyro_alpha + gyroState.z * (1 - stabSettings.gyro_alpha);
+    if (gyroFilterAlpha != stabSettings.gyro_alpha) {
+        // GyroTau changed, carry on from the current output
+        struct biquad_coeffs coeffs;
+        gyroFilterAlpha = stabSettings.gyro_alpha;
+        biquad_first_order(&coeffs, gyroFilterAlpha);
+        biquad_bank_init(&gyroFilter, 3, 1, &coeffs);
+        biquad_bank_reset(&gyroFilter, gyro_filtered);
+    }
+    float gyro[3] = { gyroState.x, gyroState.y, gyroState.z };
+    biquad_bank_apply(&gyroFilter, gyro);
+    gyro_filtered[0] = gyro[0];
+    gyro_filtered[1] = gyro[1];
+    gyro_filtered[2] = gyro[2];
 
     PIOS_CALLBACKSCHEDULER_Dispatch(callbackHandle);
     stabSettings.monitor.gyroupdates++;
@@ -109,9 +109,7 @@ int32_t StabilizationInitialize()
     pid_zero(&stabSettings.outerPids[0]);
     pid_zero(&stabSettings.outerPids[1]);
     pid_zero(&stabSettings.outerPids[2]);
-    pid_zero(&stabSettings.innerPids[0]);
-    pid_zero(&stabSettings.innerPids[1]);
-    pid_zero(&stabSettings.innerPids[2]);
+    pid_bank_zero(&stabSettings.innerPids);
     return 0;
 }
 
@@ -304,22 +302,22 @@ static void BankUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
     StabilizationBankGet(&stabSettings.stabBank);
 
     // Set the roll rate PID constants
-    pid_configure(&stabSettings.innerPids[0], stabSettings.stabBank.RollRatePID.Kp,
-                  stabSettings.stabBank.RollRatePID.Ki,
-                  stabSettings.stabBank.RollRatePID.Kd,
-                  stabSettings.stabBank.RollRatePID.ILimit);
+    pid_bank_configure(&stabSettings.innerPids, 0, stabSettings.stabBank.RollRatePID.Kp,
+                       stabSettings.stabBank.RollRatePID.Ki,
+                       stabSettings.stabBank.RollRatePID.Kd,
+                       stabSettings.stabBank.RollRatePID.ILimit);
 
     // Set the pitch rate PID constants
-    pid_configure(&stabSettings.innerPids[1], stabSettings.stabBank.PitchRatePID.Kp,
-                  stabSettings.stabBank.PitchRatePID.Ki,
-                  stabSettings.stabBank.PitchRatePID.Kd,
-                  stabSettings.stabBank.PitchRatePID.ILimit);
+    pid_bank_configure(&stabSettings.innerPids, 1, stabSettings.stabBank.PitchRatePID.Kp,
+                       stabSettings.stabBank.PitchRatePID.Ki,
+                       stabSettings.stabBank.PitchRatePID.Kd,
+                       stabSettings.stabBank.PitchRatePID.ILimit);
 
     // Set the yaw rate PID constants
-    pid_configure(&stabSettings.innerPids[2], stabSettings.stabBank.YawRatePID.Kp,
-                  stabSettings.stabBank.YawRatePID.Ki,
-                  stabSettings.stabBank.YawRatePID.Kd,
-                  stabSettings.stabBank.YawRatePID.ILimit);
+    pid_bank_configure(&stabSettings.innerPids, 2, stabSettings.stabBank.YawRatePID.Kp,
+                       stabSettings.stabBank.YawRatePID.Ki,
+                       stabSettings.stabBank.YawRatePID.Kd,
+                       stabSettings.stabBank.YawRatePID.ILimit);
 
     // Set the roll attitude PI constants
     pid_configure(&stabSettings.outerPids[0], stabSettings.stabBank.RollPI.Kp,
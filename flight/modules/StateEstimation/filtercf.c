@@ -114,6 +114,7 @@ int32_t filterCFInitialize(stateFilter *handle)
     globalInit();
     handle->init      = &initwithoutmag;
     handle->filter    = &filter;
+    handle->inputs    = SENSORUPDATES_gyro | SENSORUPDATES_accel | SENSORUPDATES_mag;
     handle->localdata = pios_malloc(sizeof(struct data));
     return STACK_REQUIRED;
 }
@@ -123,6 +124,7 @@ int32_t filterCFMInitialize(stateFilter *handle)
     globalInit();
     handle->init      = &initwithmag;
     handle->filter    = &filter;
+    handle->inputs    = SENSORUPDATES_gyro | SENSORUPDATES_accel | SENSORUPDATES_mag;
     handle->localdata = pios_malloc(sizeof(struct data));
     return STACK_REQUIRED;
 }
@@ -89,6 +89,7 @@ static int32_t globalInit(stateFilter *handle, bool usePos, bool navOnly)
 {
     handle->init      = &init;
     handle->filter    = &filter;
+    handle->inputs    = SENSORUPDATES_gyro | SENSORUPDATES_accel | SENSORUPDATES_mag | SENSORUPDATES_baro | SENSORUPDATES_pos | SENSORUPDATES_vel | SENSORUPDATES_airspeed;
     handle->localdata = pios_malloc(sizeof(struct data));
     struct data *this = (struct data *)handle->localdata;
     this->usePos      = usePos;
@@ -250,6 +251,7 @@ static filterResult filter(stateFilter *self, stateEstimation *state)
                                            this->ekfConfiguration.Q.GyroDriftZ }
                               );
             INSSetBaroVar(this->ekfConfiguration.R.BaroZ);
+            INSSetCovariancePredictionDivider(this->ekfConfiguration.CovariancePredictionDivider);
 
             // Initialize the gyro bias
             float gyro_bias[3] = { 0.0f, 0.0f, 0.0f };
@@ -44,8 +44,7 @@
 struct data {
     GPSSettingsData  settings;
     HomeLocationData home;
-    float HomeECEF[3];
-    float HomeRne[3][3];
+    struct ltp_frame home_frame;
 };
 
 // Private variables
@@ -60,6 +59,7 @@ int32_t filterLLAInitialize(stateFilter *handle)
 {
     handle->init      = &init;
     handle->filter    = &filter;
+    handle->inputs    = SENSORUPDATES_lla;
     handle->localdata = pios_malloc(sizeof(struct data));
     GPSPositionSensorInitialize();
     return STACK_REQUIRED;
@@ -78,8 +78,8 @@ static int32_t init(__attribute__((unused)) stateFilter *self)
             this->home.Longitude,
             (int32_t)(this->home.Altitude * 1e4f),
         };
-        LLA2ECEF(LLAi, this->HomeECEF);
-        RneFromLLA(LLAi, this->HomeRne);
+        this->home_frame.valid = 0;
+        LTPFrameFromLLA(LLAi, &this->home_frame);
     }
     return 0;
 }
@@ -104,12 +104,14 @@ static filterResult filter(__attribute__((unused)) stateFilter *self, stateEstim
         if ((gpsdata.PDOP < this->settings.MaxPDOP) && (gpsdata.Satellites >= this->settings.MinSatellites) &&
             ((gpsdata.Status == GPSPOSITIONSENSOR_STATUS_FIX3D) || (gpsdata.Status == GPSPOSITIONSENSOR_STATUS_FIX3DDGNSS)) &&
             (gpsdata.Latitude != 0 || gpsdata.Longitude != 0)) {
-            int32_t LLAi[3] = {
-                gpsdata.Latitude,
-                gpsdata.Longitude,
-                (int32_t)((gpsdata.Altitude + gpsdata.GeoidSeparation) * 1e4f),
+            const int32_t LLAi[1][3] = {
+                {
+                    gpsdata.Latitude,
+                    gpsdata.Longitude,
+                    (int32_t)((gpsdata.Altitude + gpsdata.GeoidSeparation) * 1e4f),
+                }
             };
-            LLA2Base(LLAi, this->HomeECEF, this->HomeRne, state->pos);
+            LLA2LTP(&this->home_frame, LLAi, &state->pos, 1);
             state->updated |= SENSORUPDATES_pos;
         }
     }
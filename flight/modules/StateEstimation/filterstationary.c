@@ -53,6 +53,7 @@ int32_t filterStationaryInitialize(stateFilter *handle)
 {
     handle->init      = &init;
     handle->filter    = &filter;
+    handle->inputs    = 0; // fakes position updates at a fixed rate, needs to run on every update
     handle->localdata = pios_malloc(sizeof(struct data));
     return STACK_REQUIRED;
 }
@@ -64,6 +64,7 @@ int32_t filterVelocityInitialize(stateFilter *handle)
 {
     handle->init      = &init;
     handle->filter    = &filter;
+    handle->inputs    = SENSORUPDATES_pos | SENSORUPDATES_vel;
     handle->localdata = pios_malloc(sizeof(struct data));
     return STACK_REQUIRED;
 }
@@ -82,6 +82,7 @@ typedef struct {
 typedef struct stateFilterStruct {
     int32_t (*init)(struct stateFilterStruct *self);
     filterResult (*filter)(struct stateFilterStruct *self, stateEstimation *state);
+    sensorUpdates inputs; // filter is skipped if none of these are updated, 0 runs it on every update
     void *localdata;
 } stateFilter;
 
@@ -54,14 +54,19 @@
 
 #include "revosettings.h"
 #include "flightstatus.h"
+#include "stabilizationsettings.h"
 
 #include "CoordinateConversions.h"
 
+#define PIOS_INSTRUMENT_MODULE
+#include <pios_instrumentation_helper.h>
+
 // Private constants
 #define STACK_SIZE_BYTES        256
 #define CALLBACK_PRIORITY       CALLBACK_PRIORITY_REGULAR
 #define TASK_PRIORITY           CALLBACK_TASK_FLIGHTCONTROL
 #define TIMEOUT_MS              10
+#define MAX_PIPELINE_LENGTH     7
 
 // Private filter init const
 #define FILTER_INIT_FORCE       -1
@@ -129,20 +134,31 @@
 
 
 // Private types
-struct filterPipelineStruct;
-
-typedef const struct filterPipelineStruct {
-    const stateFilter *filter;
-    const struct filterPipelineStruct *next;
-} filterPipeline;
+// a filter of the active pipeline together with the result it returned last time it ran
+typedef struct {
+    filterResult (*filter)(stateFilter *self, stateEstimation *state);
+    stateFilter   *self;
+    sensorUpdates inputs;
+    filterResult  lastResult;
+} filterStage;
 
 // Private variables
 static DelayedCallbackInfo *stateEstimationCallback;
 
 static volatile RevoSettingsData revoSettings;
 static volatile sensorUpdates updatedSensors;
-static volatile int32_t fusionAlgorithm  = -1;
-static const filterPipeline *filterChain = NULL;
+// kept apart from updatedSensors, with the rate loop fast path it is set from the Sensors task
+static volatile bool gyroSensorUpdated;
+static volatile int32_t fusionAlgorithm = -1;
+
+// the active filter pipeline, flattened into an array when it is selected
+static filterStage filterChain[MAX_PIPELINE_LENGTH];
+static uint8_t filterChainLength;
+
+PERF_DEFINE_COUNTER(counterPipeline);
+PERF_DEFINE_COUNTER(counterEstimation);
+PERF_DEFINE_COUNTER(counterPeriod);
+PERF_DEFINE_COUNTER(counterFiltersRun);
 
 // different filters available to state estimation
 static stateFilter magFilter;
@@ -164,151 +180,87 @@ static stateFilter ekf13NavFilter;
 static float gyroRaw[3];
 static float gyroDelta[3];
 
-// preconfigured filter chains selectable via revoSettings.FusionAlgorithm
+// preconfigured filter chains selectable via revoSettings.FusionAlgorithm, NULL terminated
 
-static const filterPipeline *acroQueue = &(filterPipeline) {
-    .filter = &cfFilter,
-    .next   = NULL,
+static stateFilter *const acroQueue[] = {
+    &cfFilter,
+    NULL
 };
 
-static const filterPipeline *cfQueue = &(filterPipeline) {
-    .filter = &airFilter,
-    .next   = &(filterPipeline) {
-        .filter = &baroiFilter,
-        .next   = &(filterPipeline) {
-            .filter = &altitudeFilter,
-            .next   = &(filterPipeline) {
-                .filter = &cfFilter,
-                .next   = NULL,
-            }
-        }
-    }
+static stateFilter *const cfQueue[] = {
+    &airFilter,
+    &baroiFilter,
+    &altitudeFilter,
+    &cfFilter,
+    NULL
 };
-static const filterPipeline *cfmiQueue = &(filterPipeline) {
-    .filter = &magFilter,
-    .next   = &(filterPipeline) {
-        .filter = &airFilter,
-        .next   = &(filterPipeline) {
-            .filter = &baroiFilter,
-            .next   = &(filterPipeline) {
-                .filter = &altitudeFilter,
-                .next   = &(filterPipeline) {
-                    .filter = &cfmFilter,
-                    .next   = NULL,
-                }
-            }
-        }
-    }
+
+static stateFilter *const cfmiQueue[] = {
+    &magFilter,
+    &airFilter,
+    &baroiFilter,
+    &altitudeFilter,
+    &cfmFilter,
+    NULL
 };
-static const filterPipeline *cfmQueue = &(filterPipeline) {
-    .filter = &magFilter,
-    .next   = &(filterPipeline) {
-        .filter = &airFilter,
-        .next   = &(filterPipeline) {
-            .filter = &llaFilter,
-            .next   = &(filterPipeline) {
-                .filter = &baroFilter,
-                .next   = &(filterPipeline) {
-                    .filter = &altitudeFilter,
-                    .next   = &(filterPipeline) {
-                        .filter = &cfmFilter,
-                        .next   = NULL,
-                    }
-                }
-            }
-        }
-    }
+
+static stateFilter *const cfmQueue[] = {
+    &magFilter,
+    &airFilter,
+    &llaFilter,
+    &baroFilter,
+    &altitudeFilter,
+    &cfmFilter,
+    NULL
 };
-static const filterPipeline *ekf13iQueue = &(filterPipeline) {
-    .filter = &magFilter,
-    .next   = &(filterPipeline) {
-        .filter = &airFilter,
-        .next   = &(filterPipeline) {
-            .filter = &baroiFilter,
-            .next   = &(filterPipeline) {
-                .filter = &stationaryFilter,
-                .next   = &(filterPipeline) {
-                    .filter = &ekf13iFilter,
-                    .next   = &(filterPipeline) {
-                        .filter = &velocityFilter,
-                        .next   = NULL,
-                    }
-                }
-            }
-        }
-    }
+
+static stateFilter *const ekf13iQueue[] = {
+    &magFilter,
+    &airFilter,
+    &baroiFilter,
+    &stationaryFilter,
+    &ekf13iFilter,
+    &velocityFilter,
+    NULL
 };
 
-static const filterPipeline *ekf13Queue = &(filterPipeline) {
-    .filter = &magFilter,
-    .next   = &(filterPipeline) {
-        .filter = &airFilter,
-        .next   = &(filterPipeline) {
-            .filter = &llaFilter,
-            .next   = &(filterPipeline) {
-                .filter = &baroFilter,
-                .next   = &(filterPipeline) {
-                    .filter = &ekf13Filter,
-                    .next   = &(filterPipeline) {
-                        .filter = &velocityFilter,
-                        .next   = NULL,
-                    }
-                }
-            }
-        }
-    }
+static stateFilter *const ekf13Queue[] = {
+    &magFilter,
+    &airFilter,
+    &llaFilter,
+    &baroFilter,
+    &ekf13Filter,
+    &velocityFilter,
+    NULL
 };
 
-static const filterPipeline *ekf13NavCFAttQueue = &(filterPipeline) {
-    .filter = &magFilter,
-    .next   = &(filterPipeline) {
-        .filter = &airFilter,
-        .next   = &(filterPipeline) {
-            .filter = &llaFilter,
-            .next   = &(filterPipeline) {
-                .filter = &baroFilter,
-                .next   = &(filterPipeline) {
-                    .filter = &ekf13NavFilter,
-                    .next   = &(filterPipeline) {
-                        .filter = &velocityFilter,
-                        .next   = &(filterPipeline) {
-                            .filter = &cfmFilter,
-                            .next   = NULL,
-                        }
-                    }
-                }
-            }
-        }
-    }
+static stateFilter *const ekf13NavCFAttQueue[] = {
+    &magFilter,
+    &airFilter,
+    &llaFilter,
+    &baroFilter,
+    &ekf13NavFilter,
+    &velocityFilter,
+    &cfmFilter,
+    NULL
 };
 
-static const filterPipeline *ekf13iNavCFAttQueue = &(filterPipeline) {
-    .filter = &magFilter,
-    .next   = &(filterPipeline) {
-        .filter = &airFilter,
-        .next   = &(filterPipeline) {
-            .filter = &baroiFilter,
-            .next   = &(filterPipeline) {
-                .filter = &stationaryFilter,
-                .next   = &(filterPipeline) {
-                    .filter = &ekf13iNavFilter,
-                    .next   = &(filterPipeline) {
-                        .filter = &velocityFilter,
-                        .next   = &(filterPipeline) {
-                            .filter = &cfmFilter,
-                            .next   = NULL,
-                        }
-                    }
-                }
-            }
-        }
-    }
+static stateFilter *const ekf13iNavCFAttQueue[] = {
+    &magFilter,
+    &airFilter,
+    &baroiFilter,
+    &stationaryFilter,
+    &ekf13iNavFilter,
+    &velocityFilter,
+    &cfmFilter,
+    NULL
 };
 
 // Private functions
 
 static void settingsUpdatedCb(UAVObjEvent *objEv);
 static void sensorUpdatedCb(UAVObjEvent *objEv);
+static void gyroSensorUpdatedCb(UAVObjEvent *objEv);
 static void criticalConfigUpdatedCb(UAVObjEvent *objEv);
 static void StateEstimationCb(void);
 
@@ -346,7 +298,16 @@ int32_t StateEstimationInitialize(void)
     HomeLocationConnectCallback(&criticalConfigUpdatedCb);
     AuxMagSettingsConnectCallback(&criticalConfigUpdatedCb);
 
-    GyroSensorConnectCallback(&sensorUpdatedCb);
+    // the gyro shortcut below is the first hop of the rate loop, with the fast path enabled
+    // GyroState is updated synchronously from the Sensors task instead of the event dispatcher
+    StabilizationSettingsInitialize();
+    StabilizationSettingsRateLoopFastPathOptions fastPath;
+    StabilizationSettingsRateLoopFastPathGet(&fastPath);
+    if (fastPath == STABILIZATIONSETTINGS_RATELOOPFASTPATH_TRUE) {
+        GyroSensorConnectFastCallback(&gyroSensorUpdatedCb);
+    } else {
+        GyroSensorConnectCallback(&gyroSensorUpdatedCb);
+    }
     AccelSensorConnectCallback(&sensorUpdatedCb);
     MagSensorConnectCallback(&sensorUpdatedCb);
     BaroSensorConnectCallback(&sensorUpdatedCb);
@@ -372,6 +333,11 @@ int32_t StateEstimationInitialize(void)
     stack_required = maxint32_t(stack_required, filterEKF13NavOnlyInitialize(&ekf13NavFilter));
     stack_required = maxint32_t(stack_required, filterEKF13iNavOnlyInitialize(&ekf13iNavFilter));
 
+    PERF_INIT_COUNTER(counterPipeline, 0x5E000001);
+    PERF_INIT_COUNTER(counterEstimation, 0x5E000002);
+    PERF_INIT_COUNTER(counterPeriod, 0x5E000003);
+    PERF_INIT_COUNTER(counterFiltersRun, 0x5E000004);
+
     stateEstimationCallback = PIOS_CALLBACKSCHEDULER_Create(&StateEstimationCb, CALLBACK_PRIORITY, TASK_PRIORITY, CALLBACKINFO_RUNNING_STATEESTIMATION, stack_required);
 
     return 0;
@@ -404,7 +370,6 @@ static void StateEstimationCb(void)
     static bool lastNavStatus        = false;
     static uint16_t alarmcounter     = 0;
     static uint16_t navstatuscounter = 0;
-    static const filterPipeline *current;
     static stateEstimation states;
     static uint32_t last_time;
     static uint16_t bootDelay = 64;
@@ -416,15 +381,17 @@ static void StateEstimationCb(void)
         return;
     }
 
+    PERF_TIMED_SECTION_START(counterEstimation);
     alarm = FILTERRESULT_OK;
 
     // set alarm to warning if called through timeout
-    if (updatedSensors == 0) {
+    if (updatedSensors == 0 && !gyroSensorUpdated) {
         if (PIOS_DELAY_DiffuS(last_time) > 1000 * TIMEOUT_MS) {
             alarm = FILTERRESULT_WARNING;
         }
     } else {
         last_time = PIOS_DELAY_GetRaw();
+        PERF_MEASURE_PERIOD(counterPeriod);
     }
     FlightStatusArmedOptions fsarmed;
     FlightStatusArmedGet(&fsarmed);
@@ -433,7 +400,7 @@ static void StateEstimationCb(void)
     // check if a new filter chain should be initialized
     if (fusionAlgorithm != revoSettings.FusionAlgorithm) {
         if (fsarmed == FLIGHTSTATUS_ARMED_DISARMED || fusionAlgorithm == FILTER_INIT_FORCE) {
-            const filterPipeline *newFilterChain;
+            stateFilter *const *newFilterChain;
             switch ((RevoSettingsFusionAlgorithmOptions)revoSettings.FusionAlgorithm) {
             case REVOSETTINGS_FUSIONALGORITHM_ACRONOSENSORS:
                 newFilterChain = acroQueue;
@@ -465,26 +432,35 @@ static void StateEstimationCb(void)
                 newFilterChain = NULL;
             }
             // initialize filters in chain
-            current = newFilterChain;
+            filterStage newStages[MAX_PIPELINE_LENGTH];
+            uint8_t newLength  = 0;
             bool error = 0;
             states.debugNavYaw = 0;
             states.navOk = false;
             states.navUsed     = false;
-            while (current != NULL) {
-                int32_t result = current->filter->init((stateFilter *)current->filter);
+            for (stateFilter *const *current = newFilterChain; current && *current; current++) {
+                int32_t result = (*current)->init(*current);
                 if (result != 0) {
                     error = 1;
                     break;
                 }
-                current = current->next;
+                PIOS_Assert(newLength < MAX_PIPELINE_LENGTH);
+                // no result yet, every filter runs at least once after init
+                newStages[newLength++] = (filterStage) {
+                    .filter     = (*current)->filter,
+                    .self       = *current,
+                    .inputs     = (*current)->inputs,
+                    .lastResult = FILTERRESULT_UNINITIALISED,
+                };
             }
             if (error) {
                 AlarmsSet(SYSTEMALARMS_ALARM_ATTITUDE, SYSTEMALARMS_ALARM_ERROR);
                 return;
             } else {
                 // set new fusion algorithm
-                filterChain     = newFilterChain;
-                fusionAlgorithm = revoSettings.FusionAlgorithm;
+                memcpy(filterChain, newStages, newLength * sizeof(filterStage));
+                filterChainLength = newLength;
+                fusionAlgorithm   = revoSettings.FusionAlgorithm;
             }
         }
     }
@@ -492,6 +468,10 @@ static void StateEstimationCb(void)
     // read updated sensor UAVObjects and set initial state
     states.updated = updatedSensors;
     updatedSensors = 0;
+    if (gyroSensorUpdated) {
+        gyroSensorUpdated = false;
+        states.updated   |= SENSORUPDATES_gyro;
+    }
 
     // fetch sensors, check values, and load into state struct
     FETCH_SENSOR_FROM_UAVOBJECT_CHECK_AND_LOAD_TO_STATE_3_DIMENSIONS(GyroSensor, gyro, x, y, z);
@@ -512,17 +492,20 @@ static void StateEstimationCb(void)
     // at this point sensor state is stored in "states" with some rudimentary filtering applied
 
     // apply all filters in the current filter chain
-    current = filterChain;
-
-    // we are not done, re-dispatch self execution
-
-    while (current) {
-        filterResult result = current->filter->filter((stateFilter *)current->filter, &states);
-        if (result > alarm) {
-            alarm = result;
+    // filters with none of their inputs updated are skipped and report the result of their last run
+    PERF_TIMED_SECTION_START(counterPipeline);
+    uint8_t filtersRun = 0;
+    for (filterStage *stage = filterChain; stage < filterChain + filterChainLength; stage++) {
+        if (!stage->inputs || (states.updated & stage->inputs) || stage->lastResult == FILTERRESULT_UNINITIALISED) {
+            stage->lastResult = stage->filter(stage->self, &states);
+            filtersRun++;
+        }
+        if (stage->lastResult > alarm) {
+            alarm = stage->lastResult;
         }
-        current = current->next;
     }
+    PERF_TIMED_SECTION_END(counterPipeline);
+    PERF_TRACK_VALUE(counterFiltersRun, filtersRun);
 
     // the final output of filters is saved in state variables
     // EXPORT_STATE_TO_UAVOBJECT_IF_UPDATED_3_DIMENSIONS(GyroState, gyro, x, y, z) // replaced by performance shortcut
@@ -615,7 +598,9 @@ static void StateEstimationCb(void)
         }
     }
 
-    if (updatedSensors) {
+    PERF_TIMED_SECTION_END(counterEstimation);
+
+    if (updatedSensors || gyroSensorUpdated) {
         PIOS_CALLBACKSCHEDULER_Dispatch(stateEstimationCallback);
     } else {
         PIOS_CALLBACKSCHEDULER_Schedule(stateEstimationCallback, TIMEOUT_MS, CALLBACK_UPDATEMODE_SOONER);
@@ -642,6 +627,27 @@ static void criticalConfigUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 }
 
 
+/**
+ * Callback for GyroSensor updates, runs from the Sensors task if the rate loop fast path is enabled
+ * updates GyroState right away and dispatches the state estimator callback
+ */
+static void gyroSensorUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    // shortcut - update GyroState right away
+    GyroSensorData s;
+    GyroStateData t;
+
+    GyroSensorGet(&s);
+    t.x = s.x + gyroDelta[0];
+    t.y = s.y + gyroDelta[1];
+    t.z = s.z + gyroDelta[2];
+    t.SensorReadTimestamp = s.SensorReadTimestamp;
+    GyroStateSet(&t);
+
+    gyroSensorUpdated = true;
+    PIOS_CALLBACKSCHEDULER_Dispatch(stateEstimationCallback);
+}
+
 /**
  * Callback for eventdispatcher when any sensor UAVObject has been updated
  * updates the list of "recently updated UAVObjects" and dispatches the state estimator callback
@@ -652,19 +658,6 @@ static void sensorUpdatedCb(UAVObjEvent *ev)
         return;
     }
 
-    if (ev->obj == GyroSensorHandle()) {
-        updatedSensors |= SENSORUPDATES_gyro;
-        // shortcut - update GyroState right away
-        GyroSensorData s;
-        GyroStateData t;
-        GyroSensorGet(&s);
-        t.x = s.x + gyroDelta[0];
-        t.y = s.y + gyroDelta[1];
-        t.z = s.z + gyroDelta[2];
-        t.SensorReadTimestamp = s.SensorReadTimestamp;
-        GyroStateSet(&t);
-    }
-
     if (ev->obj == AccelSensorHandle()) {
         updatedSensors |= SENSORUPDATES_accel;
     }
@@ -0,0 +1,102 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup TelemetryModule Telemetry Module
+ * @{
+ *
+ * @file       telemetrybudget.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Token bucket that shares the link capacity between classes of updates
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef TELEMETRYBUDGET_H
+#define TELEMETRYBUDGET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Number of on change updates that can wait for the link
+#define TELEMETRY_BUDGET_MAX_DEFERRED 8
+
+// Update classes, most important first
+typedef enum {
+    TELEMETRY_CLASS_CRITICAL = 0, // meta, priority, settings and acked objects, requests: always sent
+    TELEMETRY_CLASS_ONCHANGE,     // on change and manual updates: wait for the link, merged per object
+    TELEMETRY_CLASS_PERIODIC,     // periodic updates: dropped, the next period sends newer data
+    TELEMETRY_CLASS_NUMELEM
+} TelemetryClass;
+
+typedef enum {
+    TELEMETRY_BUDGET_SEND = 0,
+    TELEMETRY_BUDGET_DEFERRED,
+    TELEMETRY_BUDGET_DROPPED
+} TelemetryBudgetResult;
+
+// An on change update waiting for the link
+struct telemetry_deferred {
+    void     *obj;
+    uint16_t instId;
+    uint16_t bytes;
+};
+
+struct telemetry_budget_stats {
+    uint32_t capacity;                          // bytes/s, 0 if not limited
+    uint32_t bytes[TELEMETRY_CLASS_NUMELEM];    // admitted per class
+    uint32_t dropped[TELEMETRY_CLASS_NUMELEM];  // updates not sent per class
+    uint32_t merged;                            // on change updates merged into a waiting one
+    uint32_t elapsed;                           // ms the above were counted over
+};
+
+struct telemetry_budget {
+    uint32_t nominal;     // bytes/s of the port as configured, 0 if not limited
+    uint32_t capacity;    // bytes/s measured
+    int32_t  tokens;      // bytes that can be sent now
+    uint32_t remainder;   // refill below one byte, in bytes * ms / s
+    uint32_t lastRefill;  // ms
+
+    // link capacity measurement, the transmit side only adds to these
+    uint32_t windowStart; // ms
+    volatile uint32_t windowBytes;
+    volatile uint32_t windowBlockedUs;
+
+    // statistics, read and reset from the stats update of any channel
+    volatile uint32_t statsStart; // ms
+    volatile uint32_t bytes[TELEMETRY_CLASS_NUMELEM];
+    volatile uint32_t dropped[TELEMETRY_CLASS_NUMELEM];
+    volatile uint32_t merged;
+
+    uint8_t  numDeferred;
+    struct telemetry_deferred deferred[TELEMETRY_BUDGET_MAX_DEFERRED];
+};
+
+void telemetry_budget_init(struct telemetry_budget *budget, uint32_t nominal, uint32_t now);
+TelemetryBudgetResult telemetry_budget_admit(struct telemetry_budget *budget, TelemetryClass cls, void *obj, uint16_t instId, uint16_t bytes, uint32_t now);
+bool telemetry_budget_next_deferred(struct telemetry_budget *budget, uint32_t now, struct telemetry_deferred *deferred);
+void telemetry_budget_transmitted(struct telemetry_budget *budget, uint32_t bytes, uint32_t blockedUs);
+void telemetry_budget_get_stats(struct telemetry_budget *budget, uint32_t now, struct telemetry_budget_stats *stats);
+
+#endif // TELEMETRYBUDGET_H
+
+/**
+ * @}
+ * @}
+ */
@@ -58,11 +58,17 @@
  * passes each event to the UAVTalk library which results in the appropriate
  * transmit routine being called to send the data back to the recipient on
  * the "local" or "radio" link.
+ *
+ * Each channel has a budget that shares the capacity of its link between
+ * classes of updates, see telemetrybudget.c. Updates that do not fit wait or
+ * are dropped in processObjEvent(), the waiting ones are sent by the "Tx"
+ * task as the budget allows.
  */
 
 #include <openpilot.h>
 
 #include "telemetry.h"
+#include "telemetrybudget.h"
 
 #include "flighttelemetrystats.h"
 #include "gcstelemetrystats.h"
@@ -98,6 +104,7 @@
 #define MAX_RETRIES               2
 #define STATS_UPDATE_PERIOD_MS    4000
 #define CONNECTION_TIMEOUT_MS     8000
+#define UAVTALK_PACKET_OVERHEAD   11 // header and checksum, see uavtalk_priv.h
 
 #ifdef PIOS_INCLUDE_RFM22B
 #define HAS_RADIO
@@ -120,12 +127,15 @@ typedef struct {
     xTaskHandle rxTaskHandle;
     // Telemetry stream
     UAVTalkConnection uavTalkCon;
+    // Share of the link for each class of updates, and the port it is for
+    struct telemetry_budget budget;
+    uint32_t budgetPort;
 } channelContext;
 
 #ifdef HAS_RADIO
 // Main telemetry channel
 static channelContext localChannel;
-static int32_t transmitLocalData(uint8_t *data, int32_t length);
+static int32_t transmitLocalData(const struct pios_com_iovec *iov, uint8_t iovcnt);
 static void registerLocalObject(UAVObjHandle obj);
 static uint32_t localPort();
 #endif /* ifdef HAS_RADIO */
@@ -134,7 +144,7 @@ static void updateSettings(channelContext *channel);
 
 // OPLink telemetry channel
 static channelContext radioChannel;
-static int32_t transmitRadioData(uint8_t *data, int32_t length);
+static int32_t transmitRadioData(const struct pios_com_iovec *iov, uint8_t iovcnt);
 static void registerRadioObject(UAVObjHandle obj);
 static uint32_t radioPort();
 static uint32_t radio_port;
@@ -154,6 +164,7 @@ static void updateObject(
 static void processObjEvent(
     channelContext *channel,
     UAVObjEvent *ev);
+static void processDeferred(channelContext *channel);
 static int32_t setUpdatePeriod(
     channelContext *channel,
     UAVObjHandle obj,
@@ -164,6 +175,9 @@ static int32_t setLoggingPeriod(
     int32_t updatePeriodMs);
 static void updateTelemetryStats();
 static void gcsTelemetryStatsUpdated();
+static uint32_t telemetryBaud();
+static uint32_t linkCapacity(uint32_t port);
+static void updateBudgetStats(FlightTelemetryStatsData *flightStats);
 
 /**
  * Initialise the telemetry module
@@ -478,6 +492,70 @@ static void updateObject(
 }
 
 
+/**
+ * Class of an update for the link budget
+ * \param[in] obj The object
+ * \param[in] metadata The object's metadata
+ * \param[in] event The event that triggers the update
+ */
+static TelemetryClass updateClass(UAVObjHandle obj, UAVObjMetadata *metadata, int32_t event)
+{
+    if (UAVObjIsMetaobject(obj) || UAVObjIsSettings(obj) || UAVObjIsPriority(obj)
+        || UAVObjGetTelemetryAcked(metadata)) {
+        return TELEMETRY_CLASS_CRITICAL;
+    }
+    if (event == EV_UPDATED_PERIODIC) {
+        return TELEMETRY_CLASS_PERIODIC;
+    }
+    return TELEMETRY_CLASS_ONCHANGE;
+}
+
+/**
+ * Size of an update on the link
+ * \param[in] obj The object
+ * \param[in] instId The instance or UAVOBJ_ALL_INSTANCES
+ */
+static uint16_t updateBytes(UAVObjHandle obj, uint16_t instId)
+{
+    uint32_t instances = (instId == UAVOBJ_ALL_INSTANCES) ? UAVObjGetNumInstances(obj) : 1;
+    uint32_t bytes     = instances * (UAVTALK_PACKET_OVERHEAD + UAVObjGetNumBytes(obj));
+
+    return (bytes > 0xFFFF) ? 0xFFFF : bytes;
+}
+
+/**
+ * Send an object update to the GCS (with retries)
+ * \param[in] telemetry channel context
+ * \param[in] obj The object
+ * \param[in] instId The instance or UAVOBJ_ALL_INSTANCES
+ * \param[in] acked Whether to wait for an ack
+ */
+static void sendObject(
+    channelContext *channel,
+    UAVObjHandle obj,
+    uint16_t instId,
+    uint8_t acked)
+{
+    int32_t retries = 0;
+    int32_t success = -1;
+
+    while (retries < MAX_RETRIES && success == -1) {
+        // call blocks until ack is received or timeout
+        success = UAVTalkSendObject(channel->uavTalkCon,
+                                    obj,
+                                    instId,
+                                    acked, REQ_TIMEOUT_MS);
+        if (success == -1) {
+            ++retries;
+        }
+    }
+    // Update stats
+    txRetries += retries;
+    if (success == -1) {
+        ++txErrors;
+    }
+}
+
 /**
  * Processes queue events
  */
@@ -505,23 +583,22 @@ static void processObjEvent(
         if ((ev->event == EV_UPDATED && (updateMode == UPDATEMODE_ONCHANGE || updateMode == UPDATEMODE_THROTTLED))
             || ev->event == EV_UPDATED_MANUAL
             || (ev->event == EV_UPDATED_PERIODIC && updateMode != UPDATEMODE_THROTTLED)) {
-            // Send update to GCS (with retries)
-            while (retries < MAX_RETRIES && success == -1) {
-                // call blocks until ack is received or timeout
-                success = UAVTalkSendObject(channel->uavTalkCon,
-                                            ev->obj,
-                                            ev->instId,
-                                            UAVObjGetTelemetryAcked(&metadata), REQ_TIMEOUT_MS);
-                if (success == -1) {
-                    ++retries;
-                }
-            }
-            // Update stats
-            txRetries += retries;
-            if (success == -1) {
-                ++txErrors;
+            // Send update to GCS if the link has room for it
+            if (telemetry_budget_admit(&channel->budget,
+                                       updateClass(ev->obj, &metadata, ev->event),
+                                       ev->obj,
+                                       ev->instId,
+                                       updateBytes(ev->obj, ev->instId),
+                                       xTaskGetTickCount() * portTICK_RATE_MS) == TELEMETRY_BUDGET_SEND) {
+                sendObject(channel, ev->obj, ev->instId, UAVObjGetTelemetryAcked(&metadata));
             }
         } else if (ev->event == EV_UPDATE_REQ) {
+            telemetry_budget_admit(&channel->budget,
+                                   TELEMETRY_CLASS_CRITICAL,
+                                   ev->obj,
+                                   ev->instId,
+                                   UAVTALK_PACKET_OVERHEAD,
+                                   xTaskGetTickCount() * portTICK_RATE_MS);
             // Request object update from GCS (with retries)
             while (retries < MAX_RETRIES && success == -1) {
                 // call blocks until update is received or timeout
@@ -581,6 +658,30 @@ static void processObjEvent(
     }
 }
 
+/**
+ * Send the updates that waited for the link, as far as the budget allows.
+ * Restarts the budget when the channel changes port.
+ */
+static void processDeferred(channelContext *channel)
+{
+    struct telemetry_deferred deferred;
+    uint32_t port = channel->getPort();
+    uint32_t now  = xTaskGetTickCount() * portTICK_RATE_MS;
+
+    if (port != channel->budgetPort) {
+        channel->budgetPort = port;
+        telemetry_budget_init(&channel->budget, linkCapacity(port), now);
+    }
+
+    while (telemetry_budget_next_deferred(&channel->budget, now, &deferred)) {
+        UAVObjMetadata metadata;
+
+        UAVObjGetMetadata(deferred.obj, &metadata);
+        sendObject(channel, deferred.obj, deferred.instId, UAVObjGetTelemetryAcked(&metadata));
+        now = xTaskGetTickCount() * portTICK_RATE_MS;
+    }
+}
+
 /**
  * Telemetry transmit task, regular priority
  */
@@ -606,6 +707,8 @@ static void telemetryTxTask(void *parameters)
             // Process event
             processObjEvent(channel, &ev);
         }
+        // send what waited for the link
+        processDeferred(channel);
         // check regular queue and process update - non-blocking
         if (xQueueReceive(channel->queue, &ev, 0) == pdTRUE) {
             // Process event
@@ -616,6 +719,8 @@ static void telemetryTxTask(void *parameters)
             processObjEvent(channel, &ev);
         }
 #else
+        // send what waited for the link
+        processDeferred(channel);
         // wait on queue for updates (1 tick) then repeat cycle
         if (xQueueReceive(channel->queue, &ev, 1) == pdTRUE) {
             // Process event
@@ -690,17 +795,21 @@ static uint32_t radioPort()
 #ifdef HAS_RADIO
 /**
  * Transmit data buffer to the modem or USB port.
- * \param[in] data Data buffer to send
- * \param[in] length Length of buffer
+ * \param[in] iov Segments of the frame to send
+ * \param[in] iovcnt Number of segments
  * \return -1 on failure
  * \return number of bytes transmitted on success
  */
-static int32_t transmitLocalData(uint8_t *data, int32_t length)
+static int32_t transmitLocalData(const struct pios_com_iovec *iov, uint8_t iovcnt)
 {
     uint32_t outputPort = localChannel.getPort();
 
     if (outputPort) {
-        return PIOS_COM_SendBuffer(outputPort, data, length);
+        uint32_t start = PIOS_DELAY_GetRaw();
+        int32_t ret    = PIOS_COM_SendBufferV(outputPort, iov, iovcnt);
+        // time spent waiting for the port tells how full the link is
+        telemetry_budget_transmitted(&localChannel.budget, (ret > 0) ? ret : 0, PIOS_DELAY_DiffuS(start));
+        return ret;
     }
 
     return -1;
@@ -709,17 +818,21 @@ static int32_t transmitLocalData(uint8_t *data, int32_t length)
 
 /**
  * Transmit data buffer to the radioport.
- * \param[in] data Data buffer to send
- * \param[in] length Length of buffer
+ * \param[in] iov Segments of the frame to send
+ * \param[in] iovcnt Number of segments
  * \return -1 on failure
  * \return number of bytes transmitted on success
  */
-static int32_t transmitRadioData(uint8_t *data, int32_t length)
+static int32_t transmitRadioData(const struct pios_com_iovec *iov, uint8_t iovcnt)
 {
     uint32_t outputPort = radioChannel.getPort();
 
     if (outputPort) {
-        return PIOS_COM_SendBuffer(outputPort, data, length);
+        uint32_t start = PIOS_DELAY_GetRaw();
+        int32_t ret    = PIOS_COM_SendBufferV(outputPort, iov, iovcnt);
+        // time spent waiting for the port tells how full the link is
+        telemetry_budget_transmitted(&radioChannel.budget, (ret > 0) ? ret : 0, PIOS_DELAY_DiffuS(start));
+        return ret;
     }
 
     return -1;
@@ -858,6 +971,8 @@ static void updateTelemetryStats()
         flightStats.RxFailures   += utalkStats.rxErrors;
         flightStats.RxSyncErrors += utalkStats.rxSyncErrors;
         flightStats.RxCrcErrors  += utalkStats.rxCrcErrors;
+
+        updateBudgetStats(&flightStats);
     } else {
         flightStats.TxDataRate   = 0;
         flightStats.TxBytes      = 0;
@@ -869,6 +984,12 @@ static void updateTelemetryStats()
         flightStats.RxFailures   = 0;
         flightStats.RxSyncErrors = 0;
         flightStats.RxCrcErrors  = 0;
+
+        flightStats.LinkCapacity = 0;
+        memset(&flightStats.TxUtilization, 0, sizeof(flightStats.TxUtilization));
+        memset(&flightStats.TxDropped, 0, sizeof(flightStats.TxDropped));
+        flightStats.TxMerged     = 0;
+        updateBudgetStats(NULL);
     }
     txErrors  = 0;
     txRetries = 0;
@@ -923,6 +1044,50 @@ static void updateTelemetryStats()
     }
 }
 
+/**
+ * Add the link budget statistics of the channels since the last update
+ * \param[in,out] flightStats the stats to update, NULL to only reset them
+ */
+static void updateBudgetStats(FlightTelemetryStatsData *flightStats)
+{
+    channelContext *channels[] = {
+        &radioChannel,
+#ifdef HAS_RADIO
+        &localChannel,
+#endif
+    };
+    uint32_t now = xTaskGetTickCount() * portTICK_RATE_MS;
+    uint32_t capacity = 0;
+    uint64_t capacityBytes = 0;
+    uint32_t bytes[TELEMETRY_CLASS_NUMELEM] = { 0 };
+
+    for (uint32_t i = 0; i < NELEMENTS(channels); i++) {
+        struct telemetry_budget_stats stats;
+
+        telemetry_budget_get_stats(&channels[i]->budget, now, &stats);
+        if (!flightStats || !stats.capacity) {
+            // utilization of a link that is not limited is meaningless
+            continue;
+        }
+        capacity      += stats.capacity;
+        capacityBytes += (uint64_t)stats.capacity * stats.elapsed / 1000;
+        for (int c = 0; c < TELEMETRY_CLASS_NUMELEM; c++) {
+            bytes[c] += stats.bytes[c];
+        }
+        flightStats->TxDropped.OnChange += stats.dropped[TELEMETRY_CLASS_ONCHANGE];
+        flightStats->TxDropped.Periodic += stats.dropped[TELEMETRY_CLASS_PERIODIC];
+        flightStats->TxMerged += stats.merged;
+    }
+
+    if (!flightStats) {
+        return;
+    }
+    flightStats->LinkCapacity = capacity;
+    flightStats->TxUtilization.Critical = capacityBytes ? 100.0f * bytes[TELEMETRY_CLASS_CRITICAL] / capacityBytes : 0.0f;
+    flightStats->TxUtilization.OnChange = capacityBytes ? 100.0f * bytes[TELEMETRY_CLASS_ONCHANGE] / capacityBytes : 0.0f;
+    flightStats->TxUtilization.Periodic = capacityBytes ? 100.0f * bytes[TELEMETRY_CLASS_PERIODIC] / capacityBytes : 0.0f;
+}
+
 /**
  * Update the telemetry settings, called on startup.
  * FIXME: This should be in the TelemetrySettings object. But objects
@@ -935,35 +1100,107 @@ static void updateSettings(channelContext *channel)
     uint32_t port = channel->getPort();
 
     if (port) {
-        // Retrieve settings
-        HwSettingsTelemetrySpeedOptions speed;
-        HwSettingsTelemetrySpeedGet(&speed);
+        uint32_t baud = telemetryBaud();
 
         // Set port speed
-        switch (speed) {
-        case HWSETTINGS_TELEMETRYSPEED_2400:
-            PIOS_COM_ChangeBaud(port, 2400);
+        if (baud) {
+            PIOS_COM_ChangeBaud(port, baud);
+        }
+    }
+}
+
+/**
+ * Telemetry port speed from the HwSettings
+ * \return baud rate, 0 if not set
+ */
+static uint32_t telemetryBaud()
+{
+    // Retrieve settings
+    HwSettingsTelemetrySpeedOptions speed;
+
+    HwSettingsTelemetrySpeedGet(&speed);
+
+    switch (speed) {
+    case HWSETTINGS_TELEMETRYSPEED_2400:
+        return 2400;
+
+    case HWSETTINGS_TELEMETRYSPEED_4800:
+        return 4800;
+
+    case HWSETTINGS_TELEMETRYSPEED_9600:
+        return 9600;
+
+    case HWSETTINGS_TELEMETRYSPEED_19200:
+        return 19200;
+
+    case HWSETTINGS_TELEMETRYSPEED_38400:
+        return 38400;
+
+    case HWSETTINGS_TELEMETRYSPEED_57600:
+        return 57600;
+
+    case HWSETTINGS_TELEMETRYSPEED_115200:
+        return 115200;
+    }
+    return 0;
+}
+
+/**
+ * Nominal capacity of the link on a port, the budget measures the actual one
+ * \param[in] port com port number
+ * \return bytes/s, 0 if the link is not limited
+ */
+static uint32_t linkCapacity(uint32_t port)
+{
+    if (!port) {
+        return 0;
+    }
+#ifdef PIOS_INCLUDE_USB
+    if (port == PIOS_COM_TELEM_USB) {
+        return 0;
+    }
+#endif /* PIOS_INCLUDE_USB */
+#ifdef PIOS_INCLUDE_RFM22B
+    if (port == PIOS_COM_RF) {
+        OPLinkSettingsAirDataRateOptions rate;
+        uint32_t bps = 64000;
+
+        OPLinkSettingsAirDataRateGet(&rate);
+        switch (rate) {
+        case OPLINKSETTINGS_AIRDATARATE_9600:
+            bps = 9600;
+            break;
+        case OPLINKSETTINGS_AIRDATARATE_19200:
+            bps = 19200;
             break;
-        case HWSETTINGS_TELEMETRYSPEED_4800:
-            PIOS_COM_ChangeBaud(port, 4800);
+        case OPLINKSETTINGS_AIRDATARATE_32000:
+            bps = 32000;
             break;
-        case HWSETTINGS_TELEMETRYSPEED_9600:
-            PIOS_COM_ChangeBaud(port, 9600);
+        case OPLINKSETTINGS_AIRDATARATE_57600:
+            bps = 57600;
             break;
-        case HWSETTINGS_TELEMETRYSPEED_19200:
-            PIOS_COM_ChangeBaud(port, 19200);
+        case OPLINKSETTINGS_AIRDATARATE_64000:
+            bps = 64000;
             break;
-        case HWSETTINGS_TELEMETRYSPEED_38400:
-            PIOS_COM_ChangeBaud(port, 38400);
+        case OPLINKSETTINGS_AIRDATARATE_100000:
+            bps = 100000;
             break;
-        case HWSETTINGS_TELEMETRYSPEED_57600:
-            PIOS_COM_ChangeBaud(port, 57600);
+        case OPLINKSETTINGS_AIRDATARATE_128000:
+            bps = 128000;
             break;
-        case HWSETTINGS_TELEMETRYSPEED_115200:
-            PIOS_COM_ChangeBaud(port, 115200);
+        case OPLINKSETTINGS_AIRDATARATE_192000:
+            bps = 192000;
+            break;
+        case OPLINKSETTINGS_AIRDATARATE_256000:
+            bps = 256000;
             break;
         }
+        // the air time is shared with the other side, half of it for telemetry
+        return bps / 8 / 2;
     }
+#endif /* PIOS_INCLUDE_RFM22B */
+    // serial port, start and stop bits
+    return telemetryBaud() / 10;
 }
 
 /**
@@ -0,0 +1,276 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup TelemetryModule Telemetry Module
+ * @{
+ *
+ * @file       telemetrybudget.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Token bucket that shares the link capacity between classes of updates
+ *
+ * Each telemetry channel fills a bucket with the capacity of its link and
+ * every update takes its size out of it. Critical updates are always sent,
+ * even into debt. On change updates wait in a short list when the bucket is
+ * empty, a newer update of an object that is waiting is merged into it.
+ * Periodic updates are dropped unless there is room for them and a reserve
+ * for the other classes, the next period sends the newer data anyway.
+ *
+ * The link capacity starts at what the port is configured for and follows
+ * what the link takes: when sending blocks the link is full and the rate
+ * it took is its capacity, otherwise the capacity creeps back up.
+ *
+ * The Tx task of the channel owns the bucket. The transmit counts come from
+ * the Rx task as well and the statistics are collected by the stats update
+ * of either channel, these counters are only changed with atomic operations.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <string.h>
+
+#include "telemetrybudget.h"
+
+// Private constants
+#define MIN_BURST_BYTES       256  // about the largest object
+#define BURST_MS              250  // bucket size in time at the link capacity
+#define MIN_CAPACITY          16   // bytes/s, never measure the link down to nothing
+#define MEASURE_WINDOW_MS     1000
+#define SATURATED_PERCENT     10   // blocked this much of a window means the link is full
+
+#define MIN(a, b)             ((a) < (b) ? (a) : (b))
+#define MAX(a, b)             ((a) > (b) ? (a) : (b))
+
+static int32_t burst(const struct telemetry_budget *budget)
+{
+    return MAX(budget->capacity * BURST_MS / 1000, MIN_BURST_BYTES);
+}
+
+/**
+ * Update the measured link capacity once per window
+ */
+static void measure(struct telemetry_budget *budget, uint32_t now)
+{
+    uint32_t elapsed = now - budget->windowStart;
+
+    if (elapsed < MEASURE_WINDOW_MS) {
+        return;
+    }
+
+    // the transmit side adds from other tasks, take the counts and clear them in one step
+    uint32_t bytes     = __sync_fetch_and_and(&budget->windowBytes, 0);
+    uint32_t blockedUs = __sync_fetch_and_and(&budget->windowBlockedUs, 0);
+    budget->windowStart = now;
+
+    if (budget->nominal == 0) {
+        return;
+    }
+
+    uint32_t rate = (uint32_t)((uint64_t)bytes * 1000 / elapsed);
+    if ((uint64_t)blockedUs * 100 > (uint64_t)elapsed * 1000 * SATURATED_PERCENT) {
+        // the link could not take more, what it took is what it can do
+        budget->capacity = MAX((3 * budget->capacity + rate) / 4, MIN_CAPACITY);
+    } else if (rate > budget->capacity) {
+        budget->capacity = rate;
+    } else if (budget->capacity < budget->nominal) {
+        // nothing blocked, try for more
+        budget->capacity += (budget->nominal - budget->capacity + 7) / 8;
+    }
+}
+
+static void refill(struct telemetry_budget *budget, uint32_t now)
+{
+    uint32_t elapsed = now - budget->lastRefill;
+
+    budget->lastRefill = now;
+    measure(budget, now);
+
+    if (budget->capacity == 0) {
+        return;
+    }
+
+    // a long gap fills the bucket whatever its exact length
+    elapsed = MIN(elapsed, 10000);
+    uint64_t fill = (uint64_t)budget->capacity * elapsed + budget->remainder;
+    budget->remainder = (uint32_t)(fill % 1000);
+    budget->tokens    = MIN(budget->tokens + (int32_t)(fill / 1000), burst(budget));
+}
+
+/**
+ * True if there are tokens for bytes and the reserve, anything fits in a full bucket
+ */
+static bool affordable(const struct telemetry_budget *budget, uint16_t bytes, int32_t reserve)
+{
+    return budget->capacity == 0 || budget->tokens >= MIN(bytes + reserve, burst(budget));
+}
+
+static void take(struct telemetry_budget *budget, TelemetryClass cls, uint16_t bytes)
+{
+    __sync_fetch_and_add(&budget->bytes[cls], bytes);
+    if (budget->capacity) {
+        budget->tokens = MAX(budget->tokens - bytes, -burst(budget));
+    }
+}
+
+static int findDeferred(const struct telemetry_budget *budget, void *obj, uint16_t instId)
+{
+    for (int i = 0; i < budget->numDeferred; i++) {
+        if (budget->deferred[i].obj == obj && budget->deferred[i].instId == instId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void removeDeferred(struct telemetry_budget *budget, int idx)
+{
+    budget->numDeferred--;
+    memmove(&budget->deferred[idx], &budget->deferred[idx + 1], (budget->numDeferred - idx) * sizeof(budget->deferred[0]));
+}
+
+/**
+ * Initialise the budget of a channel
+ * \param[in] nominal the capacity of the port in bytes/s, 0 if it is not limited
+ * \param[in] now the time in ms
+ */
+void telemetry_budget_init(struct telemetry_budget *budget, uint32_t nominal, uint32_t now)
+{
+    memset(budget, 0, sizeof(*budget));
+    budget->nominal     = nominal;
+    budget->capacity    = nominal;
+    budget->tokens      = burst(budget);
+    budget->lastRefill  = now;
+    budget->windowStart = now;
+    budget->statsStart  = now;
+}
+
+/**
+ * Decide whether an update can be sent now
+ * \param[in] cls the class of the update
+ * \param[in] obj, instId what the update is of
+ * \param[in] bytes the size of the update on the link
+ * \param[in] now the time in ms
+ * \return TELEMETRY_BUDGET_SEND if it should be sent now, the budget is taken
+ * \return TELEMETRY_BUDGET_DEFERRED if it waits, see telemetry_budget_next_deferred()
+ * \return TELEMETRY_BUDGET_DROPPED if it should not be sent
+ */
+TelemetryBudgetResult telemetry_budget_admit(struct telemetry_budget *budget, TelemetryClass cls, void *obj, uint16_t instId, uint16_t bytes, uint32_t now)
+{
+    int idx = findDeferred(budget, obj, instId);
+
+    refill(budget, now);
+
+    switch (cls) {
+    case TELEMETRY_CLASS_CRITICAL:
+        break;
+
+    case TELEMETRY_CLASS_ONCHANGE:
+        if (idx >= 0) {
+            // already waiting, it will send the newer data
+            budget->deferred[idx].bytes = bytes;
+            __sync_fetch_and_add(&budget->merged, 1);
+            return TELEMETRY_BUDGET_DEFERRED;
+        }
+        // do not overtake the updates that are waiting
+        if (budget->numDeferred > 0 || !affordable(budget, bytes, 0)) {
+            if (budget->numDeferred == TELEMETRY_BUDGET_MAX_DEFERRED) {
+                __sync_fetch_and_add(&budget->dropped[cls], 1);
+                return TELEMETRY_BUDGET_DROPPED;
+            }
+            budget->deferred[budget->numDeferred].obj    = obj;
+            budget->deferred[budget->numDeferred].instId = instId;
+            budget->deferred[budget->numDeferred].bytes  = bytes;
+            budget->numDeferred++;
+            return TELEMETRY_BUDGET_DEFERRED;
+        }
+        break;
+
+    case TELEMETRY_CLASS_PERIODIC:
+    default:
+        // keep a quarter of the bucket for the other classes
+        if (budget->numDeferred > 0 || !affordable(budget, bytes, burst(budget) / 4)) {
+            __sync_fetch_and_add(&budget->dropped[TELEMETRY_CLASS_PERIODIC], 1);
+            return TELEMETRY_BUDGET_DROPPED;
+        }
+        cls = TELEMETRY_CLASS_PERIODIC;
+        break;
+    }
+
+    if (idx >= 0) {
+        // this sends newer data than the waiting update
+        removeDeferred(budget, idx);
+        __sync_fetch_and_add(&budget->merged, 1);
+    }
+    take(budget, cls, bytes);
+    return TELEMETRY_BUDGET_SEND;
+}
+
+/**
+ * Get the oldest waiting update if it can be sent now, the budget is taken
+ * \param[in] now the time in ms
+ * \param[out] deferred the update to send
+ * \return true if there is one
+ */
+bool telemetry_budget_next_deferred(struct telemetry_budget *budget, uint32_t now, struct telemetry_deferred *deferred)
+{
+    refill(budget, now);
+
+    if (budget->numDeferred == 0 || !affordable(budget, budget->deferred[0].bytes, 0)) {
+        return false;
+    }
+
+    *deferred = budget->deferred[0];
+    removeDeferred(budget, 0);
+    take(budget, TELEMETRY_CLASS_ONCHANGE, deferred->bytes);
+    return true;
+}
+
+/**
+ * Account bytes the link was given, from the transmit function
+ * The receive task transmits too, so this may run concurrently with the other calls
+ * \param[in] bytes the bytes sent
+ * \param[in] blockedUs how long sending them took
+ */
+void telemetry_budget_transmitted(struct telemetry_budget *budget, uint32_t bytes, uint32_t blockedUs)
+{
+    __sync_fetch_and_add(&budget->windowBytes, bytes);
+    __sync_fetch_and_add(&budget->windowBlockedUs, blockedUs);
+}
+
+/**
+ * Get the statistics since the last call and reset them
+ * Any task can call this, each count is taken and cleared in one step so none is lost
+ * \param[in] now the time in ms
+ * \param[out] stats the statistics
+ */
+void telemetry_budget_get_stats(struct telemetry_budget *budget, uint32_t now, struct telemetry_budget_stats *stats)
+{
+    stats->capacity = budget->capacity;
+    stats->elapsed  = now - __sync_lock_test_and_set(&budget->statsStart, now);
+    stats->merged   = __sync_fetch_and_and(&budget->merged, 0);
+    for (int c = 0; c < TELEMETRY_CLASS_NUMELEM; c++) {
+        stats->bytes[c]   = __sync_fetch_and_and(&budget->bytes[c], 0);
+        stats->dropped[c] = __sync_fetch_and_and(&budget->dropped[c], 0);
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
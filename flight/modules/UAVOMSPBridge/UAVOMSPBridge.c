@@ -268,29 +268,26 @@ static void uavoMSPBridgeTask(void *parameters);
 
 static void msp_send(struct msp_bridge *m, uint8_t cmd, const uint8_t *data, size_t len)
 {
-    uint8_t buf[5];
+    uint8_t hdr[5];
     uint8_t cs = (uint8_t)(len) ^ cmd;
 
-    buf[0] = '$';
-    buf[1] = 'M';
-    buf[2] = '>';
-    buf[3] = (uint8_t)(len);
-    buf[4] = cmd;
+    hdr[0] = '$';
+    hdr[1] = 'M';
+    hdr[2] = '>';
+    hdr[3] = (uint8_t)(len);
+    hdr[4] = cmd;
 
-    PIOS_COM_SendBuffer(m->com, buf, sizeof(buf));
-
-    if (len > 0) {
-        PIOS_COM_SendBuffer(m->com, data, len);
-
-        for (unsigned i = 0; i < len; i++) {
-            cs ^= data[i];
-        }
+    for (unsigned i = 0; i < len; i++) {
+        cs ^= data[i];
     }
 
-    cs    ^= 0;
+    struct pios_com_iovec iov[] = {
+        { .base = hdr,  .len = sizeof(hdr)   },
+        { .base = data, .len = (uint16_t)len },
+        { .base = &cs,  .len = 1             },
+    };
 
-    buf[0] = cs;
-    PIOS_COM_SendBuffer(m->com, buf, 1);
+    PIOS_COM_SendBufferV(m->com, iov, NELEMENTS(iov));
 }
 
 static msp_state msp_state_size(struct msp_bridge *m, uint8_t b)
@@ -90,6 +90,19 @@ assures priority access on all data objects
 
 This approach is tested and works both on Linux and BSD style Unix (MAC OS X)
 
+Virtual time (lockstep) mode:
+
+When enabled with vPortEnableVirtualTime() before the scheduler starts, the
+supervisor no longer waits for wall clock time. It fires the next tick as soon
+as the system is idle, i.e. the idle task is running or the running task is
+blocked in the host kernel between vPortEnterHostWait() and
+vPortExitHostWait(). ullPortGetVirtualTimeUs() then returns the simulated time
+derived from the tick count. With configUSE_TICKLESS_IDLE the idle task also
+steps over stretches where every task is delayed (vPortSuppressTicksAndSleep()).
+A tick is never delayed by more than one real
+tick period, so busy tasks degrade the simulation to real time instead of
+stalling it.
+
 */
 
 #include <pthread.h>
@@ -110,6 +123,7 @@ This approach is tested and works both on Linux and BSD style Unix (MAC OS X)
 /*-----------------------------------------------------------*/
 
 #define MAX_NUMBER_OF_TASKS 		( _POSIX_THREAD_THREADS_MAX )
+#define IDLE_POLL_MICROSECONDS		( 20 )	/* virtual time: how often the supervisor looks for an idle system */
 /*-----------------------------------------------------------*/
 
 #define PORT_PRINT(...) fprintf(stderr,__VA_ARGS__)
@@ -137,6 +151,7 @@ typedef struct THREAD_SUSPENSIONS
 	pthread_mutex_t threadSleepMutex;
 	pthread_cond_t threadSleepCond;
     volatile enum {THREAD_SLEEPING,THREAD_RUNNING,THREAD_STARTING,THREAD_YIELDING,THREAD_PREEMPTING,THREAD_WAKING} threadStatus;
+	volatile portBASE_TYPE xHostWaiting;
 } xThreadState;
 /*-----------------------------------------------------------*/
 
@@ -158,6 +173,10 @@ static volatile portBASE_TYPE xInterruptsEnabled = pdFALSE;
 static volatile portBASE_TYPE xSchedulerNesting = 0;
 static volatile portBASE_TYPE xPendYield = pdFALSE;
 static volatile portLONG lIndexOfLastAddedTask = 0;
+static volatile portBASE_TYPE xVirtualTime = pdFALSE;
+static volatile unsigned long long ullVirtualTimeUs = 0;
+static pthread_mutex_t xVirtualTimeMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xVirtualTimeCond = PTHREAD_COND_INITIALIZER;
 /*-----------------------------------------------------------*/
 
 /*
@@ -172,6 +191,9 @@ static xThreadState* prvGetThreadHandleByThread( pthread_t hThread );
 static portLONG prvGetFreeThreadState( void );
 static void prvDeleteThread( void *xThreadId );
 static void prvPortYield();
+static portBASE_TYPE prvAllTasksIdle( void );
+static void prvWaitForIdle( void );
+static void prvSignalIdle( void );
 /*-----------------------------------------------------------*/
 
 /*
@@ -301,6 +323,13 @@ portBASE_TYPE xPortStartScheduler( void )
 	gettimeofday( &lastTime, NULL );
 	struct timespec wait;
 	
+	while ( pdTRUE != xSchedulerEnd && pdTRUE == xVirtualTime )
+	{
+		/* lockstep: tick as soon as everybody is idle, but at least once per real tick period */
+		prvWaitForIdle();
+		vPortSystemTickHandler();
+	}
+
 	while ( pdTRUE != xSchedulerEnd )
 	{
 		/* wait for the specified wait time */
@@ -452,6 +481,12 @@ void prvPortYield()
 	xTaskToResume = prvGetThreadHandle( xTaskGetCurrentTaskHandle() );
 	if ( xTaskToSuspend != xTaskToResume )
 	{
+		/* Going idle lets virtual time advance */
+		if ( pdTRUE == xVirtualTime && xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle() )
+		{
+			prvSignalIdle();
+		}
+
 		/* Resume the other thread first */
 		prvResumeThread( xTaskToResume );
 
@@ -646,6 +681,9 @@ void vPortSystemTickHandler()
 	/**
 	 * call tick handler
 	 */
+	if ( pdTRUE == xVirtualTime ) {
+		ullVirtualTimeUs += portTICK_RATE_MICROSECONDS;
+	}
 	xTaskIncrementTick();
 
 	
@@ -924,6 +962,7 @@ portLONG lIndex;
 		pxThreads[ lIndex ].uxCriticalNesting = 0;
 		pxThreads[ lIndex ].threadSleepMutex = minit;
 		pxThreads[ lIndex ].threadSleepCond = cinit;
+		pxThreads[ lIndex ].xHostWaiting = pdFALSE;
 	}
 
 	sigsuspendself.sa_flags = 0;
@@ -1029,6 +1068,7 @@ portLONG lIndex;
 				xInterruptsEnabled = pdTRUE;
 			}
 			pxThreads[ lIndex ].uxCriticalNesting = 0;
+			pxThreads[ lIndex ].xHostWaiting = pdFALSE;
 			break;
 		}
 	}
@@ -1087,3 +1127,142 @@ struct tms xTimes;
 }
 /*-----------------------------------------------------------*/
 
+/**
+ * switch the supervisor to virtual time, must be called before the scheduler starts
+ */
+void vPortEnableVirtualTime( void )
+{
+	PORT_ASSERT( pdFALSE == xSchedulerStarted );
+	xVirtualTime = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortVirtualTimeEnabled( void )
+{
+	return xVirtualTime;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * simulated time in microseconds, advanced by every tick in virtual time mode
+ */
+unsigned long long ullPortGetVirtualTimeUs( void )
+{
+	return ullVirtualTimeUs;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * tickless idle hook (portSUPPRESS_TICKS_AND_SLEEP), called by the idle task with the scheduler suspended
+ * in virtual time mode skip straight to the tick before the next task unblocks, the supervisor delivers
+ * that tick as soon as the idle task has resumed the scheduler
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+	if ( pdTRUE != xVirtualTime ) {
+		return;
+	}
+
+	vPortEnterCritical();
+
+	/* A tick or a task readied between the idle task's check and here would
+	otherwise be stepped over, confirm the sleep with the ticks held off. */
+	if ( eTaskConfirmSleepModeStatus() == eAbortSleep ) {
+		vPortExitCritical();
+		return;
+	}
+
+	vTaskStepTick( xExpectedIdleTime - 1 );
+	ullVirtualTimeUs += ( unsigned long long )( xExpectedIdleTime - 1 ) * portTICK_RATE_MICROSECONDS;
+	vPortExitCritical();
+
+	prvSignalIdle();
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * mark the calling task as blocked in a host system call (select, recv, ...)
+ * FreeRTOS still sees it running, but it does not keep virtual time from advancing
+ */
+void vPortEnterHostWait( void )
+{
+	xThreadState *pxThread = prvGetThreadHandleByThread( pthread_self() );
+
+	if ( pxThread ) {
+		pxThread->xHostWaiting = pdTRUE;
+		if ( pdTRUE == xVirtualTime ) {
+			prvSignalIdle();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitHostWait( void )
+{
+	xThreadState *pxThread = prvGetThreadHandleByThread( pthread_self() );
+
+	if ( pxThread ) {
+		pxThread->xHostWaiting = pdFALSE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * the system is idle if the running task is the idle task or waits for the host
+ * no task of higher priority can be ready, otherwise it would be running instead
+ * while the scheduler is suspended ticks would only pend, e.g. around the idle task's tick step
+ */
+static portBASE_TYPE prvAllTasksIdle( void )
+{
+	xTaskHandle hCurrent = xTaskGetCurrentTaskHandle();
+	xThreadState *pxCurrent = prvGetThreadHandle( hCurrent );
+
+	if ( !pxCurrent || pxCurrent->threadStatus != THREAD_RUNNING ) {
+		return pdFALSE;
+	}
+	if ( taskSCHEDULER_SUSPENDED == xTaskGetSchedulerState() ) {
+		return pdFALSE;
+	}
+	return ( hCurrent == xTaskGetIdleTaskHandle() || pdTRUE == pxCurrent->xHostWaiting ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSignalIdle( void )
+{
+	PORT_LOCK( xVirtualTimeMutex );
+	pthread_cond_signal( &xVirtualTimeCond );
+	PORT_UNLOCK( xVirtualTimeMutex );
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * block the supervisor until the system is idle or one real tick period has passed
+ * the wakeup from a task going idle can come before the supervisor waits, or while the idle task still
+ * holds the scheduler, so look again every few microseconds instead of relying on it alone
+ */
+static void prvWaitForIdle( void )
+{
+	struct timeval xNow;
+	unsigned long long ullDeadlineUs, ullNowUs, ullSliceUs;
+	struct timespec xSlice;
+
+	gettimeofday( &xNow, NULL );
+	ullNowUs = 1000000ULL * xNow.tv_sec + xNow.tv_usec;
+	ullDeadlineUs = ullNowUs + portTICK_RATE_MICROSECONDS;
+
+	PORT_LOCK( xVirtualTimeMutex );
+	while ( pdTRUE != prvAllTasksIdle() && pdTRUE != xSchedulerEnd && ullNowUs < ullDeadlineUs ) {
+		ullSliceUs = ullNowUs + IDLE_POLL_MICROSECONDS;
+		if ( ullSliceUs > ullDeadlineUs ) {
+			ullSliceUs = ullDeadlineUs;
+		}
+		xSlice.tv_sec = ullSliceUs / 1000000;
+		xSlice.tv_nsec = 1000 * ( ullSliceUs % 1000000 );
+		(void)pthread_cond_timedwait( &xVirtualTimeCond, &xVirtualTimeMutex, &xSlice );
+
+		gettimeofday( &xNow, NULL );
+		ullNowUs = 1000000ULL * xNow.tv_sec + xNow.tv_usec;
+	}
+	PORT_UNLOCK( xVirtualTimeMutex );
+}
+/*-----------------------------------------------------------*/
@@ -89,6 +89,7 @@ extern "C" {
 #define portSHORT		short
 #define portSTACK_TYPE  unsigned long
 #define portBASE_TYPE   long
+#define portPOINTER_SIZE_TYPE	unsigned long	/* hosts are LP64 or ILP32 */
 
 typedef portSTACK_TYPE StackType_t;
 typedef long BaseType_t;
@@ -169,6 +170,15 @@ extern unsigned long ulPortGetTimerValue( void );
 #undef portGET_RUN_TIME_COUNTER_VALUE
 #define portGET_RUN_TIME_COUNTER_VALUE()			ulPortGetTimerValue()			/* Query the System time stats for this process. */
 
+/* Virtual time (lockstep) simulation, see port.c. Needs INCLUDE_xTaskGetIdleTaskHandle. */
+extern void vPortEnableVirtualTime( void );
+extern portBASE_TYPE xPortVirtualTimeEnabled( void );
+extern unsigned long long ullPortGetVirtualTimeUs( void );
+extern void vPortEnterHostWait( void );
+extern void vPortExitHostWait( void );
+extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+
 #ifdef __cplusplus
 }
 #endif
@@ -2683,6 +2683,12 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 			/* A yield was pended while the scheduler was suspended. */
 			eReturn = eAbortSleep;
 		}
+		else if( uxPendedTicks != ( UBaseType_t ) 0U )
+		{
+			/* A tick interrupt has already occurred but was held pending
+			because the scheduler is suspended. */
+			eReturn = eAbortSleep;
+		}
 		else
 		{
 			#if configUSE_TIMERS == 0
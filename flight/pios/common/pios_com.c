@@ -524,32 +524,17 @@ int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, u
 
 
 /**
- * Sends a package over given port
- * (blocking function)
- * \param[in] port COM port
- * \param[in] buffer character buffer
- * \param[in] len buffer length
+ * Pushes a buffer into the tx fifo, waiting for room as needed.
+ * Caller must hold sendbuffer_sem.
  * \return -1 if port not available
- * \return -2 if mutex can't be taken;
  * \return -3 if data cannot be sent in the max allotted time of 5000msec
  * \return number of bytes transmitted on success
  */
-int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len)
+static int32_t PIOS_COM_SendBufferBlockingInternal(struct pios_com_dev *com_dev, const uint8_t *buffer, uint16_t len)
 {
-    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
-
-    if (!PIOS_COM_validate(com_dev)) {
-        /* Undefined COM port for this board (see pios_board.c) */
-        return -1;
-    }
-    PIOS_Assert(com_dev->has_tx);
-#if defined(PIOS_INCLUDE_FREERTOS)
-    if (xSemaphoreTake(com_dev->sendbuffer_sem, 5) != pdTRUE) {
-        return -2;
-    }
-#endif /* PIOS_INCLUDE_FREERTOS */
     uint32_t max_frag_len  = fifoBuf_getSize(&com_dev->tx);
     uint32_t bytes_to_send = len;
+
     while (bytes_to_send) {
         uint32_t frag_size;
 
@@ -565,9 +550,6 @@ int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len
         } else {
             switch (rc) {
             case -1:
-#if defined(PIOS_INCLUDE_FREERTOS)
-                xSemaphoreGive(com_dev->sendbuffer_sem);
-#endif /* PIOS_INCLUDE_FREERTOS */
                 /* Device is invalid, this will never work */
                 return -1;
 
@@ -580,24 +562,189 @@ int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len
                 }
 #if defined(PIOS_INCLUDE_FREERTOS)
                 if (xSemaphoreTake(com_dev->tx_sem, 5000) != pdTRUE) {
-                    xSemaphoreGive(com_dev->sendbuffer_sem);
                     return -3;
                 }
 #endif
                 continue;
             default:
                 /* Unhandled return code */
+                return rc;
+            }
+        }
+    }
+    return len;
+}
+
+/**
+ * Sends a package over given port
+ * (blocking function)
+ * \param[in] port COM port
+ * \param[in] buffer character buffer
+ * \param[in] len buffer length
+ * \return -1 if port not available
+ * \return -2 if mutex can't be taken;
+ * \return -3 if data cannot be sent in the max allotted time of 5000msec
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+    PIOS_Assert(com_dev->has_tx);
 #if defined(PIOS_INCLUDE_FREERTOS)
-                xSemaphoreGive(com_dev->sendbuffer_sem);
+    if (xSemaphoreTake(com_dev->sendbuffer_sem, 5) != pdTRUE) {
+        return -2;
+    }
 #endif /* PIOS_INCLUDE_FREERTOS */
-                return rc;
+    int32_t ret = PIOS_COM_SendBufferBlockingInternal(com_dev, buffer, len);
+#if defined(PIOS_INCLUDE_FREERTOS)
+    xSemaphoreGive(com_dev->sendbuffer_sem);
+#endif /* PIOS_INCLUDE_FREERTOS */
+    return ret;
+}
+
+static uint32_t PIOS_COM_IovecLength(const struct pios_com_iovec *iov, uint8_t iovcnt)
+{
+    uint32_t total = 0;
+
+    for (uint8_t i = 0; i < iovcnt; i++) {
+        total += iov[i].len;
+    }
+    return total;
+}
+
+static int32_t PIOS_COM_SendBufferVNonBlockingInternal(struct pios_com_dev *com_dev, const struct pios_com_iovec *iov, uint8_t iovcnt, uint32_t total)
+{
+    PIOS_Assert(com_dev);
+    PIOS_Assert(com_dev->has_tx);
+    if (com_dev->driver->available && !(com_dev->driver->available(com_dev->lower_id) & COM_AVAILABLE_TX)) {
+        /* Underlying device is down/unconnected, act like an infinite data sink */
+        fifoBuf_clearData(&com_dev->tx);
+        return total;
+    }
+
+    if (total > fifoBuf_getFree(&com_dev->tx)) {
+        /* Buffer cannot accept the whole frame (retry) */
+        return -2;
+    }
+
+    for (uint8_t i = 0; i < iovcnt; i++) {
+        if (iov[i].len) {
+            fifoBuf_putData(&com_dev->tx, iov[i].base, iov[i].len);
+        }
+    }
+
+    if (total > 0) {
+        /* Whole frame is in the tx buffer, make sure the tx is started */
+        if (com_dev->driver->tx_start) {
+            com_dev->driver->tx_start(com_dev->lower_id,
+                                      fifoBuf_getUsed(&com_dev->tx));
+        }
+    }
+    return total;
+}
+
+/**
+ * Sends a frame made of several segments over given port.
+ * All segments are queued at once or not at all, so the frame is never
+ * interleaved with data from other senders.
+ * \param[in] port COM port
+ * \param[in] iov array of segments
+ * \param[in] iovcnt number of segments
+ * \return -1 if port not available
+ * \return -2 if buffer cannot hold the whole frame
+ *            caller should retry until buffer is free again
+ * \return -3 another thread is already sending, caller should
+ *            retry until com is available again
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_SendBufferVNonBlocking(uint32_t com_id, const struct pios_com_iovec *iov, uint8_t iovcnt)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+    PIOS_Assert(com_dev->has_tx);
+    PIOS_Assert(iov || !iovcnt);
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xSemaphoreTake(com_dev->sendbuffer_sem, 0) != pdTRUE) {
+        return -3;
+    }
+#endif /* PIOS_INCLUDE_FREERTOS */
+    int32_t ret = PIOS_COM_SendBufferVNonBlockingInternal(com_dev, iov, iovcnt, PIOS_COM_IovecLength(iov, iovcnt));
+#if defined(PIOS_INCLUDE_FREERTOS)
+    xSemaphoreGive(com_dev->sendbuffer_sem);
+#endif /* PIOS_INCLUDE_FREERTOS */
+    return ret;
+}
+
+/**
+ * Sends a frame made of several segments over given port
+ * (blocking function)
+ * The port is held for the whole frame so it is never interleaved with
+ * data from other senders. Frames that fit in the tx fifo are queued in
+ * one go.
+ * \param[in] port COM port
+ * \param[in] iov array of segments
+ * \param[in] iovcnt number of segments
+ * \return -1 if port not available
+ * \return -2 if mutex can't be taken;
+ * \return -3 if data cannot be sent in the max allotted time of 5000msec
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_SendBufferV(uint32_t com_id, const struct pios_com_iovec *iov, uint8_t iovcnt)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+    PIOS_Assert(com_dev->has_tx);
+    PIOS_Assert(iov || !iovcnt);
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xSemaphoreTake(com_dev->sendbuffer_sem, 5) != pdTRUE) {
+        return -2;
+    }
+#endif /* PIOS_INCLUDE_FREERTOS */
+    uint32_t total = PIOS_COM_IovecLength(iov, iovcnt);
+    int32_t ret;
+
+    if (total <= fifoBuf_getSize(&com_dev->tx)) {
+        while ((ret = PIOS_COM_SendBufferVNonBlockingInternal(com_dev, iov, iovcnt, total)) == -2) {
+            /* Wait for the underlying device to make room for the whole frame */
+            if (com_dev->driver->tx_start) {
+                (com_dev->driver->tx_start)(com_dev->lower_id,
+                                            fifoBuf_getUsed(&com_dev->tx));
+            }
+#if defined(PIOS_INCLUDE_FREERTOS)
+            if (xSemaphoreTake(com_dev->tx_sem, 5000) != pdTRUE) {
+                ret = -3;
+                break;
+            }
+#endif
+        }
+    } else {
+        /* Frame larger than the fifo, stream it segment by segment while holding the port */
+        ret = total;
+        for (uint8_t i = 0; i < iovcnt; i++) {
+            int32_t rc = PIOS_COM_SendBufferBlockingInternal(com_dev, iov[i].base, iov[i].len);
+            if (rc < 0) {
+                ret = rc;
+                break;
             }
         }
     }
 #if defined(PIOS_INCLUDE_FREERTOS)
     xSemaphoreGive(com_dev->sendbuffer_sem);
 #endif /* PIOS_INCLUDE_FREERTOS */
-    return len;
+    return ret;
 }
 
 /**
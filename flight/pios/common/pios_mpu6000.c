@@ -51,6 +51,22 @@ bool PIOS_MPU6000_driver_Test(uintptr_t context);
 void PIOS_MPU6000_driver_Reset(uintptr_t context);
 void PIOS_MPU6000_driver_get_scale(float *scales, uint8_t size, uintptr_t context);
 QueueHandle_t PIOS_MPU6000_driver_get_queue(uintptr_t context);
+#ifdef PIOS_INCLUDE_SPI
+bool PIOS_MPU6000_driver_poll(uintptr_t context);
+uint16_t PIOS_MPU6000_driver_fetch_block(PIOS_SENSORS_3Axis_SensorsBlock *block, uint8_t size, uintptr_t context);
+void PIOS_MPU6000_driver_reset_fifo(uintptr_t context);
+
+const PIOS_SENSORS_Driver PIOS_MPU6000_Burst_Driver = {
+    .test        = PIOS_MPU6000_driver_Test,
+    .poll        = PIOS_MPU6000_driver_poll,
+    .fetch       = NULL,
+    .fetch_block = PIOS_MPU6000_driver_fetch_block,
+    .reset       = PIOS_MPU6000_driver_reset_fifo,
+    .get_queue   = NULL,
+    .get_scale   = PIOS_MPU6000_driver_get_scale,
+    .is_polled   = true,
+};
+#endif /* PIOS_INCLUDE_SPI */
 
 const PIOS_SENSORS_Driver PIOS_MPU6000_Driver = {
     .test      = PIOS_MPU6000_driver_Test,
@@ -115,6 +131,15 @@ static PIOS_SENSORS_3Axis_SensorsWithTemp *queue_data = 0;
 #define SENSOR_COUNT     2
 #define SENSOR_DATA_SIZE (sizeof(PIOS_SENSORS_3Axis_SensorsWithTemp) + sizeof(Vector3i16) * SENSOR_COUNT)
 
+#ifdef PIOS_INCLUDE_SPI
+// Accel, temperature and gyro records, same layout as the sensor registers
+#define PIOS_MPU6000_FIFO_STORE        (PIOS_MPU6000_ACCEL_OUT | PIOS_MPU6000_FIFO_TEMP_OUT | PIOS_MPU6000_FIFO_GYRO_X_OUT | PIOS_MPU6000_FIFO_GYRO_Y_OUT | PIOS_MPU6000_FIFO_GYRO_Z_OUT)
+#define PIOS_MPU6000_FIFO_SIZE         1024
+#define PIOS_MPU6000_MAX_BURST_SAMPLES 24
+static uint8_t fifo_buffer[PIOS_MPU6000_MAX_BURST_SAMPLES * PIOS_MPU6000_SAMPLES_BYTES];
+static uint32_t fifo_read_timestamp;
+#endif
+
 // ! Private functions
 static struct mpu6000_dev *PIOS_MPU6000_alloc(const struct pios_mpu6000_cfg *cfg);
 static int32_t PIOS_MPU6000_Validate(struct mpu6000_dev *dev);
@@ -146,10 +171,17 @@ struct pios_mpu6000_io_driver i2c_io_driver = {
 #endif /* PIOS_INCLUDE_I2C */
 
 static bool PIOS_MPU6000_HandleData(uint32_t gyro_read_timestamp);
+static void PIOS_MPU6000_ConvertSample(const mpu6000_data_t *raw, PIOS_SENSORS_3Axis_SensorsWithTemp *sample);
 static int32_t PIOS_MPU6000_Test(void);
 
 void PIOS_MPU6000_Register()
 {
+#ifdef PIOS_INCLUDE_SPI
+    if (dev->cfg->fifo_burst && dev->cfg->i2c_addr == 0) {
+        PIOS_SENSORS_Register(&PIOS_MPU6000_Burst_Driver, PIOS_SENSORS_TYPE_3AXIS_GYRO_ACCEL, 0);
+        return;
+    }
+#endif
     PIOS_SENSORS_Register(&PIOS_MPU6000_Driver, PIOS_SENSORS_TYPE_3AXIS_GYRO_ACCEL, 0);
 }
 /**
@@ -236,6 +268,19 @@ int32_t PIOS_MPU6000_Init(uint32_t port_id, uint32_t slave_num, const struct pio
  */
 static void PIOS_MPU6000_Config(struct pios_mpu6000_cfg const *cfg)
 {
+    uint8_t fifo_store   = cfg->Fifo_store;
+    uint8_t user_ctl     = cfg->User_ctl;
+    uint8_t interrupt_en = cfg->interrupt_en;
+
+#ifdef PIOS_INCLUDE_SPI
+    // Burst mode: every sample goes to the FIFO, no data ready interrupts
+    if (cfg->fifo_burst && cfg->i2c_addr == 0) {
+        fifo_store    = PIOS_MPU6000_FIFO_STORE;
+        user_ctl     |= PIOS_MPU6000_USERCTL_FIFO_EN;
+        interrupt_en  = 0;
+    }
+#endif
+
     PIOS_MPU6000_Test();
 
     // Reset chip
@@ -271,17 +316,17 @@ static void PIOS_MPU6000_Config(struct pios_mpu6000_cfg const *cfg)
     }
 
     // Interrupt configuration
-    while (dev->driver->SetReg(PIOS_MPU6000_INT_EN_REG, cfg->interrupt_en) != 0) {
+    while (dev->driver->SetReg(PIOS_MPU6000_INT_EN_REG, interrupt_en) != 0) {
         ;
     }
 
     // FIFO storage
-    while (dev->driver->SetReg(PIOS_MPU6000_FIFO_EN_REG, cfg->Fifo_store) != 0) {
+    while (dev->driver->SetReg(PIOS_MPU6000_FIFO_EN_REG, fifo_store) != 0) {
         ;
     }
     PIOS_MPU6000_ConfigureRanges(cfg->gyro_range, cfg->accel_range, cfg->filter);
     // Interrupt configuration
-    while (dev->driver->SetReg(PIOS_MPU6000_USER_CTRL_REG, cfg->User_ctl) != 0) {
+    while (dev->driver->SetReg(PIOS_MPU6000_USER_CTRL_REG, user_ctl) != 0) {
         ;
     }
 
@@ -296,10 +341,10 @@ static void PIOS_MPU6000_Config(struct pios_mpu6000_cfg const *cfg)
     }
 
     // Interrupt configuration
-    while (dev->driver->SetReg(PIOS_MPU6000_INT_EN_REG, cfg->interrupt_en) != 0) {
+    while (dev->driver->SetReg(PIOS_MPU6000_INT_EN_REG, interrupt_en) != 0) {
         ;
     }
-    if ((dev->driver->GetReg(PIOS_MPU6000_INT_EN_REG)) != cfg->interrupt_en) {
+    if ((dev->driver->GetReg(PIOS_MPU6000_INT_EN_REG)) != interrupt_en) {
         return;
     }
 
@@ -721,76 +766,83 @@ static bool PIOS_MPU6000_HandleData(uint32_t gyro_read_timestamp_p)
         return false;
     }
 
+    PIOS_MPU6000_ConvertSample(&mpu6000_data, queue_data);
+    queue_data->timestamp = gyro_read_timestamp_p;
+
+    BaseType_t higherPriorityTaskWoken;
+    xQueueSendToBackFromISR(dev->queue, (void *)queue_data, &higherPriorityTaskWoken);
+    return higherPriorityTaskWoken == pdTRUE;
+}
+
+/**
+ * @brief Convert a raw sample to a sensor sample in OP orientation, without timestamp
+ */
+static void PIOS_MPU6000_ConvertSample(const mpu6000_data_t *raw, PIOS_SENSORS_3Axis_SensorsWithTemp *sample)
+{
     // Rotate the sensor to OP convention.  The datasheet defines X as towards the right
     // and Y as forward.  OP convention transposes this.  Also the Z is defined negatively
     // to our convention
     switch (dev->cfg->orientation) {
     case PIOS_MPU6000_TOP_0DEG:
-        queue_data->sample[0].y = GET_SENSOR_DATA(mpu6000_data, Accel_X); // chip X
-        queue_data->sample[0].x = GET_SENSOR_DATA(mpu6000_data, Accel_Y); // chip Y
-        queue_data->sample[1].y = GET_SENSOR_DATA(mpu6000_data, Gyro_X); // chip X
-        queue_data->sample[1].x = GET_SENSOR_DATA(mpu6000_data, Gyro_Y); // chip Y
+        sample->sample[0].y = GET_SENSOR_DATA((*raw), Accel_X); // chip X
+        sample->sample[0].x = GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
+        sample->sample[1].y = GET_SENSOR_DATA((*raw), Gyro_X); // chip X
+        sample->sample[1].x = GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
         break;
     case PIOS_MPU6000_TOP_90DEG:
         // -1 to bring it back to -32768 +32767 range
-        queue_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_Y)); // chip Y
-        queue_data->sample[0].x = GET_SENSOR_DATA(mpu6000_data, Accel_X); // chip X
-        queue_data->sample[1].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_Y)); // chip Y
-        queue_data->sample[1].x = GET_SENSOR_DATA(mpu6000_data, Gyro_X); // chip X
+        sample->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Accel_Y)); // chip Y
+        sample->sample[0].x = GET_SENSOR_DATA((*raw), Accel_X); // chip X
+        sample->sample[1].y = -1 - (GET_SENSOR_DATA((*raw), Gyro_Y)); // chip Y
+        sample->sample[1].x = GET_SENSOR_DATA((*raw), Gyro_X); // chip X
         break;
     case PIOS_MPU6000_TOP_180DEG:
-        queue_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_X)); // chip X
-        queue_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_Y)); // chip Y
-        queue_data->sample[1].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_X)); // chip X
-        queue_data->sample[1].x = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_Y)); // chip Y
+        sample->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Accel_X)); // chip X
+        sample->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Accel_Y)); // chip Y
+        sample->sample[1].y = -1 - (GET_SENSOR_DATA((*raw), Gyro_X)); // chip X
+        sample->sample[1].x = -1 - (GET_SENSOR_DATA((*raw), Gyro_Y)); // chip Y
         break;
     case PIOS_MPU6000_TOP_270DEG:
-        queue_data->sample[0].y = GET_SENSOR_DATA(mpu6000_data, Accel_Y); // chip Y
-        queue_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_X)); // chip X
-        queue_data->sample[1].y = GET_SENSOR_DATA(mpu6000_data, Gyro_Y); // chip Y
-        queue_data->sample[1].x = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_X)); // chip X
+        sample->sample[0].y = GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
+        sample->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Accel_X)); // chip X
+        sample->sample[1].y = GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
+        sample->sample[1].x = -1 - (GET_SENSOR_DATA((*raw), Gyro_X)); // chip X
         break;
     case PIOS_MPU6000_BOTTOM_0DEG:
-        queue_data->sample[0].y = GET_SENSOR_DATA(mpu6000_data, Accel_X); // chip X
-        queue_data->sample[0].x = -1 - GET_SENSOR_DATA(mpu6000_data, Accel_Y); // chip Y
-        queue_data->sample[1].y = GET_SENSOR_DATA(mpu6000_data, Gyro_X); // chip X
-        queue_data->sample[1].x = -1 - GET_SENSOR_DATA(mpu6000_data, Gyro_Y); // chip Y
+        sample->sample[0].y = GET_SENSOR_DATA((*raw), Accel_X); // chip X
+        sample->sample[0].x = -1 - GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
+        sample->sample[1].y = GET_SENSOR_DATA((*raw), Gyro_X); // chip X
+        sample->sample[1].x = -1 - GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
         break;
     case PIOS_MPU6000_BOTTOM_90DEG:
-        queue_data->sample[0].y = GET_SENSOR_DATA(mpu6000_data, Accel_Y); // chip Y
-        queue_data->sample[0].x = GET_SENSOR_DATA(mpu6000_data, Accel_X); // chip X
-        queue_data->sample[1].y = GET_SENSOR_DATA(mpu6000_data, Gyro_Y); // chip Y
-        queue_data->sample[1].x = GET_SENSOR_DATA(mpu6000_data, Gyro_X); // chip X
+        sample->sample[0].y = GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
+        sample->sample[0].x = GET_SENSOR_DATA((*raw), Accel_X); // chip X
+        sample->sample[1].y = GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
+        sample->sample[1].x = GET_SENSOR_DATA((*raw), Gyro_X); // chip X
         break;
     case PIOS_MPU6000_BOTTOM_180DEG:
-        queue_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_X)); // chip X
-        queue_data->sample[0].x = GET_SENSOR_DATA(mpu6000_data, Accel_Y); // chip Y
-        queue_data->sample[1].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_X)); // chip X
-        queue_data->sample[1].x = GET_SENSOR_DATA(mpu6000_data, Gyro_Y); // chip Y
+        sample->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Accel_X)); // chip X
+        sample->sample[0].x = GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
+        sample->sample[1].y = -1 - (GET_SENSOR_DATA((*raw), Gyro_X)); // chip X
+        sample->sample[1].x = GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
         break;
     case PIOS_MPU6000_BOTTOM_270DEG:
-        queue_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_Y)); // chip Y
-        queue_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_X)); // chip X
-        queue_data->sample[1].y = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_Y)); // chip Y
-        queue_data->sample[1].x = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_X)); // chip X
+        sample->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Accel_Y)); // chip Y
+        sample->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Accel_X)); // chip X
+        sample->sample[1].y = -1 - (GET_SENSOR_DATA((*raw), Gyro_Y)); // chip Y
+        sample->sample[1].x = -1 - (GET_SENSOR_DATA((*raw), Gyro_X)); // chip X
         break;
     }
     if ((dev->cfg->orientation & PIOS_MPU6000_LOCATION_MASK) == PIOS_MPU6000_LOCATION_TOP) {
-        queue_data->sample[0].z = -1 - (GET_SENSOR_DATA(mpu6000_data, Accel_Z));
-        queue_data->sample[1].z = -1 - (GET_SENSOR_DATA(mpu6000_data, Gyro_Z));
+        sample->sample[0].z = -1 - (GET_SENSOR_DATA((*raw), Accel_Z));
+        sample->sample[1].z = -1 - (GET_SENSOR_DATA((*raw), Gyro_Z));
     } else {
-        queue_data->sample[0].z = GET_SENSOR_DATA(mpu6000_data, Accel_Z);
-        queue_data->sample[1].z = GET_SENSOR_DATA(mpu6000_data, Gyro_Z);
+        sample->sample[0].z = GET_SENSOR_DATA((*raw), Accel_Z);
+        sample->sample[1].z = GET_SENSOR_DATA((*raw), Gyro_Z);
     }
-    const int16_t temp = GET_SENSOR_DATA(mpu6000_data, Temperature);
+    const int16_t temp = GET_SENSOR_DATA((*raw), Temperature);
     // Temperature in degrees C = (TEMP_OUT Register Value as a signed quantity)/340 + 36.53
-    queue_data->temperature = 3653 + (temp * 100) / 340;
-    queue_data->timestamp   = gyro_read_timestamp_p;
-
-
-    BaseType_t higherPriorityTaskWoken;
-    xQueueSendToBackFromISR(dev->queue, (void *)queue_data, &higherPriorityTaskWoken);
-    return higherPriorityTaskWoken == pdTRUE;
+    sample->temperature = 3653 + (temp * 100) / 340;
 }
 
 // Sensor driver implementation
@@ -815,6 +867,84 @@ QueueHandle_t PIOS_MPU6000_driver_get_queue(__attribute__((unused)) uintptr_t co
 {
     return dev->queue;
 }
+
+#ifdef PIOS_INCLUDE_SPI
+bool PIOS_MPU6000_driver_poll(__attribute__((unused)) uintptr_t context)
+{
+    return mpu6000_configured;
+}
+
+/**
+ * @brief Read every complete record from the FIFO with one SPI burst and sum them
+ * @return number of samples in the block
+ */
+uint16_t PIOS_MPU6000_driver_fetch_block(PIOS_SENSORS_3Axis_SensorsBlock *block, uint8_t size, __attribute__((unused)) uintptr_t context)
+{
+    PIOS_Assert(size >= SENSOR_COUNT);
+
+    uint32_t timestamp = PIOS_DELAY_GetRaw();
+
+    if (PIOS_MPU6000_ClaimBus(true) != 0) {
+        return 0;
+    }
+    PIOS_SPI_TransferByte(dev->port_id, 0x80 | PIOS_MPU6000_FIFO_CNT_MSB);
+    uint16_t fifo_count = PIOS_SPI_TransferByte(dev->port_id, 0) << 8;
+    fifo_count |= PIOS_SPI_TransferByte(dev->port_id, 0);
+    PIOS_MPU6000_ReleaseBus();
+
+    if (fifo_count >= PIOS_MPU6000_FIFO_SIZE) {
+        // overflowed, records are no longer aligned
+        PIOS_MPU6000_driver_reset_fifo(0);
+        return 0;
+    }
+
+    uint16_t samples = fifo_count / PIOS_MPU6000_SAMPLES_BYTES;
+    if (samples > PIOS_MPU6000_MAX_BURST_SAMPLES) {
+        samples = PIOS_MPU6000_MAX_BURST_SAMPLES;
+    }
+    if (samples == 0) {
+        return 0;
+    }
+
+    if (PIOS_MPU6000_ClaimBus(true) != 0) {
+        return 0;
+    }
+    PIOS_SPI_TransferByte(dev->port_id, 0x80 | PIOS_MPU6000_FIFO_REG);
+    int32_t result = PIOS_SPI_TransferBlock(dev->port_id, NULL, fifo_buffer, samples * PIOS_MPU6000_SAMPLES_BYTES, NULL);
+    PIOS_MPU6000_ReleaseBus();
+    if (result < 0) {
+        return 0;
+    }
+
+    memset(block, 0, sizeof(*block) + SENSOR_COUNT * sizeof(Vector3i32));
+    block->count = SENSOR_COUNT;
+    for (uint16_t i = 0; i < samples; i++) {
+        mpu6000_data_t raw;
+        uint8_t sample_data[SENSOR_DATA_SIZE];
+        PIOS_SENSORS_3Axis_SensorsWithTemp *sample = (PIOS_SENSORS_3Axis_SensorsWithTemp *)sample_data;
+
+        memcpy(&raw.buffer[1], &fifo_buffer[i * PIOS_MPU6000_SAMPLES_BYTES], PIOS_MPU6000_SAMPLES_BYTES);
+        PIOS_MPU6000_ConvertSample(&raw, sample);
+        for (uint8_t j = 0; j < SENSOR_COUNT; j++) {
+            block->sum[j].x += sample->sample[j].x;
+            block->sum[j].y += sample->sample[j].y;
+            block->sum[j].z += sample->sample[j].z;
+        }
+        block->temperature += sample->temperature;
+    }
+    // the records were sampled since the previous burst, report the middle of that window
+    block->timestamp = fifo_read_timestamp ? fifo_read_timestamp + (timestamp - fifo_read_timestamp) / 2 : timestamp;
+    fifo_read_timestamp = timestamp;
+    block->samples   = samples;
+
+    return samples;
+}
+
+void PIOS_MPU6000_driver_reset_fifo(__attribute__((unused)) uintptr_t context)
+{
+    dev->driver->SetReg(PIOS_MPU6000_USER_CTRL_REG, dev->cfg->User_ctl | PIOS_MPU6000_USERCTL_FIFO_EN | PIOS_MPU6000_USERCTL_FIFO_RST);
+}
+#endif /* PIOS_INCLUDE_SPI */
 #endif /* PIOS_INCLUDE_MPU6000 */
 
 /**
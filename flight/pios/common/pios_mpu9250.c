@@ -131,6 +131,18 @@ volatile bool mpu9250_configured = false;
 static mpu9250_data_t mpu9250_data;
 static int32_t mpu9250_id;
 
+// Accel, temperature and gyro records, same layout as the sensor registers
+#ifdef PIOS_MPU9250_ACCEL
+#define PIOS_MPU9250_FIFO_STORE        (PIOS_MPU9250_ACCEL_OUT | PIOS_MPU9250_FIFO_TEMP_OUT | PIOS_MPU9250_FIFO_GYRO_X_OUT | PIOS_MPU9250_FIFO_GYRO_Y_OUT | PIOS_MPU9250_FIFO_GYRO_Z_OUT)
+#else
+#define PIOS_MPU9250_FIFO_STORE        (PIOS_MPU9250_FIFO_TEMP_OUT | PIOS_MPU9250_FIFO_GYRO_X_OUT | PIOS_MPU9250_FIFO_GYRO_Y_OUT | PIOS_MPU9250_FIFO_GYRO_Z_OUT)
+#endif
+#define PIOS_MPU9250_FIFO_RECORD_BYTES (PIOS_MPU9250_ACCEL_SAMPLES_BYTES + PIOS_MPU9250_TEMP_SAMPLES_BYTES + PIOS_MPU9250_GYRO_SAMPLES_BYTES)
+#define PIOS_MPU9250_FIFO_SIZE         512
+#define PIOS_MPU9250_MAX_BURST_SAMPLES 24
+static uint8_t fifo_buffer[PIOS_MPU9250_MAX_BURST_SAMPLES * PIOS_MPU9250_FIFO_RECORD_BYTES];
+static uint32_t fifo_read_timestamp;
+
 // ! Private functions
 static struct mpu9250_dev *PIOS_MPU9250_alloc(const struct pios_mpu9250_cfg *cfg);
 static int32_t PIOS_MPU9250_Validate(struct mpu9250_dev *dev);
@@ -139,6 +151,10 @@ static int32_t PIOS_MPU9250_SetReg(uint8_t address, uint8_t buffer);
 static int32_t PIOS_MPU9250_GetReg(uint8_t address);
 static void PIOS_MPU9250_SetSpeed(const bool fast);
 static bool PIOS_MPU9250_HandleData(uint32_t gyro_read_timestamp);
+static void PIOS_MPU9250_ConvertSample(const mpu9250_data_t *raw, PIOS_SENSORS_3Axis_SensorsWithTemp *sample);
+#ifdef PIOS_MPU9250_MAG
+static void PIOS_MPU9250_ConvertMag(const mpu9250_data_t *raw);
+#endif
 static bool PIOS_MPU9250_ReadSensor(bool *woken);
 static int32_t PIOS_MPU9250_Test(void);
 #if defined(PIOS_MPU9250_MAG)
@@ -163,6 +179,21 @@ const PIOS_SENSORS_Driver PIOS_MPU9250_Main_Driver = {
     .is_polled = false,
 };
 
+bool PIOS_MPU9250_Burst_driver_poll(uintptr_t context);
+uint16_t PIOS_MPU9250_Burst_driver_fetch_block(PIOS_SENSORS_3Axis_SensorsBlock *block, uint8_t size, uintptr_t context);
+void PIOS_MPU9250_Burst_driver_Reset(uintptr_t context);
+
+const PIOS_SENSORS_Driver PIOS_MPU9250_Burst_Driver = {
+    .test        = PIOS_MPU9250_Main_driver_Test,
+    .poll        = PIOS_MPU9250_Burst_driver_poll,
+    .fetch       = NULL,
+    .fetch_block = PIOS_MPU9250_Burst_driver_fetch_block,
+    .reset       = PIOS_MPU9250_Burst_driver_Reset,
+    .get_queue   = NULL,
+    .get_scale   = PIOS_MPU9250_Main_driver_get_scale,
+    .is_polled   = true,
+};
+
 // mag sensor interface
 bool PIOS_MPU9250_Mag_driver_Test(uintptr_t context);
 void PIOS_MPU9250_Mag_driver_Reset(uintptr_t context);
@@ -182,6 +213,10 @@ const PIOS_SENSORS_Driver PIOS_MPU9250_Mag_Driver = {
 
 void PIOS_MPU9250_MainRegister()
 {
+    if (dev->cfg->fifo_burst) {
+        PIOS_SENSORS_Register(&PIOS_MPU9250_Burst_Driver, PIOS_SENSORS_TYPE_3AXIS_GYRO_ACCEL, 0);
+        return;
+    }
     PIOS_SENSORS_Register(&PIOS_MPU9250_Main_Driver, PIOS_SENSORS_TYPE_3AXIS_GYRO_ACCEL, 0);
 }
 
@@ -267,6 +302,16 @@ int32_t PIOS_MPU9250_Init(uint32_t spi_id, uint32_t slave_num, const struct pios
 static void PIOS_MPU9250_Config(struct pios_mpu9250_cfg const *cfg)
 {
     uint8_t power;
+    uint8_t fifo_store   = cfg->Fifo_store;
+    uint8_t user_ctl     = cfg->User_ctl;
+    uint8_t interrupt_en = cfg->interrupt_en;
+
+    // Burst mode: every sample goes to the FIFO, no data ready interrupts
+    if (cfg->fifo_burst) {
+        fifo_store    = PIOS_MPU9250_FIFO_STORE;
+        user_ctl     |= PIOS_MPU9250_USERCTL_FIFO_EN;
+        interrupt_en  = 0;
+    }
 
     while (PIOS_MPU9250_Test() != 0) {
         ;
@@ -296,7 +341,7 @@ static void PIOS_MPU9250_Config(struct pios_mpu9250_cfg const *cfg)
         ;
     }
 
-    while (PIOS_MPU9250_SetReg(PIOS_MPU9250_USER_CTRL_REG, cfg->User_ctl) != 0) {
+    while (PIOS_MPU9250_SetReg(PIOS_MPU9250_USER_CTRL_REG, user_ctl) != 0) {
         ;
     }
 
@@ -308,7 +353,7 @@ static void PIOS_MPU9250_Config(struct pios_mpu9250_cfg const *cfg)
     power &= ~PIOS_MPU9250_PWRMGMT2_DISABLE_ACCEL;
 #endif
 
-    while (PIOS_MPU9250_SetReg(PIOS_MPU9250_FIFO_EN_REG, cfg->Fifo_store) != 0) {
+    while (PIOS_MPU9250_SetReg(PIOS_MPU9250_FIFO_EN_REG, fifo_store) != 0) {
         ;
     }
     PIOS_MPU9250_SetReg(PIOS_MPU9250_PWR_MGMT2_REG, power);
@@ -329,10 +374,10 @@ static void PIOS_MPU9250_Config(struct pios_mpu9250_cfg const *cfg)
 #endif
 
     // Interrupt enable
-    while (PIOS_MPU9250_SetReg(PIOS_MPU9250_INT_EN_REG, cfg->interrupt_en) != 0) {
+    while (PIOS_MPU9250_SetReg(PIOS_MPU9250_INT_EN_REG, interrupt_en) != 0) {
         ;
     }
-    if ((PIOS_MPU9250_GetReg(PIOS_MPU9250_INT_EN_REG)) != cfg->interrupt_en) {
+    if ((PIOS_MPU9250_GetReg(PIOS_MPU9250_INT_EN_REG)) != interrupt_en) {
         return;
     }
 
@@ -836,97 +881,107 @@ bool PIOS_MPU9250_IRQHandler(void)
 
 static bool PIOS_MPU9250_HandleData(uint32_t gyro_read_timestamp)
 {
-    // Rotate the sensor to OP convention.  The datasheet defines X as towards the right
-    // and Y as forward.  OP convention transposes this.  Also the Z is defined negatively
-    // to our convention
     if (!queue_data) {
         return false;
     }
 
+    PIOS_MPU9250_ConvertSample(&mpu9250_data, queue_data);
+    queue_data->timestamp = gyro_read_timestamp;
+    mag_data->temperature = queue_data->temperature;
 #ifdef PIOS_MPU9250_MAG
-    bool mag_valid = mpu9250_data.data.st1 & PIOS_MPU9250_MAG_DATA_RDY;
+    PIOS_MPU9250_ConvertMag(&mpu9250_data);
 #endif
 
+    BaseType_t higherPriorityTaskWoken;
+    xQueueSendToBackFromISR(dev->queue, queue_data, &higherPriorityTaskWoken);
+    return higherPriorityTaskWoken == pdTRUE;
+}
+
+/**
+ * @brief Convert the accel, gyro and temperature of a raw sample to OP orientation, without timestamp
+ */
+static void PIOS_MPU9250_ConvertSample(const mpu9250_data_t *raw, PIOS_SENSORS_3Axis_SensorsWithTemp *sample)
+{
+    // Rotate the sensor to OP convention.  The datasheet defines X as towards the right
+    // and Y as forward.  OP convention transposes this.  Also the Z is defined negatively
+    // to our convention
+
     // Currently we only support rotations on top so switch X/Y accordingly
     switch (dev->cfg->orientation) {
     case PIOS_MPU9250_TOP_0DEG:
 #ifdef PIOS_MPU9250_ACCEL
-        queue_data->sample[0].y = GET_SENSOR_DATA(mpu9250_data, Accel_X); // chip X
-        queue_data->sample[0].x = GET_SENSOR_DATA(mpu9250_data, Accel_Y); // chip Y
-#endif
-        queue_data->sample[1].y = GET_SENSOR_DATA(mpu9250_data, Gyro_X); // chip X
-        queue_data->sample[1].x = GET_SENSOR_DATA(mpu9250_data, Gyro_Y); // chip Y
-#ifdef PIOS_MPU9250_MAG
-        if (mag_valid) {
-            mag_data->sample[0].y = GET_SENSOR_DATA(mpu9250_data, Mag_Y) * dev->mag_sens_adj[1]; // chip Y
-            mag_data->sample[0].x = GET_SENSOR_DATA(mpu9250_data, Mag_X) * dev->mag_sens_adj[0]; // chip X
-        }
+        sample->sample[0].y = GET_SENSOR_DATA((*raw), Accel_X); // chip X
+        sample->sample[0].x = GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
 #endif
+        sample->sample[1].y = GET_SENSOR_DATA((*raw), Gyro_X); // chip X
+        sample->sample[1].x = GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
         break;
     case PIOS_MPU9250_TOP_90DEG:
         // -1 to bring it back to -32768 +32767 range
 #ifdef PIOS_MPU9250_ACCEL
-        queue_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu9250_data, Accel_Y)); // chip Y
-        queue_data->sample[0].x = GET_SENSOR_DATA(mpu9250_data, Accel_X); // chip X
-#endif
-        queue_data->sample[1].y = -1 - (GET_SENSOR_DATA(mpu9250_data, Gyro_Y)); // chip Y
-        queue_data->sample[1].x = GET_SENSOR_DATA(mpu9250_data, Gyro_X); // chip X
-#ifdef PIOS_MPU9250_MAG
-        if (mag_valid) {
-            mag_data->sample[0].y = GET_SENSOR_DATA(mpu9250_data, Mag_X) * dev->mag_sens_adj[0]; // chip X
-            mag_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu9250_data, Mag_Y)) * dev->mag_sens_adj[1]; // chip Y
-        }
-
+        sample->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Accel_Y)); // chip Y
+        sample->sample[0].x = GET_SENSOR_DATA((*raw), Accel_X); // chip X
 #endif
+        sample->sample[1].y = -1 - (GET_SENSOR_DATA((*raw), Gyro_Y)); // chip Y
+        sample->sample[1].x = GET_SENSOR_DATA((*raw), Gyro_X); // chip X
         break;
     case PIOS_MPU9250_TOP_180DEG:
 #ifdef PIOS_MPU9250_ACCEL
-        queue_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu9250_data, Accel_X)); // chip X
-        queue_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu9250_data, Accel_Y)); // chip Y
-#endif
-        queue_data->sample[1].y = -1 - (GET_SENSOR_DATA(mpu9250_data, Gyro_X)); // chip X
-        queue_data->sample[1].x = -1 - (GET_SENSOR_DATA(mpu9250_data, Gyro_Y)); // chip Y
-#ifdef PIOS_MPU9250_MAG
-        if (mag_valid) {
-            mag_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu9250_data, Mag_Y)) * dev->mag_sens_adj[1]; // chip Y
-            mag_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu9250_data, Mag_X)) * dev->mag_sens_adj[0]; // chip X
-        }
+        sample->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Accel_X)); // chip X
+        sample->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Accel_Y)); // chip Y
 #endif
+        sample->sample[1].y = -1 - (GET_SENSOR_DATA((*raw), Gyro_X)); // chip X
+        sample->sample[1].x = -1 - (GET_SENSOR_DATA((*raw), Gyro_Y)); // chip Y
         break;
     case PIOS_MPU9250_TOP_270DEG:
 #ifdef PIOS_MPU9250_ACCEL
-        queue_data->sample[0].y = GET_SENSOR_DATA(mpu9250_data, Accel_Y); // chip Y
-        queue_data->sample[0].x = -1 - (GET_SENSOR_DATA(mpu9250_data, Accel_X)); // chip X
-#endif
-        queue_data->sample[1].y = GET_SENSOR_DATA(mpu9250_data, Gyro_Y); // chip Y
-        queue_data->sample[1].x = -1 - (GET_SENSOR_DATA(mpu9250_data, Gyro_X)); // chip X
-#ifdef PIOS_MPU9250_MAG
-        if (mag_valid) {
-            mag_data->sample[0].y = -1 - (GET_SENSOR_DATA(mpu9250_data, Mag_X)) * dev->mag_sens_adj[0]; // chip X
-            mag_data->sample[0].x = GET_SENSOR_DATA(mpu9250_data, Mag_Y) * dev->mag_sens_adj[1]; // chip Y
-        }
+        sample->sample[0].y = GET_SENSOR_DATA((*raw), Accel_Y); // chip Y
+        sample->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Accel_X)); // chip X
 #endif
+        sample->sample[1].y = GET_SENSOR_DATA((*raw), Gyro_Y); // chip Y
+        sample->sample[1].x = -1 - (GET_SENSOR_DATA((*raw), Gyro_X)); // chip X
         break;
     }
 #ifdef PIOS_MPU9250_ACCEL
-    queue_data->sample[0].z = -1 - (GET_SENSOR_DATA(mpu9250_data, Accel_Z));
+    sample->sample[0].z = -1 - (GET_SENSOR_DATA((*raw), Accel_Z));
 #endif
-    queue_data->sample[1].z = -1 - (GET_SENSOR_DATA(mpu9250_data, Gyro_Z));
-    const int16_t temp = GET_SENSOR_DATA(mpu9250_data, Temperature);
-    queue_data->temperature = 2100 + ((float)(temp - PIOS_MPU9250_TEMP_OFFSET)) * (100.0f / PIOS_MPU9250_TEMP_SENSITIVITY);
-    queue_data->timestamp   = gyro_read_timestamp;
-    mag_data->temperature   = queue_data->temperature;
+    sample->sample[1].z = -1 - (GET_SENSOR_DATA((*raw), Gyro_Z));
+    const int16_t temp = GET_SENSOR_DATA((*raw), Temperature);
+    sample->temperature = 2100 + ((float)(temp - PIOS_MPU9250_TEMP_OFFSET)) * (100.0f / PIOS_MPU9250_TEMP_SENSITIVITY);
+}
+
 #ifdef PIOS_MPU9250_MAG
-    if (mag_valid) {
-        mag_data->sample[0].z = GET_SENSOR_DATA(mpu9250_data, Mag_Z) * dev->mag_sens_adj[2]; // chip Z
-        mag_ready = true;
+/**
+ * @brief Convert the magnetometer part of a raw sample to OP orientation if it holds new data
+ */
+static void PIOS_MPU9250_ConvertMag(const mpu9250_data_t *raw)
+{
+    if (!(raw->data.st1 & PIOS_MPU9250_MAG_DATA_RDY)) {
+        return;
     }
-#endif
 
-    BaseType_t higherPriorityTaskWoken;
-    xQueueSendToBackFromISR(dev->queue, queue_data, &higherPriorityTaskWoken);
-    return higherPriorityTaskWoken == pdTRUE;
+    switch (dev->cfg->orientation) {
+    case PIOS_MPU9250_TOP_0DEG:
+        mag_data->sample[0].y = GET_SENSOR_DATA((*raw), Mag_Y) * dev->mag_sens_adj[1]; // chip Y
+        mag_data->sample[0].x = GET_SENSOR_DATA((*raw), Mag_X) * dev->mag_sens_adj[0]; // chip X
+        break;
+    case PIOS_MPU9250_TOP_90DEG:
+        mag_data->sample[0].y = GET_SENSOR_DATA((*raw), Mag_X) * dev->mag_sens_adj[0]; // chip X
+        mag_data->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Mag_Y)) * dev->mag_sens_adj[1]; // chip Y
+        break;
+    case PIOS_MPU9250_TOP_180DEG:
+        mag_data->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Mag_Y)) * dev->mag_sens_adj[1]; // chip Y
+        mag_data->sample[0].x = -1 - (GET_SENSOR_DATA((*raw), Mag_X)) * dev->mag_sens_adj[0]; // chip X
+        break;
+    case PIOS_MPU9250_TOP_270DEG:
+        mag_data->sample[0].y = -1 - (GET_SENSOR_DATA((*raw), Mag_X)) * dev->mag_sens_adj[0]; // chip X
+        mag_data->sample[0].x = GET_SENSOR_DATA((*raw), Mag_Y) * dev->mag_sens_adj[1]; // chip Y
+        break;
+    }
+    mag_data->sample[0].z = GET_SENSOR_DATA((*raw), Mag_Z) * dev->mag_sens_adj[2]; // chip Z
+    mag_ready = true;
 }
+#endif /* PIOS_MPU9250_MAG */
 
 static bool PIOS_MPU9250_ReadSensor(bool *woken)
 {
@@ -966,6 +1021,102 @@ QueueHandle_t PIOS_MPU9250_Main_driver_get_queue(__attribute__((unused)) uintptr
     return dev->queue;
 }
 
+bool PIOS_MPU9250_Burst_driver_poll(__attribute__((unused)) uintptr_t context)
+{
+    return mpu9250_configured;
+}
+
+/**
+ * @brief Read every complete record from the FIFO with one SPI burst and sum them.
+ * The magnetometer is not stored in the FIFO, it is read once per burst instead.
+ * @return number of samples in the block
+ */
+uint16_t PIOS_MPU9250_Burst_driver_fetch_block(PIOS_SENSORS_3Axis_SensorsBlock *block, uint8_t size, __attribute__((unused)) uintptr_t context)
+{
+    PIOS_Assert(size >= SENSOR_COUNT);
+
+    uint32_t timestamp = PIOS_DELAY_GetRaw();
+
+    if (PIOS_MPU9250_ClaimBus(true) != 0) {
+        return 0;
+    }
+    PIOS_SPI_TransferByte(dev->spi_id, 0x80 | PIOS_MPU9250_FIFO_CNT_MSB);
+    uint16_t fifo_count = PIOS_SPI_TransferByte(dev->spi_id, 0) << 8;
+    fifo_count |= PIOS_SPI_TransferByte(dev->spi_id, 0);
+    PIOS_MPU9250_ReleaseBus();
+
+    if (fifo_count >= PIOS_MPU9250_FIFO_SIZE) {
+        // overflowed, records are no longer aligned
+        PIOS_MPU9250_Burst_driver_Reset(0);
+        return 0;
+    }
+
+    uint16_t samples = fifo_count / PIOS_MPU9250_FIFO_RECORD_BYTES;
+    if (samples > PIOS_MPU9250_MAX_BURST_SAMPLES) {
+        samples = PIOS_MPU9250_MAX_BURST_SAMPLES;
+    }
+    if (samples == 0) {
+        return 0;
+    }
+
+    if (PIOS_MPU9250_ClaimBus(true) != 0) {
+        return 0;
+    }
+    PIOS_SPI_TransferByte(dev->spi_id, 0x80 | PIOS_MPU9250_FIFO_REG);
+    int32_t result = PIOS_SPI_TransferBlock(dev->spi_id, NULL, fifo_buffer, samples * PIOS_MPU9250_FIFO_RECORD_BYTES, NULL);
+    PIOS_MPU9250_ReleaseBus();
+    if (result < 0) {
+        return 0;
+    }
+
+    memset(block, 0, sizeof(*block) + SENSOR_COUNT * sizeof(Vector3i32));
+    block->count = SENSOR_COUNT;
+    for (uint16_t i = 0; i < samples; i++) {
+        mpu9250_data_t raw;
+        uint8_t sample_data[SENSOR_DATA_SIZE];
+        PIOS_SENSORS_3Axis_SensorsWithTemp *sample = (PIOS_SENSORS_3Axis_SensorsWithTemp *)sample_data;
+
+        memset(&raw, 0, sizeof(raw));
+        memcpy(&raw.buffer[1], &fifo_buffer[i * PIOS_MPU9250_FIFO_RECORD_BYTES], PIOS_MPU9250_FIFO_RECORD_BYTES);
+        PIOS_MPU9250_ConvertSample(&raw, sample);
+        for (uint8_t j = 0; j < SENSOR_COUNT; j++) {
+            block->sum[j].x += sample->sample[j].x;
+            block->sum[j].y += sample->sample[j].y;
+            block->sum[j].z += sample->sample[j].z;
+        }
+        block->temperature += sample->temperature;
+    }
+    // the records were sampled since the previous burst, report the middle of that window
+    block->timestamp = fifo_read_timestamp ? fifo_read_timestamp + (timestamp - fifo_read_timestamp) / 2 : timestamp;
+    fifo_read_timestamp   = timestamp;
+    block->samples        = samples;
+    mag_data->temperature = block->temperature / samples;
+
+#ifdef PIOS_MPU9250_MAG
+    if (mpu9250_id == PIOS_MPU9250_GYRO_ACC_ID && PIOS_MPU9250_ClaimBus(true) == 0) {
+        const uint8_t mpu9250_send_buf[1 + PIOS_MPU9250_SAMPLES_BYTES] = { PIOS_MPU9250_SENSOR_FIRST_REG | 0x80 };
+
+        // the data requested on the previous burst is read back now
+        if (PIOS_SPI_TransferBlock(dev->spi_id, &mpu9250_send_buf[0], &mpu9250_data.buffer[0], sizeof(mpu9250_data_t), NULL) >= 0) {
+            PIOS_MPU9250_ConvertMag(&mpu9250_data);
+        }
+        PIOS_MPU9250_ReleaseBus();
+        if (PIOS_MPU9250_ClaimBus(true) == 0) {
+            PIOS_SPI_TransferByte(dev->spi_id, PIOS_MPU9250_I2C_SLV0_CTRL);
+            PIOS_SPI_TransferByte(dev->spi_id, PIOS_MPU9250_I2C_SLV_ENABLE | 0x8);
+            PIOS_MPU9250_ReleaseBus();
+        }
+    }
+#endif
+
+    return samples;
+}
+
+void PIOS_MPU9250_Burst_driver_Reset(__attribute__((unused)) uintptr_t context)
+{
+    PIOS_MPU9250_SetReg(PIOS_MPU9250_USER_CTRL_REG, dev->cfg->User_ctl | PIOS_MPU9250_USERCTL_FIFO_EN | PIOS_MPU9250_USERCTL_FIFO_RST);
+}
+
 
 /* PIOS sensor driver implementation */
 bool PIOS_MPU9250_Mag_driver_Test(__attribute__((unused)) uintptr_t context)
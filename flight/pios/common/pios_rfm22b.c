@@ -80,6 +80,22 @@
 #define RFM22B_DEFAULT_MAX_CHANNEL           250
 #define RFM22B_PPM_ONLY_DATARATE             RFM22_datarate_9600
 
+// Data packet frame flags, see radio_txStart()
+#define RFM22B_FRAME_PPM                     0x01
+#define RFM22B_FRAME_STREAM                  0x02
+#define RFM22B_FRAME_AUX_STREAM              0x04
+#define RFM22B_FRAME_AUX_FIRST               0x08
+#define RFM22B_FRAME_VERSION_MASK            0xF0
+#define RFM22B_FRAME_HEADER_LEN              1
+
+// Version of the data packet format, bump it when the air format changes.
+// It is in the flags byte of every data packet and in the last sync byte, so
+// radios with a different format don't hear each other and never connect.
+// Version 0 is the format before the frame flags, with a stream number byte.
+#define RFM22B_PROTOCOL_VERSION              1
+#define RFM22B_FRAME_VERSION                 (RFM22B_PROTOCOL_VERSION << 4)
+#define RFM22B_PPM_LEN                       (RFM22B_PPM_NUM_CHANNELS + 1)
+
 // PPM encoding limits
 #define RFM22B_PPM_MIN                       1
 #define RFM22B_PPM_MAX                       511
@@ -116,6 +132,7 @@
 #define SYNC_BYTE_2                          0xD4
 #define SYNC_BYTE_3                          0x4B
 #define SYNC_BYTE_4                          0x59
+#define SYNC_BYTE_4_VERSIONED                (SYNC_BYTE_4 ^ (RFM22B_PROTOCOL_VERSION * 0x93))
 
 #ifndef RX_LED_ON
 #define RX_LED_ON
@@ -180,6 +197,8 @@ static enum pios_radio_event rfm22_init(struct pios_rfm22b_dev *rfm22b_dev);
 static enum pios_radio_event radio_setRxMode(struct pios_rfm22b_dev *rfm22b_dev);
 static enum pios_radio_event radio_rxData(struct pios_rfm22b_dev *rfm22b_dev);
 static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *rfm22b_dev, uint8_t *p, uint16_t rx_len);
+static uint8_t rfm22_txStreamData(struct pios_rfm22b_dev *rfm22b_dev, bool aux, uint8_t *p, uint8_t max_len);
+static void rfm22_rxStreamData(struct pios_rfm22b_dev *rfm22b_dev, bool aux, uint8_t *p, uint8_t len);
 static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *rfm22b_dev);
 static enum pios_radio_event radio_txData(struct pios_rfm22b_dev *rfm22b_dev);
 static enum pios_radio_event rfm22_txFailure(struct pios_rfm22b_dev *rfm22b_dev);
@@ -1190,9 +1209,14 @@ static void pios_rfm22_task(void *parameters)
                 rfm22_process_event(rfm22b_dev, event);
             }
         } else {
-            // Has it been too long since the last event?
+            // Has it been too long since the last event?  At the slow datarates the
+            // coordinator only sends every other packet time, which can be longer.
             uint32_t curTime = pios_rfm22_time_ms();
-            if (pios_rfm22_time_difference_ms(lastEventTime, curTime) > PIOS_RFM22B_SUPERVISOR_TIMEOUT) {
+            uint32_t timeout = rfm22b_dev->packet_time * 3;
+            if (timeout < PIOS_RFM22B_SUPERVISOR_TIMEOUT) {
+                timeout = PIOS_RFM22B_SUPERVISOR_TIMEOUT;
+            }
+            if (pios_rfm22_time_difference_ms(lastEventTime, curTime) > timeout) {
                 // Clear the event queue.
                 enum pios_radio_event event;
                 while (xQueueReceive(rfm22b_dev->eventQueue, &event, 0) == pdTRUE) {
@@ -1528,7 +1552,7 @@ static enum pios_radio_event rfm22_init(struct pios_rfm22b_dev *rfm22b_dev)
     rfm22_write(rfm22b_dev, RFM22_sync_word3, SYNC_BYTE_1);
     rfm22_write(rfm22b_dev, RFM22_sync_word2, SYNC_BYTE_2);
     rfm22_write(rfm22b_dev, RFM22_sync_word1, SYNC_BYTE_3);
-    rfm22_write(rfm22b_dev, RFM22_sync_word0, SYNC_BYTE_4);
+    rfm22_write(rfm22b_dev, RFM22_sync_word0, SYNC_BYTE_4_VERSIONED);
 
     // TX FIFO Almost Full Threshold (0 - 63)
     rfm22_write(rfm22b_dev, RFM22_tx_fifo_control1, TX_FIFO_HI_WATERMARK);
@@ -1787,6 +1811,44 @@ static void rfm22_rxFailure(struct pios_rfm22b_dev *rfm22b_dev)
 * Radio Transmit and Receive functions.
 *****************************************************************************/
 
+/**
+ * Fetch data to send from one of the COM streams.
+ *
+ * @param[in] radio_dev The device structure
+ * @param[in] aux Fetch from the auxiliary stream?
+ * @param[out] p  The buffer to fill
+ * @param[in] max_len The space in the buffer
+ * @return The number of bytes fetched
+ */
+static uint8_t rfm22_txStreamData(struct pios_rfm22b_dev *radio_dev, bool aux, uint8_t *p, uint8_t max_len)
+{
+    pios_com_callback tx_out_cb = aux ? radio_dev->aux_tx_out_cb : radio_dev->tx_out_cb;
+    bool need_yield = false;
+
+    if (!tx_out_cb || (max_len == 0)) {
+        return 0;
+    }
+    return (tx_out_cb)(aux ? radio_dev->aux_tx_out_context : radio_dev->tx_out_context, p, max_len, NULL, &need_yield);
+}
+
+/**
+ * Pass received data to one of the COM streams.
+ *
+ * @param[in] radio_dev The device structure
+ * @param[in] aux Pass it to the auxiliary stream?
+ * @param[in] p  The received data
+ * @param[in] len The number of bytes received
+ */
+static void rfm22_rxStreamData(struct pios_rfm22b_dev *radio_dev, bool aux, uint8_t *p, uint8_t len)
+{
+    pios_com_callback rx_in_cb = aux ? radio_dev->aux_rx_in_cb : radio_dev->rx_in_cb;
+    bool need_yield = false;
+
+    if (rx_in_cb && (len > 0)) {
+        (rx_in_cb)(aux ? radio_dev->aux_rx_in_context : radio_dev->rx_in_context, p, len, NULL, &need_yield);
+    }
+}
+
 /**
  * Start a transmit if possible
  *
@@ -1795,9 +1857,10 @@ static void rfm22_rxFailure(struct pios_rfm22b_dev *rfm22b_dev)
  */
 static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
 {
-    uint8_t *p  = radio_dev->tx_packet;
-    uint8_t len = 0;
-    uint8_t max_data_len = radio_dev->max_packet_len - (radio_dev->ppm_only_mode ? 0 : RS_ECC_NPARITY);
+    uint8_t *frame = radio_dev->tx_packet;
+    uint8_t *p     = frame + (radio_dev->ppm_only_mode ? 0 : RFM22B_FRAME_HEADER_LEN);
+    uint8_t len    = 0;
+    uint8_t max_data_len = radio_dev->max_packet_len - (radio_dev->ppm_only_mode ? 0 : RS_ECC_NPARITY + RFM22B_FRAME_HEADER_LEN);
 
     // Don't send if it's not our turn, or if we're receiving a packet.
     if (!rfm22_timeToSend(radio_dev) || !PIOS_RFM22B_InRxWait((uint32_t)radio_dev)) {
@@ -1812,7 +1875,7 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
     // Should we append PPM data to the packet?
     bool ppm_valid = false;
     if (radio_dev->ppm_send_mode) {
-        len = RFM22B_PPM_NUM_CHANNELS + (radio_dev->ppm_only_mode ? 2 : 1);
+        len = RFM22B_PPM_LEN + (radio_dev->ppm_only_mode ? 1 : 0);
 
         // Ensure we can fit the PPM data in the packet.
         if (max_data_len < len) {
@@ -1859,30 +1922,51 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
         }
     }
 
-    // Append data from the com interface if applicable.
+    /*
+     * Data packets are aggregated frames that carry the PPM data and both COM
+     * streams together, up to the maximum packet length for the datarate.  A
+     * flags byte says which sections follow: the PPM data first, then the
+     * streams.  When both streams are present the first one is preceded by
+     * its length and RFM22B_FRAME_AUX_FIRST gives their order, the last
+     * section runs to the end of the frame.  The upper bits of the flags are
+     * the protocol version.  A frame with nothing to carry is only sent by the
+     * coordinator, that is the one a remote connects on.
+     */
     bool packet_data = false;
     if (!radio_dev->ppm_only_mode) {
-        uint8_t newlen  = 0;
-        bool need_yield = false;
-        uint8_t i = 0;
-        // Try to get some data to send
-        while (newlen == 0 && i < 2) {
-            radio_dev->last_stream_sent = (radio_dev->last_stream_sent + 1) % 2;
-            if (!radio_dev->last_stream_sent) {
-                if (radio_dev->tx_out_cb) {
-                    newlen = (radio_dev->tx_out_cb)(radio_dev->tx_out_context, p + len + 1, max_data_len - len - 1, NULL, &need_yield);
-                }
-            } else {
-                if (radio_dev->aux_tx_out_cb) {
-                    newlen = (radio_dev->aux_tx_out_cb)(radio_dev->aux_tx_out_context, p + len + 1, max_data_len - len - 1, NULL, &need_yield);
-                }
+        uint8_t flags = RFM22B_FRAME_VERSION | (len ? RFM22B_FRAME_PPM : 0);
+
+        // Let the streams take turns at being first, so that a busy one can't starve the other.
+        radio_dev->last_stream_sent = !radio_dev->last_stream_sent;
+        bool aux_first  = radio_dev->last_stream_sent;
+        uint8_t space   = max_data_len - len;
+        uint8_t first_len = rfm22_txStreamData(radio_dev, aux_first, p + len, space);
+        if (first_len) {
+            flags |= aux_first ? RFM22B_FRAME_AUX_STREAM : RFM22B_FRAME_STREAM;
+            // The second stream gets what's left after the length byte of the first.
+            uint8_t second_len = 0;
+            if (space > first_len + 1) {
+                second_len = rfm22_txStreamData(radio_dev, !aux_first, p + len + first_len + 1, space - first_len - 1);
+            }
+            if (second_len) {
+                flags |= RFM22B_FRAME_STREAM | RFM22B_FRAME_AUX_STREAM | (aux_first ? RFM22B_FRAME_AUX_FIRST : 0);
+                memmove(p + len + 1, p + len, first_len);
+                p[len] = first_len;
+                len   += 1 + second_len;
+            }
+            len += first_len;
+        } else {
+            uint8_t second_len = rfm22_txStreamData(radio_dev, !aux_first, p + len, space);
+            if (second_len) {
+                flags |= aux_first ? RFM22B_FRAME_STREAM : RFM22B_FRAME_AUX_STREAM;
+                len   += second_len;
             }
-            i++;
         }
-        if (newlen) {
-            packet_data = true;
-            *(p + len)  = radio_dev->last_stream_sent;
-            len += newlen + 1;
+        packet_data = (flags & (RFM22B_FRAME_STREAM | RFM22B_FRAME_AUX_STREAM)) != 0;
+
+        if ((flags != RFM22B_FRAME_VERSION) || rfm22_isCoordinator(radio_dev)) {
+            frame[0] = flags;
+            len += RFM22B_FRAME_HEADER_LEN;
         }
     }
 
@@ -1897,7 +1981,7 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
     // Add the error correcting code.
     if (!radio_dev->ppm_only_mode) {
         if (len != 0) {
-            encode_data((unsigned char *)p, len, (unsigned char *)p);
+            encode_data((unsigned char *)frame, len, (unsigned char *)frame);
         }
         len += RS_ECC_NPARITY;
     }
@@ -1909,7 +1993,7 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
     }
 
     // Transmit the packet.
-    PIOS_RFM22B_TransmitPacket((uint32_t)radio_dev, p, len);
+    PIOS_RFM22B_TransmitPacket((uint32_t)radio_dev, frame, len);
 
     return RADIO_EVENT_NUM_EVENTS;
 }
@@ -1971,7 +2055,8 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
 {
     bool good_packet      = true;
     bool corrected_packet = false;
-    uint8_t stream_num    = 0;
+    uint8_t flags         = 0;
+    uint8_t first_len     = 0;
     uint8_t data_len      = rx_len;
 
     // We don't rsencode ppm only packets.
@@ -1989,15 +2074,36 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
                 corrected_packet = true;
             }
         }
+    } else if (radio_dev->ppm_recv_mode) {
+        flags = RFM22B_FRAME_PPM;
+    }
+
+    // Data packets are aggregated frames, see radio_txStart().
+    if ((good_packet || corrected_packet) && !radio_dev->ppm_only_mode) {
+        // A frame of another protocol version is dropped, the link does not connect on it.
+        if ((data_len == 0) || ((*p & RFM22B_FRAME_VERSION_MASK) != RFM22B_FRAME_VERSION)) {
+            good_packet = corrected_packet = false;
+        } else {
+            flags = *p++;
+            data_len--;
+            uint8_t section_len = (flags & RFM22B_FRAME_PPM) ? RFM22B_PPM_LEN : 0;
+            if ((flags & RFM22B_FRAME_STREAM) && (flags & RFM22B_FRAME_AUX_STREAM)) {
+                first_len    = p[section_len];
+                section_len += 1 + first_len;
+            }
+            if (section_len > data_len) {
+                good_packet = corrected_packet = false;
+            }
+        }
     }
 
     // Should we pull PPM data off of the head of the packet?
-    if ((good_packet || corrected_packet) && radio_dev->ppm_recv_mode) {
-        uint8_t ppm_len = RFM22B_PPM_NUM_CHANNELS + (radio_dev->ppm_only_mode ? 2 : 1);
+    if ((good_packet || corrected_packet) && (flags & RFM22B_FRAME_PPM)) {
+        uint8_t ppm_len = RFM22B_PPM_LEN + (radio_dev->ppm_only_mode ? 1 : 0);
 
         // Ensure the packet it long enough
         if (data_len < ppm_len) {
-            good_packet = false;
+            good_packet = corrected_packet = false;
         }
 
         // Verify the CRC if this is a PPM only packet.
@@ -2012,7 +2118,7 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
             }
         }
 
-        if (good_packet || corrected_packet) {
+        if ((good_packet || corrected_packet) && radio_dev->ppm_recv_mode) {
             for (uint8_t i = 0; i < RFM22B_PPM_NUM_CHANNELS; ++i) {
                 // Calculate 9-bit value taking the LSB from byte 0
                 uint32_t val = (p[i + 1] << 1) + ((p[0] >> i) & 1);
@@ -2025,14 +2131,13 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
                 }
             }
 
-            p += RFM22B_PPM_NUM_CHANNELS + 1;
-            data_len -= RFM22B_PPM_NUM_CHANNELS + 1;
-
             // Call the PPM received callback if it's available.
             if (radio_dev->ppm_callback) {
                 radio_dev->ppm_callback(radio_dev->ppm_context, radio_dev->ppm);
             }
         }
+        p += RFM22B_PPM_LEN;
+        data_len -= RFM22B_PPM_LEN;
     }
 
     // Set the packet status
@@ -2051,23 +2156,13 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
 
     enum pios_radio_event ret_event = RADIO_EVENT_RX_COMPLETE;
     if (good_packet || corrected_packet) {
-        // Send the data to the com port
-        bool rx_need_yield;
-
-
-        if ((data_len > 0) && !radio_dev->ppm_only_mode) {
-            stream_num = *p;
-            p++;
-            data_len--;
-            if (!stream_num) {
-                if (radio_dev->rx_in_cb) {
-                    (radio_dev->rx_in_cb)(radio_dev->rx_in_context, p, data_len, NULL, &rx_need_yield);
-                }
-            } else {
-                if (radio_dev->aux_rx_in_cb) {
-                    (radio_dev->aux_rx_in_cb)(radio_dev->aux_rx_in_context, p, data_len, NULL, &rx_need_yield);
-                }
-            }
+        // Send the data to the com ports
+        if ((flags & RFM22B_FRAME_STREAM) && (flags & RFM22B_FRAME_AUX_STREAM)) {
+            bool aux_first = (flags & RFM22B_FRAME_AUX_FIRST) != 0;
+            rfm22_rxStreamData(radio_dev, aux_first, p + 1, first_len);
+            rfm22_rxStreamData(radio_dev, !aux_first, p + 1 + first_len, data_len - 1 - first_len);
+        } else if (flags & (RFM22B_FRAME_STREAM | RFM22B_FRAME_AUX_STREAM)) {
+            rfm22_rxStreamData(radio_dev, (flags & RFM22B_FRAME_AUX_STREAM) != 0, p, data_len);
         }
         /*
          * If the packet is valid and destined for us we synchronize the clock.
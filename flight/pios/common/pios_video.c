@@ -51,12 +51,13 @@ static const struct pios_video_cfg *dev_cfg;
 // For 192x128 pixel mode, allocations are as the names are written.
 // divide by 8 because two bytes to a word.
 // Must be allocated in one block, so it is in a struct.
+// Word aligned for the blitter in osdgen.
 struct _buffers {
     uint8_t buffer0_level[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
     uint8_t buffer0_mask[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
     uint8_t buffer1_level[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
     uint8_t buffer1_mask[GRAPHICS_HEIGHT * GRAPHICS_WIDTH];
-} buffers;
+} buffers __attribute__((aligned(4)));
 
 // Remove the struct definition (makes it easier to write for.)
 #define         buffer0_level (buffers.buffer0_level)
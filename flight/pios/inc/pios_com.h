@@ -41,6 +41,12 @@ typedef void (*pios_com_callback_ctrl_line)(uint32_t context, uint32_t mask, uin
 typedef void (*pios_com_callback_baud_rate)(uint32_t context, uint32_t baud);
 typedef void (*pios_com_callback_available)(uint32_t context, uint32_t available);
 
+/* Scatter-gather segment for PIOS_COM_SendBufferV() */
+struct pios_com_iovec {
+    const uint8_t *base;
+    uint16_t len;
+};
+
 enum PIOS_COM_Word_Length {
     PIOS_COM_Word_length_Unchanged = 0,
     PIOS_COM_Word_length_8b,
@@ -92,6 +98,8 @@ extern int32_t PIOS_COM_SendCharNonBlocking(uint32_t com_id, char c);
 extern int32_t PIOS_COM_SendChar(uint32_t com_id, char c);
 extern int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, uint16_t len);
 extern int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len);
+extern int32_t PIOS_COM_SendBufferVNonBlocking(uint32_t com_id, const struct pios_com_iovec *iov, uint8_t iovcnt);
+extern int32_t PIOS_COM_SendBufferV(uint32_t com_id, const struct pios_com_iovec *iov, uint8_t iovcnt);
 extern int32_t PIOS_COM_SendStringNonBlocking(uint32_t com_id, const char *str);
 extern int32_t PIOS_COM_SendString(uint32_t com_id, const char *str);
 extern int32_t PIOS_COM_SendFormattedStringNonBlocking(uint32_t com_id, const char *format, ...);
@@ -165,6 +165,7 @@ struct pios_mpu6000_cfg {
     SPIPrescalerTypeDef std_prescaler;
 #endif /* PIOS_INCLUDE_SPI */
     uint8_t max_downsample;
+    bool    fifo_burst; /* SPI only: read all samples from the FIFO once per Sensors loop instead of one per data ready interrupt */
 };
 
 /* Public Functions */
@@ -235,6 +235,7 @@ struct pios_mpu9250_cfg {
     SPIPrescalerTypeDef fast_prescaler;
     SPIPrescalerTypeDef std_prescaler;
     uint8_t max_downsample;
+    bool    fifo_burst; /* read all samples from the FIFO once per Sensors loop instead of one per data ready interrupt */
 };
 
 /* Public Functions */
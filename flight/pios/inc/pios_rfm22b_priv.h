@@ -39,7 +39,7 @@
 
 // ************************************
 
-#define RFM22B_MAX_PACKET_LEN 64
+#define RFM22B_MAX_PACKET_LEN 80 // enough for the longest packet that fits in a slot at any datarate
 #define RFM22B_NUM_CHANNELS   251
 
 // External type definitions
@@ -35,6 +35,12 @@ typedef bool (*PIOS_SENSORS_test_function)(uintptr_t context);
 typedef void (*PIOS_SENSORS_reset_function)(uintptr_t context);
 typedef bool (*PIOS_SENSORS_poll_function)(uintptr_t context);
 typedef void (*PIOS_SENSORS_fetch_function)(void *samples, uint8_t size, uintptr_t context);
+struct PIOS_SENSORS_3Axis_SensorsBlock;
+/**
+ * fetch every sample queued in the sensor FIFO with a single burst read.
+ * returns the number of samples summed into the block, 0 if none were available
+ */
+typedef uint16_t (*PIOS_SENSORS_fetch_block_function)(struct PIOS_SENSORS_3Axis_SensorsBlock *block, uint8_t size, uintptr_t context);
 /**
  * return an array with current scale for the instance.
  * Instances with multiples sensors returns several value in the same
@@ -47,6 +53,7 @@ typedef struct PIOS_SENSORS_Driver {
     PIOS_SENSORS_test_function      test; // called at startup to test the sensor
     PIOS_SENSORS_poll_function      poll; // called to check whether data are available for polled sensors
     PIOS_SENSORS_fetch_function     fetch; // called to fetch data for polled sensors
+    PIOS_SENSORS_fetch_block_function fetch_block; // optional, called instead of fetch for polled sensors with a FIFO
     PIOS_SENSORS_reset_function     reset; // reset sensor. for example if data are not received in the allotted time
     PIOS_SENSORS_get_queue_function get_queue; // get the queue reference
     PIOS_SENSORS_get_scale_function get_scale; // return scales for the sensors
@@ -82,6 +89,17 @@ typedef struct PIOS_SENSORS_3Axis_SensorsWithTemp {
     Vector3i16 sample[];
 } PIOS_SENSORS_3Axis_SensorsWithTemp;
 
+/**
+ * A burst of 3d samples with temperature, summed by the driver
+ */
+typedef struct PIOS_SENSORS_3Axis_SensorsBlock {
+    uint32_t   timestamp;    // PIOS_DELAY_GetRaw() time of the middle of the burst
+    uint16_t   count;        // number of sensor instances
+    uint16_t   samples;      // number of samples summed in this block
+    int32_t    temperature;  // sum of Degrees Celsius * 100
+    Vector3i32 sum[];
+} PIOS_SENSORS_3Axis_SensorsBlock;
+
 typedef struct PIOS_SENSORS_1Axis_SensorsWithTemp {
     float sample; // sample
     float temperature; // Degrees Celsius
@@ -145,6 +163,19 @@ static inline void PIOS_SENSOR_Fetch(const PIOS_SENSORS_Instance *sensor, void *
     sensor->driver->fetch(samples, size, sensor->context);
 }
 
+/**
+ * Fetch all samples buffered by a polled sensor with a FIFO
+ * @param sensor sensor instance
+ * @param block block receiving the summed samples
+ * @param size number of Vector3i32 within the block
+ * @return number of samples summed into the block
+ */
+static inline uint16_t PIOS_SENSORS_FetchBlock(const PIOS_SENSORS_Instance *sensor, PIOS_SENSORS_3Axis_SensorsBlock *block, uint8_t size)
+{
+    PIOS_Assert(sensor);
+    return sensor->driver->fetch_block(block, size, sensor->context);
+}
+
 static inline void PIOS_SENSOR_Reset(const PIOS_SENSORS_Instance *sensor)
 {
     PIOS_Assert(sensor);
@@ -38,6 +38,22 @@
 #include <fcntl.h>
 #include <netinet/in.h>
 
+/*
+ * On Linux all UDP devices are served by one epoll thread and datagrams
+ * are moved with recvmmsg()/sendmmsg() in batches of PIOS_UDP_BATCH_SIZE
+ */
+#if defined(__linux__)
+#define PIOS_UDP_USE_MMSG
+#endif
+
+#ifndef PIOS_UDP_BATCH_SIZE
+#define PIOS_UDP_BATCH_SIZE 8
+#endif
+
+#ifndef PIOS_UDP_TX_BUFFER_SIZE
+#define PIOS_UDP_TX_BUFFER_SIZE PIOS_UDP_RX_BUFFER_SIZE
+#endif
+
 struct pios_udp_cfg {
     const char *ip;
     uint16_t   port;
@@ -45,11 +61,13 @@ struct pios_udp_cfg {
 
 typedef struct {
     const struct pios_udp_cfg *cfg;
+#if !defined(PIOS_UDP_USE_MMSG)
 #if defined(PIOS_INCLUDE_FREERTOS)
     xTaskHandle rxThread;
 #else
     pthread_t   rxThread;
 #endif
+#endif /* !defined(PIOS_UDP_USE_MMSG) */
 
     int socket;
     struct sockaddr_in server;
@@ -64,8 +82,13 @@ typedef struct {
     pios_com_callback  rx_in_cb;
     uint32_t rx_in_context;
 
+#if defined(PIOS_UDP_USE_MMSG)
+    /* rx staging is shared by the epoll thread, tx is staged per device */
+    uint8_t  tx_buffer[PIOS_UDP_BATCH_SIZE][PIOS_UDP_TX_BUFFER_SIZE];
+#else
     uint8_t  rx_buffer[PIOS_UDP_RX_BUFFER_SIZE];
     uint8_t  tx_buffer[PIOS_UDP_RX_BUFFER_SIZE];
+#endif
 } pios_udp_dev;
 
 extern int32_t PIOS_UDP_Init(uint32_t *udp_id, const struct pios_udp_cfg *cfg);
@@ -362,6 +362,96 @@ int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len
     return rc;
 }
 
+/**
+ * Sends a frame made of several segments over given port.
+ * All segments are queued at once or not at all.
+ * \param[in] port COM port
+ * \param[in] iov array of segments
+ * \param[in] iovcnt number of segments
+ * \return -1 if port not available
+ * \return -2 buffer cannot hold the whole frame
+ *            caller should retry until buffer is free again
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_SendBufferVNonBlocking(uint32_t com_id, const struct pios_com_iovec *iov, uint8_t iovcnt)
+{
+    struct pios_com_dev *com_dev = PIOS_COM_find_dev(com_id);
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+
+    PIOS_Assert(com_dev->has_tx);
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < iovcnt; i++) {
+        total += iov[i].len;
+    }
+
+    if (total >= fifoBuf_getFree(&com_dev->tx)) {
+        /* Buffer cannot accept the whole frame (retry) */
+        return -2;
+    }
+
+    PIOS_IRQ_Disable();
+    for (uint8_t i = 0; i < iovcnt; i++) {
+        fifoBuf_putData(&com_dev->tx, iov[i].base, iov[i].len);
+    }
+    PIOS_IRQ_Enable();
+
+    if (total > 0) {
+        /* More data has been put in the tx buffer, make sure the tx is started */
+        if (com_dev->driver->tx_start) {
+            com_dev->driver->tx_start(com_dev->lower_id,
+                                      fifoBuf_getUsed(&com_dev->tx));
+        }
+    }
+
+    return total;
+}
+
+/**
+ * Sends a frame made of several segments over given port
+ * (blocking function)
+ * \param[in] port COM port
+ * \param[in] iov array of segments
+ * \param[in] iovcnt number of segments
+ * \return -1 if port not available
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_SendBufferV(uint32_t com_id, const struct pios_com_iovec *iov, uint8_t iovcnt)
+{
+    struct pios_com_dev *com_dev = PIOS_COM_find_dev(com_id);
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+
+    PIOS_Assert(com_dev->has_tx);
+
+    int32_t rc;
+    do {
+        rc = PIOS_COM_SendBufferVNonBlocking(com_id, iov, iovcnt);
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+        if (rc == -2) {
+            /* Make sure the transmitter is running while we wait */
+            if (com_dev->driver->tx_start) {
+                (com_dev->driver->tx_start)(com_dev->lower_id,
+                                            fifoBuf_getUsed(&com_dev->tx));
+            }
+            if (xSemaphoreTake(com_dev->tx_sem, portMAX_DELAY) != pdTRUE) {
+                return -3;
+            }
+        }
+#endif
+    } while (rc == -2);
+
+    return rc;
+}
+
 /**
  * Sends a single character over given port
  * \param[in] port COM port
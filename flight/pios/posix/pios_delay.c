@@ -63,6 +63,13 @@ int32_t PIOS_DELAY_WaituS(uint32_t uS)
 {
     static struct timespec wait, rest;
 
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xPortVirtualTimeEnabled()) {
+        /* simulated time only advances on ticks, busy waits take no time */
+        return 0;
+    }
+#endif
+
     wait.tv_sec  = 0;
     wait.tv_nsec = 1000 * uS;
     while (nanosleep(&wait, &rest) != 0) {
@@ -90,6 +97,12 @@ int32_t PIOS_DELAY_WaitmS(uint32_t mS)
     // PIOS_DELAY_WaituS(1000);
     static struct timespec wait, rest;
 
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xPortVirtualTimeEnabled()) {
+        return 0;
+    }
+#endif
+
     wait.tv_sec  = mS / 1000;
     wait.tv_nsec = (mS % 1000) * 1000000;
     while (nanosleep(&wait, &rest) != 0) {
@@ -109,6 +122,12 @@ uint32_t PIOS_DELAY_GetuS()
 {
     static struct timespec current;
 
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xPortVirtualTimeEnabled()) {
+        return (uint32_t)ullPortGetVirtualTimeUs();
+    }
+#endif
+
     clock_gettime(CLOCK_REALTIME, &current);
     return (current.tv_sec * 1000000) + (current.tv_nsec / 1000);
 }
@@ -141,5 +160,14 @@ uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
     return PIOS_DELAY_GetuS() - raw;
 }
 
+/**
+ * @brief Subtract two raw times and convert to us.
+ * @return Interval between raw times in microseconds
+ */
+uint32_t PIOS_DELAY_DiffuS2(uint32_t raw, uint32_t later)
+{
+    return later - raw;
+}
+
 
 #endif /* if defined(PIOS_INCLUDE_DELAY) */
@@ -68,4 +68,24 @@ void PIOS_Servo_Set(uint8_t Servo, uint16_t Position)
 #endif // PIOS_ENABLE_DEBUG_PINS
 }
 
+/**
+ * The simulated outputs have no timers, banks or update modes
+ */
+void PIOS_Servo_SetActive(__attribute__((unused)) uint32_t Active)
+{}
+
+void PIOS_Servo_Update()
+{}
+
+void PIOS_Servo_SetBankMode(__attribute__((unused)) uint8_t bank, __attribute__((unused)) uint8_t mode)
+{}
+
+void PIOS_Servo_DSHot_Rate(__attribute__((unused)) uint32_t rate_in_khz)
+{}
+
+uint8_t PIOS_Servo_GetPinBank(__attribute__((unused)) uint8_t pin)
+{
+    return 0;
+}
+
 #endif /* if defined(PIOS_INCLUDE_SERVO) */
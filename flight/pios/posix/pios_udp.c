@@ -27,6 +27,11 @@
  */
 
 
+/* recvmmsg()/sendmmsg() */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 /* Project Includes */
 #include "pios.h"
 
@@ -35,6 +40,10 @@
 #include <signal.h>
 #include <pios_udp_priv.h>
 
+#if defined(PIOS_UDP_USE_MMSG)
+#include <sys/epoll.h>
+#endif
+
 /* We need a list of UDP devices */
 
 #define PIOS_UDP_MAX_DEV 256
@@ -71,6 +80,93 @@ static pios_udp_dev *find_udp_dev_by_id(uint8_t udp)
     return &(pios_udp_devices[udp]);
 }
 
+#if defined(PIOS_UDP_USE_MMSG)
+
+static int pios_udp_epoll_fd = -1;
+#if defined(PIOS_INCLUDE_FREERTOS)
+static xTaskHandle pios_udp_rx_thread;
+#else
+static pthread_t pios_udp_rx_thread;
+#endif
+
+/**
+ * Drain all pending datagrams of one device, PIOS_UDP_BATCH_SIZE per syscall
+ */
+static void PIOS_UDP_ReceiveBatch(pios_udp_dev *udp_dev)
+{
+    /* only ever touched by the rx thread */
+    static uint8_t rx_buffer[PIOS_UDP_BATCH_SIZE][PIOS_UDP_RX_BUFFER_SIZE];
+    static struct sockaddr_in rx_addr[PIOS_UDP_BATCH_SIZE];
+
+    struct mmsghdr msgs[PIOS_UDP_BATCH_SIZE];
+    struct iovec iovecs[PIOS_UDP_BATCH_SIZE];
+    int received;
+
+    do {
+        memset(msgs, 0, sizeof(msgs));
+        for (int i = 0; i < PIOS_UDP_BATCH_SIZE; i++) {
+            iovecs[i].iov_base = rx_buffer[i];
+            iovecs[i].iov_len  = PIOS_UDP_RX_BUFFER_SIZE;
+            msgs[i].msg_hdr.msg_iov     = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+            msgs[i].msg_hdr.msg_name    = &rx_addr[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(rx_addr[i]);
+        }
+
+        received = recvmmsg(udp_dev->socket, msgs, PIOS_UDP_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        if (received <= 0) {
+            break;
+        }
+
+        /* replies go to whoever sent the most recent datagram */
+        udp_dev->client = rx_addr[received - 1];
+        udp_dev->clientLength = msgs[received - 1].msg_hdr.msg_namelen;
+
+        /* we do NOT buffer data locally. If the com buffer can't receive, data is discarded! */
+        bool rx_need_yield = false;
+        if (udp_dev->rx_in_cb) {
+            for (int i = 0; i < received; i++) {
+                (void)(udp_dev->rx_in_cb)(udp_dev->rx_in_context, rx_buffer[i], msgs[i].msg_len, NULL, &rx_need_yield);
+            }
+        }
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+        if (rx_need_yield) {
+            vPortYieldFromISR();
+        }
+#endif /* PIOS_INCLUDE_FREERTOS */
+    } while (received == PIOS_UDP_BATCH_SIZE);
+}
+
+/**
+ * RxThread, serves all UDP devices
+ */
+void *PIOS_UDP_RxThread(__attribute__((unused)) void *unused)
+{
+    struct epoll_event events[PIOS_UDP_BATCH_SIZE];
+
+    /**
+     * com devices never get closed except by application "reboot"
+     */
+    while (1) {
+#if defined(PIOS_INCLUDE_FREERTOS)
+        /* do not hold back virtual time while nothing arrives */
+        vPortEnterHostWait();
+#endif
+        int ready = epoll_wait(pios_udp_epoll_fd, events, PIOS_UDP_BATCH_SIZE, -1);
+#if defined(PIOS_INCLUDE_FREERTOS)
+        vPortExitHostWait();
+#endif
+
+        /* ready < 0 is EINTR from the scheduler signals, just wait again */
+        for (int i = 0; i < ready; i++) {
+            PIOS_UDP_ReceiveBatch(&pios_udp_devices[events[i].data.u32]);
+        }
+    }
+}
+
+#else /* if defined(PIOS_UDP_USE_MMSG) */
+
 /**
  * RxThread
  */
@@ -88,12 +184,19 @@ void *PIOS_UDP_RxThread(void *udp_dev_n)
          */
         int received;
         udp_dev->clientLength = sizeof(udp_dev->client);
-        if ((received = recvfrom(udp_dev->socket,
-                                 &udp_dev->rx_buffer,
-                                 PIOS_UDP_RX_BUFFER_SIZE,
-                                 0,
-                                 (struct sockaddr *)&udp_dev->client,
-                                 (socklen_t *)&udp_dev->clientLength)) >= 0) {
+#if defined(PIOS_INCLUDE_FREERTOS)
+        vPortEnterHostWait();
+#endif
+        received = recvfrom(udp_dev->socket,
+                            &udp_dev->rx_buffer,
+                            PIOS_UDP_RX_BUFFER_SIZE,
+                            0,
+                            (struct sockaddr *)&udp_dev->client,
+                            (socklen_t *)&udp_dev->clientLength);
+#if defined(PIOS_INCLUDE_FREERTOS)
+        vPortExitHostWait();
+#endif
+        if (received >= 0) {
             /* copy received data to buffer if possible */
             /* we do NOT buffer data locally. If the com buffer can't receive, data is discarded! */
             /* (thats what the USART driver does too!) */
@@ -111,6 +214,8 @@ void *PIOS_UDP_RxThread(void *udp_dev_n)
     }
 }
 
+#endif /* if defined(PIOS_UDP_USE_MMSG) */
+
 
 /**
  * Open UDP socket
@@ -136,6 +241,26 @@ int32_t PIOS_UDP_Init(uint32_t *udp_id, const struct pios_udp_cfg *cfg)
     udp_dev->server.sin_port   = htons(udp_dev->cfg->port);
     int res = bind(udp_dev->socket, (struct sockaddr *)&udp_dev->server, sizeof(udp_dev->server));
 
+#if defined(PIOS_UDP_USE_MMSG)
+    /* All devices share one rx thread, started with the first one */
+    if (pios_udp_epoll_fd < 0) {
+        pios_udp_epoll_fd = epoll_create1(0);
+        PIOS_Assert(pios_udp_epoll_fd >= 0);
+#if defined(PIOS_INCLUDE_FREERTOS)
+        xTaskCreate((pdTASK_CODE)PIOS_UDP_RxThread, "UDP_Rx_Thread", 1024, NULL, (tskIDLE_PRIORITY + 1), &pios_udp_rx_thread);
+#else
+        pthread_create(&pios_udp_rx_thread, NULL, PIOS_UDP_RxThread, NULL);
+#endif
+    }
+
+    struct epoll_event event = {
+        .events = EPOLLIN,
+        .data   = { .u32 = pios_udp_num_devices - 1 },
+    };
+    if (res == 0) {
+        res = epoll_ctl(pios_udp_epoll_fd, EPOLL_CTL_ADD, udp_dev->socket, &event);
+    }
+#else /* if defined(PIOS_UDP_USE_MMSG) */
     /* Create transmit thread for this connection */
 #if defined(PIOS_INCLUDE_FREERTOS)
 // ( pdTASK_CODE pvTaskCode, const portCHAR * const pcName, unsigned portSHORT usStackDepth, void *pvParameters, unsigned portBASE_TYPE uxPriority, xTaskHandle *pvCreatedTask );
@@ -143,6 +268,7 @@ int32_t PIOS_UDP_Init(uint32_t *udp_id, const struct pios_udp_cfg *cfg)
 #else
     pthread_create(&udp_dev->rxThread, NULL, PIOS_UDP_RxThread, (void *)udp_dev);
 #endif
+#endif /* if defined(PIOS_UDP_USE_MMSG) */
 
 
     printf("udp dev %i - socket %i opened - result %i\n", pios_udp_num_devices - 1, udp_dev->socket, res);
@@ -169,6 +295,59 @@ static void PIOS_UDP_RxStart(uint32_t udp_id, uint16_t rx_bytes_avail)
 }
 
 
+#if defined(PIOS_UDP_USE_MMSG)
+
+static void PIOS_UDP_TxStart(uint32_t udp_id, uint16_t tx_bytes_avail)
+{
+    pios_udp_dev *udp_dev = find_udp_dev_by_id(udp_id);
+
+    PIOS_Assert(udp_dev);
+
+    if (!udp_dev->tx_out_cb) {
+        return;
+    }
+
+    /**
+     * we send everything directly whenever notified of data to send,
+     * staging up to PIOS_UDP_BATCH_SIZE datagrams per sendmmsg()
+     */
+    while (tx_bytes_avail > 0) {
+        struct mmsghdr msgs[PIOS_UDP_BATCH_SIZE];
+        struct iovec iovecs[PIOS_UDP_BATCH_SIZE];
+        int count = 0;
+
+        memset(msgs, 0, sizeof(msgs));
+        while (tx_bytes_avail > 0 && count < PIOS_UDP_BATCH_SIZE) {
+            bool tx_need_yield = false;
+            uint16_t length    = (udp_dev->tx_out_cb)(udp_dev->tx_out_context, udp_dev->tx_buffer[count], PIOS_UDP_TX_BUFFER_SIZE, NULL, &tx_need_yield);
+            if (length == 0) {
+                /* fifo drained by someone else */
+                tx_bytes_avail = 0;
+                break;
+            }
+            iovecs[count].iov_base = udp_dev->tx_buffer[count];
+            iovecs[count].iov_len  = length;
+            msgs[count].msg_hdr.msg_iov     = &iovecs[count];
+            msgs[count].msg_hdr.msg_iovlen  = 1;
+            msgs[count].msg_hdr.msg_name    = &udp_dev->client;
+            msgs[count].msg_hdr.msg_namelen = sizeof(udp_dev->client);
+            tx_bytes_avail = (length < tx_bytes_avail) ? (tx_bytes_avail - length) : 0;
+            count++;
+        }
+
+        int sent = 0;
+        while (sent < count) {
+            int res = sendmmsg(udp_dev->socket, &msgs[sent], count - sent, 0);
+            if (res <= 0) {
+                break;
+            }
+            sent += res;
+        }
+    }
+}
+
+#else /* if defined(PIOS_UDP_USE_MMSG) */
+
 static void PIOS_UDP_TxStart(uint32_t udp_id, uint16_t tx_bytes_avail)
 {
     pios_udp_dev *udp_dev = find_udp_dev_by_id(udp_id);
@@ -200,6 +379,8 @@ static void PIOS_UDP_TxStart(uint32_t udp_id, uint16_t tx_bytes_avail)
     }
 }
 
+#endif /* if defined(PIOS_UDP_USE_MMSG) */
+
 static void PIOS_UDP_RegisterRxCallback(uint32_t udp_id, pios_com_callback rx_in_cb, uint32_t context)
 {
     pios_udp_dev *udp_dev = find_udp_dev_by_id(udp_id);
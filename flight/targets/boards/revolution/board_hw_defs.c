@@ -1770,6 +1770,7 @@ static const struct pios_mpu6000_cfg pios_mpu6000_cfg = {
     .fast_prescaler = PIOS_SPI_PRESCALER_4,
     .std_prescaler  = PIOS_SPI_PRESCALER_64,
     .max_downsample = 20,
+    .fifo_burst     = false, /* not yet verified on production MPU6000 parts */
 };
 
 const struct pios_mpu6000_cfg *PIOS_BOARD_HW_DEFS_GetMPU6000Cfg(__attribute__((unused)) uint32_t board_revision)
@@ -55,6 +55,7 @@
 #define configUSE_TICK_HOOK                          0
 #define configCPU_CLOCK_HZ                           ((unsigned long)72000000)
 #define configTICK_RATE_HZ                           ((portTickType)1000)
+#define configUSE_TICKLESS_IDLE                      1 /* only acts in virtual time mode, see port.c */
 #define configMAX_PRIORITIES                         ((unsigned portBASE_TYPE)5)
 #define configMINIMAL_STACK_SIZE                     ((unsigned short)256)
 #define configTOTAL_HEAP_SIZE                        ((size_t)(45 * 1024))
@@ -85,6 +86,7 @@
 #define INCLUDE_vTaskDelay                           1
 #define INCLUDE_xTaskGetSchedulerState               1
 #define INCLUDE_xTaskGetCurrentTaskHandle            1
+#define INCLUDE_xTaskGetIdleTaskHandle               1
 #define INCLUDE_uxTaskGetStackHighWaterMark          0
 
 
@@ -39,6 +39,8 @@ extern "C" {
 #include <systemmod.h>
 }
 
+#include <string.h>
+
 /**
  * OpenPilot Main function:
  *
@@ -47,9 +49,18 @@ extern "C" {
  * Start FreeRTOS Scheduler (vTaskStartScheduler)<BR>
  * If something goes wrong, blink LED1 and LED2 every 100ms
  *
+ * Pass --lockstep to run on virtual time: the tick advances as soon as all
+ * tasks are idle, so simulated flights run faster than real time.
+ *
  */
-int main()
+int main(int argc, char *argv[])
 {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--lockstep")) {
+            vPortEnableVirtualTime();
+        }
+    }
+
     /* Brings up System using CMSIS functions, enables the LEDs. */
     PIOS_SYS_Init();
 
@@ -0,0 +1,192 @@
+/**
+ ******************************************************************************
+ *
+ * @file       ut_uavobjects.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      UAVObject store for the unit tests
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <stdlib.h>
+
+#include "ut_uavobjects.h"
+
+#define UT_MAX_OBJECTS   32
+#define UT_MAX_CALLBACKS 4
+
+struct ut_callback {
+    UAVObjEventCallback cb;
+    uint8_t eventMask;
+};
+
+struct ut_object {
+    const UAVObjType  *type;
+    uint8_t *data;
+    UAVObjMetadata     metadata;
+    struct ut_callback callbacks[UT_MAX_CALLBACKS];
+};
+
+static struct ut_object objects[UT_MAX_OBJECTS];
+static unsigned int numObjects;
+
+static struct ut_object *object(UAVObjHandle obj_handle, uint16_t instId)
+{
+    struct ut_object *obj = (struct ut_object *)obj_handle;
+
+    if (obj < objects || obj >= &objects[numObjects] || instId != 0) {
+        return NULL;
+    }
+    return obj;
+}
+
+// the callbacks run right away, the event task is not simulated
+static void updated(struct ut_object *obj)
+{
+    UAVObjEvent ev = { .obj = obj, .instId = 0, .event = EV_UPDATED };
+
+    for (unsigned int i = 0; i < UT_MAX_CALLBACKS; i++) {
+        if (obj->callbacks[i].cb && (obj->callbacks[i].eventMask == EV_MASK_ALL || (obj->callbacks[i].eventMask & EV_UPDATED))) {
+            obj->callbacks[i].cb(&ev);
+        }
+    }
+}
+
+UAVObjHandle UAVObjRegister(const UAVObjType *type, bool isSingleInstance,
+                            __attribute__((unused)) bool isSettings, __attribute__((unused)) bool isPriority)
+{
+    if (!isSingleInstance || numObjects == UT_MAX_OBJECTS) {
+        return NULL;
+    }
+
+    struct ut_object *obj = &objects[numObjects++];
+    obj->type = type;
+    obj->data = calloc(1, type->instance_size);
+    type->init_callback((UAVObjHandle)obj, 0);
+    return (UAVObjHandle)obj;
+}
+
+UAVObjHandle UAVObjGetByID(uint32_t id)
+{
+    for (unsigned int i = 0; i < numObjects; i++) {
+        if (objects[i].type->id == id) {
+            return (UAVObjHandle)&objects[i];
+        }
+    }
+    return NULL;
+}
+
+int32_t UAVObjSetInstanceData(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn)
+{
+    return UAVObjSetInstanceDataField(obj_handle, instId, dataIn, 0, UAVObjGetNumBytes(obj_handle));
+}
+
+int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId, void *dataOut)
+{
+    return UAVObjGetInstanceDataField(obj_handle, instId, dataOut, 0, UAVObjGetNumBytes(obj_handle));
+}
+
+int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn, uint32_t offset, uint32_t size)
+{
+    struct ut_object *obj = object(obj_handle, instId);
+
+    if (!obj || offset + size > obj->type->instance_size) {
+        return -1;
+    }
+    memcpy(&obj->data[offset], dataIn, size);
+    updated(obj);
+    return 0;
+}
+
+int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, void *dataOut, uint32_t offset, uint32_t size)
+{
+    struct ut_object *obj = object(obj_handle, instId);
+
+    if (!obj || offset + size > obj->type->instance_size) {
+        return -1;
+    }
+    memcpy(dataOut, &obj->data[offset], size);
+    return 0;
+}
+
+int32_t UAVObjSetData(UAVObjHandle obj_handle, const void *dataIn)
+{
+    return UAVObjSetInstanceData(obj_handle, 0, dataIn);
+}
+
+int32_t UAVObjGetData(UAVObjHandle obj_handle, void *dataOut)
+{
+    return UAVObjGetInstanceData(obj_handle, 0, dataOut);
+}
+
+int32_t UAVObjSetDataField(UAVObjHandle obj_handle, const void *dataIn, uint32_t offset, uint32_t size)
+{
+    return UAVObjSetInstanceDataField(obj_handle, 0, dataIn, offset, size);
+}
+
+int32_t UAVObjGetDataField(UAVObjHandle obj_handle, void *dataOut, uint32_t offset, uint32_t size)
+{
+    return UAVObjGetInstanceDataField(obj_handle, 0, dataOut, offset, size);
+}
+
+uint32_t UAVObjGetNumBytes(UAVObjHandle obj_handle)
+{
+    struct ut_object *obj = object(obj_handle, 0);
+
+    return obj ? obj->type->instance_size : 0;
+}
+
+int32_t UAVObjSetMetadata(UAVObjHandle obj_handle, const UAVObjMetadata *dataIn)
+{
+    struct ut_object *obj = object(obj_handle, 0);
+
+    if (!obj) {
+        return -1;
+    }
+    obj->metadata = *dataIn;
+    return 0;
+}
+
+int32_t UAVObjGetMetadata(UAVObjHandle obj_handle, UAVObjMetadata *dataOut)
+{
+    struct ut_object *obj = object(obj_handle, 0);
+
+    if (!obj) {
+        return -1;
+    }
+    *dataOut = obj->metadata;
+    return 0;
+}
+
+int32_t UAVObjConnectCallback(UAVObjHandle obj_handle, UAVObjEventCallback cb, uint8_t eventMask, __attribute__((unused)) bool fast)
+{
+    struct ut_object *obj = object(obj_handle, 0);
+
+    if (!obj) {
+        return -1;
+    }
+    for (unsigned int i = 0; i < UT_MAX_CALLBACKS; i++) {
+        if (!obj->callbacks[i].cb) {
+            obj->callbacks[i].cb = cb;
+            obj->callbacks[i].eventMask = eventMask;
+            return 0;
+        }
+    }
+    return -1;
+}
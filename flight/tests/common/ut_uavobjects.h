@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ *
+ * @file       ut_uavobjects.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      The UAVObject manager API for the unit tests
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef UT_UAVOBJECTS_H
+#define UT_UAVOBJECTS_H
+
+/*
+ * The suites build the generated UAVObjects on top of ut_uavobjects.c, a store
+ * of single instance objects without telemetry, logging or settings files.
+ * Include this instead of uavobjectmanager.h from the suite's openpilot.h or
+ * pios.h, after the FreeRTOS stubs of the suite if it has any.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef FREERTOS_H
+typedef void *xQueueHandle;
+#endif
+
+#ifndef PIOS_STATIC_ASSERT
+#define PIOS_STATIC_ASSERT(test) ((void)sizeof(int[1 - 2 * !(test)]))
+#endif
+
+// settings objects are registered by their XxxInitialize() like the others
+#ifndef SETTINGS_INITCALL
+#define SETTINGS_INITCALL(fn)
+#endif
+
+#include "uavobjectmanager.h"
+
+#endif /* UT_UAVOBJECTS_H */
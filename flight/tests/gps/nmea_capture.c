@@ -0,0 +1,61 @@
+#include <stdio.h>
+
+#include "openpilot.h"
+#include "NMEA.h"
+#include "nmea_capture.h"
+
+/* the sentences and captures the NMEA tests feed to the parser */
+
+uint16_t nmea_build_sentence(char *buf, const char *body)
+{
+    uint8_t checksum = 0;
+
+    for (const char *p = body; *p; p++) {
+        checksum ^= *p;
+    }
+    return sprintf(buf, "$%s*%02X\r\n", body, checksum);
+}
+
+uint32_t nmea_build_capture(char *buf, uint32_t size)
+{
+    char body[NMEA_MAX_PACKET_LENGTH];
+    char sentences[8 * NMEA_MAX_PACKET_LENGTH];
+    uint32_t len = 0;
+
+    for (uint32_t epoch = 0;; epoch++) {
+        /* 12:35:19.00 on 23.03.2017, flying north east at 2 m/s */
+        uint32_t hs  = 4531900 + epoch * 10;
+        uint32_t lat = 17114370 + epoch * 108;
+        uint32_t lon = 33915900 + epoch * 158;
+        int n = 0;
+
+        sprintf(body, "GNGGA,%02u%02u%02u.%02u,47%02u.%05u,N,008%02u.%05u,E,1,%02u,0.%02u,%u.%u,M,48.0,M,,",
+                hs / 360000, hs / 6000 % 60, hs / 100 % 60, hs % 100, lat / 100000, lat % 100000,
+                lon / 100000, lon % 100000, 8 + epoch % 5, 80 + epoch % 20, 499 + epoch % 50, epoch % 10);
+        n += nmea_build_sentence(&sentences[n], body);
+        sprintf(body, "GNGSA,A,3,23,29,07,08,09,18,26,,,,,,1.%02u,0.%02u,1.%02u", 50 + epoch % 40, 80 + epoch % 20, 20 + epoch % 30);
+        n += nmea_build_sentence(&sentences[n], body);
+        sprintf(body, "GNRMC,%02u%02u%02u.%02u,A,47%02u.%05u,N,008%02u.%05u,E,3.%03u,%u.%02u,230317,,,A",
+                hs / 360000, hs / 6000 % 60, hs / 100 % 60, hs % 100, lat / 100000, lat % 100000,
+                lon / 100000, lon % 100000, 880 + epoch % 100, 40 + epoch % 10, epoch % 100);
+        n += nmea_build_sentence(&sentences[n], body);
+        sprintf(body, "GNVTG,%u.%02u,T,,M,3.%03u,N,7.%03u,K,A", 40 + epoch % 10, epoch % 100, 880 + epoch % 100, 200 + epoch % 100);
+        n += nmea_build_sentence(&sentences[n], body);
+        if (epoch % 10 == 0) {
+            for (uint32_t s = 0; s < 3; s++) {
+                sprintf(body, "GPGSV,3,%u,12,%02u,%02u,%03u,%02u,%02u,%02u,%03u,%02u,%02u,%02u,%03u,,%02u,%02u,%03u,%02u",
+                        s + 1, 4 * s + 1, 10 + s, 30 * s, 40 + epoch % 9, 4 * s + 2, 20 + s, 30 * s + 90, 35,
+                        4 * s + 3, 30 + s, 30 * s + 180, 4 * s + 4, 40 + s, 30 * s + 270, 28);
+                n += nmea_build_sentence(&sentences[n], body);
+            }
+            sprintf(body, "GNZDA,%02u%02u%02u.%02u,23,03,2017,00,00", hs / 360000, hs / 6000 % 60, hs / 100 % 60, hs % 100);
+            n += nmea_build_sentence(&sentences[n], body);
+            n += nmea_build_sentence(&sentences[n], "GNTXT,01,01,02,ANTSTATUS=OK");
+        }
+        if (len + n > size) {
+            return len;
+        }
+        memcpy(&buf[len], sentences, n);
+        len += n;
+    }
+}
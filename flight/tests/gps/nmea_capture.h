@@ -0,0 +1,18 @@
+#ifndef NMEA_CAPTURE_H
+#define NMEA_CAPTURE_H
+
+/* what the test needs from nmea_capture.c */
+
+#include "NMEA.h"
+
+/* "$<body>*<checksum>\r\n", returns the sentence length */
+uint16_t nmea_build_sentence(char *buf, const char *body);
+
+/*
+ * what a u-blox 8 sends by default at 10 Hz, GGA, GSA, RMC and VTG every epoch,
+ * GSV, ZDA and a TXT sentence the parser does not handle once a second
+ * returns the length of the capture, at most size
+ */
+uint32_t nmea_build_capture(char *buf, uint32_t size);
+
+#endif /* NMEA_CAPTURE_H */
@@ -0,0 +1,12 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+/* the parts of openpilot.h used by the GPS parsers */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "pios.h"
+#include "ut_uavobjects.h"
+
+#endif /* OPENPILOT_H */
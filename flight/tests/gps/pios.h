@@ -0,0 +1,11 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "pios_config.h"
+#include "pios_helpers.h"
+
+#endif /* PIOS_H */
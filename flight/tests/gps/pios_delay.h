@@ -0,0 +1,9 @@
+#ifndef PIOS_DELAY_H
+#define PIOS_DELAY_H
+
+/* the delay functions used by the GPS parsers, implemented by the test */
+
+extern uint32_t PIOS_DELAY_GetuS();
+extern uint32_t PIOS_DELAY_GetuSSince(uint32_t t);
+
+#endif /* PIOS_DELAY_H */
@@ -0,0 +1,103 @@
+#include "openpilot.h"
+#include "UBX.h"
+#include "ubx_capture.h"
+
+/* the frames and captures the UBX tests feed to the parser */
+
+uint16_t ubx_build_frame(uint8_t *buf, uint8_t msgClass, uint8_t msgID, const uint8_t *payload, uint16_t len)
+{
+    uint8_t ck_a = 0, ck_b = 0;
+
+    buf[0] = UBX_SYNC1;
+    buf[1] = UBX_SYNC2;
+    buf[2] = msgClass;
+    buf[3] = msgID;
+    buf[4] = len & 0xff;
+    buf[5] = len >> 8;
+    memcpy(&buf[6], payload, len);
+    for (uint16_t i = 2; i < len + 6; i++) {
+        ck_a += buf[i];
+        ck_b += ck_a;
+    }
+    buf[len + 6] = ck_a;
+    buf[len + 7] = ck_b;
+    return len + 8;
+}
+
+uint16_t ubx_build_nav_pvt(uint8_t *buf, uint32_t tow, int32_t lat, int32_t lon, int32_t velN)
+{
+    // u-blox 8 appends 8 bytes to the u-blox 7 message
+    uint8_t payload[sizeof(struct UBX_NAV_PVT) + 8] = { 0 };
+    struct UBX_NAV_PVT *pvt = (struct UBX_NAV_PVT *)payload;
+
+    pvt->iTOW    = tow;
+    pvt->year    = 2017;
+    pvt->month   = 5;
+    pvt->day     = 5;
+    pvt->hour    = (tow / 3600000) % 24;
+    pvt->min     = (tow / 60000) % 60;
+    pvt->sec     = (tow / 1000) % 60;
+    pvt->valid   = PVT_VALID_VALIDTIME;
+    pvt->fixType = PVT_FIX_TYPE_3D;
+    pvt->flags   = PVT_FLAGS_GNSSFIX_OK;
+    pvt->numSV   = 14;
+    pvt->lat     = lat;
+    pvt->lon     = lon;
+    pvt->height  = 512000;
+    pvt->hMSL    = 465000;
+    pvt->velN    = velN;
+    pvt->velE    = -velN / 2;
+    pvt->velD    = 120;
+    pvt->gSpeed  = velN;
+    pvt->heading = 4500000;
+    pvt->pDOP    = 142;
+    return ubx_build_frame(buf, UBX_CLASS_NAV, UBX_ID_NAV_PVT, payload, sizeof(payload));
+}
+
+uint16_t ubx_build_nav_svinfo(uint8_t *buf, uint32_t tow, uint8_t numCh)
+{
+    struct UBX_NAV_SVINFO svinfo;
+
+    memset(&svinfo, 0, sizeof(svinfo));
+    svinfo.iTOW  = tow;
+    svinfo.numCh = numCh;
+    for (uint8_t chan = 0; chan < numCh; chan++) {
+        svinfo.sv[chan].chn  = chan;
+        svinfo.sv[chan].svid = chan + 1;
+        svinfo.sv[chan].cno  = (chan % 3) ? 20 + chan : 0;
+        svinfo.sv[chan].elev = chan * 2;
+        svinfo.sv[chan].azim = chan * 10;
+    }
+    return ubx_build_frame(buf, UBX_CLASS_NAV, UBX_ID_NAV_SVINFO, (uint8_t *)&svinfo,
+                           offsetof(struct UBX_NAV_SVINFO, sv) + numCh * sizeof(struct UBX_NAV_SVINFO_SV));
+}
+
+uint16_t ubx_build_nav_dop(uint8_t *buf, uint32_t tow)
+{
+    struct UBX_NAV_DOP dop;
+
+    memset(&dop, 0, sizeof(dop));
+    dop.iTOW = tow;
+    dop.pDOP = 142;
+    dop.hDOP = 87;
+    dop.vDOP = 112;
+    return ubx_build_frame(buf, UBX_CLASS_NAV, UBX_ID_NAV_DOP, (uint8_t *)&dop, sizeof(dop));
+}
+
+uint32_t ubx_build_capture(uint8_t *buf, uint32_t size, uint32_t tow)
+{
+    // the largest epoch is a PVT, a SVINFO with 32 channels, a DOP and an unhandled message
+    const uint32_t maxEpoch = 100 + 8 + 8 + MAX_SVS * 12 + 26 + 24;
+    const uint8_t aopStatus[16] = { 0 };
+    uint32_t len = 0;
+
+    for (uint32_t epoch = 0; len + maxEpoch <= size; epoch++, tow += 100) {
+        len += ubx_build_nav_pvt(&buf[len], tow, 473977418 + epoch * 37, 85455939 - epoch * 21, 1500 + epoch % 700);
+        if (epoch % 10 == 0) {
+            len += ubx_build_nav_svinfo(&buf[len], tow, 8 + epoch % (MAX_SVS - 7));
+            len += ubx_build_nav_dop(&buf[len], tow);
+            len += ubx_build_frame(&buf[len], UBX_CLASS_NAV, UBX_ID_NAV_AOPSTATUS, aopStatus, sizeof(aopStatus));
+        }
+    }
+    return len;
+}
@@ -0,0 +1,34 @@
+#ifndef UBX_CAPTURE_H
+#define UBX_CAPTURE_H
+
+/*
+ * UBX.h uses "class" as a field name and can not be included from C++,
+ * this declares what the test needs from UBX.c and ubx_capture.c
+ */
+
+#include "GPS.h"
+
+#define UBX_TEST_BUFFER_SIZE 1024
+
+int parse_ubx_stream(uint8_t *rx, uint16_t len, char *gps_rx_buffer, GPSPositionSensorData *GpsData, struct GPS_RX_STATS *gpsRxStats);
+
+/* frame a payload, returns the frame length */
+uint16_t ubx_build_frame(uint8_t *buf, uint8_t msgClass, uint8_t msgID, const uint8_t *payload, uint16_t len);
+
+/* a u-blox 8 NAV-PVT frame (92 byte payload) with a 3D fix */
+uint16_t ubx_build_nav_pvt(uint8_t *buf, uint32_t tow, int32_t lat, int32_t lon, int32_t velN);
+
+/* a NAV-SVINFO frame with numCh channels */
+uint16_t ubx_build_nav_svinfo(uint8_t *buf, uint32_t tow, uint8_t numCh);
+
+/* a NAV-DOP frame */
+uint16_t ubx_build_nav_dop(uint8_t *buf, uint32_t tow);
+
+/*
+ * what a u-blox 8 configured by autoconfig sends, NAV-PVT at 10 Hz, NAV-SVINFO and NAV-DOP at 1 Hz
+ * and a few messages the parser does not handle, starting at time of week tow
+ * returns the length of the capture, at most size
+ */
+uint32_t ubx_build_capture(uint8_t *buf, uint32_t size, uint32_t tow);
+
+#endif /* UBX_CAPTURE_H */
@@ -0,0 +1,656 @@
+#include "gtest/gtest.h"
+
+#include <math.h> /* lroundf */
+#include <stdio.h> /* printf */
+#include <string.h> /* memcpy */
+#include "ut_clock.h" /* now_ns */
+#include <vector>
+
+extern "C" {
+#include "openpilot.h"
+#include "gpsextendedstatus.h"
+#include "ubx_capture.h"
+#include "nmea_capture.h"
+}
+
+#define CAPTURE_SIZE     100000
+#define FUZZ_RUNS        200
+#define BENCHMARK_LOOPS  20
+#define GPS_READ_BUFFER  128
+#define CAPTURE_TOW      100000
+#define NMEA_READ_BUFFER 255
+
+/* what the parsers published through the UAVObjects, vectors of the types without the alignment */
+static std::vector<float> velocities;
+static std::vector<GPSPositionSensorDataPacked> positions;
+static std::vector<int> satellites;
+static std::vector<GPSTimeDataPacked> times;
+
+extern "C" {
+uint32_t PIOS_DELAY_GetuS()
+{
+    return 1;
+}
+
+uint32_t PIOS_DELAY_GetuSSince(__attribute__((unused)) uint32_t t)
+{
+    return 0;
+}
+
+void auxmagsupport_publish_samples(__attribute__((unused)) float mags[3], __attribute__((unused)) uint8_t status) {}
+
+AuxMagSettingsTypeOptions auxmagsupport_get_type()
+{
+    return AUXMAGSETTINGS_TYPE_GPSV9;
+}
+}
+
+static void position_updated(__attribute__((unused)) UAVObjEvent *ev)
+{
+    GPSPositionSensorData position;
+
+    GPSPositionSensorGet(&position);
+    positions.push_back(position);
+}
+
+static void velocity_updated(__attribute__((unused)) UAVObjEvent *ev)
+{
+    GPSVelocitySensorData velocity;
+
+    GPSVelocitySensorGet(&velocity);
+    velocities.push_back(velocity.North);
+}
+
+static void satellites_updated(__attribute__((unused)) UAVObjEvent *ev)
+{
+    GPSSatellitesData sats;
+
+    GPSSatellitesGet(&sats);
+    satellites.push_back(sats.SatsInView);
+}
+
+static void time_updated(__attribute__((unused)) UAVObjEvent *ev)
+{
+    GPSTimeData time;
+
+    GPSTimeGet(&time);
+    times.push_back(time);
+}
+
+/* register the objects the parsers publish through, once for all tests */
+static void initialize_objects(void)
+{
+    if (GPSPositionSensorHandle()) {
+        return;
+    }
+    GPSPositionSensorInitialize();
+    GPSVelocitySensorInitialize();
+    GPSSatellitesInitialize();
+    GPSTimeInitialize();
+    GPSExtendedStatusInitialize();
+    GPSPositionSensorConnectCallback(position_updated);
+    GPSVelocitySensorConnectCallback(velocity_updated);
+    GPSSatellitesConnectCallback(satellites_updated);
+    GPSTimeConnectCallback(time_updated);
+}
+
+/* rand() differs between C libraries, the golden digests need the same reads and corruptions everywhere */
+static uint32_t random_state;
+
+static uint32_t next_random(void)
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 16;
+}
+
+/* FNV-1a over what a parser published, a whole run compares against one golden value */
+static uint32_t digest(uint32_t hash, int32_t value)
+{
+    for (int i = 0; i < 4; i++) {
+        hash = (hash ^ ((uint32_t)value >> (8 * i) & 0xff)) * 16777619u;
+    }
+    return hash;
+}
+
+struct parse_result {
+    std::vector<int> returns;
+    std::vector<float> velocities;
+    std::vector<GPSPositionSensorDataPacked> positions;
+    std::vector<int> satellites;
+    std::vector<GPSTimeDataPacked> times;
+    struct GPS_RX_STATS stats;
+};
+
+/* a message set more than 6 days ahead, the parser takes the next capture for a time of week wrap around */
+static void new_message_set(void)
+{
+    static char gps_rx_buffer[UBX_TEST_BUFFER_SIZE];
+    GPSPositionSensorData gpsPosition;
+    struct GPS_RX_STATS stats = { 0, 0, 0, 0 };
+    uint8_t frame[UBX_TEST_BUFFER_SIZE];
+
+    memset(&gpsPosition, 0, sizeof(gpsPosition));
+    uint16_t len = ubx_build_nav_pvt(frame, CAPTURE_TOW + 7 * 24 * 3600 * 1000, 0, 0, 0);
+    parse_ubx_stream(frame, len, gps_rx_buffer, &gpsPosition, &stats);
+    velocities.clear();
+    positions.clear();
+    satellites.clear();
+}
+
+static uint32_t capture(uint8_t *buf, uint32_t size)
+{
+    return ubx_build_capture(buf, size, CAPTURE_TOW);
+}
+
+/* feed a capture to a parser in reads of random length, like the GPS task gets them from PIOS_COM */
+static void parse(const uint8_t *data, uint32_t len, unsigned int seed, uint16_t maxRead, struct parse_result *result)
+{
+    static char gps_rx_buffer[UBX_TEST_BUFFER_SIZE];
+    GPSPositionSensorData gpsPosition;
+    uint8_t rx[GPS_READ_BUFFER];
+
+    memset(&gpsPosition, 0, sizeof(gpsPosition));
+    memset(&result->stats, 0, sizeof(result->stats));
+    new_message_set();
+
+    random_state = seed;
+    for (uint32_t i = 0; i < len;) {
+        uint16_t count = 1 + next_random() % maxRead;
+        if (count > len - i) {
+            count = len - i;
+        }
+        memcpy(rx, &data[i], count);
+        result->returns.push_back(parse_ubx_stream(rx, count, gps_rx_buffer, &gpsPosition, &result->stats));
+        i += count;
+    }
+    /* the parser state is static, leave it between messages for the next test */
+    uint8_t flush[UBX_TEST_BUFFER_SIZE] = { 0 };
+    parse_ubx_stream(flush, sizeof(flush), gps_rx_buffer, &gpsPosition, &result->stats);
+
+    result->velocities = velocities;
+    result->positions  = positions;
+    result->satellites = satellites;
+}
+
+/* flip, drop and insert bytes, more sync chars than random noise would have */
+static uint32_t corrupt(uint8_t *data, uint32_t len, uint32_t size, unsigned int seed)
+{
+    random_state = seed;
+    int errors = 1 + next_random() % 50;
+    for (int e = 0; e < errors; e++) {
+        uint32_t pos = next_random() % len;
+        switch (next_random() % 4) {
+        case 0:
+            data[pos] ^= 1 + next_random() % 255;
+            break;
+        case 1:
+            memmove(&data[pos], &data[pos + 1], len - pos - 1);
+            len--;
+            break;
+        case 2:
+        case 3:
+            if (len < size) {
+                memmove(&data[pos + 1], &data[pos], len - pos);
+                data[pos] = (next_random() & 1) ? 0xb5 : next_random();
+                len++;
+            }
+            break;
+        }
+    }
+    return len;
+}
+
+/*
+ * ubx_digest() of the FuzzMatchesGolden runs, captured once from the byte by byte parser UBX.c had
+ * before the block parser, which has to publish the same from any input
+ */
+static const uint32_t ubx_golden[FUZZ_RUNS] = {
+    0xd00b4d6f, 0x216b32af, 0xa1be64e8, 0xf0036226, 0xa600bdb8, 0x82bf3f10, 0x6e4bb405, 0x7ec2c60b,
+    0x0a1072a3, 0xc303b261, 0xbf85e5e7, 0x0621fb33, 0x9c00d8de, 0x58196b00, 0x412cff0d, 0x26ab2e8a,
+    0x19a96875, 0xabb59e6e, 0xf8d88e04, 0xc484789a, 0xfa404353, 0x018b5fd3, 0xec8fd79a, 0x4680fef1,
+    0x528c6306, 0x322a7581, 0xd0f88860, 0x4f467489, 0x13a3d414, 0x9a5fb677, 0xc1cb4c6e, 0x4ff30105,
+    0xb69852d6, 0xd9348e99, 0xccde71ad, 0xed7fd4d5, 0xefdb3ef6, 0x68a2e1a9, 0xc95e32a6, 0xedaea78e,
+    0x1636bbe7, 0xd08df946, 0x938e6f74, 0x7ffbfce3, 0x3bbbf306, 0x8a912427, 0x61b2355f, 0xed482a8b,
+    0xb68e7a0e, 0x7a7a2c84, 0xa68781ad, 0x40047f08, 0x665556dd, 0xcaa06cdd, 0xc7ca241d, 0x3902ee0f,
+    0xbb13c339, 0x0b61e5a6, 0x054a8897, 0xa9873b75, 0x62875ce7, 0x5aa8fa60, 0xe31df41b, 0x0094fec8,
+    0x028f0cfc, 0x22a22b60, 0x61f9ba9b, 0xd65b5d11, 0xc462d5d4, 0x08285b72, 0xfcf441dc, 0x4af68dd3,
+    0x5b467eaf, 0xc0c9e8a6, 0x1e8cb42d, 0x2211ce01, 0xe9a28194, 0x4f744d8f, 0x0cba28b9, 0x53c248cc,
+    0xa4d48d59, 0x4b295b25, 0x32f3fb65, 0x8b3bcf1c, 0xa74105f2, 0x086cc12f, 0x5aaf33d2, 0x21c9e91c,
+    0x3937d58a, 0x0188cacc, 0x2abb919d, 0x568e1df7, 0x8b6be7c1, 0xfa35052b, 0x99ea0ade, 0xf39e027e,
+    0xdb91a860, 0xfa1a1d23, 0xf789e01f, 0x1e262b45, 0x7161306c, 0x8f73bfd2, 0x8a1d40c9, 0x848257d1,
+    0xa3419a48, 0xb6ffe567, 0x76d6961b, 0xfc693c50, 0xcb2fd975, 0x193a1a75, 0xedd5c776, 0x08219607,
+    0xadc78b84, 0x28302a72, 0x2924cc97, 0x0b00626d, 0xe388a3a6, 0xef2b31d7, 0xe06b8108, 0x4832eca8,
+    0x63e1552e, 0xa2c2e010, 0x6208fa9e, 0xd513c5f8, 0xa5107159, 0x4e3b2807, 0x101c9b2c, 0xf08f14f3,
+    0xc5af2251, 0x8f111e7b, 0xafe5804c, 0x05c9970b, 0x847accde, 0x9598dbab, 0x3503e8cd, 0x505414c9,
+    0xd72ea029, 0x393536dc, 0xc46079e8, 0x57eff58c, 0x836df2eb, 0x78609c9f, 0xd6950a07, 0xb639314e,
+    0x8f00488d, 0xf3b87871, 0xb94df9ba, 0xb8847f0b, 0x8f0aeae4, 0xab392d53, 0x57a1aa7c, 0xcc8bef5e,
+    0xc648ff17, 0xf1ca1a26, 0x43c1de9c, 0x4b20e254, 0x7491d877, 0xf0383748, 0x137870fd, 0x7c061920,
+    0x81fb5d22, 0xf809151f, 0x13ace63f, 0xe1d4b8d1, 0xbabce2d6, 0x4f40e688, 0x9c565ff1, 0x9a633c56,
+    0xd2193e7d, 0x1903ef69, 0xa7365e4a, 0x1268c62a, 0xa50ef875, 0xacd7c9d6, 0xd0e80b7f, 0xd7dcb745,
+    0xe176d8e1, 0x4aab4fed, 0xda579682, 0x1023a0c0, 0x086ae663, 0xd80e3c74, 0xec712ec4, 0x01a73ae5,
+    0xe8522423, 0x5cbfa2d9, 0x7c75026d, 0xcb446eba, 0x71960988, 0xf97b25b2, 0x0875da7f, 0x50d0ef38,
+    0xb962de8b, 0x34e64a52, 0x4c91b837, 0xd597d962, 0x0bf2e2e6, 0x8cfe3e17, 0x8afce486, 0x5df0f296,
+};
+
+static uint32_t ubx_digest(const struct parse_result &result)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < result.returns.size(); i++) {
+        hash = digest(hash, result.returns[i]);
+    }
+    for (size_t i = 0; i < result.velocities.size(); i++) {
+        hash = digest(hash, lroundf(result.velocities[i] * 1000.0f));
+    }
+    hash = digest(hash, result.positions.size());
+    for (size_t i = 0; i < result.satellites.size(); i++) {
+        hash = digest(hash, result.satellites[i]);
+    }
+    hash = digest(hash, result.stats.gpsRxReceived);
+    hash = digest(hash, result.stats.gpsRxChkSumError);
+    return digest(hash, result.stats.gpsRxOverflow);
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class UBXTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        initialize_objects();
+        buf = new uint8_t[CAPTURE_SIZE];
+    }
+
+    virtual void TearDown()
+    {
+        delete[] buf;
+    }
+
+    uint8_t *buf;
+};
+
+TEST_F(UBXTest, DecodePvt) {
+    static char gps_rx_buffer[UBX_TEST_BUFFER_SIZE];
+    GPSPositionSensorData gpsPosition;
+    struct GPS_RX_STATS stats = { 0, 0, 0, 0 };
+
+    memset(&gpsPosition, 0, sizeof(gpsPosition));
+    new_message_set();
+
+    uint16_t len = ubx_build_nav_pvt(buf, CAPTURE_TOW, 473977418, 85455939, 2500);
+    EXPECT_EQ(PARSER_COMPLETE, parse_ubx_stream(buf, len, gps_rx_buffer, &gpsPosition, &stats));
+    EXPECT_EQ(1, stats.gpsRxReceived);
+    EXPECT_EQ(473977418, gpsPosition.Latitude);
+    EXPECT_EQ(85455939, gpsPosition.Longitude);
+    EXPECT_FLOAT_EQ(465.0f, gpsPosition.Altitude);
+    EXPECT_FLOAT_EQ(47.0f, gpsPosition.GeoidSeparation);
+    EXPECT_EQ(14, gpsPosition.Satellites);
+    EXPECT_EQ(GPSPOSITIONSENSOR_STATUS_FIX3D, gpsPosition.Status);
+    ASSERT_EQ(1u, velocities.size());
+    EXPECT_FLOAT_EQ(2.5f, velocities[0]);
+
+    /* a frame with a bad checksum is counted and not decoded */
+    len = ubx_build_nav_pvt(buf, CAPTURE_TOW + 1000, 1, 2, 3);
+    buf[len - 1]++;
+    EXPECT_EQ(PARSER_ERROR, parse_ubx_stream(buf, len, gps_rx_buffer, &gpsPosition, &stats));
+    EXPECT_EQ(1, stats.gpsRxChkSumError);
+    EXPECT_EQ(473977418, gpsPosition.Latitude);
+}
+
+TEST_F(UBXTest, ShortFrameIgnored) {
+    static char gps_rx_buffer[UBX_TEST_BUFFER_SIZE];
+    GPSPositionSensorData gpsPosition;
+    struct GPS_RX_STATS stats = { 0, 0, 0, 0 };
+    uint8_t payload[20] = { 0 };
+
+    memset(&gpsPosition, 0, sizeof(gpsPosition));
+    new_message_set();
+
+    /* a NAV-PVT too short to hold the fields and a NAV-SVINFO claiming more channels than it has */
+    uint8_t svinfo[UBX_TEST_BUFFER_SIZE];
+    uint16_t svinfoLen = ubx_build_nav_svinfo(svinfo, CAPTURE_TOW, 4);
+    svinfo[6 + 4] = 30; // numCh
+    uint16_t len = ubx_build_frame(buf, 0x01, 0x07, payload, sizeof(payload));
+    len += ubx_build_frame(&buf[len], 0x01, 0x30, &svinfo[6], svinfoLen - 8);
+
+    EXPECT_EQ(PARSER_INCOMPLETE, parse_ubx_stream(buf, len, gps_rx_buffer, &gpsPosition, &stats));
+    EXPECT_EQ(2, stats.gpsRxReceived);
+    EXPECT_EQ(0u, velocities.size());
+    ASSERT_EQ(1u, satellites.size());
+    EXPECT_EQ(4, satellites[0]);
+}
+
+TEST_F(UBXTest, SplitReads) {
+    struct parse_result bytes, reads;
+    uint32_t len = capture(buf, CAPTURE_SIZE);
+
+    /* every read size, from one byte at a time to frames that fit completely */
+    parse(buf, len, 1, GPS_READ_BUFFER, &reads);
+    len = capture(buf, CAPTURE_SIZE);
+    parse(buf, len, 1, 1, &bytes);
+
+    EXPECT_EQ(0, reads.stats.gpsRxChkSumError);
+    EXPECT_EQ(0, bytes.stats.gpsRxChkSumError);
+    EXPECT_EQ(reads.stats.gpsRxReceived, bytes.stats.gpsRxReceived);
+    EXPECT_EQ(reads.velocities, bytes.velocities);
+    EXPECT_EQ(reads.satellites, bytes.satellites);
+    EXPECT_EQ(reads.positions.size(), bytes.positions.size());
+    EXPECT_GT(reads.positions.size(), 0u);
+}
+
+TEST_F(UBXTest, FuzzMatchesGolden) {
+    for (unsigned int run = 0; run < FUZZ_RUNS; run++) {
+        struct parse_result result;
+        uint32_t size = CAPTURE_SIZE / 10;
+        uint32_t len  = corrupt(buf, capture(buf, size - 100), size, run);
+
+        parse(buf, len, run, 1 + run % GPS_READ_BUFFER, &result);
+        SCOPED_TRACE(run);
+        EXPECT_EQ(ubx_golden[run], ubx_digest(result));
+    }
+}
+
+TEST_F(UBXTest, Benchmark) {
+    struct parse_result result;
+    uint32_t len = capture(buf, CAPTURE_SIZE);
+    uint16_t reads[2] = { 58, GPS_READ_BUFFER };
+
+    /* 58 bytes is what 5ms at 115200 baud brings, the full read buffer what the task reads when it lags */
+    for (int r = 0; r < 2; r++) {
+        uint64_t block = 0;
+        for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+            static char gps_rx_buffer[UBX_TEST_BUFFER_SIZE];
+            GPSPositionSensorData gpsPosition;
+            uint8_t rx[GPS_READ_BUFFER];
+
+            memset(&gpsPosition, 0, sizeof(gpsPosition));
+            memset(&result.stats, 0, sizeof(result.stats));
+            new_message_set();
+
+            uint64_t start = now_ns();
+            for (uint32_t i = 0; i < len; i += reads[r]) {
+                uint16_t count = (len - i < reads[r]) ? len - i : reads[r];
+                memcpy(rx, &buf[i], count);
+                parse_ubx_stream(rx, count, gps_rx_buffer, &gpsPosition, &result.stats);
+            }
+            block += now_ns() - start;
+        }
+        printf("%u byte reads: block parser %.2f ns per byte\n", reads[r], (double)block / BENCHMARK_LOOPS / len);
+    }
+}
+
+/* feed an NMEA stream to the parser in reads of random length */
+static void parse_nmea(const char *data, uint32_t len, unsigned int seed, uint8_t maxRead, struct parse_result *result)
+{
+    static char gps_rx_buffer[NMEA_MAX_PACKET_LENGTH];
+    GPSPositionSensorData gpsPosition;
+    GPSTimeData time;
+    uint8_t rx[NMEA_READ_BUFFER];
+
+    memset(&gpsPosition, 0, sizeof(gpsPosition));
+    memset(&result->stats, 0, sizeof(result->stats));
+    memset(&time, 0, sizeof(time));
+    GPSTimeSet(&time);
+    positions.clear();
+    satellites.clear();
+    times.clear();
+
+    random_state = seed;
+    for (uint32_t i = 0; i < len;) {
+        uint8_t count = 1 + next_random() % maxRead;
+        if (count > len - i) {
+            count = len - i;
+        }
+        memcpy(rx, &data[i], count);
+        result->returns.push_back(parse_nmea_stream(rx, count, gps_rx_buffer, &gpsPosition, &result->stats));
+        i += count;
+    }
+
+    result->positions  = positions;
+    result->satellites = satellites;
+    result->times = times;
+}
+
+/*
+ * nmea_digest() of the MatchesGolden runs and nmea_stats_digest() of the Corrupted runs, captured once
+ * from the parser NMEA.c had before the fixed point one
+ */
+static const uint32_t nmea_golden[NMEA_READ_BUFFER] = {
+    0xee57282a, 0x3295de1a, 0x702f750a, 0xaafbc07a, 0x3b034fba, 0xd25184ea, 0xf6fa29aa, 0x94e69d6a,
+    0xdce9233a, 0x432a87aa, 0x37f10afa, 0x9a812f6a, 0x3a07e25a, 0x93bb6b4a, 0x7d05b39a, 0x7f65e6fa,
+    0x783c161a, 0xb9bf3f2a, 0xdabfadba, 0x6d044c1a, 0x997c47fa, 0x1ce1e70a, 0x79070aaa, 0x7b7df88a,
+    0x6ceef3fa, 0x9617423a, 0x7fa8f13a, 0xfde5d2ea, 0x7971505a, 0xb6fe716a, 0x581e5f9a, 0x461c199a,
+    0x46667e1a, 0x2c7cf09a, 0x1161eb6a, 0x8c8237ba, 0x1fa8b38a, 0xf96109ea, 0x0fe41e7a, 0xe0430bba,
+    0xa4eb368f, 0x40e650da, 0x380703ea, 0xaf9ab6ef, 0xc4bc8c4a, 0xf6ad703f, 0xc1b9a93a, 0xad6edbea,
+    0x743b8b2a, 0x41efabdf, 0x3ca4088a, 0xcb1ecaea, 0x2385c5aa, 0xdfc77f4a, 0x0ec38d1a, 0xd4c5472a,
+    0xb68e4afa, 0xccb6e4ba, 0x6314153a, 0x6dbe2ada, 0x7f8674ca, 0x9ab5d88a, 0xaa4c3c1a, 0x4ea2bf4a,
+    0x461be3af, 0x54f59d2f, 0x16bafcfa, 0xbb72e8ef, 0x8db029da, 0x93f329ea, 0x330624ff, 0x6686099a,
+    0xfc3b3f0f, 0xd48d0e4a, 0xd48a863a, 0x250d66ea, 0xc5f3116a, 0xdca0c11f, 0x3b4b10ea, 0x8f9b90cf,
+    0x042f1e4a, 0xc220211a, 0x3d022c3f, 0x55970fef, 0x976bee9a, 0x1c4dddea, 0x2f3d536a, 0x3530185a,
+    0x620ef4ea, 0xd069463f, 0x5008c61a, 0x3a3d4a8a, 0x83b02f1a, 0x4e57046a, 0x680ffc3f, 0xd4e0cafa,
+    0xc73db5ba, 0x0261e72a, 0xa208e84f, 0xdd29bf9f, 0x1e69c2af, 0x2480051f, 0x9f7348ef, 0xa70b160f,
+    0xa562e28f, 0x942a61cf, 0x00065b2a, 0x00a7d82a, 0xd2b053cf, 0x29b806af, 0xeb98c65a, 0xb2a9bd1a,
+    0xec95a0ea, 0xec3f7caf, 0x39e9c88a, 0x03b5307f, 0x9aaf061a, 0x69566f7a, 0xc0c456ea, 0x383f956f,
+    0x61be215f, 0x99038fca, 0x0c35058f, 0x3fd9eb0f, 0x156aa7ef, 0xf16e013a, 0x8692769a, 0x98dd517f,
+    0x17c52f2f, 0xf6d072ca, 0xfa49f1ef, 0x5e2cf12a, 0x9dd26b8a, 0xa799cb6a, 0x739092ca, 0x6ad7949a,
+    0x15b9b1ba, 0xa737971f, 0x6d52594a, 0x41e7178f, 0x7b81c60a, 0xfeb5df2a, 0x31a48b4a, 0xd2667bfa,
+    0x64c94e2f, 0x25f5d62a, 0xfad6140a, 0xdf65c02f, 0xdaf5cd1a, 0x6866ee9f, 0x922e783f, 0xd20356ea,
+    0x2303608a, 0xf6f3945f, 0x5538bbbf, 0x8493a23a, 0x4703646f, 0xfd35fecf, 0xe30fe09f, 0x633b5d7a,
+    0xb2f4debf, 0x405af82f, 0xf9470b6f, 0x6f64fa2a, 0x1aeb597a, 0x35947b3a, 0x2d14961f, 0x84de430a,
+    0x05021f2a, 0x06a789cf, 0x5e92a9ba, 0x9a07751a, 0x02555b4a, 0x6ece184a, 0xabb9889a, 0x4817df5a,
+    0x4b8c750a, 0xd321cc5f, 0xd1d2602f, 0xeb05daaf, 0x20bc1c8f, 0x84c0b92a, 0x6d17694f, 0x9858132a,
+    0x66d08e9a, 0x40370d1f, 0x4d7a00ba, 0x232d3e2f, 0x70cd85df, 0xff13b38a, 0xeacffe4a, 0xda4414ff,
+    0x7f8f2faf, 0x91cd109f, 0x1461c85f, 0xe5d65b7f, 0xfc4d99df, 0xe5d92d9a, 0xff7f122f, 0xc113c34f,
+    0xdaca42fa, 0x227f642a, 0xf3c7737a, 0x7a2313da, 0xa449570f, 0xa293b53f, 0x9e8cfcaf, 0x46f1b92f,
+    0xccf4c6ba, 0x8c5e1fbf, 0xbd9626cf, 0x9ce6efca, 0xc469e20f, 0xa37666aa, 0x8b81c42f, 0x9bd35a9f,
+    0x464ece4a, 0x23a52aaf, 0x26ae3c6a, 0x36acf98a, 0xd75e317f, 0x5c11361a, 0xa26fd21f, 0xed25efdf,
+    0xca9a446a, 0xf4e5610a, 0x64015a1a, 0x0302511a, 0xc231975f, 0x3b8ce17a, 0xfede0fda, 0xc90e3f0a,
+    0xba279d7a, 0x9e818c3f, 0x341bca7f, 0x6b19adff, 0x6947836a, 0xb7f66b8f, 0xadc1595f, 0x4014b13f,
+    0x8898c77f, 0x3650e23a, 0xb874371f, 0x0f35e4ea, 0xdd19703a, 0x9094897a, 0xadee041f, 0xc20f9d6f,
+    0x4eb6b3df, 0x0c989a1a, 0x276add5f, 0x9c15d99f, 0x4476003a, 0x954ac6ea, 0x4cf5798a,
+};
+
+static const uint32_t nmea_corrupted_golden[FUZZ_RUNS] = {
+    0x58c9258b, 0xe8a4155a, 0xa9cdc08b, 0x5011ff49, 0x2e5efd35, 0x35107649, 0xe8a4155a, 0x700deb0b,
+    0xa30d5e4b, 0xd86c932b, 0x4e4bffcb, 0x1304c49a, 0x165229c9, 0x7053a87a, 0xa9cdc08b, 0x8ecc378b,
+    0x694d88cb, 0x01dc843a, 0x961f384b, 0x32087d95, 0xa341dd1a, 0xdd01b29a, 0xfe1fc0ba, 0x165229c9,
+    0xe31e37ba, 0x38d0546b, 0x2d2df1ab, 0x21a7ab78, 0x192149ba, 0x3153b2c9, 0x03a59e5a, 0x1fe1abfa,
+    0x266d8f6b, 0x59a1817a, 0x99b25ae9, 0x334a76cb, 0x1f09500b, 0x82278945, 0x1fe1abfa, 0x1fe1abfa,
+    0x8840541a, 0x4e4bffcb, 0xf608bd4d, 0x165229c9, 0x266d8f6b, 0xa9cdc08b, 0x6d0a4c4b, 0x0c9d11f5,
+    0x5208c34b, 0xdb2350da, 0x3422d2ba, 0xd641505a, 0x04e022fa, 0x3a0ad90b, 0x8bfd179a, 0x42c1ff4d,
+    0xdb07344d, 0x6756c4c9, 0x3e9ff87a, 0xecadb9eb, 0x73caae8b, 0xb2ff230b, 0xf8033b9a, 0x5373bdba,
+    0xbb3fc75a, 0x5011ff49, 0x334a76cb, 0x1f09500b, 0x7053a87a, 0x57db81fc, 0x694d88cb, 0x192149ba,
+    0x4e4bffcb, 0x6e7546ba, 0x58c9258b, 0x7053a87a, 0x59a1817a, 0xa03e3e5a, 0xa03e3e5a, 0x853cb55a,
+    0x3aaeb62b, 0x700deb0b, 0x700deb0b, 0x04e022fa, 0x5dc3884d, 0x58c9258b, 0x334a76cb, 0xa39ffccb,
+    0x844f11cb, 0x4c553bc9, 0x694d88cb, 0x73caae8b, 0x62d2e3fa, 0x1fe1abfa, 0x52e11f3a, 0xa9cdc08b,
+    0xd1ac30eb, 0x165229c9, 0x1f09500b, 0x698bd1a4, 0xd641505a, 0x9c817ada, 0x78c5114d, 0x3153b2c9,
+    0x7bd9eead, 0x52e11f3a, 0xe8a4155a, 0x0b6c066b, 0x5011ff49, 0x8ecc378b, 0x35107649, 0xea82771a,
+    0xd641505a, 0x1fe1abfa, 0x192149ba, 0x4e4bffcb, 0xf5c6ba29, 0x334a76cb, 0x9877d649, 0x07af42eb,
+    0x5011ff49, 0xc200299a, 0x16216545, 0x1304c49a, 0x3daae055, 0x52e11f3a, 0xb4b3e3e9, 0x5011ff49,
+    0x165229c9, 0x42c1ff4d, 0x961f384b, 0xa7025ae5, 0xc200299a, 0x4c553bc9, 0x3153b2c9, 0xa59a7b18,
+    0x482f7aab, 0x45f2f93a, 0x880bd54b, 0xa03e3e5a, 0x42c1ff4d, 0x35107649, 0x5373bdba, 0x57db81fc,
+    0x192149ba, 0x6b138849, 0x3153b2c9, 0x81c96994, 0x089ce67a, 0xea82771a, 0xda364cf4, 0x8ecc378b,
+    0x2e5efd35, 0x16216545, 0x82278945, 0xa30d5e4b, 0x52e11f3a, 0x37df963a, 0xfe1fc0ba, 0x58c9258b,
+    0x334a76cb, 0x10ac269c, 0x93c69a4d, 0x3e9ff87a, 0x21a7ab78, 0x70ff48e5, 0x1304c49a, 0x5373bdba,
+    0x698bd1a4, 0x6b138849, 0x6d0a4c4b, 0x334a76cb, 0x42c1ff4d, 0x5a108ed7, 0xb78303da, 0x4c553bc9,
+    0xbb3fc75a, 0x3153b2c9, 0x8b55317a, 0x3daae055, 0xc07fe78b, 0xa9cdc08b, 0x2e5efd35, 0xc200299a,
+    0x5208c34b, 0xf5c6ba29, 0x3422d2ba, 0x3422d2ba, 0xd86c932b, 0x3a0ad90b, 0x58c9258b, 0x667e68da,
+    0x45f2f93a, 0x475ad907, 0x2e5efd35, 0x78c5114d, 0xa6fea09a, 0xc07fe78b, 0xa30d5e4b, 0xf36e1c2b,
+};
+
+static uint32_t nmea_digest(const struct parse_result &result)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < result.returns.size(); i++) {
+        hash = digest(hash, result.returns[i]);
+    }
+    for (size_t i = 0; i < result.satellites.size(); i++) {
+        hash = digest(hash, result.satellites[i]);
+    }
+    hash = digest(hash, result.stats.gpsRxReceived);
+    hash = digest(hash, result.stats.gpsRxChkSumError);
+    hash = digest(hash, result.stats.gpsRxParserError);
+    hash = digest(hash, result.stats.gpsRxOverflow);
+
+    /* the floats to a thousandth, the fixed point parser may round the last bit differently */
+    for (size_t i = 0; i < result.positions.size(); i++) {
+        const GPSPositionSensorDataPacked &p = result.positions[i];
+        hash = digest(hash, p.Latitude);
+        hash = digest(hash, p.Longitude);
+        hash = digest(hash, p.Satellites);
+        hash = digest(hash, p.Status);
+        hash = digest(hash, lroundf(p.Altitude * 1000.0f));
+        hash = digest(hash, lroundf(p.GeoidSeparation * 1000.0f));
+        hash = digest(hash, lroundf(p.Groundspeed * 1000.0f));
+        hash = digest(hash, lroundf(p.Heading * 1000.0f));
+        hash = digest(hash, lroundf(p.PDOP * 1000.0f));
+        hash = digest(hash, lroundf(p.HDOP * 1000.0f));
+        hash = digest(hash, lroundf(p.VDOP * 1000.0f));
+    }
+    for (size_t i = 0; i < result.times.size(); i++) {
+        const GPSTimeDataPacked &t = result.times[i];
+        hash = digest(hash, t.Hour);
+        hash = digest(hash, t.Minute);
+        hash = digest(hash, t.Second);
+        hash = digest(hash, t.Day);
+        hash = digest(hash, t.Month);
+        hash = digest(hash, t.Year);
+    }
+    return hash;
+}
+
+/* the old parser read garbage out of malformed numbers in corrupted sentences, only the checksum handling is kept */
+static uint32_t nmea_stats_digest(const struct parse_result &result)
+{
+    uint32_t hash = 2166136261u;
+
+    hash = digest(hash, result.stats.gpsRxChkSumError);
+    hash = digest(hash, result.stats.gpsRxOverflow);
+    return digest(hash, result.stats.gpsRxReceived + result.stats.gpsRxParserError);
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class NMEATest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        initialize_objects();
+        buf = new char[CAPTURE_SIZE];
+        memset(&stats, 0, sizeof(stats));
+        memset(&gpsPosition, 0, sizeof(gpsPosition));
+        positions.clear();
+    }
+
+    virtual void TearDown()
+    {
+        delete[] buf;
+    }
+
+    int parse_sentence(const char *body)
+    {
+        uint16_t len = nmea_build_sentence(buf, body);
+
+        return parse_nmea_stream((uint8_t *)buf, len, gps_rx_buffer, &gpsPosition, &stats);
+    }
+
+    char *buf;
+    char gps_rx_buffer[NMEA_MAX_PACKET_LENGTH];
+    GPSPositionSensorData gpsPosition;
+    struct GPS_RX_STATS stats;
+};
+
+TEST_F(NMEATest, DecodeGGA) {
+    EXPECT_EQ(PARSER_COMPLETE, parse_sentence("GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,"));
+    EXPECT_EQ(1, stats.gpsRxReceived);
+    ASSERT_EQ(1u, positions.size());
+    EXPECT_EQ(481172999, positions[0].Latitude);
+    EXPECT_EQ(115166666, positions[0].Longitude);
+    EXPECT_EQ(8, positions[0].Satellites);
+    EXPECT_FLOAT_EQ(545.4f, positions[0].Altitude);
+    EXPECT_FLOAT_EQ(46.9f, positions[0].GeoidSeparation);
+
+    /* south and west, more digits than the fixed point keeps */
+    EXPECT_EQ(PARSER_COMPLETE, parse_sentence("GNGGA,123519,3352.1234567,S,15112.5,W,1,08,0.9,5.4,M,1.0,M,,"));
+    ASSERT_EQ(2u, positions.size());
+    EXPECT_EQ(-338687242, positions[1].Latitude);
+    EXPECT_EQ(-1512083333, positions[1].Longitude);
+}
+
+TEST_F(NMEATest, NegativeNumbers) {
+    /* below sea level and below the ellipsoid, the whole and the fractional part have the same sign */
+    EXPECT_EQ(PARSER_COMPLETE, parse_sentence("GPGGA,123519,3147.000,N,03530.000,E,1,08,0.9,-412.5,M,-0.7,M,,"));
+    ASSERT_EQ(1u, positions.size());
+    EXPECT_FLOAT_EQ(-412.5f, positions[0].Altitude);
+    EXPECT_FLOAT_EQ(-0.7f, positions[0].GeoidSeparation);
+}
+
+TEST_F(NMEATest, ChecksumAndUnknownSentences) {
+    uint16_t len = nmea_build_sentence(buf, "GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,");
+
+    buf[10] ^= 1;
+    EXPECT_EQ(PARSER_INCOMPLETE, parse_nmea_stream((uint8_t *)buf, len, gps_rx_buffer, &gpsPosition, &stats));
+    EXPECT_EQ(1, stats.gpsRxChkSumError);
+
+    /* a valid checksum on a sentence without parser, a missing checksum and a truncated name */
+    EXPECT_EQ(PARSER_INCOMPLETE, parse_sentence("GPTXT,01,01,02,ANTSTATUS=OK"));
+    EXPECT_EQ(PARSER_INCOMPLETE, parse_sentence("GPGGAX,123519"));
+    EXPECT_EQ(PARSER_INCOMPLETE, parse_sentence("G"));
+    strcpy(buf, "$GPGSA,A,3\r\n");
+    EXPECT_EQ(PARSER_INCOMPLETE, parse_nmea_stream((uint8_t *)buf, strlen(buf), gps_rx_buffer, &gpsPosition, &stats));
+    EXPECT_EQ(3, stats.gpsRxParserError);
+    EXPECT_EQ(2, stats.gpsRxChkSumError);
+    EXPECT_EQ(0u, positions.size());
+}
+
+TEST_F(NMEATest, MatchesGolden) {
+    uint32_t len = nmea_build_capture(buf, CAPTURE_SIZE / 10);
+
+    /* every read size the GPS task can get */
+    for (unsigned int run = 0; run < NMEA_READ_BUFFER; run++) {
+        struct parse_result result;
+
+        parse_nmea(buf, len, run, 1 + run, &result);
+        SCOPED_TRACE(run);
+        EXPECT_EQ(nmea_golden[run], nmea_digest(result));
+        EXPECT_EQ(0, result.stats.gpsRxChkSumError);
+        EXPECT_GT(result.positions.size(), 0u);
+        EXPECT_GT(result.satellites.size(), 0u);
+        EXPECT_GT(result.times.size(), 0u);
+    }
+}
+
+TEST_F(NMEATest, Corrupted) {
+    for (unsigned int run = 0; run < FUZZ_RUNS; run++) {
+        struct parse_result result;
+        uint32_t size = CAPTURE_SIZE / 10;
+        uint32_t len  = corrupt((uint8_t *)buf, nmea_build_capture(buf, size - 100), size, run);
+
+        parse_nmea(buf, len, run, 1 + run % NMEA_READ_BUFFER, &result);
+        SCOPED_TRACE(run);
+        EXPECT_EQ(nmea_corrupted_golden[run], nmea_stats_digest(result));
+    }
+}
+
+TEST_F(NMEATest, Benchmark) {
+    uint32_t len = nmea_build_capture(buf, CAPTURE_SIZE);
+    uint32_t sentences = 0;
+    uint64_t table     = 0;
+
+    for (uint32_t i = 0; i < len; i++) {
+        sentences += (buf[i] == '$');
+    }
+
+    /* 58 bytes is what 5ms at 115200 baud brings */
+    for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+        uint8_t rx[58];
+
+        uint64_t start = now_ns();
+        for (uint32_t i = 0; i < len; i += sizeof(rx)) {
+            uint8_t count = (len - i < sizeof(rx)) ? len - i : sizeof(rx);
+            memcpy(rx, &buf[i], count);
+            parse_nmea_stream(rx, count, gps_rx_buffer, &gpsPosition, &stats);
+        }
+        table += now_ns() - start;
+    }
+    printf("NMEA: fixed point parser %.0f ns per sentence\n", (double)table / BENCHMARK_LOOPS / sentences);
+}
@@ -0,0 +1,25 @@
+#define INSGPS_RENAME(name) ins13_ ## name
+#include "insgps_rename.h"
+#include "insgps13state.c"
+#include "insgps_filters.h"
+
+const struct insgps_filter insgps13_filter = {
+    .name                   = "insgps13",
+    .init                   = INSGPSInit,
+    .num_states             = ins_get_num_states,
+    .set_state              = INSSetState,
+    .set_mag_north          = INSSetMagNorth,
+    .set_mag_var            = INSSetMagVar,
+    .set_accel_var          = INSSetAccelVar,
+    .set_gyro_var           = INSSetGyroVar,
+    .set_gyro_bias_var      = INSSetGyroBiasVar,
+    .set_baro_var           = INSSetBaroVar,
+    .set_pos_vel_var        = INSSetPosVelVar,
+    .reset_p                = INSResetP,
+    .set_covariance_divider = INSSetCovariancePredictionDivider,
+    .state_prediction       = INSStatePrediction,
+    .covariance_prediction  = INSCovariancePrediction,
+    .correction             = INSCorrection,
+    .get_variance           = INSGetVariance,
+    .nav                    = &Nav,
+};
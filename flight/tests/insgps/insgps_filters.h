@@ -0,0 +1,37 @@
+#ifndef INSGPS_FILTERS_H
+#define INSGPS_FILTERS_H
+
+#include "insgps.h"
+
+/* Entry points of one INSGPS filter, see insgps13.c and insgps14.c */
+struct insgps_filter {
+    const char *name;
+    void       (*init)(void);
+    uint16_t   (*num_states)(void);
+    void       (*set_state)(const float pos[3], const float vel[3], const float q[4], const float gyro_bias[3], const float accel_bias[3]);
+    void       (*set_mag_north)(const float B[3]);
+    void       (*set_mag_var)(const float scaled_mag_var[3]);
+    void       (*set_accel_var)(const float accel_var[3]);
+    void       (*set_gyro_var)(const float gyro_var[3]);
+    void       (*set_gyro_bias_var)(const float gyro_bias_var[3]);
+    void       (*set_baro_var)(const float baro_var);
+    void       (*set_pos_vel_var)(const float PosVar[3], const float VelVar[3]);
+    void       (*reset_p)(const float *PDiag);
+    void       (*set_covariance_divider)(uint8_t divider);
+    void       (*state_prediction)(const float gyro_data[3], const float accel_data[3], float dT);
+    void       (*covariance_prediction)(float dT);
+    void       (*correction)(const float mag_data[3], const float Pos[3], const float Vel[3], const float BaroAlt, uint16_t SensorsUsed);
+    void       (*get_variance)(float *PDiag);
+    struct NavStruct *nav;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern const struct insgps_filter insgps13_filter;
+extern const struct insgps_filter insgps14_filter;
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INSGPS_FILTERS_H */
@@ -0,0 +1,307 @@
+/* Generated by the insgps unit test with INSGPS_GOLDEN set, do not edit */
+
+static const float insgps13_golden[15][32] = {
+    {
+        3.84782362, 0.320532322, -10.7914686, 2.00247955,
+        0.51225853, -0.381420195, 0.951837301, 0.185490802,
+        0.191336587, 0.151622429, 0.00063337246, -0.00034695369,
+        3.84455307e-05, 0, 0, 0,
+        0.00564114423, 0.00565402582, 0.000233231549, 0.00136495824,
+        0.00146567682, 0.000691699912, 1.81698056e-06, 2.74480067e-06,
+        2.84184716e-06, 9.69941993e-06, 9.71408554e-07, 9.70624342e-07,
+        9.99476583e-07, 0, 0, 0
+    },
+    {
+        7.67031765, 1.53842187, -11.4270935, 1.88020289,
+        1.05965674, -0.272248864, 0.805383205, 0.413402468,
+        0.330991328, 0.266272545, 0.00436622789, -0.00235702586,
+        0.00174177426, 0, 0, 0,
+        0.003742642, 0.00376213808, 0.000183151089, 0.00112402753,
+        0.00118387782, 0.000218202433, 1.43861348e-06, 2.11601423e-06,
+        2.62687126e-06, 7.8704179e-06, 7.99897578e-07, 8.15137241e-07,
+        9.48406125e-07, 0, 0, 0
+    },
+    {
+        11.1873608, 3.45398521, -11.8586578, 1.65095031,
+        1.39555275, -0.143889993, 0.787323356, 0.377077639,
+        0.255548924, 0.415486693, 0.00969638675, -0.00448706467,
+        0.00686750095, 0, 0, 0,
+        0.00335635594, 0.00337451277, 0.000138589297, 0.00108388928,
+        0.00114130543, 8.61482549e-05, 2.4490696e-06, 1.82142412e-06,
+        2.27410828e-06, 8.02783688e-06, 5.5306225e-07, 6.49230515e-07,
+        7.49305514e-07, 0, 0, 0
+    },
+    {
+        14.2562647, 6.07618046, -11.9848099, 1.3431313,
+        1.64248395, 0.0147586074, 0.809456587, 0.233149275,
+        -0.0118180336, 0.538778126, 0.0128843654, -0.00586906215,
+        0.0100727482, 0, 0, 0,
+        0.00325553888, 0.00327209639, 0.00011172246, 0.00104266568,
+        0.00106231985, 4.68566977e-05, 3.68205929e-06, 1.32985554e-06,
+        1.68882525e-06, 8.15788462e-06, 3.7734074e-07, 5.47328455e-07,
+        5.49413187e-07, 0, 0, 0
+    },
+    {
+        16.7582188, 9.23814583, -11.8278513, 1.02234042,
+        1.83095086, 0.160556704, 0.692548811, 0.323853314,
+        -0.189105824, 0.616225779, 0.0145749971, -0.00740292296,
+        0.0106923748, 0, 0, 0,
+        0.00322664389, 0.00323953596, 9.58520104e-05, 0.000998595729,
+        0.00101030234, 3.21354055e-05, 4.62455046e-06, 1.38583732e-06,
+        2.08454026e-06, 6.04170873e-06, 2.75912811e-07, 4.26941909e-07,
+        4.44846819e-07, 0, 0, 0
+    },
+    {
+        18.5988979, 12.8388367, -11.370718, 0.730224371,
+        1.9696703, 0.291141272, 0.440132886, 0.547399282,
+        -0.162186027, 0.693060398, 0.0154802063, -0.00852850266,
+        0.0104055544, 0, 0, 0,
+        0.00321699912, 0.00322840665, 8.66131813e-05, 0.000980324927,
+        0.000997734489, 2.59928365e-05, 5.8184919e-06, 1.01699698e-06,
+        3.43423312e-06, 2.88975275e-06, 2.30194956e-07, 3.13024259e-07,
+        3.6639014e-07, 0, 0, 0
+    },
+    {
+        19.665266, 16.622757, -10.6598558, 0.336094499,
+        2.03037643, 0.385577679, 0.278078198, 0.569770634,
+        -0.193618804, 0.748696029, 0.0156160677, -0.00895776134,
+        0.0109159136, 0, 0, 0,
+        0.00321295694, 0.00322618219, 8.14567829e-05, 0.000985695515,
+        0.000978905591, 2.32327493e-05, 6.8886925e-06, 1.03428999e-06,
+        3.23798326e-06, 1.41300859e-06, 2.15877108e-07, 2.43842919e-07,
+        2.98355474e-07, 0, 0, 0
+    },
+    {
+        19.9410591, 20.5496693, -9.8670826, -0.0572893508,
+        2.03738999, 0.405669183, 0.31546554, 0.355579287,
+        -0.413829654, 0.7763955, 0.0157762207, -0.00898199994,
+        0.0114814704, 0, 0, 0,
+        0.00321169663, 0.00322625786, 7.87248064e-05, 0.00098462007,
+        0.000976594165, 2.20823258e-05, 6.85890382e-06, 2.23128609e-06,
+        1.67824942e-06, 1.28799479e-06, 2.10618552e-07, 1.9841525e-07,
+        2.37011108e-07, 0, 0, 0
+    },
+    {
+        19.4595032, 24.5658531, -9.11057949, -0.41146189,
+        1.98045707, 0.353985637, 0.336852789, 0.0741595104,
+        -0.510843575, 0.78744489, 0.0160331819, -0.0088803377,
+        0.0118499165, 0, 0, 0,
+        0.00321189337, 0.00322460826, 7.76194793e-05, 0.00096381933,
+        0.000953679148, 2.19169797e-05, 6.19954699e-06, 2.9890607e-06,
+        8.8249584e-07, 1.27468036e-06, 2.00685648e-07, 1.70494587e-07,
+        1.93128685e-07, 0, 0, 0
+    },
+    {
+        18.2242146, 28.304781, -8.50535583, -0.799991071,
+        1.79880393, 0.254495084, 0.279849291, -0.052449584,
+        -0.303488612, 0.909300923, 0.0164121948, -0.0086846482,
+        0.0123526659, 0, 0, 0,
+        0.00321177277, 0.00322155841, 7.7788085e-05, 0.000947680906,
+        0.000953498471, 2.26242246e-05, 7.18814908e-06, 1.82376402e-06,
+        1.08151517e-06, 7.31150521e-07, 1.82116096e-07, 1.57992048e-07,
+        1.65603893e-07, 0, 0, 0
+    },
+    {
+        16.0723553, 31.7099037, -8.10120583, -1.23858738,
+        1.5442977, 0.118537284, 0.153297797, -0.0254835449,
+        -0.0700616688, 0.985363781, 0.016830381, -0.00863888022,
+        0.0126617095, 0, 0, 0,
+        0.00321113155, 0.0032202492, 7.86231685e-05, 0.000938621,
+        0.000955566997, 2.33949431e-05, 7.92342234e-06, 1.21360438e-06,
+        1.16400281e-06, 1.71518209e-07, 1.5956941e-07, 1.49955994e-07,
+        1.49500934e-07, 0, 0, 0
+    },
+    {
+        13.4415827, 34.7094116, -8.00584412, -1.50300395,
+        1.3114351, -0.0378137082, -0.00334694982, 0.0899284184,
+        -0.188187838, 0.978001595, 0.0174536947, -0.00879385881,
+        0.0128086302, 0, 0, 0,
+        0.0032099688, 0.00322003011, 7.90546546e-05, 0.000936775294,
+        0.000949314272, 2.33375267e-05, 7.68497739e-06, 1.46337413e-06,
+        1.13643682e-06, 5.34466693e-08, 1.40083216e-07, 1.3915016e-07,
+        1.43721749e-07, 0, 0, 0
+    },
+    {
+        10.332408, 37.0972137, -8.26272964, -1.68788207,
+        1.00726736, -0.199314922, -0.161102086, 0.238621071,
+        -0.447158128, 0.846850514, 0.0178648327, -0.00892715063,
+        0.0129500497, 0, 0, 0,
+        0.00320926588, 0.0032202797, 7.89553378e-05, 0.000929921225,
+        0.00094951276, 2.30606711e-05, 6.13209204e-06, 2.39892938e-06,
+        1.19927176e-06, 5.78421748e-07, 1.26453799e-07, 1.28097312e-07,
+        1.41125341e-07, 0, 0, 0
+    },
+    {
+        6.70812654, 38.8330879, -8.73781776, -1.86086726,
+        0.671895027, -0.312271565, -0.351265788, 0.266537189,
+        -0.446840614, 0.778398275, 0.0180371795, -0.00890381634,
+        0.0130283227, 0, 0, 0,
+        0.00320858369, 0.0032213591, 7.84582735e-05, 0.000924939755,
+        0.000955696334, 2.23347324e-05, 5.34057017e-06, 2.19145568e-06,
+        1.25586303e-06, 1.44403975e-06, 1.17173833e-07, 1.2278349e-07,
+        1.34694204e-07, 0, 0, 0
+    },
+    {
+        2.79682708, 39.759758, -9.42946148, -1.94322133,
+        0.303675413, -0.383358955, -0.521885335, 0.0844469517,
+        -0.2623685, 0.807259142, 0.018216949, -0.00898032263,
+        0.013181339, 0, 0, 0,
+        0.00320795644, 0.00322247925, 7.74484579e-05, 0.000925001688,
+        0.000952998758, 2.15171403e-05, 5.29645604e-06, 1.47486116e-06,
+        1.06568007e-06, 2.39428982e-06, 1.09531292e-07, 1.20875995e-07,
+        1.24140414e-07, 0, 0, 0
+    },
+};
+
+static const float insgps14_golden[15][32] = {
+    {
+        3.85113859, 0.322881997, -10.7910719, 2.01205444,
+        0.520459235, -0.380528986, 0.951400399, 0.185347781,
+        0.191188499, 0.154694751, 0.000457677525, -0.000198730515,
+        -0.000117362244, 0, 0, -0.000105411804,
+        0.00569046196, 0.00569016673, 0.000253574952, 0.00174874254,
+        0.00174596044, 0.000866033894, 2.19394587e-06, 3.91021285e-06,
+        3.75932882e-06, 8.97241716e-06, 9.80919594e-07, 9.80548634e-07,
+        9.92519858e-07, 9.97900588e-06, 0, 0
+    },
+    {
+        7.66753149, 1.54179215, -11.4278984, 1.87803876,
+        1.08894897, -0.274151623, 0.801702023, 0.411125064,
+        0.334563613, 0.276255876, 0.0036170925, -0.0019955521,
+        0.000562914007, 0, 0, -0.000549132412,
+        0.00378797553, 0.00378777459, 0.000186925798, 0.00125809037,
+        0.00125804765, 0.000227518525, 1.33059643e-06, 2.60597062e-06,
+        2.76647188e-06, 7.58206534e-06, 8.47741092e-07, 8.479862e-07,
+        9.34716809e-07, 9.96188737e-06, 0, 0
+    },
+    {
+        11.1819096, 3.46360326, -11.8605089, 1.64857912,
+        1.44813263, -0.14632225, 0.777988434, 0.373726517,
+        0.261113048, 0.432299256, 0.00942130107, -0.00465665897,
+        0.00491794338, 0, 0, -0.000930965471,
+        0.00339028216, 0.00338976597, 0.000139931173, 0.0012085851,
+        0.00120698439, 8.87300921e-05, 2.35784159e-06, 2.21445293e-06,
+        2.45209912e-06, 7.83831001e-06, 5.98751626e-07, 6.65056291e-07,
+        7.34387129e-07, 9.87954536e-06, 0, 0
+    },
+    {
+        14.2507992, 6.08638906, -11.9891663, 1.34043384,
+        1.67337978, 0.00906738173, 0.796580434, 0.234048069,
+        -0.00781372935, 0.557333171, 0.0129843531, -0.00642702915,
+        0.00852899347, 0, 0, 9.61849437e-05,
+        0.00328513538, 0.00328346947, 0.000112285605, 0.00115495746,
+        0.00113379478, 4.8447564e-05, 3.72647287e-06, 1.49443986e-06,
+        1.86943271e-06, 7.95991218e-06, 3.96167366e-07, 5.60339402e-07,
+        5.26591577e-07, 9.82133497e-06, 0, 0
+    },
+    {
+        16.753231, 9.24240303, -11.8348036, 1.01959825,
+        1.83254731, 0.152842045, 0.678909659, 0.327625513,
+        -0.182565421, 0.631199777, 0.0146493083, -0.00791535433,
+        0.00963639468, 0, 0, -9.88447791e-05,
+        0.0032535065, 0.00325145689, 9.76554438e-05, 0.00108578533,
+        0.00110212795, 3.47547357e-05, 4.66114079e-06, 1.40635302e-06,
+        2.35674111e-06, 5.95330221e-06, 2.76696056e-07, 4.43044513e-07,
+        4.27127787e-07, 9.6352187e-06, 0, 0
+    },
+    {
+        18.5913467, 12.835825, -11.3780842, 0.722423851,
+        1.95911074, 0.283922464, 0.42747584, 0.550140083,
+        -0.152358964, 0.700997174, 0.0154750794, -0.00878183357,
+        0.00987515133, 0, 0, -0.00136023259,
+        0.00323817297, 0.00324246986, 8.73063254e-05, 0.00102559163,
+        0.00107972557, 2.61025871e-05, 5.47665331e-06, 1.04392291e-06,
+        3.80943129e-06, 2.65087988e-06, 2.22685912e-07, 3.15809558e-07,
+        3.41460805e-07, 9.34848867e-06, 0, 0
+    },
+    {
+        19.649044, 16.6102104, -10.6680164, 0.311005831,
+        2.00541401, 0.378454894, 0.266624838, 0.573076904,
+        -0.18418552, 0.752708316, 0.0156117007, -0.00902270433,
+        0.0107645877, 0, 0, -0.00106727879,
+        0.00322211022, 0.00323593151, 8.35295432e-05, 0.0009599193,
+        0.00101005926, 2.86663744e-05, 5.81260883e-06, 1.07117103e-06,
+        3.6397837e-06, 1.18142168e-06, 2.04595622e-07, 2.35830228e-07,
+        2.57627391e-07, 9.20603088e-06, 0, 0
+    },
+    {
+        19.9295769, 20.5264816, -9.8746376, -0.0658734515,
+        1.99676573, 0.399457484, 0.304642558, 0.36112529,
+        -0.408001661, 0.78122735, 0.0158630162, -0.00908234809,
+        0.0114085302, 0, 0, 0.00111290021,
+        0.00322506507, 0.00322762295, 8.63310488e-05, 0.00103051343,
+        0.000980053679, 2.86872109e-05, 5.99673103e-06, 2.08306733e-06,
+        2.00093564e-06, 1.28779277e-06, 1.95919725e-07, 1.90789734e-07,
+        2.08798909e-07, 8.2938277e-06, 0, 0
+    },
+    {
+        19.4554234, 24.5436459, -9.12131596, -0.406411737,
+        1.94922769, 0.343922883, 0.327318817, 0.0798405334,
+        -0.509524286, 0.791752994, 0.0162324011, -0.00894333422,
+        0.0118186381, 0, 0, 0.00187351555,
+        0.00323246932, 0.00323105184, 8.46368057e-05, 0.00103774504,
+        0.00100592489, 2.61019068e-05, 5.81303539e-06, 2.76520927e-06,
+        9.91011575e-07, 1.27610735e-06, 1.84812748e-07, 1.58753409e-07,
+        1.74423548e-07, 7.27164206e-06, 0, 0
+    },
+    {
+        18.2223148, 28.2856045, -8.51993752, -0.794274628,
+        1.77428031, 0.241573393, 0.270150334, -0.0494974889,
+        -0.303644329, 0.912342608, 0.0166638717, -0.00876738969,
+        0.0123486817, 0, 0, 0.00302098785,
+        0.00323557178, 0.0032335408, 8.20248533e-05, 0.00101992465,
+        0.00101895188, 2.54565821e-05, 6.74864623e-06, 1.7765966e-06,
+        1.13680494e-06, 6.83537905e-07, 1.65836369e-07, 1.42149233e-07,
+        1.49337737e-07, 6.8205527e-06, 0, 0
+    },
+    {
+        16.0683975, 31.6893463, -8.11932659, -1.23781252,
+        1.51904202, 0.102475069, 0.143088445, -0.0247729626,
+        -0.069898203, 0.986927748, 0.0170591492, -0.00879197195,
+        0.0126711559, 0, 0, 0.00352134206,
+        0.00323555665, 0.00323385652, 8.36640975e-05, 0.00100825645,
+        0.0010188896, 3.05949397e-05, 7.19997752e-06, 1.26731936e-06,
+        1.22302765e-06, 1.42458944e-07, 1.42822628e-07, 1.31711502e-07,
+        1.31389811e-07, 6.71950511e-06, 0, 0
+    },
+    {
+        13.4390373, 34.6894608, -8.02278137, -1.49869001,
+        1.29124844, -0.0502167493, -0.0130584538, 0.0916944817,
+        -0.18703185, 0.977977872, 0.0176438466, -0.00901987404,
+        0.012851214, 0, 0, 0.000653380179,
+        0.00323440088, 0.00323323812, 8.91841701e-05, 0.00100510044,
+        0.00100464374, 3.22966698e-05, 6.76511945e-06, 1.48487743e-06,
+        1.23482539e-06, 6.12678761e-08, 1.22934424e-07, 1.20027451e-07,
+        1.21765581e-07, 6.04721254e-06, 0, 0
+    },
+    {
+        10.332489, 37.0779572, -8.27654648, -1.67972338,
+        0.987727106, -0.208652109, -0.168496221, 0.242500469,
+        -0.444739044, 0.845582426, 0.018013699, -0.00919531751,
+        0.0130806714, 0, 0, -0.000806543452,
+        0.00323379925, 0.00323199225, 8.61357112e-05, 0.000996707357,
+        0.000993849826, 2.57670981e-05, 5.39608436e-06, 2.29338821e-06,
+        1.34416996e-06, 5.40045846e-07, 1.08680553e-07, 1.08017673e-07,
+        1.15588136e-07, 5.20989079e-06, 0, 0
+    },
+    {
+        6.71160507, 38.8116302, -8.74756432, -1.85078919,
+        0.650326073, -0.318923593, -0.356925428, 0.269963592,
+        -0.444564372, 0.775942266, 0.0181713458, -0.0092307115,
+        0.0132173644, 0, 0, -0.00303187454,
+        0.0032327543, 0.00323065324, 8.03655057e-05, 0.000990062486,
+        0.000989495078, 2.45617521e-05, 4.75054412e-06, 2.14683337e-06,
+        1.41314024e-06, 1.29464547e-06, 9.83333805e-08, 1.00507428e-07,
+        1.07568773e-07, 4.99692078e-06, 0, 0
+    },
+    {
+        2.80119801, 39.7408638, -9.43705368, -1.93616951,
+        0.288911968, -0.387837529, -0.527103722, 0.0862819031,
+        -0.261723995, 0.803876638, 0.0183388144, -0.00934264436,
+        0.0133911232, 0, 0, -0.00294711767,
+        0.00323176314, 0.0032299608, 7.99639674e-05, 0.000988643267,
+        0.000985839055, 2.30966416e-05, 4.76369178e-06, 1.54402846e-06,
+        1.16259855e-06, 2.18436435e-06, 8.93850185e-08, 9.64207842e-08,
+        9.69786456e-08, 4.93231482e-06, 0, 0
+    },
+};
@@ -0,0 +1,35 @@
+/*
+ * Every filter implementation exports the same symbols. Before including one,
+ * define INSGPS_RENAME(name) to give them a prefix unique to that filter.
+ */
+#define INSGPSInit              INSGPS_RENAME(INSGPSInit)
+#define INSStatePrediction      INSGPS_RENAME(INSStatePrediction)
+#define INSCovariancePrediction INSGPS_RENAME(INSCovariancePrediction)
+#define INSCorrection           INSGPS_RENAME(INSCorrection)
+#define INSResetP               INSGPS_RENAME(INSResetP)
+#define INSGetVariance          INSGPS_RENAME(INSGetVariance)
+#define INSGetState             INSGPS_RENAME(INSGetState)
+#define INSSetState             INSGPS_RENAME(INSSetState)
+#define INSSetPosVelVar         INSGPS_RENAME(INSSetPosVelVar)
+#define INSSetGyroBias          INSGPS_RENAME(INSSetGyroBias)
+#define INSSetAccelBias         INSGPS_RENAME(INSSetAccelBias)
+#define INSSetAccelVar          INSGPS_RENAME(INSSetAccelVar)
+#define INSSetGyroVar           INSGPS_RENAME(INSSetGyroVar)
+#define INSSetGyroBiasVar       INSGPS_RENAME(INSSetGyroBiasVar)
+#define INSSetMagNorth          INSGPS_RENAME(INSSetMagNorth)
+#define INSSetMagVar            INSGPS_RENAME(INSSetMagVar)
+#define INSSetBaroVar           INSGPS_RENAME(INSSetBaroVar)
+#define INSSetCovariancePredictionDivider INSGPS_RENAME(INSSetCovariancePredictionDivider)
+#define INSSetArmed             INSGPS_RENAME(INSSetArmed)
+#define INSPosVelReset          INSGPS_RENAME(INSPosVelReset)
+#define INSLimitBias            INSGPS_RENAME(INSLimitBias)
+#define MagCorrection           INSGPS_RENAME(MagCorrection)
+#define MagVelBaroCorrection    INSGPS_RENAME(MagVelBaroCorrection)
+#define FullCorrection          INSGPS_RENAME(FullCorrection)
+#define GpsBaroCorrection       INSGPS_RENAME(GpsBaroCorrection)
+#define GpsMagCorrection        INSGPS_RENAME(GpsMagCorrection)
+#define VelBaroCorrection       INSGPS_RENAME(VelBaroCorrection)
+#define CovariancePrediction    INSGPS_RENAME(CovariancePrediction)
+#define ins_get_num_states      INSGPS_RENAME(ins_get_num_states)
+#define Nav                     INSGPS_RENAME(Nav)
+#define zeros                   INSGPS_RENAME(zeros)
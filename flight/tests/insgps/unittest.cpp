@@ -0,0 +1,421 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* getenv */
+#include <string.h> /* memset */
+#include <math.h> /* sin, cos */
+#include "ut_clock.h" /* now_ns */
+#include <vector>
+
+extern "C" {
+#include "insgps_filters.h"
+}
+
+/*
+ * Replays a synthetic flight through the INSGPS filters the way filterekf.c drives them:
+ * state and covariance prediction at IMU rate, mag and baro correction at 100Hz,
+ * GPS correction at 10Hz. The stream is generated from an analytic trajectory with
+ * deterministic noise, so the filter output can be checked against both the truth
+ * and the golden outputs in insgps_golden.h.
+ *
+ * To update the golden outputs after an intended change of the filter results:
+ *   rm flight/tests/insgps/insgps_golden.h
+ *   INSGPS_GOLDEN=$PWD/flight/tests/insgps/insgps_golden.h make ut_insgps_run
+ */
+
+#define IMU_RATE_HZ        500
+#define DURATION_S         30
+#define STEPS              (IMU_RATE_HZ * DURATION_S)
+#define MAG_DIVIDER        5
+#define GPS_DIVIDER        50
+#define CHECKPOINT_DIVIDER 1000
+#define CHECKPOINTS        (STEPS / CHECKPOINT_DIVIDER)
+#define NAV_VALUES         16
+#define MAX_STATES         16
+#define GOLDEN_VALUES      (NAV_VALUES + MAX_STATES)
+#define BENCHMARK_RUNS     5
+
+#include "insgps_golden.h"
+
+static const double dT      = 1.0 / IMU_RATE_HZ;
+static const double gravity = 9.81;
+static const float Be[3]    = { 0.40f, 0.05f, 0.90f };
+static const double gyro_bias[3] = { 0.02, -0.01, 0.015 };
+
+struct stream_sample {
+    float    gyro[3];
+    float    accel[3];
+    float    mag[3];
+    float    pos[3];
+    float    vel[3];
+    float    baro;
+    uint16_t sensors;
+    float    q[4]; // truth
+};
+
+enum timing_stage {
+    TIMING_STATE_PREDICTION = 0,
+    TIMING_COVARIANCE_PREDICTION,
+    TIMING_MAG_BARO_CORRECTION,
+    TIMING_FULL_CORRECTION,
+    TIMING_COUNT
+};
+
+static const char *const timing_names[TIMING_COUNT] = {
+    "INSStatePrediction",
+    "INSCovariancePrediction",
+    "INSCorrection(mag, baro)",
+    "INSCorrection(mag, baro, gps)",
+};
+
+struct replay_result {
+    float    golden[CHECKPOINTS][GOLDEN_VALUES];
+    float    nav[NAV_VALUES];
+    float    truth_q[4];
+    uint64_t ns[TIMING_COUNT];
+    uint32_t calls[TIMING_COUNT];
+};
+
+/* deterministic, approximately normal noise */
+static uint32_t noise_state;
+static double noise(double sigma)
+{
+    double sum = 0;
+
+    for (int i = 0; i < 12; i++) {
+        noise_state ^= noise_state << 13;
+        noise_state ^= noise_state >> 17;
+        noise_state ^= noise_state << 5;
+        sum += noise_state / 4294967296.0;
+    }
+    return (sum - 6.0) * sigma;
+}
+
+static void body_rates(double t, double w[3])
+{
+    w[0] = 0.3 * sin(0.7 * t);
+    w[1] = 0.2 * sin(0.4 * t + 1.0);
+    w[2] = 0.15;
+}
+
+/* same quaternion derivative as StateEq() */
+static void quat_dot(const double q[4], const double w[3], double qdot[4])
+{
+    qdot[0] = (-q[1] * w[0] - q[2] * w[1] - q[3] * w[2]) / 2.0;
+    qdot[1] = (q[0] * w[0] - q[3] * w[1] + q[2] * w[2]) / 2.0;
+    qdot[2] = (q[3] * w[0] + q[0] * w[1] - q[1] * w[2]) / 2.0;
+    qdot[3] = (-q[2] * w[0] + q[1] * w[1] + q[0] * w[2]) / 2.0;
+}
+
+/* Rbe, the earth to body rotation used by MeasurementEq() */
+static void quat_to_rbe(const double q[4], double R[3][3])
+{
+    R[0][0] = q[0] * q[0] + q[1] * q[1] - q[2] * q[2] - q[3] * q[3];
+    R[0][1] = 2.0 * (q[1] * q[2] + q[0] * q[3]);
+    R[0][2] = 2.0 * (q[1] * q[3] - q[0] * q[2]);
+    R[1][0] = 2.0 * (q[1] * q[2] - q[0] * q[3]);
+    R[1][1] = q[0] * q[0] - q[1] * q[1] + q[2] * q[2] - q[3] * q[3];
+    R[1][2] = 2.0 * (q[2] * q[3] + q[0] * q[1]);
+    R[2][0] = 2.0 * (q[1] * q[3] + q[0] * q[2]);
+    R[2][1] = 2.0 * (q[2] * q[3] - q[0] * q[1]);
+    R[2][2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+/* a 20m radius circle at 2m/s with a slow altitude oscillation, NED */
+static void trajectory(double t, double pos[3], double vel[3], double acc[3])
+{
+    const double r = 20.0, w = 0.1, h = 10.0, a = 2.0, v = 0.2;
+
+    pos[0] = r * sin(w * t);
+    pos[1] = r * (1.0 - cos(w * t));
+    pos[2] = -h - a * sin(v * t);
+    vel[0] = r * w * cos(w * t);
+    vel[1] = r * w * sin(w * t);
+    vel[2] = -a * v * cos(v * t);
+    acc[0] = -r * w * w * sin(w * t);
+    acc[1] = r * w * w * cos(w * t);
+    acc[2] = a * v * v * sin(v * t);
+}
+
+static const std::vector<stream_sample> &sensor_stream(void)
+{
+    static std::vector<stream_sample> stream;
+
+    if (!stream.empty()) {
+        return stream;
+    }
+
+    double q[4] = { 1.0, 0.0, 0.0, 0.0 };
+    noise_state = 0x12345678;
+    for (int k = 0; k < STEPS; k++) {
+        double t = k * dT;
+        stream_sample s;
+        double pos[3], vel[3], acc[3], w[3], R[3][3];
+
+        memset(&s, 0, sizeof(s));
+        trajectory(t, pos, vel, acc);
+        body_rates(t, w);
+        quat_to_rbe(q, R);
+
+        const double f_ned[3] = { acc[0], acc[1], acc[2] - gravity };
+        for (int i = 0; i < 3; i++) {
+            s.gyro[i]  = w[i] + gyro_bias[i] + noise(0.005);
+            s.accel[i] = R[i][0] * f_ned[0] + R[i][1] * f_ned[1] + R[i][2] * f_ned[2] + noise(0.05);
+            s.mag[i]   = R[i][0] * Be[0] + R[i][1] * Be[1] + R[i][2] * Be[2] + noise(0.01);
+            s.pos[i]   = pos[i] + noise(0.3);
+            s.vel[i]   = vel[i] + noise(0.05);
+        }
+        s.baro = -pos[2] + noise(0.2);
+        if (k % MAG_DIVIDER == 0) {
+            s.sensors |= MAG_SENSORS | BARO_SENSOR;
+        }
+        if (k % GPS_DIVIDER == 0) {
+            s.sensors |= POS_SENSORS | HORIZ_SENSORS | VERT_SENSORS;
+        }
+        for (int i = 0; i < 4; i++) {
+            s.q[i] = q[i];
+        }
+        stream.push_back(s);
+
+        // RK4 of the truth attitude to the next sample
+        double k1[4], k2[4], k3[4], k4[4], tmp[4], wm[3], we[3];
+        body_rates(t + dT / 2, wm);
+        body_rates(t + dT, we);
+        quat_dot(q, w, k1);
+        for (int i = 0; i < 4; i++) {
+            tmp[i] = q[i] + k1[i] * dT / 2;
+        }
+        quat_dot(tmp, wm, k2);
+        for (int i = 0; i < 4; i++) {
+            tmp[i] = q[i] + k2[i] * dT / 2;
+        }
+        quat_dot(tmp, wm, k3);
+        for (int i = 0; i < 4; i++) {
+            tmp[i] = q[i] + k3[i] * dT;
+        }
+        quat_dot(tmp, we, k4);
+        double norm = 0;
+        for (int i = 0; i < 4; i++) {
+            q[i] += (k1[i] + 2 * k2[i] + 2 * k3[i] + k4[i]) * dT / 6;
+            norm += q[i] * q[i];
+        }
+        for (int i = 0; i < 4; i++) {
+            q[i] /= sqrt(norm);
+        }
+    }
+    return stream;
+}
+
+static void nav_values(const struct insgps_filter *filter, float values[NAV_VALUES])
+{
+    const struct NavStruct *nav = filter->nav;
+
+    memcpy(&values[0], nav->Pos, sizeof(nav->Pos));
+    memcpy(&values[3], nav->Vel, sizeof(nav->Vel));
+    memcpy(&values[6], nav->q, sizeof(nav->q));
+    memcpy(&values[10], nav->gyro_bias, sizeof(nav->gyro_bias));
+    memcpy(&values[13], nav->accel_bias, sizeof(nav->accel_bias));
+}
+
+static void replay(const struct insgps_filter *filter, uint8_t covariance_divider, struct replay_result *result)
+{
+    const std::vector<stream_sample> &stream = sensor_stream();
+    const float zeros[3] = { 0 };
+    float pos[3], vel[3];
+
+    memset(result, 0, sizeof(*result));
+    for (int i = 0; i < 3; i++) {
+        pos[i] = stream[0].pos[i];
+        vel[i] = stream[0].vel[i];
+    }
+
+    // the EKFConfiguration defaults, with the magnetometer variance of a unit vector
+    const float mag_var[3]       = { 0.005f, 0.005f, 0.005f };
+    const float accel_var[3]     = { 0.003f, 0.003f, 0.003f };
+    const float gyro_var[3]      = { 0.001f, 0.001f, 0.001f };
+    const float gyro_bias_var[3] = { 1e-6f, 1e-6f, 1e-6f };
+    const float pos_var[3]       = { 0.1f, 0.1f, 1000000.0f };
+    const float vel_var[3]       = { 0.01f, 0.01f, 0.01f };
+    const float p_diag[MAX_STATES] = { 25.0f, 25.0f, 25.0f, 5.0f, 5.0f, 5.0f, 1e-5f, 1e-5f, 1e-5f, 1e-5f, 1e-6f, 1e-6f, 1e-6f, 1e-5f, 1e-5f, 1e-5f };
+
+    filter->init();
+    filter->set_mag_north(Be);
+    filter->set_mag_var(mag_var);
+    filter->set_accel_var(accel_var);
+    filter->set_gyro_var(gyro_var);
+    filter->set_gyro_bias_var(gyro_bias_var);
+    filter->set_baro_var(0.01f);
+    filter->set_pos_vel_var(pos_var, vel_var);
+    filter->set_state(pos, vel, stream[0].q, zeros, zeros);
+    filter->reset_p(p_diag);
+    filter->set_covariance_divider(covariance_divider);
+
+    for (int k = 0; k < STEPS; k++) {
+        const stream_sample &s = stream[k];
+        uint64_t start = now_ns();
+
+        filter->state_prediction(s.gyro, s.accel, (float)dT);
+        uint64_t predicted = now_ns();
+        filter->covariance_prediction((float)dT);
+        uint64_t end = now_ns();
+        result->ns[TIMING_STATE_PREDICTION]      += predicted - start;
+        result->ns[TIMING_COVARIANCE_PREDICTION] += end - predicted;
+        result->calls[TIMING_STATE_PREDICTION]++;
+        result->calls[TIMING_COVARIANCE_PREDICTION]++;
+
+        if (s.sensors) {
+            enum timing_stage stage = (s.sensors & POS_SENSORS) ? TIMING_FULL_CORRECTION : TIMING_MAG_BARO_CORRECTION;
+            start = now_ns();
+            filter->correction(s.mag, s.pos, s.vel, s.baro, s.sensors);
+            result->ns[stage] += now_ns() - start;
+            result->calls[stage]++;
+        }
+
+        if ((k + 1) % CHECKPOINT_DIVIDER == 0) {
+            float *values = result->golden[(k + 1) / CHECKPOINT_DIVIDER - 1];
+            nav_values(filter, values);
+            filter->get_variance(&values[NAV_VALUES]);
+        }
+    }
+    nav_values(filter, result->nav);
+    memcpy(result->truth_q, stream[STEPS - 1].q, sizeof(result->truth_q));
+}
+
+static void write_golden(const struct insgps_filter *filter, const struct replay_result *result, const char *path)
+{
+    FILE *file = fopen(path, "a");
+
+    ASSERT_TRUE(file != NULL);
+    if (ftell(file) == 0) {
+        fprintf(file, "/* Generated by the insgps unit test with INSGPS_GOLDEN set, do not edit */\n");
+    }
+    fprintf(file, "\nstatic const float %s_golden[%d][%d] = {\n", filter->name, CHECKPOINTS, GOLDEN_VALUES);
+    for (int c = 0; c < CHECKPOINTS; c++) {
+        fprintf(file, "    {");
+        for (int i = 0; i < GOLDEN_VALUES; i++) {
+            fprintf(file, "%s%.9g%s", (i % 4) ? " " : "\n        ", result->golden[c][i], i < GOLDEN_VALUES - 1 ? "," : "");
+        }
+        fprintf(file, "\n    },\n");
+    }
+    fprintf(file, "};\n");
+    fclose(file);
+}
+
+/* regardless of the golden outputs, the filter has to track the truth */
+static void check_truth(const struct insgps_filter *filter, const struct replay_result *result)
+{
+    const std::vector<stream_sample> &stream = sensor_stream();
+    double pos[3], vel[3], acc[3];
+
+    trajectory((STEPS - 1) * dT, pos, vel, acc);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(pos[i], result->nav[i], 1.5) << filter->name << " position " << i;
+        EXPECT_NEAR(vel[i], result->nav[3 + i], 0.5) << filter->name << " velocity " << i;
+        EXPECT_NEAR(gyro_bias[i], result->nav[10 + i], 0.01) << filter->name << " gyro bias " << i;
+    }
+    // angle between the estimated and the true attitude
+    float dot = 0;
+    for (int i = 0; i < 4; i++) {
+        dot += result->nav[6 + i] * stream[STEPS - 1].q[i];
+    }
+    float error_deg = 2.0f * acosf(fminf(fabsf(dot), 1.0f)) * 180.0f / M_PI;
+    EXPECT_LT(error_deg, 4.0f) << filter->name << " attitude error";
+    printf("%s: attitude error %.2f deg, position error %.2f %.2f %.2f m\n", filter->name, error_deg,
+           result->nav[0] - pos[0], result->nav[1] - pos[1], result->nav[2] - pos[2]);
+}
+
+static void check_filter(const struct insgps_filter *filter, const float golden[CHECKPOINTS][GOLDEN_VALUES])
+{
+    struct replay_result result;
+    const char *golden_path = getenv("INSGPS_GOLDEN");
+
+    replay(filter, 1, &result);
+
+    if (golden_path) {
+        write_golden(filter, &result, golden_path);
+    } else {
+        uint16_t values = NAV_VALUES + filter->num_states();
+        for (int c = 0; c < CHECKPOINTS; c++) {
+            for (int i = 0; i < values; i++) {
+                float expected = golden[c][i];
+                EXPECT_NEAR(expected, result.golden[c][i], 1e-4f + 1e-3f * fabsf(expected)) << filter->name << " checkpoint " << c << " value " << i;
+            }
+        }
+    }
+
+    check_truth(filter, &result);
+}
+
+/* covariance propagated once every covariance_divider state predictions */
+static void check_decimated(const struct insgps_filter *filter, uint8_t covariance_divider)
+{
+    struct replay_result reference;
+    struct replay_result result;
+
+    replay(filter, 1, &reference);
+    replay(filter, covariance_divider, &result);
+    check_truth(filter, &result);
+
+    // the variances stay within a factor of two of the ones propagated on every step
+    uint16_t states = filter->num_states();
+    for (int c = 0; c < CHECKPOINTS; c++) {
+        for (int i = 0; i < states; i++) {
+            float expected = reference.golden[c][NAV_VALUES + i];
+            float actual   = result.golden[c][NAV_VALUES + i];
+            EXPECT_GT(actual, expected * 0.5f) << filter->name << " checkpoint " << c << " variance " << i;
+            EXPECT_LT(actual, expected * 2.0f) << filter->name << " checkpoint " << c << " variance " << i;
+        }
+    }
+}
+
+static void benchmark_filter(const struct insgps_filter *filter, uint8_t covariance_divider)
+{
+    struct replay_result result;
+    double best[TIMING_COUNT];
+
+    for (int stage = 0; stage < TIMING_COUNT; stage++) {
+        best[stage] = 1e30;
+    }
+    for (int run = 0; run < BENCHMARK_RUNS; run++) {
+        replay(filter, covariance_divider, &result);
+        for (int stage = 0; stage < TIMING_COUNT; stage++) {
+            ASSERT_GT(result.calls[stage], 0u);
+            double ns = (double)result.ns[stage] / result.calls[stage];
+            if (ns < best[stage]) {
+                best[stage] = ns;
+            }
+        }
+    }
+    for (int stage = 0; stage < TIMING_COUNT; stage++) {
+        printf("%s divider %u: %-30s %8.0f ns/call (%u calls)\n", filter->name, covariance_divider, timing_names[stage], best[stage], result.calls[stage]);
+    }
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class InsgpsReplay : public testing::Test {};
+
+TEST_F(InsgpsReplay, Insgps13Regression) {
+    check_filter(&insgps13_filter, insgps13_golden);
+}
+
+TEST_F(InsgpsReplay, Insgps14Regression) {
+    check_filter(&insgps14_filter, insgps14_golden);
+}
+
+TEST_F(InsgpsReplay, Insgps13DecimatedCovariance) {
+    check_decimated(&insgps13_filter, 5);
+}
+
+TEST_F(InsgpsReplay, Insgps14DecimatedCovariance) {
+    check_decimated(&insgps14_filter, 5);
+}
+
+TEST_F(InsgpsReplay, Insgps13Benchmark) {
+    benchmark_filter(&insgps13_filter, 1);
+    benchmark_filter(&insgps13_filter, 5);
+}
+
+TEST_F(InsgpsReplay, Insgps14Benchmark) {
+    benchmark_filter(&insgps14_filter, 1);
+    benchmark_filter(&insgps14_filter, 5);
+}
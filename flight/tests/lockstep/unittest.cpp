@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <time.h> /* clock_gettime */
+#include "ut_clock.h" /* now_ns */
+#include <pthread.h> /* pthread_create */
+#include <semaphore.h> /* sem_timedwait */
+
+extern "C" {
+#include "FreeRTOS.h"
+#include "task.h"
+
+void vApplicationIdleHook(void)
+{}
+
+void vLockstepIdleBegin(TickType_t expectedIdleTime);
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, signed char *pcTaskName)
+{
+    (void)xTask;
+    printf("stack overflow in %s\n", (char *)pcTaskName);
+}
+}
+
+#define LOCKSTEP_WAKES 100
+
+struct periodic_task {
+    TickType_t period;
+    int wakes;
+    int lateWakes;
+    int clockErrors;
+};
+
+static struct periodic_task tasks[] = {
+    { 1,  0, 0, 0 },
+    { 7,  0, 0, 0 },
+    { 13, 0, 0, 0 },
+    { 29, 0, 0, 0 },
+};
+#define NUM_TASKS (sizeof(tasks) / sizeof(tasks[0]))
+
+static volatile int finishedTasks;
+static TickType_t endTick;
+static sem_t scheduleDone;
+
+// The supervisor ticks at least once per real tick period, also while the idle
+// task holds the scheduler between its sleep check and vPortSuppressTicksAndSleep().
+// On every other tickless entry wait there for two ticks, stepping over the
+// expected idle time on top of them would wake the next task a tick late.
+void vLockstepIdleBegin(TickType_t expectedIdleTime)
+{
+    static unsigned entries;
+
+    if ((++entries & 1) && expectedIdleTime > 2) {
+        unsigned long long pended = ullPortGetVirtualTimeUs() + 2 * portTICK_RATE_MICROSECONDS;
+        uint64_t start = now_ns();
+
+        while (ullPortGetVirtualTimeUs() < pended && now_ns() - start < 100000000ull) {}
+    }
+}
+
+static void periodicTask(void *parameters)
+{
+    struct periodic_task *task = (struct periodic_task *)parameters;
+    TickType_t lastWake = xTaskGetTickCount();
+    const TickType_t firstWake = lastWake;
+
+    for (int i = 1; i <= LOCKSTEP_WAKES; i++) {
+        vTaskDelayUntil(&lastWake, task->period);
+
+        TickType_t now = xTaskGetTickCount();
+        if (now != firstWake + i * task->period) {
+            task->lateWakes++;
+        }
+        // virtual time must have been stepped with the ticks, not ahead of them
+        if (ullPortGetVirtualTimeUs() != (unsigned long long)now * portTICK_RATE_MICROSECONDS) {
+            task->clockErrors++;
+        }
+        task->wakes++;
+    }
+
+    taskENTER_CRITICAL();
+    finishedTasks++;
+    taskEXIT_CRITICAL();
+    vTaskSuspend(NULL);
+}
+
+static void controlTask(void *parameters)
+{
+    (void)parameters;
+
+    while (finishedTasks < (int)NUM_TASKS) {
+        vTaskDelay(100);
+    }
+    endTick = xTaskGetTickCount();
+    sem_post(&scheduleDone);
+
+    // vTaskEndScheduler() cancels the task threads under the port's feet, the kernel idles until the process exits
+    vTaskSuspend(NULL);
+}
+
+static void *kernelThread(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < NUM_TASKS; i++) {
+        xTaskCreate(periodicTask, "periodic", configMINIMAL_STACK_SIZE, &tasks[i], 2, NULL);
+    }
+    xTaskCreate(controlTask, "control", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+
+    vPortEnableVirtualTime();
+    vTaskStartScheduler();
+    return NULL;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class Lockstep : public testing::Test {};
+
+// The kernel can only be started once per process, so all checks run on one schedule.
+TEST_F(Lockstep, PeriodicWakes) {
+    pthread_t kernel;
+    struct timespec deadline;
+
+    ASSERT_EQ(0, sem_init(&scheduleDone, 0, 0));
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += 60;
+
+    uint64_t start = now_ns();
+    ASSERT_EQ(0, pthread_create(&kernel, NULL, kernelThread, NULL));
+    ASSERT_EQ(0, sem_timedwait(&scheduleDone, &deadline));
+    uint64_t elapsed = now_ns() - start;
+
+    for (unsigned i = 0; i < NUM_TASKS; i++) {
+        EXPECT_EQ(LOCKSTEP_WAKES, tasks[i].wakes) << "period " << tasks[i].period;
+        EXPECT_EQ(0, tasks[i].lateWakes) << "period " << tasks[i].period;
+        EXPECT_EQ(0, tasks[i].clockErrors) << "period " << tasks[i].period;
+    }
+
+    // idle stretches are stepped over, so the simulation runs ahead of real time
+    uint64_t simulatedUs = (uint64_t)endTick * portTICK_RATE_MICROSECONDS;
+    EXPECT_LT(elapsed / 1000, simulatedUs);
+    printf("%u ticks simulated in %.1f ms\n", (unsigned)endTick, elapsed / 1e6);
+}
@@ -0,0 +1,217 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <math.h> /* sinf */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "butterworth.h"
+#include "biquad.h"
+#include "pios_math.h"
+}
+
+#define SAMPLE_RATE      1000.0f
+#define SETTLE_SAMPLES   2000
+#define MEASURE_SAMPLES  2000
+#define BENCHMARK_FRAMES 200000
+
+/* peak output amplitude of a filter bank channel for a unit sine input once settled */
+static float sine_gain(struct biquad_bank *bank, float frequency)
+{
+    float peak = 0.0f;
+
+    biquad_bank_reset(bank, NULL);
+    for (int n = 0; n < SETTLE_SAMPLES + MEASURE_SAMPLES; n++) {
+        float samples[BIQUAD_BANK_MAX_CHANNELS] = { 0 };
+        samples[0] = sinf(2.0f * M_PI_F * frequency * n / SAMPLE_RATE);
+        biquad_bank_apply(bank, samples);
+        if (n >= SETTLE_SAMPLES && fabsf(samples[0]) > peak) {
+            peak = fabsf(samples[0]);
+        }
+    }
+    return peak;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class BiquadTest : public testing::Test {
+protected:
+    struct biquad_bank bank;
+};
+
+TEST_F(BiquadTest, InitLimits) {
+    struct biquad_coeffs coeffs[BIQUAD_BANK_MAX_STAGES + 1];
+
+    for (int s = 0; s <= BIQUAD_BANK_MAX_STAGES; s++) {
+        biquad_lowpass(&coeffs[s], 0.1f, 0.7071f);
+    }
+    EXPECT_EQ(0, biquad_bank_init(&bank, BIQUAD_BANK_MAX_CHANNELS, BIQUAD_BANK_MAX_STAGES, coeffs));
+    EXPECT_EQ(-1, biquad_bank_init(&bank, BIQUAD_BANK_MAX_CHANNELS + 1, 1, coeffs));
+    EXPECT_EQ(-1, biquad_bank_init(&bank, 1, BIQUAD_BANK_MAX_STAGES + 1, coeffs));
+}
+
+TEST_F(BiquadTest, LowpassMatchesButterworth) {
+    struct biquad_coeffs coeffs;
+    struct ButterWorthDF2Filter butterworth;
+    float wn1 = 0.0f, wn2 = 0.0f;
+
+    biquad_lowpass(&coeffs, 80.0f / SAMPLE_RATE, M_SQRT1_2);
+    InitButterWorthDF2Filter(80.0f / SAMPLE_RATE, &butterworth);
+    ASSERT_EQ(0, biquad_bank_init(&bank, 1, 1, &coeffs));
+
+    srand(1234);
+    for (int n = 0; n < 1000; n++) {
+        float x = (float)rand() / RAND_MAX - 0.5f;
+        float expected = FilterButterWorthDF2(x, &butterworth, &wn1, &wn2);
+        biquad_bank_apply(&bank, &x);
+        ASSERT_NEAR(expected, x, 1e-5f) << "sample " << n;
+    }
+}
+
+TEST_F(BiquadTest, LowpassResponse) {
+    struct biquad_coeffs coeffs;
+
+    biquad_lowpass(&coeffs, 50.0f / SAMPLE_RATE, M_SQRT1_2);
+    ASSERT_EQ(0, biquad_bank_init(&bank, 1, 1, &coeffs));
+
+    EXPECT_NEAR(1.0f, sine_gain(&bank, 2.0f), 0.01f);
+    EXPECT_NEAR(M_SQRT1_2, sine_gain(&bank, 50.0f), 0.01f);
+    EXPECT_LT(sine_gain(&bank, 300.0f), 0.05f);
+}
+
+TEST_F(BiquadTest, NotchResponse) {
+    struct biquad_coeffs coeffs;
+
+    biquad_notch(&coeffs, 120.0f / SAMPLE_RATE, 3.0f);
+    ASSERT_EQ(0, biquad_bank_init(&bank, 1, 1, &coeffs));
+
+    EXPECT_LT(sine_gain(&bank, 120.0f), 0.01f);
+    EXPECT_NEAR(1.0f, sine_gain(&bank, 10.0f), 0.01f);
+    EXPECT_NEAR(1.0f, sine_gain(&bank, 450.0f), 0.01f);
+}
+
+TEST_F(BiquadTest, BlockMatchesSamples) {
+    struct biquad_coeffs coeffs[3];
+    struct biquad_bank reference;
+    float block[3][256];
+
+    biquad_notch(&coeffs[0], 120.0f / SAMPLE_RATE, 3.0f);
+    biquad_notch(&coeffs[1], 240.0f / SAMPLE_RATE, 3.0f);
+    biquad_lowpass(&coeffs[2], 90.0f / SAMPLE_RATE, M_SQRT1_2);
+    ASSERT_EQ(0, biquad_bank_init(&bank, 3, 3, coeffs));
+    ASSERT_EQ(0, biquad_bank_init(&reference, 3, 3, coeffs));
+
+    srand(1234);
+    for (int c = 0; c < 3; c++) {
+        for (int n = 0; n < 256; n++) {
+            block[c][n] = (float)rand() / RAND_MAX - 0.5f;
+        }
+    }
+    for (int n = 0; n < 256; n++) {
+        float frame[3] = { block[0][n], block[1][n], block[2][n] };
+        biquad_bank_apply(&reference, frame);
+        block[0][n] = frame[0];
+        block[1][n] = frame[1];
+        block[2][n] = frame[2];
+    }
+
+    srand(1234);
+    for (int c = 0; c < 3; c++) {
+        float samples[256];
+        for (int n = 0; n < 256; n++) {
+            samples[n] = (float)rand() / RAND_MAX - 0.5f;
+        }
+        /* in two bursts, the state carries over */
+        biquad_bank_apply_block(&bank, c, samples, 100);
+        biquad_bank_apply_block(&bank, c, &samples[100], 156);
+        for (int n = 0; n < 256; n++) {
+            ASSERT_EQ(block[c][n], samples[n]) << "channel " << c << " sample " << n;
+        }
+    }
+}
+
+TEST_F(BiquadTest, ResetSettled) {
+    struct biquad_coeffs coeffs[2];
+    const float values[2] = { 3.0f, -12.5f };
+
+    biquad_lowpass(&coeffs[0], 30.0f / SAMPLE_RATE, M_SQRT1_2);
+    biquad_notch(&coeffs[1], 100.0f / SAMPLE_RATE, 2.0f);
+    ASSERT_EQ(0, biquad_bank_init(&bank, 2, 2, coeffs));
+    biquad_bank_reset(&bank, values);
+
+    for (int n = 0; n < 100; n++) {
+        float samples[2] = { values[0], values[1] };
+        biquad_bank_apply(&bank, samples);
+        ASSERT_NEAR(values[0], samples[0], 1e-4f);
+        ASSERT_NEAR(values[1], samples[1], 1e-4f);
+    }
+}
+
+TEST_F(BiquadTest, FirstOrderMatchesSmoothing) {
+    struct biquad_coeffs coeffs;
+    const float alpha = 0.8f;
+    float smoothed[3] = { 1.0f, -2.0f, 0.5f };
+
+    /* takes over from the smoothed values the way the stabilization gyro filter does */
+    biquad_first_order(&coeffs, alpha);
+    ASSERT_EQ(0, biquad_bank_init(&bank, 3, 1, &coeffs));
+    biquad_bank_reset(&bank, smoothed);
+
+    srand(42);
+    for (int n = 0; n < 1000; n++) {
+        float samples[3];
+        for (int c = 0; c < 3; c++) {
+            samples[c]  = (float)rand() / RAND_MAX - 0.5f;
+            smoothed[c] = smoothed[c] * alpha + samples[c] * (1 - alpha);
+        }
+        biquad_bank_apply(&bank, samples);
+        for (int c = 0; c < 3; c++) {
+            ASSERT_FLOAT_EQ(smoothed[c], samples[c]) << "channel " << c << " sample " << n;
+        }
+    }
+}
+
+TEST_F(BiquadTest, Benchmark) {
+    struct biquad_coeffs coeffs[2];
+    struct ButterWorthDF2Filter butterworth;
+    float wn1[BIQUAD_BANK_MAX_CHANNELS][2] = { { 0 } };
+    float wn2[BIQUAD_BANK_MAX_CHANNELS][2] = { { 0 } };
+    float samples[BIQUAD_BANK_MAX_CHANNELS];
+    float input[256];
+    volatile float sink = 0.0f;
+
+    srand(1234);
+    for (int n = 0; n < 256; n++) {
+        input[n] = (float)rand() / RAND_MAX - 0.5f;
+    }
+
+    /* gyro and accel, two second order low pass sections each */
+    biquad_lowpass(&coeffs[0], 80.0f / SAMPLE_RATE, M_SQRT1_2);
+    biquad_lowpass(&coeffs[1], 80.0f / SAMPLE_RATE, M_SQRT1_2);
+    InitButterWorthDF2Filter(80.0f / SAMPLE_RATE, &butterworth);
+    ASSERT_EQ(0, biquad_bank_init(&bank, BIQUAD_BANK_MAX_CHANNELS, 2, coeffs));
+
+    uint64_t start = now_ns();
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for (int c = 0; c < BIQUAD_BANK_MAX_CHANNELS; c++) {
+            float x = input[(frame + c) & 255];
+            x    = FilterButterWorthDF2(x, &butterworth, &wn1[c][0], &wn2[c][0]);
+            sink = FilterButterWorthDF2(x, &butterworth, &wn1[c][1], &wn2[c][1]);
+        }
+    }
+    uint64_t scalar = now_ns() - start;
+
+    start = now_ns();
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for (int c = 0; c < BIQUAD_BANK_MAX_CHANNELS; c++) {
+            samples[c] = input[(frame + c) & 255];
+        }
+        biquad_bank_apply(&bank, samples);
+        sink = samples[0];
+    }
+    uint64_t batched = now_ns() - start;
+
+    printf("%d channels x 2 sections: FilterButterWorthDF2 %.1f ns per frame, biquad_bank_apply %.1f ns per frame\n",
+           BIQUAD_BANK_MAX_CHANNELS, (double)scalar / BENCHMARK_FRAMES, (double)batched / BENCHMARK_FRAMES);
+    (void)sink;
+}
@@ -4,6 +4,8 @@
 #include <stdio.h> /* printf */
 #include <stdlib.h> /* abort */
 #include <string.h> /* memset */
+#include <math.h> /* sin */
+#include "ut_clock.h" /* now_ns */
 
 extern "C" {
 #include <inc/CoordinateConversions.h>
@@ -14,6 +16,40 @@ extern "C" {
 #define epsilon_metric     0.2f
 #define epsilon_int_metric ((int32_t)(epsilon_metric * 1e4))
 
+#define LTP_POINTS         1000
+
+/* NED of a point relative to home, straight from the ECEF definition in double precision */
+static void reference_ned(const int32_t home[3], const int32_t LLAi[3], double NED[3])
+{
+    const double a = 6378137.0, esq = 8.1819190842622e-2 * 8.1819190842622e-2;
+    double ecef[2][3];
+    const int32_t *lla[2] = { home, LLAi };
+
+    for (int i = 0; i < 2; i++) {
+        double lat = lla[i][0] * 1e-7 * M_PI / 180.0, lon = lla[i][1] * 1e-7 * M_PI / 180.0, alt = lla[i][2] * 1e-4;
+        double N   = a / sqrt(1.0 - esq * sin(lat) * sin(lat));
+        ecef[i][0] = (N + alt) * cos(lat) * cos(lon);
+        ecef[i][1] = (N + alt) * cos(lat) * sin(lon);
+        ecef[i][2] = ((1.0 - esq) * N + alt) * sin(lat);
+    }
+    double lat = home[0] * 1e-7 * M_PI / 180.0, lon = home[1] * 1e-7 * M_PI / 180.0;
+    double d[3] = { ecef[1][0] - ecef[0][0], ecef[1][1] - ecef[0][1], ecef[1][2] - ecef[0][2] };
+    NED[0] = -sin(lat) * cos(lon) * d[0] - sin(lat) * sin(lon) * d[1] + cos(lat) * d[2];
+    NED[1] = -sin(lon) * d[0] + cos(lon) * d[1];
+    NED[2] = -cos(lat) * cos(lon) * d[0] - cos(lat) * sin(lon) * d[1] - sin(lat) * d[2];
+}
+
+/* random points up to about 100 km from home and 2000 m above it */
+static void random_points(const int32_t home[3], int32_t LLAi[][3], int count)
+{
+    srand(1234);
+    for (int i = 0; i < count; i++) {
+        LLAi[i][0] = home[0] + (rand() % 18000000) - 9000000;
+        LLAi[i][1] = home[1] + (rand() % 18000000) - 9000000;
+        LLAi[i][2] = home[2] + (rand() % 20000000);
+    }
+}
+
 // To use a test fixture, derive a class from testing::Test.
 class CoordinateConversionsTestRaw : public testing::Test {};
 
@@ -80,3 +116,112 @@ TEST_F(CoordinateConversionsTestRaw, LLA2NED) {
     EXPECT_NEAR(LLAi[1], LLAfromNED[1], epsilon_int_deg);
     EXPECT_NEAR(LLAi[2], LLAfromNED[2], epsilon_int_metric);
 }
+
+TEST_F(CoordinateConversionsTestRaw, LTPFrameRebuild) {
+    int32_t HomeLLAi[3] = { 419291600, 125571300, 240000 };
+    struct ltp_frame ltp;
+
+    memset(&ltp, 0, sizeof(ltp));
+    EXPECT_EQ(1, LTPFrameFromLLA(HomeLLAi, &ltp));
+    EXPECT_EQ(0, LTPFrameFromLLA(HomeLLAi, &ltp));
+    HomeLLAi[2] += 1;
+    EXPECT_EQ(1, LTPFrameFromLLA(HomeLLAi, &ltp));
+}
+
+TEST_F(CoordinateConversionsTestRaw, LTPMatchesReference) {
+    static int32_t LLAi[LTP_POINTS][3];
+    static float NED[LTP_POINTS][3];
+    const int32_t HomeLLAi[3] = { 419291600, 125571300, 240000 };
+    struct ltp_frame ltp;
+    float Rne[3][3];
+    float baseECEF[3];
+    double ltp_error = 0.0, base_error = 0.0;
+
+    memset(&ltp, 0, sizeof(ltp));
+    LTPFrameFromLLA(HomeLLAi, &ltp);
+    RneFromLLA(HomeLLAi, Rne);
+    LLA2ECEF(HomeLLAi, baseECEF);
+
+    random_points(HomeLLAi, LLAi, LTP_POINTS);
+    LLA2LTP(&ltp, LLAi, NED, LTP_POINTS);
+
+    for (int i = 0; i < LTP_POINTS; i++) {
+        double expected[3];
+        float base[3];
+
+        reference_ned(HomeLLAi, LLAi[i], expected);
+        LLA2Base(LLAi[i], baseECEF, Rne, base);
+        for (int k = 0; k < 3; k++) {
+            /* float output, a relative error of about 1e-7 of the distance is rounding */
+            ltp_error  = fmax(ltp_error, fabs(NED[i][k] - expected[k]));
+            base_error = fmax(base_error, fabs(base[k] - expected[k]));
+        }
+    }
+    printf("within 100 km of home: LLA2LTP largest error %.4f m, LLA2Base %.4f m\n", ltp_error, base_error);
+    EXPECT_LT(ltp_error, 0.02);
+}
+
+TEST_F(CoordinateConversionsTestRaw, LTPRoundTrip) {
+    static int32_t LLAi[LTP_POINTS][3];
+    static int32_t LLAback[LTP_POINTS][3];
+    static float NED[LTP_POINTS][3];
+    const int32_t HomeLLAi[3] = { -338688000, 1512093000, 500000 };
+    struct ltp_frame ltp;
+
+    memset(&ltp, 0, sizeof(ltp));
+    LTPFrameFromLLA(HomeLLAi, &ltp);
+    random_points(HomeLLAi, LLAi, LTP_POINTS);
+    LLA2LTP(&ltp, LLAi, NED, LTP_POINTS);
+    LTP2LLA(&ltp, NED, LLAback, LTP_POINTS);
+
+    for (int i = 0; i < LTP_POINTS; i++) {
+        /* 1e-7 degree is about 1 cm, the float NED limits this to a few of them */
+        EXPECT_NEAR(LLAi[i][0], LLAback[i][0], 3) << i;
+        EXPECT_NEAR(LLAi[i][1], LLAback[i][1], 3) << i;
+        EXPECT_NEAR(LLAi[i][2], LLAback[i][2], 200) << i;
+    }
+}
+
+TEST_F(CoordinateConversionsTestRaw, LTPDateLine) {
+    const int32_t HomeLLAi[3] = { -170000000, 1799990000, 0 };
+    int32_t LLAi[1][3] = { { -170000000, -1799990000, 0 } };
+    int32_t LLAback[1][3];
+    float NED[1][3];
+    struct ltp_frame ltp;
+
+    memset(&ltp, 0, sizeof(ltp));
+    LTPFrameFromLLA(HomeLLAi, &ltp);
+    LLA2LTP(&ltp, LLAi, NED, 1);
+    /* 0.002 degree east across the date line */
+    EXPECT_NEAR(0.0f, NED[0][0], 0.1f);
+    EXPECT_NEAR(213.0f, NED[0][1], 1.0f);
+    LTP2LLA(&ltp, NED, LLAback, 1);
+    EXPECT_NEAR(LLAi[0][1], LLAback[0][1], 3);
+}
+
+TEST_F(CoordinateConversionsTestRaw, LTPBenchmark) {
+    static int32_t LLAi[LTP_POINTS][3];
+    static float NED[LTP_POINTS][3];
+    const int32_t HomeLLAi[3] = { 419291600, 125571300, 240000 };
+    struct ltp_frame ltp;
+    float Rne[3][3];
+    float baseECEF[3];
+
+    random_points(HomeLLAi, LLAi, LTP_POINTS);
+
+    uint64_t start = now_ns();
+    RneFromLLA(HomeLLAi, Rne);
+    LLA2ECEF(HomeLLAi, baseECEF);
+    for (int i = 0; i < LTP_POINTS; i++) {
+        LLA2Base(LLAi[i], baseECEF, Rne, NED[i]);
+    }
+    uint64_t base = now_ns() - start;
+
+    start = now_ns();
+    memset(&ltp, 0, sizeof(ltp));
+    LTPFrameFromLLA(HomeLLAi, &ltp);
+    LLA2LTP(&ltp, LLAi, NED, LTP_POINTS);
+    uint64_t batched = now_ns() - start;
+
+    printf("LLA2Base %.1f ns, LLA2LTP %.1f ns per point\n", (double)base / LTP_POINTS, (double)batched / LTP_POINTS);
+}
@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <math.h> /* atan2f */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "fastmath.h"
+}
+
+#define STEPS           1000000
+#define BENCHMARK_CALLS 1000000
+
+/* the reference values are computed in double precision */
+
+// To use a test fixture, derive a class from testing::Test.
+class FastMathTest : public testing::Test {};
+
+TEST_F(FastMathTest, InvSqrt) {
+    double max_error = 0.0;
+
+    /* 1e-30 to 1e30, evenly spaced in the exponent */
+    for (int i = 0; i <= STEPS; i++) {
+        float x = powf(10.0f, -30.0f + 60.0f * i / STEPS);
+        double expected = 1.0 / sqrt((double)x);
+
+        max_error = fmax(max_error, fabs(fast_invsqrtf(x) - expected) / expected);
+        max_error = fmax(max_error, fabs(fast_sqrtf(x) - 1.0 / expected) * expected);
+    }
+    printf("fast_invsqrtf, fast_sqrtf: largest relative error %g\n", max_error);
+    EXPECT_LT(max_error, FASTMATH_INVSQRT_MAX_REL_ERROR);
+    EXPECT_EQ(0.0f, fast_sqrtf(0.0f));
+    EXPECT_EQ(0.0f, fast_sqrtf(-1.0f));
+}
+
+TEST_F(FastMathTest, Atan) {
+    double max_error = 0.0;
+
+    for (int i = 0; i <= STEPS; i++) {
+        float x = -1000.0f + 2000.0f * i / STEPS;
+        max_error = fmax(max_error, fabs(fast_atanf(x) - atan((double)x)));
+    }
+    printf("fast_atanf: largest error %g\n", max_error);
+    EXPECT_LT(max_error, FASTMATH_ATAN_MAX_ERROR);
+}
+
+TEST_F(FastMathTest, Atan2) {
+    double max_error = 0.0;
+
+    /* all around the circle at several radii */
+    for (int i = 0; i <= STEPS; i++) {
+        double angle = -M_PI + 2.0 * M_PI * i / STEPS;
+        float radius = powf(10.0f, (float)(i % 9) - 4.0f);
+        float y = radius * sin(angle);
+        float x = radius * cos(angle);
+        double error = fabs(fast_atan2f(y, x) - atan2((double)y, (double)x));
+
+        /* -pi and pi are the same angle */
+        max_error = fmax(max_error, fmin(error, 2.0 * M_PI - error));
+    }
+    printf("fast_atan2f: largest error %g\n", max_error);
+    EXPECT_LT(max_error, FASTMATH_ATAN_MAX_ERROR);
+    EXPECT_EQ(0.0f, fast_atan2f(0.0f, 0.0f));
+    EXPECT_NEAR(M_PI, fast_atan2f(0.0f, -1.0f), FASTMATH_ATAN_MAX_ERROR);
+    EXPECT_NEAR(-M_PI_2, fast_atan2f(-1.0f, 0.0f), FASTMATH_ATAN_MAX_ERROR);
+}
+
+TEST_F(FastMathTest, Asin) {
+    double max_error = 0.0;
+
+    for (int i = 0; i <= STEPS; i++) {
+        float x = -1.0f + 2.0f * i / STEPS;
+        max_error = fmax(max_error, fabs(fast_asinf(x) - asin((double)x)));
+        max_error = fmax(max_error, fabs(fast_acosf(x) - acos((double)x)));
+    }
+    printf("fast_asinf, fast_acosf: largest error %g\n", max_error);
+    EXPECT_LT(max_error, FASTMATH_ASIN_MAX_ERROR);
+    /* slightly out of range from rounding is clamped instead of NaN */
+    EXPECT_NEAR(M_PI_2, fast_asinf(1.000001f), FASTMATH_ASIN_MAX_ERROR);
+    EXPECT_NEAR(-M_PI_2, fast_asinf(-1.000001f), FASTMATH_ASIN_MAX_ERROR);
+}
+
+TEST_F(FastMathTest, SinCos) {
+    double max_error = 0.0;
+
+    for (int i = 0; i <= STEPS; i++) {
+        float x = -100.0 * M_PI + 200.0 * M_PI * i / STEPS;
+        max_error = fmax(max_error, fabs(fast_sinf(x) - sin((double)x)));
+        max_error = fmax(max_error, fabs(fast_cosf(x) - cos((double)x)));
+    }
+    printf("fast_sinf, fast_cosf: largest error %g\n", max_error);
+    EXPECT_LT(max_error, FASTMATH_SIN_MAX_ERROR);
+}
+
+TEST_F(FastMathTest, Benchmark) {
+    volatile float sink = 0.0f;
+    float sum = 0.0f;
+
+    uint64_t start = now_ns();
+    for (int i = 0; i < BENCHMARK_CALLS; i++) {
+        float x = 1.0f + i * 1e-6f;
+        sum += atan2f(x, 1.5f - x) + asinf(x - 1.0f) + 1.0f / sqrtf(x);
+    }
+    uint64_t libm = now_ns() - start;
+    sink = sum;
+
+    sum   = 0.0f;
+    start = now_ns();
+    for (int i = 0; i < BENCHMARK_CALLS; i++) {
+        float x = 1.0f + i * 1e-6f;
+        sum += fast_atan2f(x, 1.5f - x) + fast_asinf(x - 1.0f) + fast_invsqrtf(x);
+    }
+    uint64_t fast = now_ns() - start;
+    sink = sum;
+
+    printf("atan2f + asinf + 1/sqrtf: libm %.1f ns, fastmath %.1f ns per call\n",
+           (double)libm / BENCHMARK_CALLS, (double)fast / BENCHMARK_CALLS);
+    (void)sink;
+}
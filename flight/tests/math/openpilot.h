@@ -0,0 +1,13 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pios_math.h>
+
+#define pios_malloc(size) malloc(size)
+#define vPortFree(ptr)    free(ptr)
+
+#endif /* OPENPILOT_H */
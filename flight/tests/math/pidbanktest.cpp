@@ -0,0 +1,150 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <string.h> /* memset */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "pid.h"
+}
+
+#define AXES             3
+#define STEPS            2000
+#define BENCHMARK_ROUNDS 200000
+
+static float random_float(float min, float max)
+{
+    return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class PidBankTest : public testing::Test {
+protected:
+    struct pid pids[AXES];
+    struct pid_bank bank;
+    pid_bank_scaler bank_scaler;
+
+    virtual void SetUp()
+    {
+        srand(1234);
+        pid_configure_derivative(20.0f, 1.0f);
+        memset(&bank, 0, sizeof(bank));
+        memset(&bank_scaler, 0, sizeof(bank_scaler));
+        for (int t = 0; t < AXES; t++) {
+            memset(&pids[t], 0, sizeof(pids[t]));
+            configure(t, random_float(0.001f, 0.01f), random_float(0.0f, 0.02f), random_float(0.0f, 0.0001f), random_float(0.1f, 0.5f));
+        }
+        pid_bank_zero(&bank);
+    }
+
+    void configure(int t, float p, float i, float d, float iLim)
+    {
+        pid_configure(&pids[t], p, i, d, iLim);
+        pid_bank_configure(&bank, t, p, i, d, iLim);
+    }
+
+    // runs both implementations on the same random inputs, the results must be bit identical
+    void compare(uint8_t active, float dT, bool meas_based_d_term)
+    {
+        float setpoint[PID_BANK_LOOPS] = { 0 };
+        float measured[PID_BANK_LOOPS] = { 0 };
+        float output[PID_BANK_LOOPS]   = { 0 };
+
+        for (int step = 0; step < STEPS; step++) {
+            for (int t = 0; t < AXES; t++) {
+                setpoint[t] = random_float(-300.0f, 300.0f);
+                measured[t] = random_float(-300.0f, 300.0f);
+                bank_scaler.p[t] = random_float(0.5f, 1.5f);
+                bank_scaler.i[t] = random_float(0.0f, 1.5f);
+                bank_scaler.d[t] = random_float(0.5f, 1.5f);
+            }
+            pid_bank_apply_setpoint(&bank, &bank_scaler, setpoint, measured, output, active, dT, meas_based_d_term);
+            for (int t = 0; t < AXES; t++) {
+                if (!(active & (1 << t))) {
+                    continue;
+                }
+                const pid_scaler scaler = { bank_scaler.p[t], bank_scaler.i[t], bank_scaler.d[t] };
+                float expected = pid_apply_setpoint(&pids[t], &scaler, setpoint[t], measured[t], dT, meas_based_d_term);
+                ASSERT_EQ(expected, output[t]) << "axis " << t << " step " << step;
+                ASSERT_EQ(pids[t].iAccumulator, bank.iAccumulator[t]);
+                ASSERT_EQ(pids[t].lastErr, bank.lastErr[t]);
+                ASSERT_EQ(pids[t].lastDer, bank.lastDer[t]);
+            }
+        }
+    }
+};
+
+TEST_F(PidBankTest, MatchesPidApplySetpoint) {
+    compare(0x7, 0.002f, false);
+}
+
+TEST_F(PidBankTest, MatchesPidApplySetpointMeasuredDerivative) {
+    pid_configure_derivative(35.0f, 0.5f);
+    compare(0x7, 0.0025f, true);
+}
+
+TEST_F(PidBankTest, MatchesPidApplySetpointWithoutDerivative) {
+    configure(1, 0.005f, 0.01f, 0.0f, 0.3f);
+    compare(0x7, 0.002f, false);
+    compare(0x7, 0.0f, false);
+}
+
+TEST_F(PidBankTest, InactiveLoopsUnchanged) {
+    float setpoint[PID_BANK_LOOPS] = { 100.0f, 100.0f, 100.0f };
+    float measured[PID_BANK_LOOPS] = { 0 };
+    float output[PID_BANK_LOOPS]   = { -1.0f, -1.0f, -1.0f };
+
+    for (int t = 0; t < PID_BANK_LOOPS; t++) {
+        bank_scaler.p[t] = bank_scaler.i[t] = bank_scaler.d[t] = 1.0f;
+    }
+    pid_bank_apply_setpoint(&bank, &bank_scaler, setpoint, measured, output, 0x5, 0.002f, false);
+
+    EXPECT_NE(-1.0f, output[0]);
+    EXPECT_EQ(-1.0f, output[1]);
+    EXPECT_NE(-1.0f, output[2]);
+    EXPECT_EQ(0.0f, bank.iAccumulator[1]);
+    EXPECT_EQ(0.0f, bank.lastErr[1]);
+    EXPECT_EQ(0.0f, bank.lastDer[1]);
+
+    // with the unchanged state the loop then matches one that has never been skipped
+    compare(0x2, 0.002f, false);
+}
+
+TEST_F(PidBankTest, Benchmark) {
+    float setpoint[PID_BANK_LOOPS] = { 0 };
+    float measured[PID_BANK_LOOPS] = { 0 };
+    float output[PID_BANK_LOOPS]   = { 0 };
+    pid_scaler scalers[AXES];
+    volatile float sink = 0.0f;
+
+    for (int t = 0; t < AXES; t++) {
+        setpoint[t] = random_float(-300.0f, 300.0f);
+        measured[t] = random_float(-300.0f, 300.0f);
+        bank_scaler.p[t] = bank_scaler.i[t] = bank_scaler.d[t] = 1.0f;
+        scalers[t].p     = scalers[t].i = scalers[t].d = 1.0f;
+    }
+
+    uint64_t start = now_ns();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+        for (int t = 0; t < AXES; t++) {
+            measured[t] = -measured[t];
+            sink += pid_apply_setpoint(&pids[t], &scalers[t], setpoint[t], measured[t], 0.002f, false);
+        }
+    }
+    uint64_t scalar = now_ns() - start;
+
+    start = now_ns();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+        for (int t = 0; t < AXES; t++) {
+            measured[t] = -measured[t];
+        }
+        pid_bank_apply_setpoint(&bank, &bank_scaler, setpoint, measured, output, 0x7, 0.002f, false);
+        sink += output[0] + output[1] + output[2];
+    }
+    uint64_t batched = now_ns() - start;
+
+    printf("pid_apply_setpoint x%d: %.1f ns per update, pid_bank_apply_setpoint: %.1f ns per update\n",
+           AXES, (double)scalar / BENCHMARK_ROUNDS, (double)batched / BENCHMARK_ROUNDS);
+    (void)sink;
+}
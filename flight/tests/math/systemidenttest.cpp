@@ -0,0 +1,195 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <string.h> /* memset */
+#include <math.h> /* expf */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "systemident.h"
+#include "pios_math.h"
+}
+
+#define SAMPLE_RATE    500.0f
+#define IDENT_SECONDS  60
+#define PLANT_SUBSTEPS 10
+
+static const float defaultBeta[3] = { 10.0f, 10.0f, 7.0f };
+static const float defaultTau     = -4.0f;
+
+/* zero mean gaussian noise */
+static float gauss(float sigma)
+{
+    float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f);
+    float u2 = (rand() + 1.0f) / (RAND_MAX + 2.0f);
+
+    return sigma * sqrtf(-2.0f * logf(u1)) * cosf(2.0f * M_PI_F * u2);
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class SystemIdentTest : public testing::Test {
+protected:
+    struct systemident_pid_settings settings;
+
+    virtual void SetUp()
+    {
+        // SystemIdentSettings and StabilizationSettingsBank defaults
+        memset(&settings, 0, sizeof(settings));
+        settings.dampMin      = 90;
+        settings.dampRate     = 110;
+        settings.dampMax      = 150;
+        settings.noiseMin     = 6;
+        settings.noiseRate    = 10;
+        settings.noiseMax     = 16;
+        settings.calculateYaw = SYSTEMIDENT_CALCULATEYAW_LIMITTORATIO;
+        settings.yawToRollPitchPIDRatioMin = 1.0f;
+        settings.yawToRollPitchPIDRatioMax = 2.5f;
+        settings.derivativeFactor     = 1.0f;
+        settings.outerLoopKpSoftClamp = 6.5f;
+        settings.gyroReadTimeAverage  = 0.001f;
+        settings.maximumRate[0]       = 300;
+        settings.maximumRate[1]       = 300;
+        srand(1234);
+    }
+};
+
+TEST_F(SystemIdentTest, Check) {
+    const float lowPitch[3] = { 10.0f, 5.0f, 7.0f };
+    const float nanBeta[3]  = { 10.0f, NAN, 7.0f };
+
+    EXPECT_EQ(0, systemident_check(defaultTau, defaultBeta, 0.001f, SAMPLE_RATE));
+    EXPECT_EQ(SYSTEMIDENT_PITCH_BETA_LOW, systemident_check(defaultTau, lowPitch, 0.001f, SAMPLE_RATE));
+    EXPECT_EQ(SYSTEMIDENT_BETA_NAN, systemident_check(defaultTau, nanBeta, 0.001f, SAMPLE_RATE));
+    EXPECT_EQ(SYSTEMIDENT_TAU_NAN, systemident_check(NAN, defaultBeta, 0.001f, SAMPLE_RATE) & SYSTEMIDENT_TAU_NAN);
+    EXPECT_EQ(SYSTEMIDENT_TAU_TOO_LONG, systemident_check(logf(0.2f), defaultBeta, 0.001f, SAMPLE_RATE));
+    EXPECT_EQ(SYSTEMIDENT_TAU_TOO_SHORT, systemident_check(logf(0.005f), defaultBeta, 0.001f, SAMPLE_RATE));
+    EXPECT_EQ(SYSTEMIDENT_CPU_TOO_SLOW, systemident_check(defaultTau, defaultBeta, 0.003f, SAMPLE_RATE));
+}
+
+TEST_F(SystemIdentTest, SmoothQuickEndpoints) {
+    struct systemident_pids pids, expected;
+    struct systemident_pid_settings endpoint = settings;
+
+    // -1 is the smoothest damp and noise, +1 the quickest
+    settings.smoothQuickValue = -1.0f;
+    endpoint.dampRate  = settings.dampMax;
+    endpoint.noiseRate = settings.noiseMin;
+    systemident_compute_pids(defaultTau, defaultBeta, &settings, &pids);
+    systemident_compute_pids(defaultTau, defaultBeta, &endpoint, &expected);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(expected.rate[i][j], pids.rate[i][j]);
+        }
+    }
+
+    settings.smoothQuickValue = 1.0f;
+    endpoint.dampRate  = settings.dampMin;
+    endpoint.noiseRate = settings.noiseMax;
+    systemident_compute_pids(defaultTau, defaultBeta, &settings, &pids);
+    systemident_compute_pids(defaultTau, defaultBeta, &endpoint, &expected);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(expected.rate[i][j], pids.rate[i][j]);
+        }
+    }
+
+    // quicker means more gain
+    float kp = 0.0f;
+    for (float v = -1.0f; v <= 1.0f; v += 0.25f) {
+        settings.smoothQuickValue = v;
+        systemident_compute_pids(defaultTau, defaultBeta, &settings, &pids);
+        EXPECT_GT(pids.rate[0][0], kp) << "smooth quick " << v;
+        kp = pids.rate[0][0];
+    }
+}
+
+TEST_F(SystemIdentTest, Axes) {
+    struct systemident_pids pids;
+
+    // roll and pitch PIDs are inversely proportional to the gain
+    const float beta[3] = { 10.0f, 10.0f + logf(2.0f), 7.0f };
+
+    EXPECT_EQ(3, systemident_compute_pids(defaultTau, beta, &settings, &pids));
+    EXPECT_NEAR(pids.rate[0][0], 2.0f * pids.rate[1][0], 1e-6f);
+    EXPECT_NEAR(pids.rate[0][1], 2.0f * pids.rate[1][1], 1e-6f);
+    EXPECT_NEAR(pids.rate[0][2], 2.0f * pids.rate[1][2], 1e-8f);
+
+    // yaw is limited to a ratio of the largest roll and pitch kp
+    EXPECT_GE(pids.rate[2][0], pids.rate[0][0] * settings.yawToRollPitchPIDRatioMin * 0.9999f);
+    EXPECT_LE(pids.rate[2][0], pids.rate[0][0] * settings.yawToRollPitchPIDRatioMax * 1.0001f);
+
+    // a weak yaw hits the limit unless it is ignored
+    const float weakYaw[3] = { 10.0f, 10.0f, 3.0f };
+    systemident_compute_pids(defaultTau, weakYaw, &settings, &pids);
+    EXPECT_FLOAT_EQ(pids.rate[0][0] * settings.yawToRollPitchPIDRatioMax, pids.rate[2][0]);
+    settings.calculateYaw = SYSTEMIDENT_CALCULATEYAW_IGNORELIMIT;
+    systemident_compute_pids(defaultTau, weakYaw, &settings, &pids);
+    EXPECT_GT(pids.rate[2][0], pids.rate[0][0] * settings.yawToRollPitchPIDRatioMax);
+
+    // yaw is left alone when it is not calculated
+    settings.calculateYaw = SYSTEMIDENT_CALCULATEYAW_FALSE;
+    pids.rate[2][0] = pids.rate[2][1] = pids.rate[2][2] = -1.0f;
+    EXPECT_EQ(2, systemident_compute_pids(defaultTau, defaultBeta, &settings, &pids));
+    EXPECT_EQ(-1.0f, pids.rate[2][0]);
+
+    // no derivative reduces kp and ki the Ziegler-Nichols way
+    struct systemident_pids full;
+    settings.derivativeFactor = 1.0f;
+    systemident_compute_pids(defaultTau, defaultBeta, &settings, &full);
+    settings.derivativeFactor = 0.0f;
+    systemident_compute_pids(defaultTau, defaultBeta, &settings, &pids);
+    EXPECT_EQ(0.0f, pids.rate[0][2]);
+    EXPECT_FLOAT_EQ(full.rate[0][0] * 0.45f / 0.60f, pids.rate[0][0]);
+    EXPECT_FLOAT_EQ(full.rate[0][1] * 1.2f / 2.0f, pids.rate[0][1]);
+}
+
+TEST_F(SystemIdentTest, IdentifiesPlant) {
+    // each axis: the torque follows 4 * throttle * u with time constant e^tau,
+    // the rate is the integral of the torque times e^beta
+    const float beta[3] = { 9.0f, 9.5f, 7.5f };
+    const float tau     = logf(0.03f);
+    const float throttle = 0.5f;
+    const float dT_s     = 1.0f / SAMPLE_RATE;
+    float w[3]  = { 0.0f, 0.0f, 0.0f };
+    float ud[3] = { 0.0f, 0.0f, 0.0f };
+    float excitation[3] = { 0.0f, 0.0f, 0.0f };
+    struct systemident si;
+    uint64_t elapsed = 0;
+
+    systemident_init(&si, defaultBeta, defaultTau);
+    for (int n = 0; n < IDENT_SECONDS * (int)SAMPLE_RATE; n++) {
+        float u[3], gyro[3];
+
+        if (n % 50 == 0) {
+            for (int j = 0; j < 3; j++) {
+                excitation[j] = (rand() & 1) ? 0.03f : -0.03f;
+            }
+        }
+        for (int j = 0; j < 3; j++) {
+            // a weak rate loop keeps the plant from drifting away
+            u[j] = excitation[j] - 0.0004f * w[j];
+            for (int k = 0; k < PLANT_SUBSTEPS; k++) {
+                ud[j] += dT_s / PLANT_SUBSTEPS * (4.0f * throttle * u[j] - ud[j]) / expf(tau);
+                w[j]  += dT_s / PLANT_SUBSTEPS * expf(beta[j]) * ud[j];
+            }
+            gyro[j] = w[j] + gauss(2.0f);
+        }
+
+        uint64_t start = now_ns();
+        systemident_predict(&si, u, gyro, throttle, dT_s);
+        elapsed += now_ns() - start;
+    }
+
+    EXPECT_EQ((uint32_t)(IDENT_SECONDS * SAMPLE_RATE), si.predicts);
+    EXPECT_NEAR(throttle, systemident_hover_throttle(&si), 0.001f);
+    for (int j = 0; j < 3; j++) {
+        EXPECT_NEAR(beta[j], si.X[6 + j], 0.2f) << "axis " << j;
+        EXPECT_GT(si.noise[j], 0.0f);
+    }
+    EXPECT_NEAR(expf(tau), expf(si.X[9]), 0.008f);
+    EXPECT_EQ(0, systemident_check(si.X[9], &si.X[6], settings.gyroReadTimeAverage, SAMPLE_RATE));
+
+    printf("identified tau %.1f ms beta %.2f %.2f %.2f, %.0f ns per sample\n", expf(si.X[9]) * 1000.0f,
+           si.X[6], si.X[7], si.X[8], (double)elapsed / si.predicts);
+}
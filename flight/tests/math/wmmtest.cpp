@@ -0,0 +1,206 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <math.h> /* sqrtf */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "WorldMagModel.h"
+}
+
+#define MONTH             5
+#define DAY               5
+#define YEAR              2017
+#define GRID_SAMPLES      2000
+#define BENCHMARK_CALLS   2000
+
+static float norm(const float B[3])
+{
+    return sqrtf(B[0] * B[0] + B[1] * B[1] + B[2] * B[2]);
+}
+
+static float random_range(float min, float max)
+{
+    return min + (max - min) * ((float)rand() / RAND_MAX);
+}
+
+/* evaluate far away first, so none of the cached terms is reused */
+static void fresh_mag_vector(float lat, float lon, float alt, float B[3])
+{
+    float far[3];
+
+    ASSERT_EQ(0, WMM_GetMagVector(lat > 0.0f ? lat - 45.0f : lat + 45.0f, lon > 0.0f ? lon - 90.0f : lon + 90.0f, alt, MONTH, DAY, YEAR, far));
+    ASSERT_EQ(0, WMM_GetMagVector(lat, lon, alt, MONTH, DAY, YEAR, B));
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class WMMTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        WMM_KeepCache(true);
+    }
+
+    virtual void TearDown()
+    {
+        WMM_KeepCache(false);
+    }
+};
+
+TEST_F(WMMTest, InvalidInput) {
+    float B[3];
+
+    EXPECT_GT(0, WMM_GetMagVector(91.0f, 0.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVector(0.0f, 181.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVector(0.0f, 0.0f, 0.0f, 13, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVector(-91.0f, 0.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVector(0.0f, -181.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVector(0.0f, 0.0f, 0.0f, 2, 30, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVectorApprox(-91.0f, 0.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVectorApprox(0.0f, -181.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(0, WMM_GetMagVectorApprox(0.0f, 0.0f, 0.0f, 2, 30, YEAR, B));
+}
+
+TEST_F(WMMTest, FieldStrength) {
+    float B[3];
+
+    srand(1234);
+    for (int i = 0; i < 200; i++) {
+        float lat = random_range(-90.0f, 90.0f);
+        float lon = random_range(-180.0f, 180.0f);
+
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon, 0.0f, MONTH, DAY, YEAR, B));
+        /* the field at sea level is between about 22000 and 67000 nT, B is in units of 100 nT */
+        EXPECT_GT(norm(B), 200.0f) << lat << " " << lon;
+        EXPECT_LT(norm(B), 700.0f) << lat << " " << lon;
+    }
+
+    /* Iceland, mostly pointing down and north */
+    ASSERT_EQ(0, WMM_GetMagVector(65.0f, -20.0f, 0.0f, MONTH, DAY, YEAR, B));
+    EXPECT_GT(B[0], 0.0f);
+    EXPECT_GT(B[2], 4.0f * B[0]);
+}
+
+TEST_F(WMMTest, RepeatedCallsIdentical) {
+    float first[3], second[3];
+
+    fresh_mag_vector(47.3f, 8.5f, 500.0f, first);
+    ASSERT_EQ(0, WMM_GetMagVector(47.3f, 8.5f, 500.0f, MONTH, DAY, YEAR, second));
+    EXPECT_EQ(first[0], second[0]);
+    EXPECT_EQ(first[1], second[1]);
+    EXPECT_EQ(first[2], second[2]);
+}
+
+TEST_F(WMMTest, SmallMoveMatchesFresh) {
+    float cached[3], fresh[3];
+
+    srand(1234);
+    for (int i = 0; i < 100; i++) {
+        float lat = random_range(-80.0f, 80.0f);
+        float lon = random_range(-179.0f, 179.0f);
+        float dlat = random_range(-0.0009f, 0.0009f);
+        float dlon = random_range(-0.0009f, 0.0009f);
+
+        fresh_mag_vector(lat, lon, 0.0f, fresh);
+        /* the move is within the tolerance, the Legendre and longitude terms are reused */
+        ASSERT_EQ(0, WMM_GetMagVector(lat + dlat, lon + dlon, 0.0f, MONTH, DAY, YEAR, cached));
+        fresh_mag_vector(lat + dlat, lon + dlon, 0.0f, fresh);
+        for (int k = 0; k < 3; k++) {
+            EXPECT_NEAR(fresh[k], cached[k], 1e-3f * norm(fresh)) << lat << " " << lon;
+        }
+    }
+}
+
+TEST_F(WMMTest, CacheFreedMatchesKept) {
+    float kept[3], freed[3];
+
+    srand(1234);
+    for (int i = 0; i < 100; i++) {
+        float lat = random_range(-90.0f, 90.0f);
+        float lon = random_range(-180.0f, 180.0f);
+
+        fresh_mag_vector(lat, lon, 0.0f, kept);
+        /* without the kept cache every call starts from scratch */
+        WMM_KeepCache(false);
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon, 0.0f, MONTH, DAY, YEAR, freed));
+        WMM_KeepCache(true);
+        EXPECT_EQ(kept[0], freed[0]);
+        EXPECT_EQ(kept[1], freed[1]);
+        EXPECT_EQ(kept[2], freed[2]);
+    }
+}
+
+TEST_F(WMMTest, GridInterpolation) {
+    float approx[3], exact[3];
+    float max_error = 0.0f;
+
+    srand(1234);
+    for (int i = 0; i < GRID_SAMPLES; i++) {
+        float lat = random_range(-80.0f, 80.0f);
+        float lon = random_range(-180.0f, 180.0f);
+
+        ASSERT_EQ(0, WMM_GetMagVectorApprox(lat, lon, 100.0f, MONTH, DAY, YEAR, approx));
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon, 100.0f, MONTH, DAY, YEAR, exact));
+        for (int k = 0; k < 3; k++) {
+            float error = fabsf(approx[k] - exact[k]) / norm(exact);
+            if (error > max_error) {
+                max_error = error;
+            }
+        }
+    }
+    printf("1 degree grid: largest error %.5f of the field strength\n", max_error);
+    EXPECT_LT(max_error, 1e-3f);
+
+    /* the cells at the date line and the pole */
+    ASSERT_EQ(0, WMM_GetMagVectorApprox(10.0f, 179.5f, 0.0f, MONTH, DAY, YEAR, approx));
+    ASSERT_EQ(0, WMM_GetMagVector(10.0f, 179.5f, 0.0f, MONTH, DAY, YEAR, exact));
+    EXPECT_NEAR(exact[0], approx[0], 1e-2f * norm(exact));
+    ASSERT_EQ(0, WMM_GetMagVectorApprox(90.0f, 0.0f, 0.0f, MONTH, DAY, YEAR, approx));
+    ASSERT_EQ(0, WMM_GetMagVector(90.0f, 0.0f, 0.0f, MONTH, DAY, YEAR, exact));
+    EXPECT_NEAR(exact[2], approx[2], 1e-2f * norm(exact));
+
+    /* the grid does not depend on the kept cache */
+    WMM_KeepCache(false);
+    ASSERT_EQ(0, WMM_GetMagVectorApprox(47.3f, 8.6f, 0.0f, MONTH, DAY, YEAR, approx));
+    ASSERT_EQ(0, WMM_GetMagVector(47.3f, 8.6f, 0.0f, MONTH, DAY, YEAR, exact));
+    for (int k = 0; k < 3; k++) {
+        EXPECT_NEAR(exact[k], approx[k], 1e-3f * norm(exact));
+    }
+}
+
+TEST_F(WMMTest, Benchmark) {
+    float B[3];
+    float lat = 47.0f, lon = 8.0f;
+
+    uint64_t start = now_ns();
+    for (int i = 0; i < BENCHMARK_CALLS; i++) {
+        /* alternate far apart positions, nothing but the coefficients is reused */
+        WMM_GetMagVector((i & 1) ? lat : -lat, lon, 0.0f, MONTH, DAY, YEAR, B);
+    }
+    uint64_t full = now_ns() - start;
+
+    start = now_ns();
+    for (int i = 0; i < BENCHMARK_CALLS; i++) {
+        /* a slow flight, the position moves within the cache tolerance */
+        WMM_GetMagVector(lat + i * 1e-6f, lon, 0.0f, MONTH, DAY, YEAR, B);
+    }
+    uint64_t cached = now_ns() - start;
+
+    start = now_ns();
+    for (int i = 0; i < BENCHMARK_CALLS; i++) {
+        WMM_GetMagVectorApprox(lat + i * 1e-4f, lon, 0.0f, MONTH, DAY, YEAR, B);
+    }
+    uint64_t approx = now_ns() - start;
+
+    WMM_KeepCache(false);
+    start = now_ns();
+    for (int i = 0; i < BENCHMARK_CALLS; i++) {
+        /* without the kept cache, the cache is built and freed by every call */
+        WMM_GetMagVector(lat, lon, 0.0f, MONTH, DAY, YEAR, B);
+    }
+    uint64_t freed = now_ns() - start;
+
+    printf("WMM_GetMagVector %.0f ns, with cached terms %.0f ns, without keeping the cache %.0f ns, WMM_GetMagVectorApprox %.0f ns per call\n",
+           (double)full / BENCHMARK_CALLS, (double)cached / BENCHMARK_CALLS, (double)freed / BENCHMARK_CALLS, (double)approx / BENCHMARK_CALLS);
+}
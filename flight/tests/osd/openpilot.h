@@ -0,0 +1,28 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+/* the parts of openpilot.h used by osdgen */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "pios.h"
+#include "ut_uavobjects.h"
+
+typedef void *xTaskHandle;
+typedef void *xSemaphoreHandle;
+typedef uint32_t portTickType;
+
+#define pdTRUE           1
+#define tskIDLE_PRIORITY 0
+
+#define vSemaphoreCreateBinary(semaphore) ((semaphore) = NULL)
+extern long xSemaphoreTake(xSemaphoreHandle semaphore, portTickType ticks);
+extern long xTaskCreate(void (*code)(void *), const char *name, uint16_t stack_depth, void *parameters, unsigned long priority, xTaskHandle *handle);
+
+#define PIOS_TASK_MONITOR_RegisterTask(id, handle)
+#define MODULE_INITCALL(ifn, sfn)
+
+#endif /* OPENPILOT_H */
@@ -0,0 +1,16 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+/* the parts of pios.h used by osdgen */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "pios_math.h"
+#include "pios_video.h"
+
+extern int32_t PIOS_ADC_PinGet(uint32_t pin);
+extern void PIOS_Servo_Set(uint8_t servo, uint16_t position);
+
+#endif /* PIOS_H */
@@ -0,0 +1,10 @@
+#ifndef PIOS_SPI_PRIV_H
+#define PIOS_SPI_PRIV_H
+
+/* the video output is not simulated, see pios_stm32.h */
+
+struct pios_spi_cfg {
+    int unused;
+};
+
+#endif /* PIOS_SPI_PRIV_H */
@@ -0,0 +1,14 @@
+#ifndef PIOS_STM32_H
+#define PIOS_STM32_H
+
+/* the hardware types pios_video.h refers to, the tests draw into memory */
+
+struct pios_tim_channel {
+    void *timer;
+};
+
+typedef struct {
+    int unused;
+} TIM_OCInitTypeDef;
+
+#endif /* PIOS_STM32_H */
@@ -0,0 +1,457 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memcmp */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "openpilot.h"
+#include "osdgen.h"
+#include "attitudestate.h"
+#include "gpspositionsensor.h"
+#include "homelocation.h"
+#include "osdsettings.h"
+#include "barosensor.h"
+#include "flightstatus.h"
+#include "fonts.h"
+
+uint8_t *draw_buffer_level;
+uint8_t *draw_buffer_mask;
+uint8_t *disp_buffer_level;
+uint8_t *disp_buffer_mask;
+
+extern uint32_t osd_elements_kept;
+
+static AttitudeStateData attitude;
+static GPSPositionSensorData gps;
+static HomeLocationData home;
+static OsdSettingsData settings;
+static BaroSensorData baro;
+static FlightStatusData flight_status;
+static int32_t adc[8];
+// swap the draw and display buffers in the next PIOS_ADC_PinGet(), like the Vsync ISR may
+static bool swap_in_adc;
+
+int32_t PIOS_ADC_PinGet(uint32_t pin)
+{
+    if (swap_in_adc) {
+        uint8_t *tmp;
+        SWAP_BUFFS(tmp, disp_buffer_mask, draw_buffer_mask);
+        SWAP_BUFFS(tmp, disp_buffer_level, draw_buffer_level);
+        swap_in_adc = false;
+    }
+    return adc[pin];
+}
+
+void PIOS_Servo_Set(__attribute__((unused)) uint8_t servo, __attribute__((unused)) uint16_t position) {}
+
+uint16_t PIOS_Video_GetOSDLines(void)
+{
+    return 270;
+}
+
+long xSemaphoreTake(__attribute__((unused)) xSemaphoreHandle semaphore, __attribute__((unused)) portTickType ticks)
+{
+    return pdTRUE;
+}
+
+long xTaskCreate(__attribute__((unused)) void (*code)(void *), __attribute__((unused)) const char *name,
+                 __attribute__((unused)) uint16_t stack_depth, __attribute__((unused)) void *parameters,
+                 __attribute__((unused)) unsigned long priority, __attribute__((unused)) xTaskHandle *handle)
+{
+    return pdTRUE;
+}
+}
+
+#define BUFFER_BYTES    (GRAPHICS_WIDTH * GRAPHICS_HEIGHT)
+// the byte wise primitives write up to a glyph below the last line
+#define BUFFER_PADDING  (20 * GRAPHICS_WIDTH)
+#define RANDOM_RUNS     5000
+#define FRAMES          120
+#define BENCHMARK_LOOPS 200
+#define GOLDEN_STEP     10
+#define GOLDEN_RUN_STEP 100
+
+// CRC-32 of level and mask of every GOLDEN_STEP-th frame of FramesMatchBaseline, captured once
+// from the osdgen that cleared and redrew the whole frame, built with -funsigned-char as on the target
+static const uint32_t golden_frames[5][FRAMES / GOLDEN_STEP] = {
+    { 0xd976fe0f, 0x16fcc650, 0x3eaed881, 0x3eaed881, 0x6f9a1d3a, 0x6f9a1d3a, 0x71692757, 0xd27b27ca, 0x7ff786c1, 0x7ff786c1, 0x7ff786c1, 0x7ff786c1 },
+    { 0xabcb26de, 0x11602c4c, 0x15cb0f42, 0x0affb5d3, 0xc6b4c0fd, 0xa5b8c224, 0x3503e4ce, 0x32bb8a5f, 0xcc5b8442, 0x1a831285, 0x1ff3dce5, 0x00c76674 },
+    { 0x1e33cdee, 0xbc090570, 0x48e0ad83, 0xca086370, 0x980c8c97, 0x980c8c97, 0x07c4e1ee, 0x13fbba11, 0x34413f50, 0x414a50be, 0x414a50be, 0x414a50be },
+    { 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d, 0xddd7db9d },
+    { 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148, 0x6cf45148 },
+};
+
+// CRC-32 of the buffers after each run of LinesMatchGolden and GlyphsMatchGolden, chained over the runs
+// and kept every GOLDEN_RUN_STEP-th run, captured once from the byte wise primitives of that osdgen
+static const uint32_t golden_lines[RANDOM_RUNS / GOLDEN_RUN_STEP] = {
+    0x22e3ae4b, 0x8636dcd0, 0x8d54a15f, 0x7ad46b1b, 0x7eebde3c, 0x12e5d8e8, 0xabdd54c3, 0x83dfc0cc,
+    0xe50e95ed, 0xd4b596fb, 0x08b88220, 0xf97e9410, 0x15dfb4d4, 0x99b79d16, 0xb5212190, 0x966f4907,
+    0x0189d166, 0x0d9aaff8, 0xa58330da, 0xf1aba328, 0x0cd9b8c5, 0xdd5830b6, 0xb75d8ca7, 0x7e5fe111,
+    0x36f22c41, 0xdd734d19, 0x693f2c14, 0x0d9a4069, 0xd6a39061, 0x57177619, 0xa9bf4cdd, 0x9471d878,
+    0x1337e032, 0x5d7a7acd, 0x18d39d4d, 0xe2bca3f4, 0xa8081402, 0xf167d00e, 0x377529c0, 0x048b40bb,
+    0x88586d2f, 0x389733c7, 0xc91d797e, 0xfbe06240, 0xffaaa941, 0x02b2424e, 0x6de559a3, 0xe958982b,
+    0x10448ddb, 0x92802357,
+};
+
+static const uint32_t golden_glyphs[RANDOM_RUNS / GOLDEN_RUN_STEP] = {
+    0xa6c892dc, 0x85ff9290, 0x2b4c781c, 0xa9a93efa, 0x0f0e7d9e, 0xe8460a43, 0x53f19641, 0x16efef94,
+    0x3743ad03, 0xec9d4984, 0xde62a29e, 0x6b140d06, 0xb8df7ac3, 0x8574f1d6, 0xb00b5a24, 0xd4155a39,
+    0xedbdafb9, 0x020bb521, 0x5794eb3a, 0xf154127f, 0xf259eea9, 0xeeb4c478, 0x69416a40, 0xb55505ec,
+    0xdfc44d3d, 0xd58cf023, 0xd56f101f, 0xc610a7ec, 0x272fd83e, 0x78535f68, 0x047c46bb, 0xf104c959,
+    0x7554c14e, 0xf6b19614, 0x9b61c6f7, 0x0b822340, 0x98c420af, 0x78d8dd80, 0xf71df4f4, 0x2859e128,
+    0xe5bdbdb3, 0x6cada124, 0x2c8abe09, 0x5ee12c7d, 0xd38589ff, 0x87c5bb58, 0xf2e93c2e, 0x70178a52,
+    0x91d05a5b, 0x8ad43542,
+};
+
+// level and mask of the two buffers the OSD alternates between, and one for the full redraw
+enum { TRACKED_0, TRACKED_1, REFERENCE, NUM_SURFACES };
+static uint32_t surfaces[NUM_SURFACES][2][(BUFFER_BYTES + BUFFER_PADDING) / 4];
+
+static uint8_t *level(int surface)
+{
+    return (uint8_t *)surfaces[surface][0];
+}
+
+static uint8_t *mask(int surface)
+{
+    return (uint8_t *)surfaces[surface][1];
+}
+
+static void draw_into(int surface)
+{
+    draw_buffer_level = level(surface);
+    draw_buffer_mask  = mask(surface);
+}
+
+static void display(int surface)
+{
+    disp_buffer_level = level(surface);
+    disp_buffer_mask  = mask(surface);
+}
+
+// rand() differs between C libraries, the golden CRCs need the same buffers and coordinates everywhere
+static uint32_t random_state;
+
+static int next_random(void)
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 16;
+}
+
+static void random_fill(int surface)
+{
+    for (int i = 0; i < BUFFER_BYTES; i++) {
+        level(surface)[i] = next_random();
+        mask(surface)[i]  = next_random();
+    }
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, int len)
+{
+    crc = ~crc;
+    for (int i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xedb88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t frame_crc(int surface)
+{
+    return crc32(crc32(0, level(surface), BUFFER_BYTES), mask(surface), BUFFER_BYTES);
+}
+
+// first differing pixel as "x,y in level|mask", empty if the surfaces are equal
+static std::string difference(int a, int b)
+{
+    for (int i = 0; i < 2; i++) {
+        const uint8_t *pa = (const uint8_t *)surfaces[a][i];
+        const uint8_t *pb = (const uint8_t *)surfaces[b][i];
+        for (int addr = 0; addr < BUFFER_BYTES; addr++) {
+            if (pa[addr] != pb[addr]) {
+                int bit = __builtin_clz((pa[addr] ^ pb[addr]) << 24);
+                char text[64];
+                snprintf(text, sizeof(text), "%d,%d in %s", (addr % GRAPHICS_WIDTH) * 8 + bit, addr / GRAPHICS_WIDTH, i ? "mask" : "level");
+                return text;
+            }
+        }
+    }
+    return "";
+}
+
+// Flight data of frame n, some values change every frame, some only once in a while.
+static void set_inputs(int n, bool moving)
+{
+    int slow = moving ? n : n / 40;
+
+    attitude.Roll     = moving ? (n * 7) % 180 - 90 : 12;
+    attitude.Pitch    = moving ? (n * 3) % 60 - 30 : -4;
+    attitude.Yaw      = moving ? (n * 5) % 360 - 180 : 33;
+    gps.Latitude      = 520000000 + slow * 1234;
+    gps.Longitude     = 45000000 - slow * 987;
+    gps.Altitude      = 120.0f + slow;
+    gps.Heading       = (slow * 13) % 360;
+    gps.Groundspeed   = slow % 25;
+    gps.Satellites    = 9 + slow % 3;
+    gps.Status = GPSPOSITIONSENSOR_STATUS_FIX3D;
+    baro.Altitude     = 80.0f + slow % 50;
+    timex.hour = 12;
+    timex.min  = (n / 40) % 60;
+    timex.sec  = (n / 8) % 60;
+    flight_status.FlightMode = (FlightStatusFlightModeOptions)((n / 30) % 8);
+    adc[2]     = 2000 + slow % 7;
+    adc[3]     = 1000;
+    adc[4]     = 1800;
+    adc[5]     = 1500 + slow % 5;
+
+    AttitudeStateSet(&attitude);
+    GPSPositionSensorSet(&gps);
+    HomeLocationSet(&home);
+    OsdSettingsSet(&settings);
+    BaroSensorSet(&baro);
+    FlightStatusSet(&flight_status);
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class OsdTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        // the objects osdgen reads, registered once, set_inputs() publishes them
+        AttitudeStateInitialize();
+        GPSPositionSensorInitialize();
+        HomeLocationInitialize();
+        OsdSettingsInitialize();
+        BaroSensorInitialize();
+        FlightStatusInitialize();
+        random_state = 1234;
+        memset(surfaces, 0, sizeof(surfaces));
+        memset(&settings, 0, sizeof(settings));
+        settings.Attitude        = OSDSETTINGS_ATTITUDE_ENABLED;
+        settings.AttitudeSetup.X = 168;
+        settings.AttitudeSetup.Y = 135;
+        settings.Time = OSDSETTINGS_TIME_ENABLED;
+        settings.TimeSetup.X     = 10;
+        settings.TimeSetup.Y     = 240;
+        settings.Speed = OSDSETTINGS_SPEED_ENABLED;
+        settings.SpeedSetup.X    = 2;
+        settings.SpeedSetup.Y    = 145;
+        settings.Altitude        = OSDSETTINGS_ALTITUDE_ENABLED;
+        settings.AltitudeSetup.X = 330;
+        settings.AltitudeSetup.Y = 145;
+        settings.Heading         = OSDSETTINGS_HEADING_ENABLED;
+        settings.HeadingSetup.X  = 168;
+        settings.HeadingSetup.Y  = 220;
+        home.Set       = HOMELOCATION_SET_TRUE;
+        home.Latitude  = 520010000;
+        home.Longitude = 45020000;
+        home.Altitude  = 100.0f;
+        swap_in_adc    = false;
+        // what the intro left in the buffers, drawn outside of a tracked frame
+        for (int surface = TRACKED_0; surface <= TRACKED_1; surface++) {
+            draw_into(surface);
+            write_pixel_lm(0, 0, 1, 1);
+            random_fill(surface);
+        }
+        display(TRACKED_1);
+    }
+
+    // Draw frame n like the OSD task does, and the same frame after a full clear
+    // in the reference surface, which has to look the same.
+    std::string frame(int n)
+    {
+        draw_into(n % 2 ? TRACKED_1 : TRACKED_0);
+        display(n % 2 ? TRACKED_0 : TRACKED_1);
+        updateOnceEveryFrame();
+
+        draw_into(REFERENCE);
+        clearGraphics();
+        updateGraphics();
+        return difference(n % 2 ? TRACKED_1 : TRACKED_0, REFERENCE);
+    }
+};
+
+TEST_F(OsdTest, LinesMatchGolden) {
+    uint32_t crc = 0;
+
+    for (int run = 0; run < RANDOM_RUNS; run++) {
+        random_fill(TRACKED_0);
+        int mode = next_random() % 3;
+        // coordinates up to just past the edges, which the primitives clip
+        unsigned int x0 = next_random() % (GRAPHICS_WIDTH_REAL + 8);
+        unsigned int x1 = next_random() % 4 ? x0 + next_random() % 40 : next_random() % (GRAPHICS_WIDTH_REAL + 8);
+        unsigned int y0 = next_random() % GRAPHICS_HEIGHT_REAL;
+        unsigned int y1 = next_random() % 4 ? y0 + next_random() % 40 : next_random() % (GRAPHICS_HEIGHT_REAL + 4);
+        switch (run % 3) {
+        case 0:
+            write_hline(level(TRACKED_0), x0, x1, y0, mode);
+            break;
+        case 1:
+            write_vline(level(TRACKED_0), x0, y0, y1, mode);
+            break;
+        case 2:
+            // the scales pass negative widths (but never end in the first byte)
+            x1 = MAX(x1, 8);
+            y1 = MAX(y1, y0 + 1);
+            write_filled_rectangle(level(TRACKED_0), x0, y0, x1 - x0, y1 - y0, mode);
+            break;
+        }
+        crc = crc32(crc, level(TRACKED_0), BUFFER_BYTES);
+        if (run % GOLDEN_RUN_STEP == GOLDEN_RUN_STEP - 1) {
+            ASSERT_EQ(golden_lines[run / GOLDEN_RUN_STEP], crc) << "runs up to " << run;
+        }
+    }
+}
+
+TEST_F(OsdTest, GlyphsMatchGolden) {
+    uint32_t crc = 0;
+
+    for (int run = 0; run < RANDOM_RUNS; run++) {
+        random_fill(TRACKED_0);
+        draw_into(TRACKED_0);
+        unsigned int x = next_random() % GRAPHICS_WIDTH_REAL;
+        unsigned int y = next_random() % GRAPHICS_HEIGHT_REAL;
+        char ch = 32 + next_random() % 95;
+        switch (run % 4) {
+        case 0:
+        {
+            int flags = next_random() % 2 ? FONT_INVERT : 0;
+            int font  = next_random() % 2;
+            if (fonts[font].lookup[(uint8_t)ch] != (char)0xff) { // not all characters are in the font
+                write_char(ch, x, y, flags, font);
+            }
+            break;
+        }
+        case 1:
+            write_char16(ch, x, y, 2 + next_random() % 2);
+            break;
+        case 2:
+        {
+            uint16_t word = next_random();
+            unsigned int addr = next_random() % (BUFFER_BYTES - 2);
+            unsigned int xoff = next_random() % 16;
+            write_word_misaligned_OR(level(TRACKED_0), word, addr, xoff);
+            break;
+        }
+        case 3:
+        {
+            uint16_t word = next_random();
+            unsigned int addr = next_random() % (BUFFER_BYTES - 2);
+            unsigned int xoff = next_random() % 16;
+            write_word_misaligned_NAND(mask(TRACKED_0), word, addr, xoff);
+            break;
+        }
+        }
+        crc = crc32(crc32(crc, level(TRACKED_0), BUFFER_BYTES), mask(TRACKED_0), BUFFER_BYTES);
+        if (run % GOLDEN_RUN_STEP == GOLDEN_RUN_STEP - 1) {
+            ASSERT_EQ(golden_glyphs[run / GOLDEN_RUN_STEP], crc) << "runs up to " << run;
+        }
+    }
+}
+
+TEST_F(OsdTest, FramesMatchFullRedraw) {
+    const uint8_t screens[] = { 0, 1, 2, 4, 7 };
+
+    for (unsigned int s = 0; s < sizeof(screens); s++) {
+        settings.Screen = screens[s];
+        for (int n = 0; n < FRAMES; n++) {
+            set_inputs(n, n % 60 < 20);
+            ASSERT_EQ("", frame(n)) << "screen " << (int)screens[s] << " frame " << n;
+        }
+    }
+    // elements with unchanged inputs were left in place
+    EXPECT_LT(0u, osd_elements_kept);
+}
+
+TEST_F(OsdTest, FramesMatchBaseline) {
+    const uint8_t screens[] = { 0, 1, 2, 4, 7 };
+
+    for (unsigned int s = 0; s < sizeof(screens); s++) {
+        settings.Screen = screens[s];
+        for (int n = 0; n < FRAMES; n++) {
+            int surface = n % 2 ? TRACKED_1 : TRACKED_0;
+            set_inputs(n, n % 60 < 20);
+            draw_into(surface);
+            display(n % 2 ? TRACKED_0 : TRACKED_1);
+            updateOnceEveryFrame();
+            if (n % GOLDEN_STEP == GOLDEN_STEP - 1) {
+                EXPECT_EQ(golden_frames[s][n / GOLDEN_STEP], frame_crc(surface)) << "screen " << (int)screens[s] << " frame " << n;
+            }
+        }
+    }
+}
+
+TEST_F(OsdTest, ScreensAndSettingsChange) {
+    for (int n = 0; n < FRAMES * 4; n++) {
+        settings.Screen       = (n / 13) % 3;
+        settings.TimeSetup.Y  = n % 50 < 25 ? 240 : 60;
+        settings.Attitude     = (n / 7) % 2 ? OSDSETTINGS_ATTITUDE_ENABLED : OSDSETTINGS_ATTITUDE_DISABLED;
+        home.Set = (n / 17) % 2 ? HOMELOCATION_SET_TRUE : HOMELOCATION_SET_FALSE;
+        set_inputs(n, n % 30 < 5);
+        ASSERT_EQ("", frame(n)) << "frame " << n;
+    }
+}
+
+TEST_F(OsdTest, BuffersSwappedWhileDrawing) {
+    settings.Screen = 1;
+    for (int n = 0; n < FRAMES; n++) {
+        set_inputs(n, false);
+        if (n % 25 == 10) {
+            // the frame is lost, the ones after it must be right again
+            swap_in_adc = true;
+            frame(n);
+            continue;
+        }
+        ASSERT_EQ("", frame(n)) << "frame " << n;
+    }
+}
+
+TEST_F(OsdTest, Benchmark) {
+    char text[] = "Lat: 52.0001234";
+    uint64_t start, text_time, rect, full, tracked_still, tracked_moving;
+
+    draw_into(REFERENCE);
+    start = now_ns();
+    for (int loop = 0; loop < BENCHMARK_LOOPS * 10; loop++) {
+        for (unsigned int i = 0; i < sizeof(text) - 1; i++) {
+            write_char16(text[i], 85 + i * 12, 20 + loop % 200, 3);
+        }
+    }
+    text_time = now_ns() - start;
+
+    start = now_ns();
+    for (int loop = 0; loop < BENCHMARK_LOOPS * 10; loop++) {
+        write_filled_rectangle(level(REFERENCE), 83 + loop % 8, 40, 300, 100, loop % 3);
+    }
+    rect = now_ns() - start;
+
+    settings.Screen = 1;
+    set_inputs(0, false);
+    start = now_ns();
+    for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+        clearGraphics();
+        updateGraphics();
+    }
+    full = now_ns() - start;
+    start = now_ns();
+    for (int n = 0; n < BENCHMARK_LOOPS; n++) {
+        draw_into(n % 2 ? TRACKED_1 : TRACKED_0);
+        updateOnceEveryFrame();
+    }
+    tracked_still = now_ns() - start;
+    start = now_ns();
+    for (int n = 0; n < BENCHMARK_LOOPS; n++) {
+        set_inputs(n, true);
+        draw_into(n % 2 ? TRACKED_1 : TRACKED_0);
+        updateOnceEveryFrame();
+    }
+    tracked_moving = now_ns() - start;
+
+    printf("12x18 glyph %.0f ns, 300x100 rectangle %.0f ns\n",
+           (double)text_time / (BENCHMARK_LOOPS * 10 * (sizeof(text) - 1)), (double)rect / (BENCHMARK_LOOPS * 10));
+    printf("screen 1: clear and redraw %.0f ns, dirty tiles %.0f ns still, %.0f ns moving\n",
+           (double)full / BENCHMARK_LOOPS, (double)tracked_still / BENCHMARK_LOOPS, (double)tracked_moving / BENCHMARK_LOOPS);
+}
@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memset */
+#include <math.h> /* atan2f */
+
+extern "C" {
+#include "missiontable.h"
+
+static int allocations;
+
+void *pios_malloc(size_t size)
+{
+    allocations++;
+    return malloc(size);
+}
+
+void pios_free(void *p)
+{
+    free(p);
+}
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class MissionTable : public testing::Test {
+protected:
+    struct mission_table mission;
+
+    virtual void SetUp()
+    {
+        memset(&mission, 0, sizeof(mission));
+        allocations = 0;
+    }
+
+    virtual void TearDown()
+    {
+        free(mission.legs);
+    }
+
+    // a square of 100 m legs, alternating between two actions
+    bool buildSquare(uint16_t count)
+    {
+        static const float corners[4][3] = {
+            { 0.0f,   0.0f,   -10.0f },
+            { 100.0f, 0.0f,   -10.0f },
+            { 100.0f, 100.0f, -10.0f },
+            { 0.0f,   100.0f, -10.0f },
+        };
+        struct mission_action action;
+
+        if (!mission_table_begin(&mission, count, 2)) {
+            return false;
+        }
+        for (uint16_t i = 0; i < count; i++) {
+            if (!mission_table_set_leg(&mission, i, corners[i % 4], 5.0f, i % 2)) {
+                return false;
+            }
+        }
+        for (uint8_t id = 0; id < 2; id++) {
+            memset(&action, 0, sizeof(action));
+            action.mode = 10 + id;
+            action.endCondition     = 20 + id;
+            action.command = 30 + id;
+            action.jumpDestination  = -1;
+            action.errorDestination = id;
+            action.modeParameters[3]      = 1.5f + id;
+            action.conditionParameters[0] = 2.5f + id;
+            if (!mission_table_set_action(&mission, id, &action)) {
+                return false;
+            }
+        }
+        mission_table_finish(&mission);
+        return true;
+    }
+};
+
+TEST_F(MissionTable, Rebuild) {
+    EXPECT_FALSE(mission.valid);
+
+    ASSERT_TRUE(buildSquare(4));
+    EXPECT_TRUE(mission.valid);
+    EXPECT_EQ(1, allocations);
+
+    // a smaller plan reuses the legs
+    ASSERT_TRUE(buildSquare(3));
+    EXPECT_EQ(1, allocations);
+    EXPECT_EQ(4, mission.capacity);
+    EXPECT_EQ(3, mission.legCount);
+
+    // a larger one grows them
+    ASSERT_TRUE(buildSquare(8));
+    EXPECT_EQ(2, allocations);
+    EXPECT_EQ(8, mission.capacity);
+    EXPECT_FLOAT_EQ(100.0f, mission.legs[5].position[0]);
+    EXPECT_FLOAT_EQ(-10.0f, mission.legs[5].position[2]);
+    EXPECT_FLOAT_EQ(5.0f, mission.legs[5].velocity);
+}
+
+TEST_F(MissionTable, ActionCopies) {
+    ASSERT_TRUE(buildSquare(4));
+
+    // every leg carries a copy of its path action
+    for (uint16_t i = 0; i < 4; i++) {
+        const struct mission_leg *leg = &mission.legs[i];
+        EXPECT_EQ(i % 2, leg->actionId);
+        EXPECT_EQ(10 + i % 2, leg->action.mode);
+        EXPECT_EQ(20 + i % 2, leg->action.endCondition);
+        EXPECT_EQ(30 + i % 2, leg->action.command);
+        EXPECT_EQ(-1, leg->action.jumpDestination);
+        EXPECT_EQ(i % 2, leg->action.errorDestination);
+        EXPECT_FLOAT_EQ(1.5f + i % 2, leg->action.modeParameters[3]);
+        EXPECT_FLOAT_EQ(2.5f + i % 2, leg->action.conditionParameters[0]);
+    }
+}
+
+TEST_F(MissionTable, InvalidPlan) {
+    const float position[3] = { 0.0f, 0.0f, 0.0f };
+    struct mission_action action;
+
+    ASSERT_TRUE(buildSquare(4));
+
+    // the table is invalid from the start of a rebuild
+    ASSERT_TRUE(mission_table_begin(&mission, 2, 2));
+    EXPECT_FALSE(mission.valid);
+
+    // path action id out of range
+    EXPECT_TRUE(mission_table_set_leg(&mission, 0, position, 0.0f, 1));
+    EXPECT_FALSE(mission_table_set_leg(&mission, 1, position, 0.0f, 2));
+    EXPECT_FALSE(mission_table_set_leg(&mission, 2, position, 0.0f, 0));
+
+    // waypoint ids out of range, negative ones are relative or disabled
+    memset(&action, 0, sizeof(action));
+    action.errorDestination = 1;
+    action.jumpDestination  = -1;
+    EXPECT_TRUE(mission_table_set_action(&mission, 0, &action));
+    action.errorDestination = -1;
+    action.jumpDestination  = -5;
+    EXPECT_TRUE(mission_table_set_action(&mission, 0, &action));
+    action.errorDestination = 2;
+    action.jumpDestination  = 0;
+    EXPECT_FALSE(mission_table_set_action(&mission, 0, &action));
+    action.errorDestination = 0;
+    action.jumpDestination  = 2;
+    EXPECT_FALSE(mission_table_set_action(&mission, 0, &action));
+    EXPECT_FALSE(mission.valid);
+}
+
+TEST_F(MissionTable, LegSwitching) {
+    ASSERT_TRUE(buildSquare(4));
+
+    // next leg, the plan wraps around
+    EXPECT_EQ(1, mission_table_wrap(&mission, 1));
+    EXPECT_EQ(3, mission_table_wrap(&mission, 3));
+    EXPECT_EQ(0, mission_table_wrap(&mission, 4));
+    EXPECT_EQ(0, mission_table_wrap(&mission, 200));
+
+    // absolute and relative jumps
+    EXPECT_EQ(2, mission_table_jump(&mission, 0, 2));
+    EXPECT_EQ(3, mission_table_jump(&mission, 1, -2));
+    EXPECT_EQ(0, mission_table_jump(&mission, 3, -1));
+
+    // course to the next waypoint, as atan2f(north, east)
+    EXPECT_FLOAT_EQ(atan2f(100.0f, 0.0f), mission.legs[0].nextCourse);
+    EXPECT_FLOAT_EQ(atan2f(0.0f, 100.0f), mission.legs[1].nextCourse);
+    EXPECT_FLOAT_EQ(atan2f(-100.0f, 0.0f), mission.legs[2].nextCourse);
+    // the last leg leads back to the first waypoint
+    EXPECT_FLOAT_EQ(atan2f(0.0f, -100.0f), mission.legs[3].nextCourse);
+
+    printf("mission leg %u bytes\n", (unsigned)sizeof(struct mission_leg));
+}
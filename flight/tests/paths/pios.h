@@ -0,0 +1,10 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "ut_uavobjects.h"
+
+#endif /* PIOS_H */
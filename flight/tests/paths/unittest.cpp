@@ -0,0 +1,232 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <math.h> /* atan2f */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "pios.h"
+#include "pios_math.h"
+#include "mathmisc.h"
+#include "pathdesired.h"
+#include "paths.h"
+}
+
+#define POINTS          20000
+#define BENCHMARK_LOOPS 200
+#define GOLDEN_POINTS   4
+
+/* rand() differs between C libraries, the golden results need the same paths and points everywhere */
+static uint32_t random_state;
+
+static float random_range(float min, float max)
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return min + (max - min) * ((float)((random_state >> 16) & 0x7fff) / 0x7fff);
+}
+
+static const PathDesiredModeOptions modes[] = {
+    PATHDESIRED_MODE_GOTOENDPOINT,
+    PATHDESIRED_MODE_FOLLOWVECTOR,
+    PATHDESIRED_MODE_CIRCLERIGHT,
+    PATHDESIRED_MODE_CIRCLELEFT,
+    PATHDESIRED_MODE_LAND,
+    PATHDESIRED_MODE_BRAKE,
+    PATHDESIRED_MODE_AUTOTAKEOFF,
+};
+
+static void random_path(PathDesiredData *path, PathDesiredModeOptions mode)
+{
+    path->Start.North = random_range(-500.0f, 500.0f);
+    path->Start.East  = random_range(-500.0f, 500.0f);
+    path->Start.Down  = random_range(-100.0f, 0.0f);
+    path->End.North   = random_range(-500.0f, 500.0f);
+    path->End.East    = random_range(-500.0f, 500.0f);
+    path->End.Down    = random_range(-100.0f, 0.0f);
+    path->StartingVelocity = random_range(0.0f, 10.0f);
+    path->EndingVelocity   = random_range(0.0f, 10.0f);
+    path->Mode = mode;
+}
+
+static void expect_status_eq(const struct path_status *expected, const struct path_status *actual)
+{
+    EXPECT_FLOAT_EQ(expected->fractional_progress, actual->fractional_progress);
+    EXPECT_FLOAT_EQ(expected->error, actual->error);
+    for (int k = 0; k < 3; k++) {
+        EXPECT_FLOAT_EQ(expected->path_vector[k], actual->path_vector[k]);
+        EXPECT_FLOAT_EQ(expected->correction_vector[k], actual->correction_vector[k]);
+    }
+}
+
+/*
+ * path_progress() for the SegmentMatchesGolden and DegenerateSegments points, captured once from
+ * paths.c before the segment geometry was cached
+ */
+static const struct path_status segment_golden[sizeof(modes) * 2 * GOLDEN_POINTS] = {
+    { 0.576781511f, 306.307495f, { 0.238557875f, 5.66745663f, 0.0f }, { 12.8818665f, 306.036499f, 0.0f } },
+    { 0.715214014f, 226.684097f, { -0.818850398f, -2.04497576f, 0.0f }, { -84.2646484f, -210.440369f, 0.0f } },
+    { 0.434394717f, 451.258636f, { 0.284620166f, -1.48050416f, 0.0f }, { 85.1924133f, -443.144012f, 0.0f } },
+    { 0.0f, 1083.20325f, { -6.86279249f, 2.35925388f, 0.0f }, { -1024.36304f, 352.150024f, 0.0f } },
+    { 0.0f, 463.012451f, { 2.94629622f, 1.13534462f, -0.761831522f }, { 419.992645f, 161.842651f, -108.598602f } },
+    { 0.0f, 505.396393f, { -4.43105364f, 0.423923671f, -0.872375846f }, { -493.707092f, 47.23349f, -97.1999359f } },
+    { 0.0f, 862.453064f, { -6.88362551f, 1.7492851f, 0.463558465f }, { -834.110535f, 211.96637f, 56.1708374f } },
+    { 0.0f, 744.643982f, { -5.42222643f, 6.8726306f, 0.55970192f }, { -460.289337f, 583.413208f, 47.5127411f } },
+    { 0.245425195f, 153.185959f, { -1.73011351f, 5.47496939f, 0.0f }, { -140.517639f, -44.4041901f, -41.8210297f } },
+    { 0.490222871f, 705.515076f, { 2.85773635f, -5.69607306f, 0.0f }, { -625.963989f, -314.047974f, 85.4075699f } },
+    { -1.24712873f, 437.145905f, { -0.699580967f, 4.30461836f, 0.0f }, { 416.914886f, 67.7564392f, -112.639229f } },
+    { 1.09383285f, 924.904907f, { -0.00454222225f, 1.89671981f, 0.0f }, { -922.696594f, -2.2096405f, -63.8370895f } },
+    { 1.07760835f, 691.90625f, { -1.39996612f, 3.88646722f, -0.202178508f }, { 646.367432f, 227.894409f, -94.9079437f } },
+    { 5.03855562f, 845.469788f, { 0.129995853f, -6.23982143f, -1.27677429f }, { 823.986084f, 54.2909546f, -181.434738f } },
+    { -0.937086344f, 101.310638f, { 4.71286583f, 4.33363867f, -0.12582846f }, { -53.5365906f, 60.0104675f, 61.6151199f } },
+    { 1.17342079f, 355.089752f, { 2.31476569f, -6.60999393f, -0.076371111f }, { -325.938995f, -113.171448f, -83.932869f } },
+    { 0.723127842f, 378.677887f, { -9.27981472f, -0.824670553f, 0.0f }, { -33.5199242f, 377.191406f, -85.7738037f } },
+    { 0.968179941f, 470.941956f, { -2.5708096f, -2.0767684f, 0.0f }, { 295.940063f, -366.341095f, 94.7340393f } },
+    { 0.674776554f, 201.282227f, { 5.15157366f, 1.16580677f, 0.0f }, { 44.4269905f, -196.318039f, -67.407753f } },
+    { 0.901178956f, 367.469421f, { 3.40660381f, 2.50838113f, 0.0f }, { -217.884079f, 295.905884f, -52.1820679f } },
+    { 0.742293715f, 71.8599854f, { 2.69156051f, -0.28862676f, 0.0f }, { -7.66190481f, -71.4503555f, 76.8013535f } },
+    { 0.833505511f, 567.538208f, { 1.36495268f, -2.80751753f, 0.0f }, { 510.412231f, 248.151093f, -104.524368f } },
+    { 0.137721598f, 141.644592f, { -7.3011775f, -4.16827011f, 0.0f }, { -70.2267303f, 123.009743f, 64.5786972f } },
+    { 0.689062238f, 208.360107f, { 1.88203871f, -1.11267197f, 0.0f }, { 106.038315f, 179.359436f, -3.74919891f } },
+    { 0.0180846713f, 191.122375f, { -5.46241045f, -1.01824164f, 0.0f }, { -35.0235939f, 187.885895f, -13.6890717f } },
+    { 0.747250199f, 50.0957031f, { 0.0121150743f, 0.594682276f, 0.0f }, { -50.0853081f, 1.02035522f, -38.1923866f } },
+    { 0.716507792f, 331.919495f, { -1.94792402f, -6.52313137f, 0.0f }, { 318.041931f, -94.9730225f, 23.9585571f } },
+    { 0.690746903f, 91.1417847f, { -1.04312813f, 2.69594264f, 0.0f }, { 85.000824f, 32.8889618f, 73.3314056f } },
+    { 0.000692367554f, 181.005005f, { -2.12388492f, 2.20258975f, 0.0f }, { 130.296646f, 125.640755f, 57.4800797f } },
+    { 0.941419244f, 123.096924f, { 1.38097572f, 4.50291777f, 0.0f }, { 117.686745f, -36.0927162f, 39.2605362f } },
+    { 0.395913392f, 333.255951f, { -0.19937408f, 1.15513647f, 0.0f }, { -328.40033f, -56.6811943f, -10.5090408f } },
+    { 0.883001566f, 798.8573f, { 9.49080086f, -0.502121925f, 0.0f }, { 42.2054558f, 797.741638f, -30.2667389f } },
+    { 0.456880808f, 481.200928f, { -2.01716328f, -2.67042804f, 0.0f }, { -290.038696f, -383.968628f, 0.0f } },
+    { 0.0f, 730.252258f, { -0.201668575f, 1.8030827f, 0.0f }, { -81.1700745f, 725.727112f, 0.0f } },
+    { 0.0f, 892.661072f, { 4.63853025f, -7.26985407f, 0.0f }, { 480.150757f, -752.528442f, 0.0f } },
+    { 0.0f, 674.585999f, { -4.61694527f, -7.03226376f, 0.0f }, { -370.229248f, -563.911804f, 0.0f } },
+    { 0.0f, 431.984497f, { -6.08767271f, 2.74902034f, 0.0f }, { -393.704041f, 177.785583f, 0.0f } },
+    { 0.681097627f, 292.688934f, { -5.33094549f, -4.58269119f, 0.0f }, { -221.951965f, -190.798676f, 0.0f } },
+    { 0.506530046f, 385.40155f, { -6.98459435f, 6.64533043f, 0.0f }, { -279.216888f, 265.654419f, 0.0f } },
+    { 0.236356437f, 428.540588f, { -1.69801283f, -1.45259571f, 0.0f }, { -325.641602f, -278.575989f, 0.0f } },
+    { 0.0524473228f, 216.85141f, { -2.89125061f, -6.67432356f, 0.0f }, { -184.829849f, 80.0664673f, 80.3231888f } },
+    { 1.32589877f, 210.806046f, { -6.31109476f, 4.89860868f, 0.0f }, { -129.22876f, -166.49115f, -4.4511261f } },
+    { -1.2347753f, 383.631531f, { -0.0921140388f, -0.0477676764f, 0.0f }, { 174.177795f, -335.880341f, -63.4006729f } },
+    { 5.07382011f, 237.572052f, { -3.99834967f, -3.4852345f, 0.0f }, { -134.456451f, 154.251892f, 120.699181f } },
+    { 2.27437186f, 433.99585f, { 6.51641321f, -4.09319162f, -3.40246201f }, { -258.659668f, -336.525726f, -90.5429001f } },
+    { 0.115651213f, 532.988159f, { -0.391576916f, -1.27707744f, -0.0204540528f }, { 503.507172f, -153.031967f, -84.4873886f } },
+    { -0.305366963f, 255.043777f, { -6.69212961f, -1.98152065f, -0.632895947f }, { 65.1366119f, -239.162933f, 60.0470238f } },
+    { -2.6937418f, 424.941711f, { 1.60490465f, -4.79109335f, 3.8202877f }, { 409.132599f, 109.514931f, -34.5320587f } },
+    { 0.603767991f, 238.908066f, { -4.92096758f, 1.23427606f, 0.0f }, { -231.730103f, 58.1224976f, 0.0f } },
+    { 0.272592723f, 333.538788f, { -0.468273193f, 6.39695835f, 0.0f }, { -24.350708f, 332.648712f, 0.0f } },
+    { 0.161448419f, 640.918457f, { -1.75243902f, -3.39465809f, 0.0f }, { -294.000061f, -569.508911f, 0.0f } },
+    { 0.468892097f, 533.310181f, { 0.848852754f, 2.73963833f, 0.0f }, { 157.838684f, 509.41803f, 0.0f } },
+    { 0.0f, 488.290619f, { 5.19663572f, -3.34336615f, 0.515927613f }, { 409.219604f, -263.280121f, 40.6277618f } },
+    { 0.0f, 226.323288f, { -3.99257398f, 0.902262032f, -0.449520648f }, { -219.437256f, 49.5895386f, -24.7062607f } },
+    { 0.0f, 302.839111f, { 2.84954834f, 4.47912025f, 1.29224336f }, { 157.942444f, 248.265015f, 71.625412f } },
+    { 0.0f, 587.167542f, { -3.52401757f, 3.38534951f, 0.764823854f }, { -418.344604f, 401.882996f, 90.7940826f } },
+};
+
+static const struct path_status degenerate_golden[sizeof(modes) * 2] = {
+    { 1.0f, 0.0f, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } },
+    { 0.0f, 3.0f, { -5.67247534f, 0.0f, 0.0f }, { -3.0f, 0.0f, 0.0f } },
+    { 1.0f, 0.0f, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } },
+    { 1.0f, 3.0f, { -0.365916938f, 0.0f, 0.0f }, { -3.0f, 0.0f, 0.0f } },
+    { 1.0f, 0.0f, { 1.43406487f, 0.0f, 0.0f }, { 0.0f, 0.0f, -0.0f } },
+    { 0.25f, 3.0f, { -0.0f, 1.43406487f, 0.0f }, { -3.0f, -0.0f, -0.0f } },
+    { 1.0f, 0.0f, { 5.64775515f, 0.0f, 0.0f }, { 0.0f, 0.0f, -0.0f } },
+    { 0.75f, 3.0f, { 0.0f, -5.64775515f, 0.0f }, { -3.0f, -0.0f, -0.0f } },
+    { 1.0f, 0.0f, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } },
+    { 0.0f, 3.0f, { -9.62553787f, 0.0f, 0.0f }, { -3.0f, 0.0f, 0.0f } },
+    { 1.0f, 0.0f, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } },
+    { 1.0f, 3.0f, { -4.01257372f, 0.0f, 0.0f }, { -3.0f, 0.0f, 0.0f } },
+    { 1.0f, 0.0f, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } },
+    { 0.0f, 3.0f, { -1.41148102f, 0.0f, 0.0f }, { -3.0f, 0.0f, 0.0f } },
+};
+
+// To use a test fixture, derive a class from testing::Test.
+class PathsTest : public testing::Test {};
+
+TEST_F(PathsTest, SegmentMatchesGolden) {
+    const struct path_status *expected = segment_golden;
+
+    random_state = 1234;
+    for (unsigned m = 0; m < sizeof(modes); m++) {
+        for (int mode3D = 0; mode3D < 2; mode3D++) {
+            for (int p = 0; p < GOLDEN_POINTS; p++, expected++) {
+                PathDesiredData path;
+                struct path_segment segment;
+                struct path_status actual;
+
+                random_path(&path, modes[m]);
+                float cur[3] = { random_range(-600.0f, 600.0f), random_range(-600.0f, 600.0f), random_range(-150.0f, 50.0f) };
+
+                path_segment_init(&segment, &path, mode3D);
+                path_segment_progress(&segment, cur, &actual);
+                expect_status_eq(expected, &actual);
+                path_progress(&path, cur, &actual, mode3D);
+                expect_status_eq(expected, &actual);
+            }
+        }
+    }
+}
+
+TEST_F(PathsTest, DegenerateSegments) {
+    const struct path_status *expected = degenerate_golden;
+    PathDesiredData path;
+    struct path_segment segment;
+    struct path_status actual;
+
+    random_state = 1234;
+    for (unsigned m = 0; m < sizeof(modes); m++) {
+        random_path(&path, modes[m]);
+        /* zero length path, and the current point on the end point or circle center */
+        path.Start = { path.End.North, path.End.East, path.End.Down };
+        float cur[3] = { path.End.North, path.End.East, path.End.Down };
+
+        path_segment_init(&segment, &path, true);
+        path_segment_progress(&segment, cur, &actual);
+        expect_status_eq(expected++, &actual);
+
+        cur[0] += 3.0f;
+        path_segment_progress(&segment, cur, &actual);
+        expect_status_eq(expected++, &actual);
+    }
+}
+
+TEST_F(PathsTest, Benchmark) {
+    static float points[POINTS][3];
+    PathDesiredData path;
+    struct path_segment segment;
+    struct path_status status;
+    volatile float sink = 0.0f;
+
+    random_state = 1234;
+    for (int i = 0; i < POINTS; i++) {
+        points[i][0] = random_range(-600.0f, 600.0f);
+        points[i][1] = random_range(-600.0f, 600.0f);
+        points[i][2] = random_range(-150.0f, 50.0f);
+    }
+
+    for (unsigned m = 0; m < 3; m++) {
+        random_path(&path, modes[m == 2 ? 3 : m]);
+
+        uint64_t start = now_ns();
+        for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+            for (int i = 0; i < POINTS; i += 64) {
+                path_progress(&path, points[i], &status, true);
+                sink = status.error;
+            }
+        }
+        uint64_t uncached = now_ns() - start;
+
+        path_segment_init(&segment, &path, true);
+        start = now_ns();
+        for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+            for (int i = 0; i < POINTS; i += 64) {
+                path_segment_progress(&segment, points[i], &status);
+                sink = status.error;
+            }
+        }
+        uint64_t cached = now_ns() - start;
+
+        int calls = BENCHMARK_LOOPS * ((POINTS + 63) / 64);
+        printf("mode %d: path_progress %.1f ns, path_segment_progress %.1f ns per call\n",
+               path.Mode, (double)uncached / calls, (double)cached / calls);
+    }
+    (void)sink;
+}
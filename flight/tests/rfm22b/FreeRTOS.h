@@ -0,0 +1,43 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+/*
+ * The parts of the FreeRTOS API used by the RFM22B driver.  Tasks run as
+ * coroutines in simulated time and every tick counter belongs to the simulated
+ * endpoint that created the task, see rfm22b_sim.c.
+ */
+
+typedef uint32_t portTickType;
+#define portBASE_TYPE long
+
+typedef struct sim_task *xTaskHandle;
+typedef struct sim_queue *xQueueHandle;
+typedef struct sim_semaphore *xSemaphoreHandle;
+
+#define pdTRUE           1
+#define pdFALSE          0
+#define pdPASS           pdTRUE
+#define errQUEUE_FULL    0
+
+#define portMAX_DELAY    ((portTickType)0xffffffff)
+#define portTICK_RATE_MS ((portTickType)1)
+#define tskIDLE_PRIORITY 0
+
+#define portEND_SWITCHING_ISR(woken) (void)(woken)
+
+extern portBASE_TYPE xTaskCreate(void (*code)(void *), const char *name, uint16_t stack_depth, void *parameters, unsigned portBASE_TYPE priority, xTaskHandle *handle);
+extern void vTaskDelay(portTickType ticks);
+extern portTickType xTaskGetTickCount(void);
+
+extern xQueueHandle xQueueCreate(unsigned portBASE_TYPE length, unsigned portBASE_TYPE item_size);
+extern portBASE_TYPE xQueueSend(xQueueHandle queue, const void *item, portTickType ticks);
+extern portBASE_TYPE xQueueSendFromISR(xQueueHandle queue, const void *item, portBASE_TYPE *woken);
+extern portBASE_TYPE xQueueReceive(xQueueHandle queue, void *item, portTickType ticks);
+
+extern xSemaphoreHandle sim_semaphore_create(bool given);
+#define vSemaphoreCreateBinary(semaphore) ((semaphore) = sim_semaphore_create(true))
+extern portBASE_TYPE xSemaphoreTake(xSemaphoreHandle semaphore, portTickType ticks);
+extern portBASE_TYPE xSemaphoreGive(xSemaphoreHandle semaphore);
+extern portBASE_TYPE xSemaphoreGiveFromISR(xSemaphoreHandle semaphore, portBASE_TYPE *woken);
+
+#endif /* FREERTOS_H */
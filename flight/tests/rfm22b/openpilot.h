@@ -0,0 +1,8 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+/* the parts of openpilot.h used by the Reed-Solomon library */
+
+#include "pios.h"
+
+#endif /* OPENPILOT_H */
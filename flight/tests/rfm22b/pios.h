@@ -0,0 +1,39 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+/* the parts of pios.h used by the RFM22B driver and the COM layer */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "pios_config.h"
+
+/* FreeRTOS and the hardware below the driver are simulated by rfm22b_sim.c */
+#include "FreeRTOS.h"
+#include "ut_uavobjects.h"
+
+#define pios_malloc(size)  (malloc(size))
+#define pios_free(p)       (free(p))
+
+#define PIOS_Assert(test)  assert(test)
+#define PIOS_DEBUG_Assert(test) assert(test)
+#define DEBUG_PRINTF(level, ...)
+
+#include <pios_crc.h>
+#include <pios_com.h>
+#include <pios_rcvr.h>
+#include <pios_spi.h>
+#include "pios_exti.h"
+#include "pios_delay.h"
+
+#define PIOS_SYS_SERIAL_NUM_ASCII_LEN 24
+extern int32_t PIOS_SYS_SerialNumberGet(char str[PIOS_SYS_SERIAL_NUM_ASCII_LEN + 1]);
+
+#endif /* PIOS_H */
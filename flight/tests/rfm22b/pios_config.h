@@ -0,0 +1,19 @@
+#ifndef PIOS_CONFIG_H
+#define PIOS_CONFIG_H
+
+/* Enable/Disable PiOS modules */
+#define PIOS_INCLUDE_RFM22B
+#define PIOS_INCLUDE_RFM22B_COM
+#define PIOS_INCLUDE_COM
+
+/*
+ * PIOS_INCLUDE_FREERTOS stays undefined so the drivers allocate their devices
+ * statically, every simulation run initialises a fresh pair of them
+ */
+#define PIOS_RFM22B_MAX_DEVS 64
+#define PIOS_COM_MAX_DEVS    128 // a main and an auxiliary port each
+
+/* Reed-Solomon ECC, as on the boards with an RFM22B */
+#define RS_ECC_NPARITY       4
+
+#endif /* PIOS_CONFIG_H */
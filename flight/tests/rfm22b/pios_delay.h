@@ -0,0 +1,9 @@
+#ifndef PIOS_DELAY_H
+#define PIOS_DELAY_H
+
+/* the delay functions used by the RFM22B driver, simulated code runs in no time */
+
+extern int32_t PIOS_DELAY_WaituS(uint32_t uS);
+extern int32_t PIOS_DELAY_WaitmS(uint32_t mS);
+
+#endif /* PIOS_DELAY_H */
@@ -0,0 +1,12 @@
+#ifndef PIOS_EXTI_H
+#define PIOS_EXTI_H
+
+/* the EXTI line of a simulated radio runs its vector on the falling edge of nIRQ */
+
+struct pios_exti_cfg {
+    bool (*vector)(void);
+};
+
+extern int32_t PIOS_EXTI_Init(const struct pios_exti_cfg *cfg);
+
+#endif /* PIOS_EXTI_H */
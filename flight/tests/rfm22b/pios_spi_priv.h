@@ -0,0 +1,6 @@
+#ifndef PIOS_SPI_PRIV_H
+#define PIOS_SPI_PRIV_H
+
+/* the SPI bus of a simulated radio is implemented by rfm22b_sim.c */
+
+#endif /* PIOS_SPI_PRIV_H */
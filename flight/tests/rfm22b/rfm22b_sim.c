@@ -0,0 +1,961 @@
+#include <stdio.h> /* snprintf */
+#include <math.h> /* ceil */
+#include <ucontext.h> /* makecontext/swapcontext */
+
+#include "pios.h"
+#include "pios_rfm22b_regs.h"
+#include "rfm22b_sim.h"
+
+/* everything the driver sees of the hardware and the RTOS, see rfm22b_sim.h */
+
+#define TASK_STACK_SIZE  (256 * 1024)
+#define WAKE_LATENCY_US  20 // from an interrupt to the task it woke running
+#define TX_STARTUP_US    200 // from txon to the first preamble bit
+#define FIFO_SIZE        64
+#define PREAMBLE_BYTE    0xAA
+#define MMC1_TXDTRSCALE  0x20 // tx data rate scale bit of modulation mode control 1
+#define RX_HEADER_BYTES  4 // hdlen as the driver sets it
+#define SYNC_BYTES       4 // synclen as the driver sets it
+
+struct sim_task {
+    ucontext_t       ctx;
+    void             (*code)(void *);
+    void             *parameters;
+    uint8_t          endpoint;
+    uint32_t         wait_gen;
+    portBASE_TYPE    wake_result;
+    struct sim_semaphore *waiting;
+    bool             finished;
+};
+
+struct sim_queue {
+    uint8_t *items;
+    uint32_t item_size;
+    uint32_t length;
+    uint32_t head;
+    uint32_t count;
+};
+
+struct sim_semaphore {
+    bool given;
+    struct sim_task *waiter;
+};
+
+struct sim_callback {
+    void     (*fn)(void *ctx);
+    void     *ctx;
+    uint32_t period_us;
+    uint8_t  endpoint;
+};
+
+enum event_type {
+    EVENT_TASK, // obj = task, gen = wait generation
+    EVENT_IRQ, // obj = radio
+    EVENT_TX_BYTE, // obj = radio, gen = transmit generation, arg = byte index
+    EVENT_RX_BYTE, // obj = receiving radio, gen = frame id, arg = byte | transmitter << 8
+    EVENT_CALLBACK, // obj = callback
+};
+
+struct event {
+    uint64_t time;
+    uint64_t seq;
+    enum event_type type;
+    void     *obj;
+    uint32_t gen;
+    uint32_t arg;
+};
+
+enum rx_state {
+    RX_PREAMBLE,
+    RX_SYNC,
+    RX_HEADER,
+    RX_LENGTH,
+    RX_PAYLOAD,
+};
+
+struct sim_radio {
+    uint8_t  index;
+    uint8_t  regs[128];
+    uint32_t sync_word; // used instead of what the driver programs if not 0
+    uint8_t  tx_fifo[FIFO_SIZE];
+    uint8_t  tx_head;
+    uint8_t  tx_count;
+    uint8_t  rx_fifo[FIFO_SIZE];
+    uint8_t  rx_head;
+    uint8_t  rx_count;
+    bool     irq_asserted;
+
+    // SPI transaction
+    bool     spi_addressed;
+    bool     spi_write;
+    uint8_t  spi_addr;
+
+    // transmitter
+    uint32_t tx_gen;
+    uint32_t frame_id;
+    uint64_t tx_start;
+    uint16_t tx_total;
+    uint32_t tx_bitrate; // what the radio is programmed to
+    uint32_t air_bitrate; // what the link actually runs at
+    uint8_t  tx_tuning[7];
+    bool     tx_lost;
+
+    // receiver
+    enum rx_state rx_state;
+    uint32_t rx_frame;
+    uint16_t rx_index;
+
+    struct rfm22b_sim_stats stats;
+};
+
+struct sim_clock {
+    double offset_us;
+    double rate;
+};
+
+static uint64_t now_us;
+static uint64_t event_seq;
+static struct event *events;
+static uint32_t num_events;
+static uint32_t max_events;
+
+static void **allocations;
+static uint32_t num_allocations;
+static uint32_t max_allocations;
+
+static ucontext_t scheduler_ctx;
+static struct sim_task *current_task;
+static uint8_t current_endpoint;
+static struct sim_clock clocks[RFM22B_SIM_ENDPOINTS];
+static struct sim_radio radios[RFM22B_SIM_ENDPOINTS];
+static struct rfm22b_sim_link air_link;
+static uint32_t frame_counter;
+static uint64_t rng_state;
+
+/* memory owned by the simulation, released by rfm22b_sim_reset() */
+static void *sim_alloc(size_t size)
+{
+    if (num_allocations == max_allocations) {
+        max_allocations = max_allocations ? 2 * max_allocations : 64;
+        allocations     = realloc(allocations, max_allocations * sizeof(*allocations));
+        assert(allocations);
+    }
+    void *p = calloc(1, size);
+    assert(p);
+    allocations[num_allocations++] = p;
+    return p;
+}
+
+/* xorshift64*, uniform in [0, 1) */
+static double rng_uniform(void)
+{
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (double)((rng_state * 2685821657736338717ull) >> 11) / 9007199254740992.0;
+}
+
+
+/*
+ * Event queue, a binary heap ordered by time and then by the order the events were scheduled
+ */
+
+static bool event_before(const struct event *a, const struct event *b)
+{
+    return a->time < b->time || (a->time == b->time && a->seq < b->seq);
+}
+
+static void schedule(uint64_t time, enum event_type type, void *obj, uint32_t gen, uint32_t arg)
+{
+    if (num_events == max_events) {
+        max_events = max_events ? 2 * max_events : 256;
+        events     = realloc(events, max_events * sizeof(*events));
+        assert(events);
+    }
+    struct event ev = { time < now_us ? now_us : time, event_seq++, type, obj, gen, arg };
+    uint32_t i = num_events++;
+    while (i > 0 && event_before(&ev, &events[(i - 1) / 2])) {
+        events[i] = events[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    events[i] = ev;
+}
+
+static struct event pop_event(void)
+{
+    struct event top  = events[0];
+    struct event last = events[--num_events];
+    uint32_t i = 0;
+
+    for (;;) {
+        uint32_t child = 2 * i + 1;
+        if (child >= num_events) {
+            break;
+        }
+        if (child + 1 < num_events && event_before(&events[child + 1], &events[child])) {
+            child++;
+        }
+        if (!event_before(&events[child], &last)) {
+            break;
+        }
+        events[i] = events[child];
+        i = child;
+    }
+    if (num_events > 0) {
+        events[i] = last;
+    }
+    return top;
+}
+
+
+/*
+ * Endpoint clocks
+ */
+
+static portTickType endpoint_ticks(uint8_t endpoint, uint64_t time)
+{
+    return (portTickType)((time * clocks[endpoint].rate + clocks[endpoint].offset_us) / 1000.0);
+}
+
+/* the first simulated time the tick counter of endpoint reads tick */
+static uint64_t endpoint_tick_time(uint8_t endpoint, portTickType tick)
+{
+    double t = ceil((tick * 1000.0 - clocks[endpoint].offset_us) / clocks[endpoint].rate);
+    uint64_t time = t > now_us ? (uint64_t)t : now_us;
+
+    while (endpoint_ticks(endpoint, time) < tick) {
+        time++;
+    }
+    return time;
+}
+
+
+/*
+ * FreeRTOS
+ */
+
+static void task_entry(void)
+{
+    struct sim_task *task = current_task;
+
+    task->code(task->parameters);
+    task->finished = true;
+}
+
+static void task_run(struct sim_task *task)
+{
+    current_task     = task;
+    current_endpoint = task->endpoint;
+    swapcontext(&scheduler_ctx, &task->ctx);
+    current_task     = NULL;
+}
+
+/* suspend the running task until it is woken or ticks have passed */
+static void task_block(portTickType ticks)
+{
+    struct sim_task *task = current_task;
+
+    assert(task);
+    task->wait_gen++;
+    if (ticks != portMAX_DELAY) {
+        schedule(endpoint_tick_time(task->endpoint, endpoint_ticks(task->endpoint, now_us) + ticks), EVENT_TASK, task, task->wait_gen, 0);
+    }
+    swapcontext(&task->ctx, &scheduler_ctx);
+}
+
+portBASE_TYPE xTaskCreate(void (*code)(void *), __attribute__((unused)) const char *name, __attribute__((unused)) uint16_t stack_depth,
+                          void *parameters, __attribute__((unused)) unsigned portBASE_TYPE priority, xTaskHandle *handle)
+{
+    struct sim_task *task = sim_alloc(sizeof(*task));
+
+    task->code       = code;
+    task->parameters = parameters;
+    task->endpoint   = current_endpoint;
+    getcontext(&task->ctx);
+    task->ctx.uc_stack.ss_sp   = sim_alloc(TASK_STACK_SIZE);
+    task->ctx.uc_stack.ss_size = TASK_STACK_SIZE;
+    task->ctx.uc_link = &scheduler_ctx;
+    makecontext(&task->ctx, task_entry, 0);
+    schedule(now_us, EVENT_TASK, task, task->wait_gen, 0);
+    if (handle) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+void vTaskDelay(portTickType ticks)
+{
+    task_block(ticks);
+}
+
+portTickType xTaskGetTickCount(void)
+{
+    return endpoint_ticks(current_endpoint, now_us);
+}
+
+xQueueHandle xQueueCreate(unsigned portBASE_TYPE length, unsigned portBASE_TYPE item_size)
+{
+    struct sim_queue *queue = sim_alloc(sizeof(*queue));
+
+    queue->items     = sim_alloc(length * item_size);
+    queue->item_size = item_size;
+    queue->length    = length;
+    return queue;
+}
+
+/* the driver never waits for room in a queue, a full queue fails like from an ISR */
+portBASE_TYPE xQueueSend(xQueueHandle queue, const void *item, __attribute__((unused)) portTickType ticks)
+{
+    if (queue->count == queue->length) {
+        return errQUEUE_FULL;
+    }
+    memcpy(queue->items + ((queue->head + queue->count) % queue->length) * queue->item_size, item, queue->item_size);
+    queue->count++;
+    return pdTRUE;
+}
+
+portBASE_TYPE xQueueSendFromISR(xQueueHandle queue, const void *item, portBASE_TYPE *woken)
+{
+    *woken = pdFALSE;
+    return xQueueSend(queue, item, 0);
+}
+
+/* the driver only polls its queue */
+portBASE_TYPE xQueueReceive(xQueueHandle queue, void *item, __attribute__((unused)) portTickType ticks)
+{
+    if (queue->count == 0) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
+
+xSemaphoreHandle sim_semaphore_create(bool given)
+{
+    struct sim_semaphore *semaphore = sim_alloc(sizeof(*semaphore));
+
+    semaphore->given = given;
+    return semaphore;
+}
+
+portBASE_TYPE xSemaphoreTake(xSemaphoreHandle semaphore, portTickType ticks)
+{
+    if (semaphore->given) {
+        semaphore->given = false;
+        return pdTRUE;
+    }
+    if (ticks == 0) {
+        return pdFALSE;
+    }
+    assert(!semaphore->waiter);
+    semaphore->waiter     = current_task;
+    current_task->waiting = semaphore;
+    task_block(ticks);
+    return current_task->wake_result;
+}
+
+static portBASE_TYPE semaphore_give(xSemaphoreHandle semaphore, uint32_t latency_us)
+{
+    struct sim_task *task = semaphore->waiter;
+
+    if (task) {
+        semaphore->waiter = NULL;
+        task->waiting     = NULL;
+        task->wake_result = pdTRUE;
+        task->wait_gen++;
+        schedule(now_us + latency_us, EVENT_TASK, task, task->wait_gen, 0);
+        return pdTRUE;
+    }
+    if (semaphore->given) {
+        return errQUEUE_FULL;
+    }
+    semaphore->given = true;
+    return pdTRUE;
+}
+
+portBASE_TYPE xSemaphoreGive(xSemaphoreHandle semaphore)
+{
+    return semaphore_give(semaphore, 0);
+}
+
+portBASE_TYPE xSemaphoreGiveFromISR(xSemaphoreHandle semaphore, portBASE_TYPE *woken)
+{
+    *woken = pdFALSE;
+    return semaphore_give(semaphore, WAKE_LATENCY_US);
+}
+
+static void task_wake(struct sim_task *task, uint32_t gen)
+{
+    if (task->finished || gen != task->wait_gen) {
+        return;
+    }
+    if (task->waiting) {
+        // timed out
+        task->waiting->waiter = NULL;
+        task->waiting     = NULL;
+        task->wake_result = pdFALSE;
+    }
+    task_run(task);
+}
+
+
+/*
+ * Si4432 radio
+ */
+
+static void radio_update_irq(struct sim_radio *radio)
+{
+    bool asserted = (radio->regs[RFM22_interrupt_status1] & radio->regs[RFM22_interrupt_enable1]) ||
+                    (radio->regs[RFM22_interrupt_status2] & radio->regs[RFM22_interrupt_enable2]);
+
+    // the EXTI line triggers on the falling edge of nIRQ
+    if (asserted && !radio->irq_asserted) {
+        schedule(now_us, EVENT_IRQ, radio, 0, 0);
+    }
+    radio->irq_asserted = asserted;
+}
+
+static void radio_latch(struct sim_radio *radio, uint8_t status1, uint8_t status2)
+{
+    radio->regs[RFM22_interrupt_status1] |= status1;
+    radio->regs[RFM22_interrupt_status2] |= status2;
+    radio_update_irq(radio);
+}
+
+static uint32_t radio_bitrate(const struct sim_radio *radio)
+{
+    uint32_t txdr = (radio->regs[RFM22_tx_data_rate1] << 8) | radio->regs[RFM22_tx_data_rate0];
+    uint8_t shift = (radio->regs[RFM22_modulation_mode_control1] & MMC1_TXDTRSCALE) ? 21 : 16;
+
+    return (uint32_t)(((uint64_t)txdr * 1000000 + (1u << (shift - 1))) >> shift);
+}
+
+/* the registers a transmitter and a receiver need to agree on to hear each other */
+static void radio_tuning(const struct sim_radio *radio, uint8_t tuning[7])
+{
+    tuning[0] = radio->regs[RFM22_frequency_offset1];
+    tuning[1] = radio->regs[RFM22_frequency_offset2];
+    tuning[2] = radio->regs[RFM22_frequency_band_select];
+    tuning[3] = radio->regs[RFM22_nominal_carrier_frequency1];
+    tuning[4] = radio->regs[RFM22_nominal_carrier_frequency0];
+    tuning[5] = radio->regs[RFM22_frequency_hopping_channel_select];
+    tuning[6] = radio->regs[RFM22_frequency_hopping_step_size];
+}
+
+static void radio_rx_restart(struct sim_radio *radio)
+{
+    radio->rx_state = RX_PREAMBLE;
+    radio->rx_frame = 0;
+    radio->rx_index = 0;
+}
+
+static void radio_tx_stop(struct sim_radio *radio)
+{
+    radio->tx_gen++;
+    radio->regs[RFM22_op_and_func_ctrl1] &= ~RFM22_opfc1_txon;
+    if (now_us > radio->tx_start) {
+        radio->stats.airtime_us += now_us - radio->tx_start;
+    }
+}
+
+static void radio_reset(struct sim_radio *radio)
+{
+    memset(radio->regs, 0, sizeof(radio->regs));
+    radio->regs[RFM22_DEVICE_TYPE]              = 0x08;
+    radio->regs[RFM22_DEVICE_VERSION]           = RFM22_DEVICE_VERSION_B1;
+    radio->regs[RFM22_interrupt_enable2]        = RFM22_ie2_enpor | RFM22_ie2_enchiprdy;
+    radio->regs[RFM22_op_and_func_ctrl1]        = RFM22_opfc1_xton;
+    radio->regs[RFM22_preamble_length]          = 0x08;
+    radio->regs[RFM22_preamble_detection_ctrl1] = 0x2A;
+    radio->regs[RFM22_tx_data_rate1]            = 0x0A;
+    radio->regs[RFM22_tx_data_rate0]            = 0x3D;
+    radio->regs[RFM22_tx_fifo_control1]         = 0x37;
+    radio->regs[RFM22_tx_fifo_control2]         = 0x04;
+    radio->regs[RFM22_rx_fifo_control]          = 0x37;
+    radio->tx_count     = radio->rx_count = 0;
+    radio->irq_asserted = false;
+    radio->tx_gen++;
+    radio_rx_restart(radio);
+    radio_latch(radio, 0, RFM22_is2_ipor | RFM22_is2_ichiprdy);
+}
+
+static void radio_tx_start(struct sim_radio *radio)
+{
+    uint16_t preamble = (((radio->regs[RFM22_header_control2] & 0x01) << 8) | radio->regs[RFM22_preamble_length]) / 2;
+
+    radio->tx_gen++;
+    radio->frame_id    = ++frame_counter;
+    radio->tx_start    = now_us + TX_STARTUP_US;
+    radio->tx_total    = preamble + SYNC_BYTES + RX_HEADER_BYTES + 1 + radio->regs[RFM22_transmit_packet_length];
+    radio->tx_bitrate  = radio_bitrate(radio);
+    radio->air_bitrate = air_link.bitrate ? air_link.bitrate : radio->tx_bitrate;
+    radio_tuning(radio, radio->tx_tuning);
+    radio->tx_lost     = rng_uniform() < air_link.loss;
+    radio->stats.tx_frames++;
+    if (radio->tx_lost) {
+        radio->stats.lost_frames++;
+    }
+    schedule(radio->tx_start, EVENT_TX_BYTE, radio, radio->tx_gen, 0);
+}
+
+static uint64_t radio_byte_time(const struct sim_radio *radio, uint32_t k)
+{
+    return radio->tx_start + (uint64_t)(k * 8000000.0 / radio->air_bitrate + 0.5);
+}
+
+/* byte k of the frame goes on the air */
+static void radio_tx_byte(struct sim_radio *radio, uint32_t gen, uint32_t k)
+{
+    if (gen != radio->tx_gen) {
+        return;
+    }
+    if (k == radio->tx_total) {
+        radio_tx_stop(radio);
+        radio_latch(radio, RFM22_is1_ipksent, 0);
+        return;
+    }
+
+    uint16_t preamble = radio->tx_total - SYNC_BYTES - RX_HEADER_BYTES - 1 - radio->regs[RFM22_transmit_packet_length];
+    uint8_t byte;
+    if (k < preamble) {
+        byte = PREAMBLE_BYTE;
+    } else if (k < preamble + SYNC_BYTES) {
+        byte = radio->regs[RFM22_sync_word3 + k - preamble];
+    } else if (k < preamble + SYNC_BYTES + RX_HEADER_BYTES) {
+        byte = radio->regs[RFM22_transmit_header3 + k - preamble - SYNC_BYTES];
+    } else if (k == preamble + SYNC_BYTES + RX_HEADER_BYTES) {
+        byte = radio->regs[RFM22_transmit_packet_length];
+    } else if (radio->tx_count == 0) {
+        radio_tx_stop(radio);
+        radio->stats.tx_underruns++;
+        radio_latch(radio, RFM22_is1_ifferr, 0);
+        return;
+    } else {
+        byte = radio->tx_fifo[radio->tx_head];
+        radio->tx_head = (radio->tx_head + 1) % FIFO_SIZE;
+        if (--radio->tx_count == (radio->regs[RFM22_tx_fifo_control2] & RFM22_tx_fifo_control2_mask)) {
+            radio_latch(radio, RFM22_is1_ixtffaem, 0);
+        }
+    }
+
+    if (k >= preamble + SYNC_BYTES && air_link.ber > 0.0f) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (rng_uniform() < air_link.ber) {
+                byte ^= 1 << bit;
+            }
+        }
+    }
+
+    uint64_t end = radio_byte_time(radio, k + 1);
+    if (!radio->tx_lost) {
+        for (uint8_t i = 0; i < RFM22B_SIM_ENDPOINTS; i++) {
+            if (i != radio->index) {
+                schedule(end + air_link.latency_us, EVENT_RX_BYTE, &radios[i], radio->frame_id, byte | (radio->index << 8));
+            }
+        }
+    }
+    schedule(end, EVENT_TX_BYTE, radio, radio->tx_gen, k + 1);
+}
+
+static void radio_rx_byte(struct sim_radio *radio, uint32_t frame_id, uint32_t arg)
+{
+    const struct sim_radio *tx = &radios[arg >> 8];
+    uint8_t byte = arg & 0xff;
+    uint8_t tuning[7];
+
+    // the transmitter has moved on, or the receiver is off or elsewhere
+    radio_tuning(radio, tuning);
+    if (tx->frame_id != frame_id || !(radio->regs[RFM22_op_and_func_ctrl1] & RFM22_opfc1_rxon) ||
+        memcmp(tuning, tx->tx_tuning, sizeof(tuning)) != 0 || radio_bitrate(radio) != tx->tx_bitrate) {
+        return;
+    }
+    if (radio->rx_frame != frame_id) {
+        // the bytes of another frame interrupt the packet
+        if (radio->rx_state > RX_SYNC) {
+            radio_rx_restart(radio);
+        }
+        radio->rx_frame = frame_id;
+    }
+
+    switch (radio->rx_state) {
+    case RX_PREAMBLE:
+        if (byte == 0xAA || byte == 0x55) {
+            radio->rx_index += 2;
+            if (radio->rx_index >= (radio->regs[RFM22_preamble_detection_ctrl1] >> 3)) {
+                radio->rx_state = RX_SYNC;
+                radio->rx_index = 0;
+                radio_latch(radio, 0, RFM22_is2_ipreaval);
+            }
+        } else {
+            radio->rx_index = 0;
+        }
+        break;
+    case RX_SYNC:
+        if (byte == radio->regs[RFM22_sync_word3 + radio->rx_index]) {
+            if (++radio->rx_index == SYNC_BYTES) {
+                radio->rx_state = RX_HEADER;
+                radio->rx_index = 0;
+                radio_latch(radio, 0, RFM22_is2_iswdet);
+            }
+        } else if (byte == 0xAA || byte == 0x55) {
+            radio->rx_index = 0;
+        } else {
+            radio_rx_restart(radio);
+        }
+        break;
+    case RX_HEADER:
+    {
+        uint8_t i = radio->rx_index;
+        bool broadcast = (radio->regs[RFM22_header_control1] & (RFM22_header_cntl1_bcen_3 >> i)) && byte == 0xFF;
+        radio->regs[RFM22_received_header3 + i] = byte;
+        if (!broadcast && ((byte ^ radio->regs[RFM22_check_header3 + i]) & radio->regs[RFM22_header_enable3 + i])) {
+            radio_rx_restart(radio);
+        } else if (++radio->rx_index == RX_HEADER_BYTES) {
+            radio->rx_state = RX_LENGTH;
+        }
+        break;
+    }
+    case RX_LENGTH:
+        radio->regs[RFM22_received_packet_length] = byte;
+        radio->rx_state = RX_PAYLOAD;
+        radio->rx_index = 0;
+        if (byte == 0) {
+            radio->regs[RFM22_op_and_func_ctrl1] &= ~RFM22_opfc1_rxon;
+            radio->stats.rx_frames++;
+            radio_rx_restart(radio);
+            radio_latch(radio, RFM22_is1_ipkvalid, 0);
+        }
+        break;
+    case RX_PAYLOAD:
+        if (radio->rx_count == FIFO_SIZE) {
+            radio->stats.rx_overruns++;
+            radio_rx_restart(radio);
+            radio_latch(radio, RFM22_is1_ifferr, 0);
+            break;
+        }
+        radio->rx_fifo[(radio->rx_head + radio->rx_count) % FIFO_SIZE] = byte;
+        if (++radio->rx_count == (radio->regs[RFM22_rx_fifo_control] & RFM22_rx_fifo_control_mask)) {
+            radio_latch(radio, RFM22_is1_irxffafull, 0);
+        }
+        if (++radio->rx_index == radio->regs[RFM22_received_packet_length]) {
+            // leave RX after a packet, rxmpk is not set
+            radio->regs[RFM22_op_and_func_ctrl1] &= ~RFM22_opfc1_rxon;
+            radio->stats.rx_frames++;
+            radio_rx_restart(radio);
+            radio_latch(radio, RFM22_is1_ipkvalid, 0);
+        }
+        break;
+    }
+}
+
+static void radio_write(struct sim_radio *radio, uint8_t addr, uint8_t value)
+{
+    uint8_t old = radio->regs[addr];
+
+    switch (addr) {
+    case RFM22_DEVICE_TYPE:
+    case RFM22_DEVICE_VERSION:
+    case RFM22_device_status:
+    case RFM22_interrupt_status1:
+    case RFM22_interrupt_status2:
+        break;
+    case RFM22_op_and_func_ctrl1:
+        if (value & RFM22_opfc1_swres) {
+            radio_reset(radio);
+            break;
+        }
+        radio->regs[addr] = value;
+        if ((value & RFM22_opfc1_txon) && !(old & RFM22_opfc1_txon)) {
+            radio_tx_start(radio);
+        } else if (!(value & RFM22_opfc1_txon) && (old & RFM22_opfc1_txon)) {
+            radio_tx_stop(radio);
+        }
+        if ((value & RFM22_opfc1_rxon) && !(old & RFM22_opfc1_rxon)) {
+            radio_rx_restart(radio);
+        }
+        break;
+    case RFM22_op_and_func_ctrl2:
+        radio->regs[addr] = value;
+        if (value & RFM22_opfc2_ffclrtx) {
+            radio->tx_count = 0;
+        }
+        if (value & RFM22_opfc2_ffclrrx) {
+            radio->rx_count = 0;
+        }
+        break;
+    case RFM22_interrupt_enable1:
+    case RFM22_interrupt_enable2:
+        radio->regs[addr] = value;
+        radio_update_irq(radio);
+        break;
+    case RFM22_frequency_offset1:
+    case RFM22_frequency_offset2:
+    case RFM22_frequency_band_select:
+    case RFM22_nominal_carrier_frequency1:
+    case RFM22_nominal_carrier_frequency0:
+    case RFM22_frequency_hopping_channel_select:
+    case RFM22_frequency_hopping_step_size:
+        radio->regs[addr] = value;
+        if (value != old) {
+            radio_rx_restart(radio);
+        }
+        break;
+    case RFM22_sync_word3:
+    case RFM22_sync_word2:
+    case RFM22_sync_word1:
+    case RFM22_sync_word0:
+        radio->regs[addr] = radio->sync_word ? (radio->sync_word >> (8 * (RFM22_sync_word0 - addr))) & 0xff : value;
+        break;
+    case RFM22_fifo_access:
+        if (radio->tx_count == FIFO_SIZE) {
+            radio_latch(radio, RFM22_is1_ifferr, 0);
+        } else {
+            radio->tx_fifo[(radio->tx_head + radio->tx_count++) % FIFO_SIZE] = value;
+        }
+        break;
+    default:
+        radio->regs[addr] = value;
+        break;
+    }
+}
+
+static uint8_t radio_read(struct sim_radio *radio, uint8_t addr)
+{
+    uint8_t value = radio->regs[addr];
+
+    switch (addr) {
+    case RFM22_interrupt_status1:
+    case RFM22_interrupt_status2:
+        // cleared by reading
+        radio->regs[addr] = 0;
+        radio_update_irq(radio);
+        break;
+    case RFM22_rssi:
+    {
+        int rssi = (air_link.rssi_dbm + 122) * 2;
+        value = rssi < 0 ? 0 : (rssi > 255 ? 255 : rssi);
+        break;
+    }
+    case RFM22_fifo_access:
+        if (radio->rx_count == 0) {
+            value = 0xFF;
+            radio_latch(radio, RFM22_is1_ifferr, 0);
+        } else {
+            value = radio->rx_fifo[radio->rx_head];
+            radio->rx_head = (radio->rx_head + 1) % FIFO_SIZE;
+            radio->rx_count--;
+        }
+        break;
+    }
+    return value;
+}
+
+/* one byte of an SPI transaction, the first one is the address, registers other than the FIFO auto increment */
+static uint8_t radio_spi_byte(struct sim_radio *radio, uint8_t mosi)
+{
+    uint8_t miso = 0xFF;
+
+    if (!radio->spi_addressed) {
+        radio->spi_addressed = true;
+        radio->spi_write     = mosi & 0x80;
+        radio->spi_addr      = mosi & 0x7F;
+        return miso;
+    }
+    if (radio->spi_write) {
+        radio_write(radio, radio->spi_addr, mosi);
+    } else {
+        miso = radio_read(radio, radio->spi_addr);
+    }
+    if (radio->spi_addr != RFM22_fifo_access) {
+        radio->spi_addr = (radio->spi_addr + 1) & 0x7F;
+    }
+    return miso;
+}
+
+static struct sim_radio *spi_radio(uint32_t spi_id)
+{
+    assert(spi_id >= 1 && spi_id <= RFM22B_SIM_ENDPOINTS);
+    return &radios[spi_id - 1];
+}
+
+
+/*
+ * PIOS functions below the driver
+ */
+
+int32_t PIOS_SPI_RC_PinSet(uint32_t spi_id, __attribute__((unused)) uint32_t slave_id, uint8_t pin_value)
+{
+    // a transaction starts with chip select going low
+    if (pin_value == 0) {
+        spi_radio(spi_id)->spi_addressed = false;
+    }
+    return 0;
+}
+
+int32_t PIOS_SPI_TransferByte(uint32_t spi_id, uint8_t b)
+{
+    return radio_spi_byte(spi_radio(spi_id), b);
+}
+
+int32_t PIOS_SPI_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer, uint8_t *receive_buffer, uint16_t len, __attribute__((unused)) void *callback)
+{
+    struct sim_radio *radio = spi_radio(spi_id);
+
+    for (uint16_t i = 0; i < len; i++) {
+        uint8_t miso = radio_spi_byte(radio, send_buffer ? send_buffer[i] : 0xFF);
+        if (receive_buffer) {
+            receive_buffer[i] = miso;
+        }
+    }
+    return 0;
+}
+
+int32_t PIOS_SPI_ClaimBus(__attribute__((unused)) uint32_t spi_id)
+{
+    return 0;
+}
+
+int32_t PIOS_SPI_ReleaseBus(__attribute__((unused)) uint32_t spi_id)
+{
+    return 0;
+}
+
+int32_t PIOS_EXTI_Init(__attribute__((unused)) const struct pios_exti_cfg *cfg)
+{
+    return 0;
+}
+
+int32_t PIOS_DELAY_WaituS(__attribute__((unused)) uint32_t uS)
+{
+    return 0;
+}
+
+int32_t PIOS_DELAY_WaitmS(__attribute__((unused)) uint32_t mS)
+{
+    return 0;
+}
+
+int32_t PIOS_SYS_SerialNumberGet(char str[PIOS_SYS_SERIAL_NUM_ASCII_LEN + 1])
+{
+    snprintf(str, PIOS_SYS_SERIAL_NUM_ASCII_LEN + 1, "SIMULATED%015u", current_endpoint);
+    return 0;
+}
+
+
+/*
+ * Simulation control
+ */
+
+void rfm22b_sim_reset(uint32_t seed)
+{
+    for (uint32_t i = 0; i < num_allocations; i++) {
+        free(allocations[i]);
+    }
+    num_allocations  = 0;
+    num_events       = 0;
+    now_us           = 0;
+    current_task     = NULL;
+    current_endpoint = 0;
+    frame_counter    = 0;
+    rng_state        = 0x9E3779B97F4A7C15ull ^ seed;
+    memset(&air_link, 0, sizeof(air_link));
+    air_link.rssi_dbm    = -60;
+    for (uint8_t i = 0; i < RFM22B_SIM_ENDPOINTS; i++) {
+        memset(&radios[i], 0, sizeof(radios[i]));
+        radios[i].index      = i;
+        clocks[i].offset_us  = 0.0;
+        clocks[i].rate       = 1.0;
+        radio_reset(&radios[i]);
+    }
+    // the power on events are not interesting
+    num_events = 0;
+}
+
+void rfm22b_sim_set_link(const struct rfm22b_sim_link *new_link)
+{
+    air_link = *new_link;
+}
+
+void rfm22b_sim_set_clock(uint8_t endpoint, uint32_t offset_us, float drift_ppm)
+{
+    assert(endpoint < RFM22B_SIM_ENDPOINTS);
+    clocks[endpoint].offset_us = offset_us;
+    clocks[endpoint].rate      = 1.0 + drift_ppm * 1e-6;
+}
+
+void rfm22b_sim_set_sync_word(uint8_t endpoint, uint32_t sync_word)
+{
+    assert(endpoint < RFM22B_SIM_ENDPOINTS);
+    radios[endpoint].sync_word = sync_word;
+}
+
+void rfm22b_sim_select(uint8_t endpoint)
+{
+    assert(endpoint < RFM22B_SIM_ENDPOINTS);
+    current_endpoint = endpoint;
+}
+
+uint32_t rfm22b_sim_spi_id(uint8_t endpoint)
+{
+    return endpoint + 1;
+}
+
+uint64_t rfm22b_sim_time_us(void)
+{
+    return now_us;
+}
+
+void rfm22b_sim_every(uint8_t endpoint, uint32_t period_us, void (*fn)(void *ctx), void *ctx)
+{
+    struct sim_callback *callback = sim_alloc(sizeof(*callback));
+
+    callback->fn        = fn;
+    callback->ctx       = ctx;
+    callback->period_us = period_us;
+    callback->endpoint  = endpoint;
+    schedule(now_us + period_us, EVENT_CALLBACK, callback, 0, 0);
+}
+
+void rfm22b_sim_run(uint32_t duration_us)
+{
+    uint64_t end = now_us + duration_us;
+    uint8_t selected = current_endpoint;
+
+    while (num_events > 0 && events[0].time <= end) {
+        struct event ev = pop_event();
+        now_us = ev.time;
+        switch (ev.type) {
+        case EVENT_TASK:
+            task_wake(ev.obj, ev.gen);
+            break;
+        case EVENT_IRQ:
+            current_endpoint = ((struct sim_radio *)ev.obj)->index;
+            rfm22b_sim_irq(rfm22b_sim_spi_id(current_endpoint));
+            break;
+        case EVENT_TX_BYTE:
+            radio_tx_byte(ev.obj, ev.gen, ev.arg);
+            break;
+        case EVENT_RX_BYTE:
+            radio_rx_byte(ev.obj, ev.gen, ev.arg);
+            break;
+        case EVENT_CALLBACK:
+        {
+            struct sim_callback *callback = ev.obj;
+            current_endpoint = callback->endpoint;
+            callback->fn(callback->ctx);
+            schedule(now_us + callback->period_us, EVENT_CALLBACK, callback, 0, 0);
+            break;
+        }
+        }
+    }
+    now_us = end;
+    current_endpoint = selected;
+}
+
+void rfm22b_sim_get_stats(uint8_t endpoint, struct rfm22b_sim_stats *stats)
+{
+    assert(endpoint < RFM22B_SIM_ENDPOINTS);
+    *stats = radios[endpoint].stats;
+}
@@ -0,0 +1,76 @@
+#ifndef RFM22B_SIM_H
+#define RFM22B_SIM_H
+
+/*
+ * A discrete event simulation of two OPLink endpoints, each an Si4432 radio
+ * behind the SPI and EXTI calls of the RFM22B driver, FreeRTOS tasks running as
+ * coroutines and a tick counter with its own offset and drift.  The radios
+ * exchange bytes over the air in simulated time, through a link that can lose
+ * frames, flip bits and add latency.  Nothing depends on the host's speed, a
+ * run with the same seed always gives the same result.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RFM22B_SIM_ENDPOINTS 2
+
+struct rfm22b_sim_link {
+    float    loss; // probability that a whole frame is lost
+    float    ber; // bit error rate of the bytes after the sync word
+    uint32_t latency_us; // from the end of a byte at the transmitter to the receiver
+    uint32_t bitrate; // air bitrate, 0 for the one programmed into the radios
+    int8_t   rssi_dbm;
+};
+
+struct rfm22b_sim_stats {
+    uint32_t tx_frames; // frames started
+    uint32_t tx_underruns; // frames aborted by an empty TX FIFO
+    uint32_t rx_frames; // frames that raised ipkvalid
+    uint32_t rx_overruns; // frames aborted by a full RX FIFO
+    uint32_t lost_frames; // frames from this endpoint the link dropped
+    uint64_t airtime_us; // time spent transmitting
+};
+
+/* forget all endpoints, tasks and pending events, the link is reset to a perfect one */
+void rfm22b_sim_reset(uint32_t seed);
+
+void rfm22b_sim_set_link(const struct rfm22b_sim_link *link);
+
+/* the tick counter of an endpoint runs offset_us ahead and drift_ppm faster than simulated time */
+void rfm22b_sim_set_clock(uint8_t endpoint, uint32_t offset_us, float drift_ppm);
+
+/*
+ * the radio of an endpoint uses this sync word, sync_word3 in the top byte, whatever the
+ * driver programs, e.g. to stand in for a firmware with another air format; 0 to reset
+ */
+void rfm22b_sim_set_sync_word(uint8_t endpoint, uint32_t sync_word);
+
+/* driver calls made from outside a task act on this endpoint, e.g. its serial number and tick count */
+void rfm22b_sim_select(uint8_t endpoint);
+
+/* the SPI bus id to pass to PIOS_RFM22B_Init() for an endpoint's radio */
+uint32_t rfm22b_sim_spi_id(uint8_t endpoint);
+
+uint64_t rfm22b_sim_time_us(void);
+
+/* call fn(ctx) every period_us in simulated time, with the endpoint selected */
+void rfm22b_sim_every(uint8_t endpoint, uint32_t period_us, void (*fn)(void *ctx), void *ctx);
+
+/* run the simulation for a while */
+void rfm22b_sim_run(uint32_t duration_us);
+
+void rfm22b_sim_get_stats(uint8_t endpoint, struct rfm22b_sim_stats *stats);
+
+/* implemented next to the driver: run the EXTI vector for the radio on the bus spi_id */
+void rfm22b_sim_irq(uint32_t spi_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RFM22B_SIM_H */
@@ -0,0 +1,18 @@
+/*
+ * The driver keeps the device of its EXTI vector in a file static, so it can
+ * only serve one radio per firmware.  It is built here to run two of them.
+ */
+
+#include "pios_rfm22b.c"
+
+#include "rfm22b_sim.h"
+
+void rfm22b_sim_irq(uint32_t spi_id)
+{
+    for (uint8_t i = 0; i < pios_rfm22b_num_devs; i++) {
+        if (pios_rfm22b_devs[i].spi_id == spi_id) {
+            g_rfm22b_dev = &pios_rfm22b_devs[i];
+        }
+    }
+    PIOS_RFM22_EXT_Int();
+}
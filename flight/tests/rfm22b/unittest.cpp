@@ -0,0 +1,567 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memset */
+
+extern "C" {
+#include "pios.h"
+#include "pios_rfm22b.h"
+#include "pios_rfm22b_com.h"
+#include "oplinkstatus.h"
+#include "rfm22b_sim.h"
+}
+
+/*
+ * RadioComBridge needs the generated UAVObjects and UAVTalk, so the test plays
+ * its part: each endpoint streams UAVTalk objects into a PIOS_COM port on the
+ * RFM22B COM driver, some of them acked with the retry timing of the telemetry
+ * module, and the coordinator sends PPM to the remote like a ground station
+ * with a transmitter.  The remote can also trickle a byte pattern into the
+ * auxiliary COM port, the way a serial device bridged over the link would.
+ */
+
+#define COORDINATOR     0
+#define REMOTE          1
+#define COM_BUFFER_LEN  256
+
+#define SYNC_VAL        0x3C // UAVTALK_SYNC_VAL
+#define TYPE_OBJ        0x20
+#define TYPE_OBJ_ACK    0x22
+#define TYPE_ACK        0x23
+#define HEADER_LENGTH   10 // sync, type, length, object id, instance id
+#define OBJECT_LENGTH   40
+#define ACK_EVERY       8 // every 8th object is sent with an ack request
+#define ACK_TIMEOUT_US  250000 // REQ_TIMEOUT_MS of the telemetry module
+#define ACK_RETRIES     2
+
+#define TELEMETRY_PERIOD_US 1000
+
+/*
+ * The driver only updates the link quality, and with it whether the COM port
+ * takes data, when it is asked for its stats.  The coordinator stands for a
+ * ground OPLink, the remote for the flight controller.
+ */
+#define OPLINK_STATUS_PERIOD_US 1000000 // SYSTEM_UPDATE_PERIOD_MS of the OPLink module
+#define SYSTEM_STATUS_PERIOD_US 250000 // SYSTEM_UPDATE_PERIOD_MS of the system module
+#define PPM_PERIOD_US   20000
+#define PPM_SEQUENCES   500
+#define CONNECT_STEP_US 100000
+#define CONNECT_TIMEOUT_US 60000000
+#define SETTLE_US       1000000
+#define AUX_PERIOD_US   20000
+#define AUX_CHUNK       4
+
+struct endpoint {
+    uint32_t rfm22b_id;
+    uint32_t com_id;
+    uint32_t aux_com_id;
+    uint8_t  link_state;
+    uint8_t  rx_buffer[COM_BUFFER_LEN];
+    uint8_t  tx_buffer[COM_BUFFER_LEN];
+    uint8_t  aux_rx_buffer[COM_BUFFER_LEN];
+    uint8_t  aux_tx_buffer[COM_BUFFER_LEN];
+
+    // sender
+    bool     sending;
+    uint32_t next_object;
+    bool     waiting_ack;
+    uint32_t ack_object;
+    uint64_t ack_sent_us;
+    uint64_t ack_deadline_us;
+    uint8_t  ack_retries;
+    bool     ack_reply_pending;
+    uint32_t ack_reply_object;
+
+    // receiver
+    uint8_t  frame[HEADER_LENGTH + OBJECT_LENGTH + 1];
+    uint16_t frame_count;
+    uint16_t frame_length;
+
+    // results
+    uint32_t objects_sent;
+    uint32_t objects_received;
+    uint32_t bytes_received;
+    uint32_t crc_errors;
+    uint32_t acks_received;
+    uint32_t retries;
+    uint32_t failures;
+    uint64_t ack_rtt_sum_us;
+    uint64_t ack_rtt_max_us;
+    uint32_t aux_sent;
+    uint32_t aux_received;
+    uint32_t aux_errors;
+};
+
+struct ppm_results {
+    uint64_t sent_us[PPM_SEQUENCES];
+    uint16_t sequence;
+    int32_t  last_received;
+    uint32_t received;
+    uint64_t latency_sum_us;
+    uint64_t latency_max_us;
+};
+
+struct link_results {
+    float    throughput[RFM22B_SIM_ENDPOINTS]; // UAVTalk bytes per second received by the endpoint
+    uint32_t retries;
+    uint32_t failures;
+    uint32_t crc_errors;
+    float    ack_rtt_ms;
+    float    ppm_latency_ms;
+    float    ppm_latency_max_ms;
+    uint32_t ppm_received;
+    struct rfm22b_stats radio[RFM22B_SIM_ENDPOINTS];
+};
+
+static struct endpoint endpoints[RFM22B_SIM_ENDPOINTS];
+static struct ppm_results ppm;
+
+static const struct pios_exti_cfg exti_cfg = { NULL };
+static const struct pios_rfm22b_cfg rfm22b_cfg = {
+    NULL, &exti_cfg, 127, 0, GPIO0_TX_GPIO1_RX,
+};
+
+static uint16_t build_frame(uint8_t *buf, uint8_t type, uint32_t objid, uint16_t length)
+{
+    uint16_t size = HEADER_LENGTH + length;
+
+    buf[0] = SYNC_VAL;
+    buf[1] = type;
+    buf[2] = size & 0xff;
+    buf[3] = size >> 8;
+    memcpy(&buf[4], &objid, sizeof(objid));
+    buf[8] = 0;
+    buf[9] = 0;
+    for (uint16_t i = 0; i < length; i++) {
+        buf[HEADER_LENGTH + i] = (uint8_t)(objid * 7 + i);
+    }
+    buf[size] = PIOS_CRC_updateCRC(0, buf, size);
+    return size + 1;
+}
+
+static bool send_object(struct endpoint *ep, uint32_t object, uint8_t type)
+{
+    uint8_t buf[HEADER_LENGTH + OBJECT_LENGTH + 1];
+    uint16_t len = build_frame(buf, type, object, OBJECT_LENGTH);
+
+    return PIOS_COM_SendBufferNonBlocking(ep->com_id, buf, len) == len;
+}
+
+static void frame_received(struct endpoint *ep)
+{
+    uint32_t objid;
+
+    memcpy(&objid, &ep->frame[4], sizeof(objid));
+    switch (ep->frame[1]) {
+    case TYPE_OBJ_ACK:
+        ep->ack_reply_pending = true;
+        ep->ack_reply_object  = objid;
+    // fall through
+    case TYPE_OBJ:
+        ep->objects_received++;
+        ep->bytes_received += ep->frame_length;
+        break;
+    case TYPE_ACK:
+        if (ep->waiting_ack && objid == ep->ack_object) {
+            uint64_t rtt = rfm22b_sim_time_us() - ep->ack_sent_us;
+            ep->waiting_ack     = false;
+            ep->acks_received++;
+            ep->ack_rtt_sum_us += rtt;
+            if (rtt > ep->ack_rtt_max_us) {
+                ep->ack_rtt_max_us = rtt;
+            }
+        }
+        ep->bytes_received += ep->frame_length;
+        break;
+    }
+}
+
+static void parse(struct endpoint *ep, const uint8_t *data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        if (ep->frame_count == 0 && data[i] != SYNC_VAL) {
+            continue;
+        }
+        ep->frame[ep->frame_count++] = data[i];
+        if (ep->frame_count == 4) {
+            ep->frame_length = (ep->frame[2] | (ep->frame[3] << 8)) + 1;
+            if (ep->frame_length < HEADER_LENGTH + 1 || ep->frame_length > sizeof(ep->frame)) {
+                ep->crc_errors++;
+                ep->frame_count = 0;
+            }
+        } else if (ep->frame_count > 4 && ep->frame_count == ep->frame_length) {
+            if (PIOS_CRC_updateCRC(0, ep->frame, ep->frame_length - 1) == ep->frame[ep->frame_length - 1]) {
+                frame_received(ep);
+            } else {
+                ep->crc_errors++;
+            }
+            ep->frame_count = 0;
+        }
+    }
+}
+
+/* the telemetry side of an endpoint, run every millisecond */
+static void telemetry(void *ctx)
+{
+    struct endpoint *ep = (struct endpoint *)ctx;
+    uint8_t buf[64];
+    uint16_t len;
+
+    while ((len = PIOS_COM_ReceiveBuffer(ep->com_id, buf, sizeof(buf), 0)) > 0) {
+        parse(ep, buf, len);
+    }
+    while ((len = PIOS_COM_ReceiveBuffer(ep->aux_com_id, buf, sizeof(buf), 0)) > 0) {
+        for (uint16_t i = 0; i < len; i++, ep->aux_received++) {
+            if (buf[i] != (uint8_t)ep->aux_received) {
+                ep->aux_errors++;
+            }
+        }
+    }
+
+    if (ep->ack_reply_pending) {
+        uint16_t ack_len = build_frame(buf, TYPE_ACK, ep->ack_reply_object, 0);
+        if (PIOS_COM_SendBufferNonBlocking(ep->com_id, buf, ack_len) == ack_len) {
+            ep->ack_reply_pending = false;
+        }
+    }
+
+    if (!ep->sending) {
+        return;
+    }
+
+    // the telemetry task waits for the ack of an object before it sends the next one
+    if (ep->waiting_ack) {
+        if (rfm22b_sim_time_us() < ep->ack_deadline_us) {
+            return;
+        }
+        if (ep->ack_retries == 0) {
+            ep->failures++;
+            ep->waiting_ack = false;
+        } else if (send_object(ep, ep->ack_object, TYPE_OBJ_ACK)) {
+            ep->ack_retries--;
+            ep->retries++;
+            ep->ack_deadline_us = rfm22b_sim_time_us() + ACK_TIMEOUT_US;
+            return;
+        } else {
+            return;
+        }
+    }
+
+    for (;;) {
+        uint32_t object = ep->next_object;
+        uint8_t type    = (object % ACK_EVERY == ACK_EVERY - 1) ? TYPE_OBJ_ACK : TYPE_OBJ;
+        if (!send_object(ep, object, type)) {
+            break;
+        }
+        ep->next_object++;
+        ep->objects_sent++;
+        if (type == TYPE_OBJ_ACK) {
+            ep->waiting_ack     = true;
+            ep->ack_object      = object;
+            ep->ack_retries     = ACK_RETRIES;
+            ep->ack_sent_us     = rfm22b_sim_time_us();
+            ep->ack_deadline_us = ep->ack_sent_us + ACK_TIMEOUT_US;
+            break;
+        }
+    }
+}
+
+/* the auxiliary stream of the remote: a counting byte pattern */
+static void aux_send(void *ctx)
+{
+    struct endpoint *ep = (struct endpoint *)ctx;
+    uint8_t buf[AUX_CHUNK];
+
+    for (uint8_t i = 0; i < AUX_CHUNK; i++) {
+        buf[i] = (uint8_t)(ep->aux_sent + i);
+    }
+    if (PIOS_COM_SendBufferNonBlocking(ep->aux_com_id, buf, AUX_CHUNK) == AUX_CHUNK) {
+        ep->aux_sent += AUX_CHUNK;
+    }
+}
+
+/* the status update of the OPLink module or, on the flight side, the system module */
+static void link_status(void *ctx)
+{
+    struct endpoint *ep = (struct endpoint *)ctx;
+    struct rfm22b_stats stats;
+
+    PIOS_RFM22B_GetStats(ep->rfm22b_id, &stats);
+    ep->link_state = stats.link_state;
+}
+
+/* the coordinator sends a sequence number in the first channel */
+static void ppm_send(__attribute__((unused)) void *ctx)
+{
+    int16_t channels[RFM22B_PPM_NUM_CHANNELS];
+
+    ppm.sequence = (ppm.sequence + 1) % PPM_SEQUENCES;
+    ppm.sent_us[ppm.sequence] = rfm22b_sim_time_us();
+    channels[0] = 1000 + 2 * ppm.sequence;
+    for (uint8_t i = 1; i < RFM22B_PPM_NUM_CHANNELS; i++) {
+        channels[i] = 1500;
+    }
+    PIOS_RFM22B_PPMSet(endpoints[COORDINATOR].rfm22b_id, channels, RFM22B_PPM_NUM_CHANNELS);
+}
+
+static void ppm_received(__attribute__((unused)) uint32_t context, const int16_t *channels)
+{
+    int32_t sequence = (channels[0] - 1000) / 2;
+
+    // every packet repeats the last channel values, only the first one counts
+    if (sequence < 0 || sequence >= PPM_SEQUENCES || sequence == ppm.last_received) {
+        return;
+    }
+    uint64_t latency = rfm22b_sim_time_us() - ppm.sent_us[sequence];
+    ppm.last_received   = sequence;
+    ppm.received++;
+    ppm.latency_sum_us += latency;
+    if (latency > ppm.latency_max_us) {
+        ppm.latency_max_us = latency;
+    }
+}
+
+/*
+ * Bring up both endpoints in the order the OPLink board setup does and run
+ * until the link is up.  Returns the time that took, in simulated seconds.
+ */
+static float link_start(enum rfm22b_datarate datarate, bool data_mode, bool ppm_mode)
+{
+    memset(endpoints, 0, sizeof(endpoints));
+    memset(&ppm, 0, sizeof(ppm));
+    ppm.last_received = -1;
+
+    for (uint8_t i = 0; i < RFM22B_SIM_ENDPOINTS; i++) {
+        struct endpoint *ep = &endpoints[i];
+        bool coordinator    = (i == COORDINATOR);
+
+        rfm22b_sim_select(i);
+        EXPECT_EQ(0, PIOS_RFM22B_Init(&ep->rfm22b_id, rfm22b_sim_spi_id(i), 0, &rfm22b_cfg, OPLINKSETTINGS_RFBAND_433MHZ));
+        EXPECT_EQ(0, PIOS_COM_Init(&ep->com_id, &pios_rfm22b_com_driver, ep->rfm22b_id,
+                                   ep->rx_buffer, sizeof(ep->rx_buffer), ep->tx_buffer, sizeof(ep->tx_buffer)));
+        EXPECT_EQ(0, PIOS_COM_Init(&ep->aux_com_id, &pios_rfm22b_aux_com_driver, ep->rfm22b_id,
+                                   ep->aux_rx_buffer, sizeof(ep->aux_rx_buffer), ep->aux_tx_buffer, sizeof(ep->aux_tx_buffer)));
+        PIOS_RFM22B_SetDeviceID(ep->rfm22b_id, 0);
+        PIOS_RFM22B_SetCoordinatorID(ep->rfm22b_id, coordinator ? 0 : PIOS_RFM22B_DeviceID(endpoints[COORDINATOR].rfm22b_id));
+        PIOS_RFM22B_SetXtalCap(ep->rfm22b_id, 127);
+        PIOS_RFM22B_SetChannelConfig(ep->rfm22b_id, datarate, 0, 250, coordinator, data_mode, ppm_mode);
+        PIOS_RFM22B_SetTxPower(ep->rfm22b_id, RFM22_tx_pwr_txpow_7);
+        if (!coordinator) {
+            PIOS_RFM22B_SetPPMCallback(ep->rfm22b_id, ppm_received, 0);
+        }
+        PIOS_RFM22B_Reinit(ep->rfm22b_id);
+        ep->sending = data_mode;
+        rfm22b_sim_every(i, TELEMETRY_PERIOD_US, telemetry, ep);
+        rfm22b_sim_every(i, coordinator ? OPLINK_STATUS_PERIOD_US : SYSTEM_STATUS_PERIOD_US, link_status, ep);
+    }
+    if (ppm_mode) {
+        rfm22b_sim_every(COORDINATOR, PPM_PERIOD_US, ppm_send, NULL);
+    }
+
+    // a PPM only link is one way, the coordinator never hears from the remote
+    bool one_way = ppm_mode && (!data_mode || datarate <= RFM22_datarate_9600);
+    while (rfm22b_sim_time_us() < CONNECT_TIMEOUT_US &&
+           (endpoints[REMOTE].link_state != OPLINKSTATUS_LINKSTATE_CONNECTED ||
+            (!one_way && endpoints[COORDINATOR].link_state != OPLINKSTATUS_LINKSTATE_CONNECTED))) {
+        rfm22b_sim_run(CONNECT_STEP_US);
+    }
+    float connect_s = rfm22b_sim_time_us() / 1e6f;
+    rfm22b_sim_run(SETTLE_US);
+    return connect_s;
+}
+
+/* keep streaming for a while, counting from the time the link is up */
+static void link_measure(uint32_t duration_us, struct link_results *results)
+{
+    memset(results, 0, sizeof(*results));
+    for (uint8_t i = 0; i < RFM22B_SIM_ENDPOINTS; i++) {
+        struct endpoint *ep = &endpoints[i];
+        ep->objects_sent     = ep->objects_received = ep->bytes_received = ep->crc_errors = 0;
+        ep->acks_received    = ep->retries = ep->failures = 0;
+        ep->ack_rtt_sum_us   = ep->ack_rtt_max_us = 0;
+    }
+    ppm.received       = 0;
+    ppm.latency_sum_us = ppm.latency_max_us = 0;
+
+    rfm22b_sim_run(duration_us);
+
+    uint32_t acks = 0;
+    uint64_t ack_rtt_sum_us = 0;
+    for (uint8_t i = 0; i < RFM22B_SIM_ENDPOINTS; i++) {
+        struct endpoint *ep = &endpoints[i];
+        results->throughput[i] = ep->bytes_received * 1e6f / duration_us;
+        results->retries      += ep->retries;
+        results->failures     += ep->failures;
+        results->crc_errors   += ep->crc_errors;
+        acks += ep->acks_received;
+        ack_rtt_sum_us        += ep->ack_rtt_sum_us;
+        rfm22b_sim_select(i);
+        PIOS_RFM22B_GetStats(ep->rfm22b_id, &results->radio[i]);
+    }
+    results->ack_rtt_ms = acks ? ack_rtt_sum_us / 1000.0f / acks : 0.0f;
+    results->ppm_received = ppm.received;
+    if (ppm.received) {
+        results->ppm_latency_ms     = ppm.latency_sum_us / 1000.0f / ppm.received;
+        results->ppm_latency_max_ms = ppm.latency_max_us / 1000.0f;
+    }
+}
+
+static void expect_connected(const struct link_results &results, bool one_way = false)
+{
+    EXPECT_EQ(OPLINKSTATUS_LINKSTATE_CONNECTED, results.radio[REMOTE].link_state);
+    if (!one_way) {
+        EXPECT_EQ(OPLINKSTATUS_LINKSTATE_CONNECTED, results.radio[COORDINATOR].link_state);
+    }
+}
+
+static const char *datarate_names[] = { "9600", "19200", "32000", "57600", "64000", "100000", "128000", "192000", "256000" };
+
+// To use a test fixture, derive a class from testing::Test.
+class RFM22BLinkTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        rfm22b_sim_reset(1234);
+    }
+};
+
+TEST_F(RFM22BLinkTest, Connects) {
+    struct link_results results;
+
+    link_start(RFM22_datarate_64000, true, true);
+    link_measure(3000000, &results);
+    expect_connected(results);
+    EXPECT_GT(results.throughput[COORDINATOR], 500.0f);
+    EXPECT_GT(results.throughput[REMOTE], 500.0f);
+    EXPECT_EQ(0u, results.crc_errors);
+    EXPECT_EQ(0u, results.retries);
+    EXPECT_EQ(0u, results.failures);
+    // the coordinator sends every other 13 ms slot, so some of the 20 ms PPM frames never make it
+    EXPECT_GT(results.ppm_received, 3000000u / 26000 * 9 / 10);
+    EXPECT_LT(results.ppm_latency_max_ms, 30.0f);
+}
+
+TEST_F(RFM22BLinkTest, OtherProtocolVersionNeverConnects) {
+    struct link_results results;
+
+    // the remote stands in for a firmware with the air format before version 1
+    rfm22b_sim_set_sync_word(REMOTE, 0x2DD44B59);
+    link_start(RFM22_datarate_64000, true, false);
+    link_measure(3000000, &results);
+    EXPECT_NE(OPLINKSTATUS_LINKSTATE_CONNECTED, results.radio[REMOTE].link_state);
+    EXPECT_NE(OPLINKSTATUS_LINKSTATE_CONNECTED, results.radio[COORDINATOR].link_state);
+    EXPECT_EQ(0.0f, results.throughput[COORDINATOR]);
+    EXPECT_EQ(0.0f, results.throughput[REMOTE]);
+}
+
+TEST_F(RFM22BLinkTest, PacketLoss) {
+    struct rfm22b_sim_link link = { 0.1f, 0.0f, 0, 0, -60 };
+    struct link_results results;
+
+    rfm22b_sim_set_link(&link);
+    link_start(RFM22_datarate_64000, true, true);
+    link_measure(10000000, &results);
+    expect_connected(results);
+    EXPECT_GT(results.retries, 0u);
+    EXPECT_GT(results.throughput[COORDINATOR], 200.0f);
+    EXPECT_GT(results.throughput[REMOTE], 200.0f);
+    EXPECT_GT(results.ppm_received, 0u);
+}
+
+TEST_F(RFM22BLinkTest, BitErrorsCorrected) {
+    struct rfm22b_sim_link link = { 0.0f, 2e-4f, 0, 0, -60 };
+    struct link_results results;
+
+    rfm22b_sim_set_link(&link);
+    link_start(RFM22_datarate_64000, true, true);
+    link_measure(5000000, &results);
+    expect_connected(results);
+    EXPECT_GT(results.radio[COORDINATOR].rx_corrected + results.radio[REMOTE].rx_corrected, 0);
+    EXPECT_GT(results.throughput[COORDINATOR], 200.0f);
+}
+
+TEST_F(RFM22BLinkTest, ClockOffsetAndDrift) {
+    struct link_results results;
+
+    // the remote boots 3.7 s later and its crystal is 50 ppm fast
+    rfm22b_sim_set_clock(REMOTE, 3777000, 50.0f);
+    link_start(RFM22_datarate_64000, true, true);
+    link_measure(10000000, &results);
+    expect_connected(results);
+    EXPECT_GT(results.throughput[COORDINATOR], 500.0f);
+    EXPECT_GT(results.throughput[REMOTE], 500.0f);
+    EXPECT_EQ(0u, results.failures);
+}
+
+TEST_F(RFM22BLinkTest, LatencyAndBitrate) {
+    struct rfm22b_sim_link link = { 0.0f, 0.0f, 300, 0, -60 };
+    struct link_results nominal, slow;
+
+    rfm22b_sim_set_link(&link);
+    link_start(RFM22_datarate_64000, true, true);
+    link_measure(5000000, &nominal);
+    expect_connected(nominal);
+    EXPECT_GT(nominal.throughput[COORDINATOR], 500.0f);
+
+    // packets take longer on the air than the slots the driver times them in
+    rfm22b_sim_reset(1234);
+    link.bitrate = 48000;
+    rfm22b_sim_set_link(&link);
+    link_start(RFM22_datarate_64000, true, true);
+    link_measure(5000000, &slow);
+    EXPECT_LT(slow.throughput[COORDINATOR], nominal.throughput[COORDINATOR]);
+    EXPECT_LT(slow.throughput[REMOTE], nominal.throughput[REMOTE]);
+    printf("air bitrate  64000: %.0f/%.0f B/s, 48000: %.0f/%.0f B/s\n", nominal.throughput[REMOTE], nominal.throughput[COORDINATOR],
+           slow.throughput[REMOTE], slow.throughput[COORDINATOR]);
+}
+
+TEST_F(RFM22BLinkTest, AuxStreamSharesPackets) {
+    struct link_results main_only, shared;
+
+    link_start(RFM22_datarate_57600, true, false);
+    link_measure(5000000, &main_only);
+    expect_connected(main_only);
+
+    // the auxiliary bytes ride along in the telemetry packets instead of taking slots of their own
+    rfm22b_sim_every(REMOTE, AUX_PERIOD_US, aux_send, &endpoints[REMOTE]);
+    link_measure(5000000, &shared);
+    rfm22b_sim_run(SETTLE_US);
+    expect_connected(shared);
+    EXPECT_GT(endpoints[REMOTE].aux_sent, 5000000u / AUX_PERIOD_US * AUX_CHUNK * 9 / 10);
+    // all but the chunks written since the last packet of the remote
+    EXPECT_LE(endpoints[REMOTE].aux_sent - endpoints[COORDINATOR].aux_received, 2u * AUX_CHUNK);
+    EXPECT_EQ(0u, endpoints[COORDINATOR].aux_errors);
+    EXPECT_GT(shared.throughput[COORDINATOR], main_only.throughput[COORDINATOR] * 0.9f);
+    EXPECT_GT(shared.throughput[REMOTE], main_only.throughput[REMOTE] * 0.9f);
+    printf("down B/s main only: %.0f, with aux stream: %.0f\n", main_only.throughput[COORDINATOR], shared.throughput[COORDINATOR]);
+}
+
+TEST_F(RFM22BLinkTest, Datarates) {
+    printf("datarate  mode      connect s  up B/s  down B/s  retries  ack rtt ms  ppm ms (max)  timeouts  resets\n");
+    for (int rate = RFM22_datarate_9600; rate <= RFM22_datarate_256000; rate++) {
+        for (int ppm_mode = 0; ppm_mode <= 1; ppm_mode++) {
+            struct link_results results;
+
+            // at 9600 the PPM mode is PPM only
+            bool data_mode = !(ppm_mode && rate == RFM22_datarate_9600);
+            rfm22b_sim_reset(1234);
+            float connect_s = link_start((enum rfm22b_datarate)rate, data_mode, ppm_mode);
+            link_measure(5000000, &results);
+
+            expect_connected(results, !data_mode);
+            if (data_mode) {
+                EXPECT_GT(results.throughput[COORDINATOR], 0.0f) << datarate_names[rate];
+                EXPECT_GT(results.throughput[REMOTE], 0.0f) << datarate_names[rate];
+            }
+            if (ppm_mode) {
+                EXPECT_GT(results.ppm_received, 0u) << datarate_names[rate];
+            }
+            printf("%8s  %-8s  %9.1f  %6.0f  %8.0f  %7u  %10.1f  %5.1f (%4.1f)  %8u  %6u\n", datarate_names[rate],
+                   !data_mode ? "ppm only" : (ppm_mode ? "data+ppm" : "data"), connect_s,
+                   results.throughput[REMOTE], results.throughput[COORDINATOR], results.retries, results.ack_rtt_ms,
+                   results.ppm_latency_ms, results.ppm_latency_max_ms,
+                   results.radio[COORDINATOR].timeouts + results.radio[REMOTE].timeouts,
+                   results.radio[COORDINATOR].resets + results.radio[REMOTE].resets);
+        }
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+/* the parts of openpilot.h used by the Reed-Solomon library */
+
+#include <stdint.h>
+
+/* as on the boards with an RFM22B */
+#define RS_ECC_NPARITY 4
+
+#endif /* OPENPILOT_H */
@@ -0,0 +1,188 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memcpy */
+#include "ut_clock.h" /* now_ns */
+
+extern "C" {
+#include "ecc.h"
+}
+
+#define MAX_DATA_LEN    (255 - RS_ECC_NPARITY)
+#define RANDOM_RUNS     2000
+#define PACKET_LEN      64 // about what the RFM22B driver sends per packet
+#define BENCHMARK_LOOPS 20000
+#define GOLDEN_RUNS     64
+
+/* rand() differs between C libraries, the golden parity and syndromes need the same data everywhere */
+static uint32_t random_state;
+
+static int next_random(void)
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 16;
+}
+
+static void random_data(unsigned char *buf, int len)
+{
+    for (int i = 0; i < len; i++) {
+        buf[i] = next_random() & 0xff;
+    }
+}
+
+/*
+ * parity of the first EncodeMatchesGolden messages and the RFM22B packet after them, and the syndromes
+ * of the first ErrorsCorrected codewords, captured once from rs.c before the table driven LFSR
+ */
+static const unsigned char parity_golden[GOLDEN_RUNS][RS_ECC_NPARITY] = {
+    { 0x1f, 0xa4, 0xb1, 0x62 }, { 0x2d, 0x71, 0x46, 0x1c }, { 0x4d, 0xd5, 0xe4, 0xe3 }, { 0x2e, 0x25, 0xa6, 0xaa },
+    { 0x4e, 0xfa, 0x9f, 0x5c }, { 0xe5, 0xa6, 0x7d, 0x75 }, { 0xff, 0xb0, 0xc1, 0x4f }, { 0xa4, 0x67, 0x91, 0x6c },
+    { 0x3b, 0x12, 0xa6, 0x3e }, { 0xc6, 0x02, 0x31, 0xcc }, { 0x31, 0x41, 0x55, 0x6d }, { 0xd7, 0x29, 0x30, 0x48 },
+    { 0xa9, 0xaa, 0x81, 0x20 }, { 0xd9, 0x8c, 0xbd, 0xf6 }, { 0x90, 0x57, 0xc8, 0x44 }, { 0xe0, 0x3f, 0x65, 0x16 },
+    { 0xf8, 0x2a, 0x0e, 0xeb }, { 0x76, 0xfe, 0xe0, 0xc9 }, { 0x0e, 0xf5, 0x98, 0xb0 }, { 0x4f, 0x2c, 0x8b, 0x87 },
+    { 0xde, 0x96, 0x56, 0x93 }, { 0xd6, 0x2e, 0xb1, 0xba }, { 0x54, 0x34, 0xc8, 0x49 }, { 0xa9, 0x7f, 0xa1, 0xe8 },
+    { 0x6c, 0x11, 0x09, 0x09 }, { 0x61, 0x99, 0xc7, 0x82 }, { 0x6a, 0x14, 0x29, 0x7c }, { 0xe7, 0xb9, 0xcd, 0x41 },
+    { 0xd4, 0xd1, 0x2f, 0xa8 }, { 0xe1, 0xc4, 0x5f, 0xef }, { 0xf2, 0xc8, 0x28, 0x7a }, { 0x06, 0x9b, 0xf5, 0x9f },
+    { 0xdf, 0xb7, 0x60, 0x66 }, { 0x95, 0xd4, 0xc4, 0xf9 }, { 0x91, 0x9f, 0x84, 0xcc }, { 0x21, 0x65, 0x29, 0xbe },
+    { 0x22, 0x9f, 0xc1, 0x97 }, { 0x3f, 0x24, 0x72, 0xa9 }, { 0x2c, 0xa1, 0x35, 0x2c }, { 0x9c, 0x97, 0x25, 0x14 },
+    { 0x33, 0x59, 0x51, 0x9b }, { 0xfd, 0x18, 0x8a, 0x59 }, { 0xa1, 0x6b, 0xa6, 0x08 }, { 0xd5, 0xf5, 0x5c, 0xb1 },
+    { 0x05, 0x23, 0x5d, 0x01 }, { 0xfd, 0xce, 0x48, 0xbb }, { 0x4b, 0xa1, 0xfd, 0x5e }, { 0x97, 0x6f, 0x29, 0x0c },
+    { 0x60, 0x46, 0x6a, 0x3b }, { 0x3e, 0xc7, 0x4b, 0xe8 }, { 0x02, 0xf2, 0xb0, 0xde }, { 0xa8, 0x02, 0x6f, 0xb4 },
+    { 0x0b, 0x60, 0x4b, 0x0a }, { 0x0c, 0x76, 0x5e, 0xe1 }, { 0xf3, 0xb9, 0xa2, 0xa9 }, { 0x64, 0x73, 0x0a, 0x2b },
+    { 0x2f, 0x44, 0x3b, 0x07 }, { 0xb4, 0x9a, 0x68, 0x7e }, { 0xca, 0xa2, 0xfa, 0xff }, { 0x2a, 0x1b, 0x46, 0x50 },
+    { 0x6a, 0x42, 0x07, 0xd4 }, { 0xe2, 0xf6, 0x26, 0x7c }, { 0x93, 0x5b, 0xa2, 0x4b }, { 0x13, 0xed, 0xd5, 0xba },
+};
+
+static const unsigned char packet_parity_golden[RS_ECC_NPARITY] = { 0x9f, 0xed, 0x29, 0xc4 };
+
+static const int syndrome_golden[GOLDEN_RUNS][RS_ECC_NPARITY] = {
+    { 0xd8, 0xb4, 0xee, 0x99 }, { 0x5b, 0xc4, 0x5a, 0x67 }, { 0x20, 0x3a, 0x87, 0x98 }, { 0x94, 0x0d, 0x4e, 0xca },
+    { 0xdc, 0x27, 0xda, 0xeb }, { 0xe1, 0x15, 0x3d, 0x3b }, { 0x26, 0x3b, 0x24, 0x0f }, { 0x8c, 0x5d, 0xb9, 0xd9 },
+    { 0x55, 0x0d, 0xea, 0xc5 }, { 0x38, 0x8a, 0x7d, 0x3a }, { 0xde, 0x2d, 0x5f, 0xda }, { 0x04, 0xe9, 0x24, 0xd0 },
+    { 0x87, 0x7a, 0x48, 0xce }, { 0x97, 0x6d, 0x2a, 0xaa }, { 0x13, 0x5a, 0xb8, 0xcd }, { 0x80, 0x6e, 0x07, 0x6a },
+    { 0xb1, 0x22, 0xf8, 0x5c }, { 0x6b, 0x6b, 0x6b, 0x6b }, { 0xfc, 0x49, 0x3e, 0xd0 }, { 0xf1, 0x25, 0x92, 0x26 },
+    { 0xcc, 0xdf, 0x50, 0x86 }, { 0x3c, 0x49, 0xc9, 0x6f }, { 0x23, 0xa0, 0xa1, 0xbc }, { 0xc1, 0x17, 0x39, 0x76 },
+    { 0xe3, 0x8e, 0xe0, 0xce }, { 0x17, 0x3c, 0xda, 0xb2 }, { 0x5c, 0x14, 0xac, 0xd1 }, { 0xd4, 0x81, 0x71, 0xd5 },
+    { 0x1f, 0xf8, 0x93, 0xec }, { 0xfe, 0x3f, 0x83, 0xd9 }, { 0xd6, 0xdc, 0xae, 0xda }, { 0x93, 0xd7, 0x45, 0x98 },
+    { 0x1b, 0x26, 0x4a, 0xd2 }, { 0xde, 0xa3, 0x3b, 0xa4 }, { 0xf3, 0x09, 0x54, 0xdc }, { 0xde, 0xf0, 0xd9, 0x1f },
+    { 0xc7, 0x65, 0xe7, 0xce }, { 0xe4, 0x89, 0xdb, 0xfa }, { 0x5c, 0x83, 0xd0, 0x12 }, { 0x4d, 0x88, 0x87, 0x7b },
+    { 0x2a, 0x2a, 0x2a, 0x2a }, { 0x22, 0x44, 0x88, 0x0d }, { 0x57, 0x88, 0x1a, 0x8c }, { 0xe5, 0xc9, 0xff, 0xb3 },
+    { 0x1b, 0x9d, 0xbc, 0x67 }, { 0x94, 0x8d, 0xff, 0x7b }, { 0x02, 0xae, 0xd4, 0x47 }, { 0x8f, 0xb1, 0x52, 0x59 },
+    { 0x06, 0x65, 0xc7, 0xc6 }, { 0xbe, 0x42, 0x8e, 0x9d }, { 0x09, 0xce, 0xb7, 0x3e }, { 0x94, 0xa0, 0x65, 0xe1 },
+    { 0x6d, 0x07, 0x1d, 0xca }, { 0xc3, 0xbf, 0xe7, 0x13 }, { 0xf3, 0x1f, 0x1b, 0x85 }, { 0xa1, 0x27, 0x30, 0xeb },
+    { 0x89, 0xa9, 0x69, 0xd4 }, { 0xf7, 0x4c, 0xa0, 0x71 }, { 0x7d, 0x52, 0xb0, 0xae }, { 0xd5, 0x75, 0x84, 0x10 },
+    { 0x2e, 0x6c, 0xcb, 0xfb }, { 0x6e, 0x79, 0x0b, 0x3a }, { 0x77, 0x26, 0x2d, 0xe7 }, { 0xbe, 0x2c, 0xe6, 0xfd },
+};
+
+// To use a test fixture, derive a class from testing::Test.
+class ReedSolomonTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        initialize_ecc();
+        random_state = 1234;
+    }
+};
+
+TEST_F(ReedSolomonTest, GeneratorTable) {
+    EXPECT_EQ(1, genPoly[RS_ECC_NPARITY]);
+    for (int d = 0; d < 256; d++) {
+        for (int j = 0; j < RS_ECC_NPARITY; j++) {
+            ASSERT_EQ(gmult(genPoly[j], d), (int)((genPolyMult[d] >> (8 * j)) & 0xff)) << "d " << d << " j " << j;
+        }
+    }
+}
+
+TEST_F(ReedSolomonTest, KnownVector) {
+    unsigned char msg[] = "OpenPilot RFM22B";
+    unsigned char codeword[sizeof(msg) - 1 + RS_ECC_NPARITY];
+    const unsigned char parity[RS_ECC_NPARITY] = { 0x5a, 0xe7, 0xfd, 0xb0 };
+
+    encode_data(msg, sizeof(msg) - 1, codeword);
+    EXPECT_EQ(0, memcmp(codeword, msg, sizeof(msg) - 1));
+    EXPECT_EQ(0, memcmp(codeword + sizeof(msg) - 1, parity, RS_ECC_NPARITY));
+}
+
+TEST_F(ReedSolomonTest, EncodeMatchesGolden) {
+    unsigned char msg[MAX_DATA_LEN];
+    unsigned char codeword[255];
+
+    for (int run = 0; run < GOLDEN_RUNS; run++) {
+        int len = 1 + next_random() % MAX_DATA_LEN;
+        random_data(msg, len);
+        encode_data(msg, len, codeword);
+        ASSERT_EQ(0, memcmp(codeword, msg, len)) << "length " << len;
+        ASSERT_EQ(0, memcmp(codeword + len, parity_golden[run], RS_ECC_NPARITY)) << "length " << len;
+    }
+
+    // the RFM22B driver encodes in place
+    random_data(codeword, PACKET_LEN);
+    encode_data(codeword, PACKET_LEN, codeword);
+    EXPECT_EQ(0, memcmp(codeword + PACKET_LEN, packet_parity_golden, RS_ECC_NPARITY));
+}
+
+TEST_F(ReedSolomonTest, ErrorFreeCodewords) {
+    unsigned char codeword[255];
+
+    for (int run = 0; run < RANDOM_RUNS; run++) {
+        int len = 1 + next_random() % MAX_DATA_LEN;
+        random_data(codeword, len);
+        encode_data(codeword, len, codeword);
+        decode_data(codeword, len + RS_ECC_NPARITY);
+        ASSERT_EQ(0, check_syndrome()) << "length " << len;
+    }
+}
+
+TEST_F(ReedSolomonTest, ErrorsCorrected) {
+    unsigned char sent[255];
+    unsigned char received[255];
+
+    for (int run = 0; run < RANDOM_RUNS; run++) {
+        int len    = 1 + next_random() % MAX_DATA_LEN;
+        int csize  = len + RS_ECC_NPARITY;
+        int errors = 1 + next_random() % (RS_ECC_NPARITY / 2);
+        random_data(sent, len);
+        encode_data(sent, len, sent);
+        memcpy(received, sent, csize);
+        for (int e = 0; e < errors; e++) {
+            received[next_random() % csize] ^= 1 + next_random() % 255;
+        }
+        if (memcmp(received, sent, csize) == 0) {
+            continue; // the errors landed on the same byte and cancelled out
+        }
+
+        decode_data(received, csize);
+        ASSERT_NE(0, check_syndrome());
+        for (int j = 0; run < GOLDEN_RUNS && j < RS_ECC_NPARITY; j++) {
+            ASSERT_EQ(syndrome_golden[run][j], synBytes[j]);
+        }
+        ASSERT_EQ(1, correct_errors_erasures(received, csize, 0, 0)) << "length " << len << " errors " << errors;
+        ASSERT_EQ(0, memcmp(received, sent, csize));
+    }
+}
+
+TEST_F(ReedSolomonTest, Benchmark) {
+    static unsigned char packets[256][PACKET_LEN + RS_ECC_NPARITY];
+    uint64_t start, encode, decode;
+
+    for (int i = 0; i < 256; i++) {
+        random_data(packets[i], PACKET_LEN);
+    }
+
+    start = now_ns();
+    for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+        encode_data(packets[loop & 0xff], PACKET_LEN, packets[loop & 0xff]);
+    }
+    encode = now_ns() - start;
+
+    // the packets are valid codewords now
+    start  = now_ns();
+    for (int loop = 0; loop < BENCHMARK_LOOPS; loop++) {
+        decode_data(packets[loop & 0xff], PACKET_LEN + RS_ECC_NPARITY);
+        EXPECT_EQ(0, check_syndrome());
+    }
+    decode = now_ns() - start;
+
+    printf("%d byte packets: encode %.0f ns, error free decode %.0f ns\n", PACKET_LEN,
+           (double)encode / BENCHMARK_LOOPS, (double)decode / BENCHMARK_LOOPS);
+}
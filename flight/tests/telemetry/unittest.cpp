@@ -0,0 +1,319 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memset */
+#include "ut_clock.h" /* now_ns */
+#include <pthread.h> /* pthread_create */
+
+extern "C" {
+#include "telemetrybudget.h"
+}
+
+// 2400 baud serial link, 10 bits per byte
+#define LINK_CAPACITY 240
+#define BURST         256
+
+// stand ins for object handles
+static int objA, objB, objC;
+
+// To use a test fixture, derive a class from testing::Test.
+class TelemetryBudget : public testing::Test {
+protected:
+    struct telemetry_budget budget;
+
+    virtual void SetUp()
+    {
+        telemetry_budget_init(&budget, LINK_CAPACITY, 0);
+    }
+
+    TelemetryBudgetResult admit(TelemetryClass cls, void *obj, uint16_t bytes, uint32_t now)
+    {
+        return telemetry_budget_admit(&budget, cls, obj, 0, bytes, now);
+    }
+};
+
+TEST_F(TelemetryBudget, Refill) {
+    struct telemetry_deferred deferred;
+
+    // starts with a full bucket
+    EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_ONCHANGE, &objA, 100, 0));
+    EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 100, 0));
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objC, 100, 0));
+
+    // 56 left, 44 more bytes take 184 ms
+    EXPECT_FALSE(telemetry_budget_next_deferred(&budget, 150, &deferred));
+    EXPECT_FALSE(telemetry_budget_next_deferred(&budget, 183, &deferred));
+    EXPECT_TRUE(telemetry_budget_next_deferred(&budget, 184, &deferred));
+    EXPECT_EQ(&objC, deferred.obj);
+    EXPECT_EQ(100, deferred.bytes);
+    EXPECT_FALSE(telemetry_budget_next_deferred(&budget, 184, &deferred));
+
+    // the bucket does not fill beyond the burst size
+    EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_ONCHANGE, &objA, BURST, 60000));
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 1, 60000));
+}
+
+TEST_F(TelemetryBudget, CriticalAlwaysSent) {
+    for (int i = 0; i < 20; i++) {
+        EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_CRITICAL, &objA, 200, i));
+    }
+
+    // the debt is limited to one burst
+    EXPECT_EQ(-BURST, budget.tokens);
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 10, 20));
+    EXPECT_EQ(TELEMETRY_BUDGET_DROPPED, admit(TELEMETRY_CLASS_PERIODIC, &objC, 10, 20));
+}
+
+TEST_F(TelemetryBudget, PeriodicKeepsReserve) {
+    struct telemetry_budget_stats stats;
+
+    EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_PERIODIC, &objA, BURST - 50, 0));
+    // 50 tokens are not enough with the reserve
+    EXPECT_EQ(TELEMETRY_BUDGET_DROPPED, admit(TELEMETRY_CLASS_PERIODIC, &objA, 10, 0));
+    // but the reserve is there for on change updates
+    EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 50, 0));
+
+    // periodic updates do not overtake the waiting ones
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 50, 0));
+    EXPECT_EQ(TELEMETRY_BUDGET_DROPPED, admit(TELEMETRY_CLASS_PERIODIC, &objA, 10, 1000));
+
+    telemetry_budget_get_stats(&budget, 1000, &stats);
+    EXPECT_EQ(2u, stats.dropped[TELEMETRY_CLASS_PERIODIC]);
+    EXPECT_EQ(0u, stats.dropped[TELEMETRY_CLASS_ONCHANGE]);
+}
+
+TEST_F(TelemetryBudget, OnChangeMergedInOrder) {
+    struct telemetry_deferred deferred;
+    struct telemetry_budget_stats stats;
+
+    admit(TELEMETRY_CLASS_CRITICAL, &objC, BURST, 0);
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objA, 50, 0));
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 50, 0));
+    // a newer update of A takes the place of the waiting one
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objA, 60, 0));
+    EXPECT_EQ(2, budget.numDeferred);
+    // other instances are other updates
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, telemetry_budget_admit(&budget, TELEMETRY_CLASS_ONCHANGE, &objA, 1, 50, 0));
+    EXPECT_EQ(3, budget.numDeferred);
+
+    ASSERT_TRUE(telemetry_budget_next_deferred(&budget, 1000, &deferred));
+    EXPECT_EQ(&objA, deferred.obj);
+    EXPECT_EQ(0, deferred.instId);
+    EXPECT_EQ(60, deferred.bytes);
+    ASSERT_TRUE(telemetry_budget_next_deferred(&budget, 1000, &deferred));
+    EXPECT_EQ(&objB, deferred.obj);
+    ASSERT_TRUE(telemetry_budget_next_deferred(&budget, 1000, &deferred));
+    EXPECT_EQ(&objA, deferred.obj);
+    EXPECT_EQ(1, deferred.instId);
+    EXPECT_FALSE(telemetry_budget_next_deferred(&budget, 1000, &deferred));
+
+    telemetry_budget_get_stats(&budget, 1000, &stats);
+    EXPECT_EQ(1u, stats.merged);
+    EXPECT_EQ((uint32_t)BURST, stats.bytes[TELEMETRY_CLASS_CRITICAL]);
+    EXPECT_EQ(160u, stats.bytes[TELEMETRY_CLASS_ONCHANGE]);
+}
+
+TEST_F(TelemetryBudget, DeferredFull) {
+    struct telemetry_budget_stats stats;
+    int objs[TELEMETRY_BUDGET_MAX_DEFERRED + 1];
+
+    admit(TELEMETRY_CLASS_CRITICAL, &objC, BURST, 0);
+    for (int i = 0; i < TELEMETRY_BUDGET_MAX_DEFERRED; i++) {
+        EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objs[i], 10, 0));
+    }
+    EXPECT_EQ(TELEMETRY_BUDGET_DROPPED, admit(TELEMETRY_CLASS_ONCHANGE, &objs[TELEMETRY_BUDGET_MAX_DEFERRED], 10, 0));
+    // waiting updates can still be merged
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objs[0], 10, 0));
+
+    telemetry_budget_get_stats(&budget, 0, &stats);
+    EXPECT_EQ(1u, stats.dropped[TELEMETRY_CLASS_ONCHANGE]);
+    EXPECT_EQ(1u, stats.merged);
+}
+
+TEST_F(TelemetryBudget, LargeObjectOnFullBucket) {
+    struct telemetry_deferred deferred;
+
+    // bigger than the bucket, it goes when the bucket is full
+    admit(TELEMETRY_CLASS_ONCHANGE, &objA, 10, 0);
+    EXPECT_EQ(TELEMETRY_BUDGET_DEFERRED, admit(TELEMETRY_CLASS_ONCHANGE, &objB, 1000, 0));
+    EXPECT_FALSE(telemetry_budget_next_deferred(&budget, 10, &deferred));
+    EXPECT_TRUE(telemetry_budget_next_deferred(&budget, 50, &deferred));
+    EXPECT_EQ(-BURST, budget.tokens);
+}
+
+TEST_F(TelemetryBudget, Unlimited) {
+    struct telemetry_budget_stats stats;
+
+    telemetry_budget_init(&budget, 0, 0);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_PERIODIC, &objA, 1000, 0));
+    }
+    // blocking does not make up a capacity
+    telemetry_budget_transmitted(&budget, 100, 900000);
+    EXPECT_EQ(TELEMETRY_BUDGET_SEND, admit(TELEMETRY_CLASS_PERIODIC, &objA, 1000, 1000));
+
+    telemetry_budget_get_stats(&budget, 2000, &stats);
+    EXPECT_EQ(0u, stats.capacity);
+    EXPECT_EQ(1001000u, stats.bytes[TELEMETRY_CLASS_PERIODIC]);
+    EXPECT_EQ(2000u, stats.elapsed);
+}
+
+TEST_F(TelemetryBudget, MeasuresCapacity) {
+    uint32_t now = 0;
+
+    // the link takes 100 bytes/s and blocks the sender
+    for (int i = 0; i < 20; i++) {
+        telemetry_budget_transmitted(&budget, 100, 500000);
+        now += 1000;
+        admit(TELEMETRY_CLASS_CRITICAL, &objA, 0, now);
+    }
+    EXPECT_NEAR(100, budget.capacity, 2);
+
+    // a link that stops working does not stop telemetry altogether
+    for (int i = 0; i < 50; i++) {
+        telemetry_budget_transmitted(&budget, 0, 1000000);
+        now += 1000;
+        admit(TELEMETRY_CLASS_CRITICAL, &objA, 0, now);
+    }
+    EXPECT_GE(budget.capacity, 16u);
+    EXPECT_LT(budget.capacity, 20u);
+
+    // without blocking, the rate sent is what the link can do
+    telemetry_budget_transmitted(&budget, 150, 0);
+    now += 1000;
+    admit(TELEMETRY_CLASS_CRITICAL, &objA, 0, now);
+    EXPECT_EQ(150u, budget.capacity);
+
+    // and it recovers towards the nominal capacity
+    for (int i = 0; i < 40; i++) {
+        now += 1000;
+        admit(TELEMETRY_CLASS_CRITICAL, &objA, 0, now);
+        EXPECT_LE(budget.capacity, (uint32_t)LINK_CAPACITY);
+    }
+    EXPECT_EQ((uint32_t)LINK_CAPACITY, budget.capacity);
+
+    // short blocking is normal
+    telemetry_budget_transmitted(&budget, 100, 50000);
+    now += 1000;
+    admit(TELEMETRY_CLASS_CRITICAL, &objA, 0, now);
+    EXPECT_EQ((uint32_t)LINK_CAPACITY, budget.capacity);
+}
+
+TEST_F(TelemetryBudget, StatsReset) {
+    struct telemetry_budget_stats stats;
+
+    admit(TELEMETRY_CLASS_CRITICAL, &objA, 20, 0);
+    admit(TELEMETRY_CLASS_ONCHANGE, &objB, 30, 0);
+    admit(TELEMETRY_CLASS_PERIODIC, &objC, 40, 0);
+
+    telemetry_budget_get_stats(&budget, 4000, &stats);
+    EXPECT_EQ((uint32_t)LINK_CAPACITY, stats.capacity);
+    EXPECT_EQ(4000u, stats.elapsed);
+    EXPECT_EQ(20u, stats.bytes[TELEMETRY_CLASS_CRITICAL]);
+    EXPECT_EQ(30u, stats.bytes[TELEMETRY_CLASS_ONCHANGE]);
+    EXPECT_EQ(40u, stats.bytes[TELEMETRY_CLASS_PERIODIC]);
+
+    telemetry_budget_get_stats(&budget, 5000, &stats);
+    EXPECT_EQ(1000u, stats.elapsed);
+    for (int c = 0; c < TELEMETRY_CLASS_NUMELEM; c++) {
+        EXPECT_EQ(0u, stats.bytes[c]);
+        EXPECT_EQ(0u, stats.dropped[c]);
+    }
+    EXPECT_EQ(0u, stats.merged);
+}
+
+// the Tx task of a channel admits while the stats update of the other channel collects
+#define SHARED_UPDATES 200000
+
+static volatile bool admitterDone;
+
+static void *admitterTask(void *parameters)
+{
+    struct telemetry_budget *budget = (struct telemetry_budget *)parameters;
+
+    for (int i = 0; i < SHARED_UPDATES; i++) {
+        telemetry_budget_admit(budget, TELEMETRY_CLASS_CRITICAL, &objA, 0, 10, i);
+        telemetry_budget_transmitted(budget, 10, 0);
+    }
+    admitterDone = true;
+    return NULL;
+}
+
+TEST_F(TelemetryBudget, StatsFromOtherTask) {
+    struct telemetry_budget_stats stats;
+    pthread_t admitter;
+    uint64_t bytes = 0;
+    uint32_t reads = 0;
+
+    admitterDone = false;
+    ASSERT_EQ(0, pthread_create(&admitter, NULL, admitterTask, &budget));
+    while (!admitterDone) {
+        telemetry_budget_get_stats(&budget, 0, &stats);
+        bytes += stats.bytes[TELEMETRY_CLASS_CRITICAL];
+        reads++;
+    }
+    pthread_join(admitter, NULL);
+    telemetry_budget_get_stats(&budget, 0, &stats);
+    bytes += stats.bytes[TELEMETRY_CLASS_CRITICAL];
+
+    // nothing counted twice or lost between reading and resetting
+    EXPECT_EQ(10ull * SHARED_UPDATES, bytes);
+    printf("%u stats reads while admitting\n", (unsigned)reads);
+}
+
+TEST_F(TelemetryBudget, SlowLink) {
+    // a flight on a 2400 baud link: alarms and flight status on change,
+    // attitude at 20 Hz, GPS at 5 Hz and a bulk object every second
+    const uint32_t seconds = 60;
+    struct telemetry_budget_stats stats;
+    struct telemetry_deferred deferred;
+    static int attitude, gps, bulk, status, alarms;
+    uint32_t criticalSent = 0, criticalTotal = 0;
+    uint32_t calls = 0;
+    uint64_t elapsed  = 0;
+
+    for (uint32_t now = 0; now < seconds * 1000; now++) {
+        uint64_t start = now_ns();
+
+        if (now % 50 == 0) {
+            admit(TELEMETRY_CLASS_PERIODIC, &attitude, 11 + 16, now);
+            calls++;
+        }
+        if (now % 200 == 0) {
+            admit(TELEMETRY_CLASS_PERIODIC, &gps, 11 + 40, now);
+            calls++;
+        }
+        if (now % 1000 == 500) {
+            admit(TELEMETRY_CLASS_ONCHANGE, &bulk, 11 + 120, now);
+            calls++;
+        }
+        if (now % 700 == 0) {
+            criticalTotal++;
+            criticalSent += admit(TELEMETRY_CLASS_CRITICAL, now % 1400 ? &status : &alarms, 11 + 12, now) == TELEMETRY_BUDGET_SEND;
+            calls++;
+        }
+        while (telemetry_budget_next_deferred(&budget, now, &deferred)) {
+            calls++;
+        }
+        elapsed += now_ns() - start;
+    }
+
+    telemetry_budget_get_stats(&budget, seconds * 1000, &stats);
+    uint32_t total = stats.bytes[TELEMETRY_CLASS_CRITICAL] + stats.bytes[TELEMETRY_CLASS_ONCHANGE] + stats.bytes[TELEMETRY_CLASS_PERIODIC];
+
+    // every critical update went, the link was not asked for more than it can do
+    EXPECT_EQ(criticalTotal, criticalSent);
+    EXPECT_LE(total, LINK_CAPACITY * seconds + BURST);
+    EXPECT_GT(total, LINK_CAPACITY * seconds * 9 / 10);
+    // the bulk object waited but was not lost
+    EXPECT_EQ(0u, stats.dropped[TELEMETRY_CLASS_ONCHANGE]);
+    EXPECT_GE(stats.bytes[TELEMETRY_CLASS_ONCHANGE], (seconds - 1) * (11 + 120));
+    // periodic updates give way
+    EXPECT_GT(stats.dropped[TELEMETRY_CLASS_PERIODIC], 0u);
+
+    printf("utilization critical %.1f%% on change %.1f%% periodic %.1f%%, %u periodic dropped, %.0f ns per update\n",
+           100.0 * stats.bytes[TELEMETRY_CLASS_CRITICAL] / (LINK_CAPACITY * seconds),
+           100.0 * stats.bytes[TELEMETRY_CLASS_ONCHANGE] / (LINK_CAPACITY * seconds),
+           100.0 * stats.bytes[TELEMETRY_CLASS_PERIODIC] / (LINK_CAPACITY * seconds),
+           stats.dropped[TELEMETRY_CLASS_PERIODIC], (double)elapsed / calls);
+}
@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ *
+ * @file       unittest.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Unit tests for the simposix UDP COM driver
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include "ut_clock.h" /* now_ns */
+#include <algorithm> /* std::sort */
+#include <vector>
+
+extern "C" {
+#include "pios_udp_priv.h"
+}
+
+#define UDP_TEST_IP       "127.0.0.1"
+#define UDP_TEST_RX_PORT  19900
+#define UDP_TEST_ECHO_PORT 19901
+
+#define RX_DATAGRAMS      20000
+#define RX_DATAGRAM_LEN   64
+#define RX_WINDOW         64
+#define ECHO_ROUNDS       2000
+#define TX_CHUNK_LEN      100
+#define TX_CHUNKS         20
+
+static const struct pios_udp_cfg udp_rx_cfg = {
+    .ip   = UDP_TEST_IP,
+    .port = UDP_TEST_RX_PORT,
+};
+
+static const struct pios_udp_cfg udp_echo_cfg = {
+    .ip   = UDP_TEST_IP,
+    .port = UDP_TEST_ECHO_PORT,
+};
+
+static uint32_t udp_rx_id;
+static uint32_t udp_echo_id;
+
+static volatile uint32_t rx_bytes;
+static volatile uint32_t rx_datagrams;
+
+static uint8_t echo_buf[PIOS_UDP_RX_BUFFER_SIZE];
+static volatile uint16_t echo_len;
+
+static uint32_t tx_remaining;
+static uint8_t tx_pattern;
+
+static uint16_t count_rx(__attribute__((unused)) uint32_t context, __attribute__((unused)) uint8_t *buf, uint16_t buf_len, __attribute__((unused)) uint16_t *headroom, __attribute__((unused)) bool *task_woken)
+{
+    __sync_fetch_and_add(&rx_bytes, buf_len);
+    __sync_fetch_and_add(&rx_datagrams, 1);
+    return buf_len;
+}
+
+static uint16_t echo_tx(__attribute__((unused)) uint32_t context, uint8_t *buf, uint16_t buf_len, __attribute__((unused)) uint16_t *headroom, __attribute__((unused)) bool *task_woken)
+{
+    uint16_t len = echo_len < buf_len ? echo_len : buf_len;
+
+    memcpy(buf, echo_buf, len);
+    echo_len = 0;
+    return len;
+}
+
+static uint16_t echo_rx(uint32_t context, uint8_t *buf, uint16_t buf_len, __attribute__((unused)) uint16_t *headroom, __attribute__((unused)) bool *task_woken)
+{
+    memcpy(echo_buf, buf, buf_len);
+    echo_len = buf_len;
+    pios_udp_com_driver.tx_start(context, buf_len);
+    return buf_len;
+}
+
+/* Hands out TX_CHUNKS chunks of TX_CHUNK_LEN bytes, one per call */
+static uint16_t chunked_tx(__attribute__((unused)) uint32_t context, uint8_t *buf, uint16_t buf_len, __attribute__((unused)) uint16_t *headroom, __attribute__((unused)) bool *task_woken)
+{
+    uint16_t len = TX_CHUNK_LEN;
+
+    if (len > tx_remaining) {
+        len = tx_remaining;
+    }
+    if (len > buf_len) {
+        len = buf_len;
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = tx_pattern++;
+    }
+    tx_remaining -= len;
+    return len;
+}
+
+static int open_client(void)
+{
+    int sock = socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct timeval timeout = { 2, 0 };
+
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return sock;
+}
+
+static struct sockaddr_in device_addr(uint16_t port)
+{
+    struct sockaddr_in addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = inet_addr(UDP_TEST_IP);
+    addr.sin_port = htons(port);
+    return addr;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class UdpLoopback : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        ASSERT_EQ(0, PIOS_UDP_Init(&udp_rx_id, &udp_rx_cfg));
+        ASSERT_EQ(0, PIOS_UDP_Init(&udp_echo_id, &udp_echo_cfg));
+        pios_udp_com_driver.bind_rx_cb(udp_rx_id, count_rx, udp_rx_id);
+        pios_udp_com_driver.bind_rx_cb(udp_echo_id, echo_rx, udp_echo_id);
+        pios_udp_com_driver.bind_tx_cb(udp_echo_id, echo_tx, udp_echo_id);
+    }
+};
+
+TEST_F(UdpLoopback, RxThroughput) {
+    int sock = open_client();
+    struct sockaddr_in addr = device_addr(UDP_TEST_RX_PORT);
+    uint8_t datagram[RX_DATAGRAM_LEN];
+
+    memset(datagram, 0x5a, sizeof(datagram));
+    rx_bytes     = 0;
+    rx_datagrams = 0;
+
+    uint64_t start = now_ns();
+    for (uint32_t sent = 0; sent < RX_DATAGRAMS; sent++) {
+        /* keep the socket queue bounded so nothing is dropped on loopback */
+        while (sent - rx_datagrams > RX_WINDOW) {
+            ASSERT_LT(now_ns() - start, 10000000000ull);
+        }
+        ASSERT_EQ(RX_DATAGRAM_LEN, sendto(sock, datagram, sizeof(datagram), 0, (struct sockaddr *)&addr, sizeof(addr)));
+    }
+    while (rx_datagrams < RX_DATAGRAMS) {
+        ASSERT_LT(now_ns() - start, 10000000000ull);
+    }
+    uint64_t elapsed = now_ns() - start;
+
+    EXPECT_EQ((uint32_t)RX_DATAGRAMS * RX_DATAGRAM_LEN, rx_bytes);
+    printf("rx: %u datagrams of %u bytes in %.1f ms, %.0f datagrams/s, %.2f MB/s\n",
+           RX_DATAGRAMS, RX_DATAGRAM_LEN, elapsed / 1e6,
+           RX_DATAGRAMS / (elapsed / 1e9), rx_bytes / (elapsed / 1e3));
+    close(sock);
+}
+
+TEST_F(UdpLoopback, EchoLatency) {
+    int sock = open_client();
+    struct sockaddr_in addr = device_addr(UDP_TEST_ECHO_PORT);
+    std::vector<uint64_t> rtt;
+    uint8_t out[32];
+    uint8_t in[sizeof(out)];
+
+    for (uint32_t round = 0; round < ECHO_ROUNDS; round++) {
+        memset(out, (uint8_t)round, sizeof(out));
+        uint64_t start = now_ns();
+        ASSERT_EQ((ssize_t)sizeof(out), sendto(sock, out, sizeof(out), 0, (struct sockaddr *)&addr, sizeof(addr)));
+        ASSERT_EQ((ssize_t)sizeof(in), recv(sock, in, sizeof(in), 0));
+        rtt.push_back(now_ns() - start);
+        ASSERT_EQ(0, memcmp(out, in, sizeof(out)));
+    }
+
+    std::sort(rtt.begin(), rtt.end());
+    printf("echo rtt: min %.1f us, median %.1f us, p99 %.1f us, max %.1f us\n",
+           rtt.front() / 1e3, rtt[rtt.size() / 2] / 1e3,
+           rtt[rtt.size() * 99 / 100] / 1e3, rtt.back() / 1e3);
+    close(sock);
+}
+
+TEST_F(UdpLoopback, TxBatch) {
+    int sock = open_client();
+    struct sockaddr_in addr = device_addr(UDP_TEST_ECHO_PORT);
+    uint8_t buf[PIOS_UDP_RX_BUFFER_SIZE];
+
+    /* let the device learn our address */
+    ASSERT_EQ(1, sendto(sock, "x", 1, 0, (struct sockaddr *)&addr, sizeof(addr)));
+    ASSERT_EQ(1, recv(sock, buf, sizeof(buf), 0));
+
+    pios_udp_com_driver.bind_tx_cb(udp_echo_id, chunked_tx, udp_echo_id);
+    tx_remaining = TX_CHUNK_LEN * TX_CHUNKS;
+    tx_pattern   = 0;
+    pios_udp_com_driver.tx_start(udp_echo_id, TX_CHUNK_LEN * TX_CHUNKS);
+    pios_udp_com_driver.bind_tx_cb(udp_echo_id, echo_tx, udp_echo_id);
+
+    /* every chunk arrives as its own datagram, in order */
+    uint8_t expected = 0;
+    for (uint32_t chunk = 0; chunk < TX_CHUNKS; chunk++) {
+        ASSERT_EQ(TX_CHUNK_LEN, recv(sock, buf, sizeof(buf), 0));
+        for (uint32_t i = 0; i < TX_CHUNK_LEN; i++) {
+            ASSERT_EQ(expected++, buf[i]);
+        }
+    }
+    EXPECT_EQ(0u, tx_remaining);
+    close(sock);
+}
@@ -0,0 +1,478 @@
+/**
+ ******************************************************************************
+ *
+ * @file       autotunereplay.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Replays GyroState and ActuatorDesired from GCS logs through the
+ *             AutoTune system identification and prints the resulting PIDs
+ *
+ * The samples are fed to the estimator the way the AutoTune module does it:
+ * the gyro is low pass filtered like the stabilization module does, it is
+ * paired with the latest ActuatorDesired and the time step comes from the
+ * gyro SensorReadTimestamp. This needs logs with every gyro update in them,
+ * as recorded by on board logging with GyroState logged on change.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <openpilot.h>
+#include <systemident.h>
+#include <gyrostate.h>
+#include <actuatordesired.h>
+#include <systemidentsettings.h>
+#include <stabilizationsettings.h>
+#include <stabilizationsettingsbank1.h>
+#include "oplreader.h"
+
+// a gyro update and the actuators at that time
+struct replay_sample {
+    uint32_t timestamp; // log time in ms
+    uint32_t sensorReadTimestamp;
+    float    gyro[3];
+    float    u[3];
+    float    throttle;
+};
+
+struct replay_log {
+    ActuatorDesiredDataPacked actuators;
+    bool     haveActuators;
+    struct replay_sample *samples;
+    uint32_t numSamples;
+    uint32_t capacity;
+};
+
+// command line options, the defaults are those of the UAVObject definitions
+struct replay_options {
+    float    beta[3];
+    float    tau;
+    float    gyroTau;
+    float    sensorRate;
+    float    cpuMHz;      // 0: estimate from the log
+    float    minThrottle;
+    float    start;       // s
+    float    end;         // s, 0: end of log
+    struct systemident_pid_settings pid;
+};
+
+/**
+ * Take the option defaults from the settings the firmware is built with
+ */
+static int load_defaults(struct replay_options *opt)
+{
+    SystemIdentSettingsData systemIdentSettings;
+    StabilizationSettingsData stabilizationSettings;
+    StabilizationSettingsBank1Data bank;
+
+    _Static_assert(SYSTEMIDENT_CALCULATEYAW_FALSE == SYSTEMIDENTSETTINGS_CALCULATEYAW_FALSE, "SYSTEMIDENT_CALCULATEYAW_FALSE != SYSTEMIDENTSETTINGS_CALCULATEYAW_FALSE");
+    _Static_assert(SYSTEMIDENT_CALCULATEYAW_LIMITTORATIO == SYSTEMIDENTSETTINGS_CALCULATEYAW_TRUELIMITTORATIO, "SYSTEMIDENT_CALCULATEYAW_LIMITTORATIO != SYSTEMIDENTSETTINGS_CALCULATEYAW_TRUELIMITTORATIO");
+    _Static_assert(SYSTEMIDENT_CALCULATEYAW_IGNORELIMIT == SYSTEMIDENTSETTINGS_CALCULATEYAW_TRUEIGNORELIMIT, "SYSTEMIDENT_CALCULATEYAW_IGNORELIMIT != SYSTEMIDENTSETTINGS_CALCULATEYAW_TRUEIGNORELIMIT");
+
+    if (SystemIdentSettingsInitialize() != 0 || StabilizationSettingsInitialize() != 0 || StabilizationSettingsBank1Initialize() != 0) {
+        fprintf(stderr, "cannot register the settings\n");
+        return -1;
+    }
+    SystemIdentSettingsGet(&systemIdentSettings);
+    StabilizationSettingsGet(&stabilizationSettings);
+    // the bank AutoTune computes its PIDs for, MaximumRate is the same default in all of them
+    StabilizationSettingsBank1Get(&bank);
+
+    opt->beta[0] = systemIdentSettings.Beta.Roll;
+    opt->beta[1] = systemIdentSettings.Beta.Pitch;
+    opt->beta[2] = systemIdentSettings.Beta.Yaw;
+    opt->tau     = systemIdentSettings.Tau;
+    opt->gyroTau = stabilizationSettings.GyroTau;
+    opt->pid.dampMin   = systemIdentSettings.DampMin;
+    opt->pid.dampRate  = systemIdentSettings.DampRate;
+    opt->pid.dampMax   = systemIdentSettings.DampMax;
+    opt->pid.noiseMin  = systemIdentSettings.NoiseMin;
+    opt->pid.noiseRate = systemIdentSettings.NoiseRate;
+    opt->pid.noiseMax  = systemIdentSettings.NoiseMax;
+    opt->pid.yawToRollPitchPIDRatioMin = systemIdentSettings.YawToRollPitchPIDRatioMin;
+    opt->pid.yawToRollPitchPIDRatioMax = systemIdentSettings.YawToRollPitchPIDRatioMax;
+    opt->pid.derivativeFactor     = systemIdentSettings.DerivativeFactor;
+    opt->pid.outerLoopKpSoftClamp = systemIdentSettings.OuterLoopKpSoftClamp;
+    opt->pid.smoothQuickValue     = systemIdentSettings.SmoothQuickValue;
+    opt->pid.gyroReadTimeAverage  = systemIdentSettings.GyroReadTimeAverage;
+    opt->pid.calculateYaw   = systemIdentSettings.CalculateYaw;
+    opt->pid.maximumRate[0] = bank.MaximumRate.Roll;
+    opt->pid.maximumRate[1] = bank.MaximumRate.Pitch;
+
+    return 0;
+}
+
+static void sample_cb(void *context, uint32_t timestamp, uint32_t objId, uint16_t instId, const uint8_t *data, uint16_t length)
+{
+    struct replay_log *log = context;
+
+    if (instId != 0) {
+        return;
+    }
+
+    if (objId == ACTUATORDESIRED_OBJID && length == ACTUATORDESIRED_NUMBYTES) {
+        memcpy(&log->actuators, data, sizeof(log->actuators));
+        log->haveActuators = true;
+    } else if (objId == GYROSTATE_OBJID && length == GYROSTATE_NUMBYTES && log->haveActuators) {
+        GyroStateDataPacked gyro;
+        memcpy(&gyro, data, sizeof(gyro));
+
+        if (log->numSamples == log->capacity) {
+            uint32_t capacity = log->capacity ? 2 * log->capacity : 65536;
+            struct replay_sample *samples = realloc(log->samples, capacity * sizeof(*samples));
+            if (!samples) {
+                fprintf(stderr, "out of memory\n");
+                exit(1);
+            }
+            log->samples  = samples;
+            log->capacity = capacity;
+        }
+
+        struct replay_sample *s = &log->samples[log->numSamples++];
+        s->timestamp = timestamp;
+        s->sensorReadTimestamp = gyro.SensorReadTimestamp;
+        s->gyro[0]   = gyro.x;
+        s->gyro[1]   = gyro.y;
+        s->gyro[2]   = gyro.z;
+        s->u[0]      = log->actuators.Roll;
+        s->u[1]      = log->actuators.Pitch;
+        s->u[2]      = log->actuators.Yaw;
+        s->throttle  = log->actuators.Thrust;
+    }
+}
+
+/**
+ * Estimate the rate of the clock behind SensorReadTimestamp against the log
+ * time, pairs of samples further apart than 1 s may have wrapped and are skipped
+ * @returns the ticks per second, 0 if the log is too short to tell
+ */
+static double estimate_tick_rate(const struct replay_log *log)
+{
+    double ticks = 0.0;
+    double ms    = 0.0;
+
+    for (uint32_t i = 1; i < log->numSamples; i++) {
+        uint32_t dMs = log->samples[i].timestamp - log->samples[i - 1].timestamp;
+        if (dMs > 1000) {
+            continue;
+        }
+        ticks += (uint32_t)(log->samples[i].sensorReadTimestamp - log->samples[i - 1].sensorReadTimestamp);
+        ms    += dMs;
+    }
+
+    if (ms < 1000.0 || ticks <= 0.0) {
+        return 0.0;
+    }
+    return ticks / ms * 1000.0;
+}
+
+static int replay(const char *path, const struct replay_options *opt)
+{
+    struct replay_log log = { .haveActuators = false };
+    struct opl_stats stats;
+    struct systemident si;
+    struct systemident_pids pids;
+    float gyroAlpha = 0.0f;
+    float y[3]      = { 0.0f, 0.0f, 0.0f };
+    double tickRate;
+    uint32_t first  = 0;
+    uint32_t last   = 0;
+
+    if (opl_read_file(path, sample_cb, &log, &stats) != 0) {
+        fprintf(stderr, "%s: cannot read\n", path);
+        return -1;
+    }
+    if (stats.truncated) {
+        fprintf(stderr, "%s: last record is truncated\n", path);
+    }
+    if (log.numSamples < 2) {
+        fprintf(stderr, "%s: no GyroState updates with ActuatorDesired, %u objects in %u records\n", path, stats.objects, stats.records);
+        free(log.samples);
+        return -1;
+    }
+
+    tickRate = opt->cpuMHz > 0.0f ? opt->cpuMHz * 1e6 : estimate_tick_rate(&log);
+    if (tickRate <= 0.0) {
+        fprintf(stderr, "%s: too short to estimate the SensorReadTimestamp clock, use --cpu-mhz\n", path);
+        free(log.samples);
+        return -1;
+    }
+
+    // the stabilization module low pass filters the gyro before AutoTune sees it,
+    // with the same fixed 2.5 ms step whatever the gyro rate is
+    if (opt->gyroTau >= 0.0001f) {
+        gyroAlpha = expf(-0.0025f / opt->gyroTau);
+    }
+
+    systemident_init(&si, opt->beta, opt->tau);
+
+    for (uint32_t i = 0; i < log.numSamples; i++) {
+        const struct replay_sample *s = &log.samples[i];
+        for (int j = 0; j < 3; j++) {
+            y[j] = y[j] * gyroAlpha + s->gyro[j] * (1 - gyroAlpha);
+        }
+        if (i == 0) {
+            continue;
+        }
+
+        float t = (s->timestamp - log.samples[0].timestamp) * 0.001f;
+        if (t < opt->start || (opt->end > 0.0f && t > opt->end) || s->throttle <= opt->minThrottle) {
+            continue;
+        }
+
+        float dT_s = (float)((uint32_t)(s->sensorReadTimestamp - log.samples[i - 1].sensorReadTimestamp) / tickRate);
+        if (dT_s <= 0.0f) {
+            continue;
+        }
+        if (dT_s > 5.0f / opt->sensorRate) {
+            dT_s = 5.0f / opt->sensorRate;
+        }
+
+        if (si.predicts == 0) {
+            first = s->timestamp;
+        }
+        systemident_predict(&si, s->u, y, s->throttle, dT_s);
+        last = s->timestamp;
+    }
+
+    if (si.predicts == 0) {
+        fprintf(stderr, "%s: no samples selected, %u gyro updates\n", path, log.numSamples);
+        free(log.samples);
+        return -1;
+    }
+
+    uint8_t check = systemident_check(si.X[9], &si.X[6], opt->pid.gyroReadTimeAverage, opt->sensorRate);
+    int axes = systemident_compute_pids(si.X[9], &si.X[6], &opt->pid, &pids);
+
+    printf("%s,%u,%.1f,%.2f,%.3f,%.3f,%.3f,%.4f,%.4f,%.4f,%.2f,%.2f,%.2f,%.3f,%u,%.1f",
+           path, si.predicts, (last - first) * 0.001f, expf(si.X[9]) * 1000.0f,
+           si.X[6], si.X[7], si.X[8], si.X[10], si.X[11], si.X[12],
+           si.noise[0], si.noise[1], si.noise[2], systemident_hover_throttle(&si), check, tickRate * 1e-6);
+    for (int i = 0; i < 3; i++) {
+        if (i < axes) {
+            printf(",%.6f,%.6f,%.6f", pids.rate[i][0], pids.rate[i][1], pids.rate[i][2]);
+        } else {
+            printf(",,,");
+        }
+    }
+    printf(",%.4f,%.4f\n", pids.outer[0], pids.outer[1]);
+
+    free(log.samples);
+    return 0;
+}
+
+static int parse_floats(const char *arg, float *values, int count)
+{
+    char *end;
+
+    for (int i = 0; i < count; i++) {
+        values[i] = strtof(arg, &end);
+        if (end == arg || (i < count - 1 && *end != ',') || (i == count - 1 && *end != '\0')) {
+            return -1;
+        }
+        arg = end + 1;
+    }
+    return 0;
+}
+
+static int parse_triple(const char *arg, uint8_t *min, uint8_t *rate, uint8_t *max)
+{
+    float v[3];
+
+    if (parse_floats(arg, v, 3) != 0) {
+        return -1;
+    }
+    for (int i = 0; i < 3; i++) {
+        if (v[i] < 0.0f || v[i] > 255.0f) {
+            return -1;
+        }
+    }
+    *min  = v[0];
+    *rate = v[1];
+    *max  = v[2];
+    return 0;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [options] log.opl...\n"
+            "Replays GyroState and ActuatorDesired through the AutoTune system identification\n"
+            "and prints one CSV line of identified parameters and PIDs per log.\n"
+            "The defaults in brackets are those of the UAVObject definitions it is built with.\n"
+            "\n"
+            "  --smooth-quick V      -1 smoothest to +1 quickest PIDs (SystemIdentSettings SmoothQuickValue)\n"
+            "  --damp MIN,RATE,MAX   SystemIdentSettings Damp\n"
+            "  --noise MIN,RATE,MAX  SystemIdentSettings Noise\n"
+            "  --yaw none|limit|ignore  SystemIdentSettings CalculateYaw\n"
+            "  --yaw-ratio MIN,MAX   SystemIdentSettings YawToRollPitchPIDRatio\n"
+            "  --derivative-factor F SystemIdentSettings DerivativeFactor\n"
+            "  --outer-kp-clamp K    SystemIdentSettings OuterLoopKpSoftClamp\n"
+            "  --max-rate ROLL,PITCH StabilizationSettingsBank1 MaximumRate\n"
+            "  --gyro-read-time S    delay from gyro read to the inner loop (SystemIdentSettings\n"
+            "                        GyroReadTimeAverage), the one measured on the airframe\n"
+            "  --gyro-tau S          StabilizationSettings GyroTau\n"
+            "  --sensor-rate HZ      gyro rate of the board (500)\n"
+            "  --cpu-mhz MHZ         SensorReadTimestamp clock (estimated from the log)\n"
+            "  --beta R,P,Y          initial ln(gain) (SystemIdentSettings Beta)\n"
+            "  --tau T               initial ln(time constant) (SystemIdentSettings Tau)\n"
+            "  --min-throttle T      only use samples with more thrust than this (0)\n"
+            "  --start S, --end S    only use samples in this part of the log, in seconds\n",
+            name);
+}
+
+int main(int argc, char *argv[])
+{
+    enum {
+        OPT_SMOOTH_QUICK = 256, OPT_DAMP, OPT_NOISE, OPT_YAW, OPT_YAW_RATIO, OPT_DERIVATIVE_FACTOR,
+        OPT_OUTER_KP_CLAMP, OPT_MAX_RATE, OPT_GYRO_READ_TIME, OPT_GYRO_TAU, OPT_SENSOR_RATE,
+        OPT_CPU_MHZ, OPT_BETA, OPT_TAU, OPT_MIN_THROTTLE, OPT_START, OPT_END,
+    };
+    static const struct option longOptions[] = {
+        { "smooth-quick",      required_argument, NULL, OPT_SMOOTH_QUICK      },
+        { "damp",              required_argument, NULL, OPT_DAMP              },
+        { "noise",             required_argument, NULL, OPT_NOISE             },
+        { "yaw",               required_argument, NULL, OPT_YAW               },
+        { "yaw-ratio",         required_argument, NULL, OPT_YAW_RATIO         },
+        { "derivative-factor", required_argument, NULL, OPT_DERIVATIVE_FACTOR },
+        { "outer-kp-clamp",    required_argument, NULL, OPT_OUTER_KP_CLAMP    },
+        { "max-rate",          required_argument, NULL, OPT_MAX_RATE          },
+        { "gyro-read-time",    required_argument, NULL, OPT_GYRO_READ_TIME    },
+        { "gyro-tau",          required_argument, NULL, OPT_GYRO_TAU          },
+        { "sensor-rate",       required_argument, NULL, OPT_SENSOR_RATE       },
+        { "cpu-mhz",           required_argument, NULL, OPT_CPU_MHZ           },
+        { "beta",              required_argument, NULL, OPT_BETA              },
+        { "tau",               required_argument, NULL, OPT_TAU               },
+        { "min-throttle",      required_argument, NULL, OPT_MIN_THROTTLE      },
+        { "start",             required_argument, NULL, OPT_START             },
+        { "end",               required_argument, NULL, OPT_END               },
+        { "help",              no_argument,       NULL, 'h'                   },
+        { NULL,                0,                 NULL, 0                     }
+    };
+    struct replay_options opt = {
+        .sensorRate = 500.0f,
+    };
+    float v[3];
+    int c;
+    int bad = 0;
+
+    if (load_defaults(&opt) != 0) {
+        return 2;
+    }
+
+    while ((c = getopt_long(argc, argv, "h", longOptions, NULL)) != -1) {
+        int error = 0;
+        switch (c) {
+        case OPT_SMOOTH_QUICK:
+            error = parse_floats(optarg, &opt.pid.smoothQuickValue, 1) || fabsf(opt.pid.smoothQuickValue) > 1.0f;
+            break;
+        case OPT_DAMP:
+            error = parse_triple(optarg, &opt.pid.dampMin, &opt.pid.dampRate, &opt.pid.dampMax);
+            break;
+        case OPT_NOISE:
+            error = parse_triple(optarg, &opt.pid.noiseMin, &opt.pid.noiseRate, &opt.pid.noiseMax);
+            break;
+        case OPT_YAW:
+            if (!strcmp(optarg, "none")) {
+                opt.pid.calculateYaw = SYSTEMIDENT_CALCULATEYAW_FALSE;
+            } else if (!strcmp(optarg, "limit")) {
+                opt.pid.calculateYaw = SYSTEMIDENT_CALCULATEYAW_LIMITTORATIO;
+            } else if (!strcmp(optarg, "ignore")) {
+                opt.pid.calculateYaw = SYSTEMIDENT_CALCULATEYAW_IGNORELIMIT;
+            } else {
+                error = 1;
+            }
+            break;
+        case OPT_YAW_RATIO:
+            error = parse_floats(optarg, v, 2);
+            opt.pid.yawToRollPitchPIDRatioMin = v[0];
+            opt.pid.yawToRollPitchPIDRatioMax = v[1];
+            break;
+        case OPT_DERIVATIVE_FACTOR:
+            error = parse_floats(optarg, &opt.pid.derivativeFactor, 1);
+            break;
+        case OPT_OUTER_KP_CLAMP:
+            error = parse_floats(optarg, &opt.pid.outerLoopKpSoftClamp, 1);
+            break;
+        case OPT_MAX_RATE:
+            error = parse_floats(optarg, v, 2) || v[0] < 1.0f || v[1] < 1.0f || v[0] > 65535.0f || v[1] > 65535.0f;
+            opt.pid.maximumRate[0] = v[0];
+            opt.pid.maximumRate[1] = v[1];
+            break;
+        case OPT_GYRO_READ_TIME:
+            error = parse_floats(optarg, &opt.pid.gyroReadTimeAverage, 1);
+            break;
+        case OPT_GYRO_TAU:
+            error = parse_floats(optarg, &opt.gyroTau, 1);
+            break;
+        case OPT_SENSOR_RATE:
+            error = parse_floats(optarg, &opt.sensorRate, 1) || opt.sensorRate <= 0.0f;
+            break;
+        case OPT_CPU_MHZ:
+            error = parse_floats(optarg, &opt.cpuMHz, 1);
+            break;
+        case OPT_BETA:
+            error = parse_floats(optarg, opt.beta, 3);
+            break;
+        case OPT_TAU:
+            error = parse_floats(optarg, &opt.tau, 1);
+            break;
+        case OPT_MIN_THROTTLE:
+            error = parse_floats(optarg, &opt.minThrottle, 1);
+            break;
+        case OPT_START:
+            error = parse_floats(optarg, &opt.start, 1);
+            break;
+        case OPT_END:
+            error = parse_floats(optarg, &opt.end, 1);
+            break;
+        default:
+            usage(argv[0]);
+            return c == 'h' ? 0 : 2;
+        }
+        if (error) {
+            fprintf(stderr, "%s: bad value '%s'\n", argv[0], optarg);
+            return 2;
+        }
+    }
+
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    printf("log,samples,seconds,tau_ms,beta_roll,beta_pitch,beta_yaw,bias_roll,bias_pitch,bias_yaw,"
+           "noise_roll,noise_pitch,noise_yaw,hover_throttle,check,cpu_mhz,"
+           "roll_kp,roll_ki,roll_kd,pitch_kp,pitch_ki,pitch_kd,yaw_kp,yaw_ki,yaw_kd,outer_kp,outer_ki\n");
+
+    for (int i = optind; i < argc; i++) {
+        clock_t start = clock();
+        if (replay(argv[i], &opt) != 0) {
+            bad++;
+            continue;
+        }
+        fprintf(stderr, "%s: replayed in %.2f s\n", argv[i], (double)(clock() - start) / CLOCKS_PER_SEC);
+    }
+
+    return bad ? 1 : 0;
+}
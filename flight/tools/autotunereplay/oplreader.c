@@ -0,0 +1,237 @@
+/**
+ ******************************************************************************
+ *
+ * @file       oplreader.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Reads the UAVObject updates out of GCS .opl log files
+ *
+ * A log file is a sequence of records, each one a uint32 timestamp in ms,
+ * an int64 byte count and that many bytes of the UAVTalk stream, see
+ * ground/gcs/src/libs/utils/logfile.cpp. Packets can span records.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pios.h>
+#include "oplreader.h"
+
+// UAVTalk framing, see flight/uavtalk/inc/uavtalk_priv.h
+#define UAVTALK_SYNC_VAL         0x3C
+#define UAVTALK_TYPE_MASK        0x78
+#define UAVTALK_TYPE_VER         0x20
+#define UAVTALK_TIMESTAMPED      0x80
+#define UAVTALK_TYPE_OBJ         (UAVTALK_TYPE_VER | 0x00)
+#define UAVTALK_TYPE_OBJ_ACK     (UAVTALK_TYPE_VER | 0x02)
+#define UAVTALK_MIN_HEADER_LENGTH 10
+#define UAVTALK_MAX_PAYLOAD      1024
+
+// Same sanity limit as the GCS log replay
+#define OPL_MAX_RECORD_SIZE      (1024 * 1024)
+
+typedef enum {
+    UAVTALK_STATE_SYNC,
+    UAVTALK_STATE_TYPE,
+    UAVTALK_STATE_SIZE,
+    UAVTALK_STATE_OBJID,
+    UAVTALK_STATE_INSTID,
+    UAVTALK_STATE_TIMESTAMP,
+    UAVTALK_STATE_DATA,
+    UAVTALK_STATE_CS
+} uavtalk_rx_state;
+
+struct uavtalk_rx {
+    uavtalk_rx_state state;
+    uint8_t  type;
+    uint8_t  cs;
+    uint16_t packetSize;
+    uint16_t length;
+    uint16_t count;
+    uint32_t objId;
+    uint16_t instId;
+    uint8_t  data[UAVTALK_MAX_PAYLOAD];
+};
+
+/**
+ * Process one byte of the UAVTalk stream
+ * @returns true when it completed an object packet with a good checksum
+ */
+static bool uavtalk_rx_byte(struct uavtalk_rx *rx, uint8_t c, struct opl_stats *stats)
+{
+    if (rx->state != UAVTALK_STATE_CS) {
+        rx->cs = PIOS_CRC_updateByte(rx->cs, c);
+    }
+
+    switch (rx->state) {
+    case UAVTALK_STATE_SYNC:
+        if (c == UAVTALK_SYNC_VAL) {
+            rx->cs    = PIOS_CRC_updateByte(0, c);
+            rx->state = UAVTALK_STATE_TYPE;
+        }
+        break;
+
+    case UAVTALK_STATE_TYPE:
+        if ((c & UAVTALK_TYPE_MASK) != UAVTALK_TYPE_VER) {
+            rx->state = UAVTALK_STATE_SYNC;
+            break;
+        }
+        rx->type  = c;
+        rx->count = 0;
+        rx->packetSize = 0;
+        rx->state = UAVTALK_STATE_SIZE;
+        break;
+
+    case UAVTALK_STATE_SIZE:
+        rx->packetSize |= (uint16_t)c << (8 * rx->count);
+        if (++rx->count < 2) {
+            break;
+        }
+        {
+            uint16_t headerLength = UAVTALK_MIN_HEADER_LENGTH + ((rx->type & UAVTALK_TIMESTAMPED) ? 2 : 0);
+            if (rx->packetSize < headerLength || rx->packetSize - headerLength > UAVTALK_MAX_PAYLOAD) {
+                rx->state = UAVTALK_STATE_SYNC;
+                break;
+            }
+            rx->length = rx->packetSize - headerLength;
+        }
+        rx->count = 0;
+        rx->objId = 0;
+        rx->state = UAVTALK_STATE_OBJID;
+        break;
+
+    case UAVTALK_STATE_OBJID:
+        rx->objId |= (uint32_t)c << (8 * rx->count);
+        if (++rx->count < 4) {
+            break;
+        }
+        rx->count  = 0;
+        rx->instId = 0;
+        rx->state  = UAVTALK_STATE_INSTID;
+        break;
+
+    case UAVTALK_STATE_INSTID:
+        rx->instId |= (uint16_t)c << (8 * rx->count);
+        if (++rx->count < 2) {
+            break;
+        }
+        rx->count = 0;
+        if (rx->type & UAVTALK_TIMESTAMPED) {
+            rx->state = UAVTALK_STATE_TIMESTAMP;
+        } else {
+            rx->state = rx->length ? UAVTALK_STATE_DATA : UAVTALK_STATE_CS;
+        }
+        break;
+
+    case UAVTALK_STATE_TIMESTAMP:
+        if (++rx->count < 2) {
+            break;
+        }
+        rx->count = 0;
+        rx->state = rx->length ? UAVTALK_STATE_DATA : UAVTALK_STATE_CS;
+        break;
+
+    case UAVTALK_STATE_DATA:
+        rx->data[rx->count++] = c;
+        if (rx->count >= rx->length) {
+            rx->state = UAVTALK_STATE_CS;
+        }
+        break;
+
+    case UAVTALK_STATE_CS:
+        rx->state = UAVTALK_STATE_SYNC;
+        if (c != rx->cs) {
+            stats->crcErrors++;
+            break;
+        }
+        switch (rx->type & ~UAVTALK_TIMESTAMPED) {
+        case UAVTALK_TYPE_OBJ:
+        case UAVTALK_TYPE_OBJ_ACK:
+            stats->objects++;
+            return true;
+        default:
+            break;
+        }
+        break;
+    }
+
+    return false;
+}
+
+/**
+ * Read a log file and report every object update in it
+ * @param[in] path the log file
+ * @param[in] callback called for every object update
+ * @param[in] context passed to the callback
+ * @param[out] stats what was found in the log
+ * @returns 0 on success, -1 if the file could not be read
+ */
+int32_t opl_read_file(const char *path, opl_object_cb callback, void *context, struct opl_stats *stats)
+{
+    static struct uavtalk_rx rx;
+    uint8_t *record = NULL;
+    int64_t recordCapacity = 0;
+    FILE *f = fopen(path, "rb");
+
+    if (!f) {
+        return -1;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    memset(&rx, 0, sizeof(rx));
+
+    for (;;) {
+        uint32_t timestamp;
+        int64_t dataSize;
+
+        if (fread(&timestamp, sizeof(timestamp), 1, f) != 1) {
+            break;
+        }
+        if (fread(&dataSize, sizeof(dataSize), 1, f) != 1 || dataSize < 1 || dataSize > OPL_MAX_RECORD_SIZE) {
+            stats->truncated = true;
+            break;
+        }
+        if (dataSize > recordCapacity) {
+            uint8_t *grown = realloc(record, dataSize);
+            if (!grown) {
+                free(record);
+                fclose(f);
+                return -1;
+            }
+            record = grown;
+            recordCapacity = dataSize;
+        }
+        if (fread(record, 1, dataSize, f) != (size_t)dataSize) {
+            stats->truncated = true;
+            break;
+        }
+        stats->records++;
+
+        for (int64_t i = 0; i < dataSize; i++) {
+            if (uavtalk_rx_byte(&rx, record[i], stats)) {
+                callback(context, timestamp, rx.objId, rx.instId, rx.data, rx.length);
+            }
+        }
+    }
+
+    free(record);
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,47 @@
+/**
+ ******************************************************************************
+ *
+ * @file       oplreader.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2017.
+ * @brief      Reads the UAVObject updates out of GCS .opl log files
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPLREADER_H
+#define OPLREADER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// What was found while reading a log
+struct opl_stats {
+    uint32_t records;    // log records read
+    uint32_t objects;    // UAVTalk object packets with a good checksum
+    uint32_t crcErrors;  // UAVTalk packets with a bad checksum
+    bool     truncated;  // the last log record is incomplete
+};
+
+// Called for every UAVObject update in the log
+// timestamp is the time of the log record that completed the packet, in ms
+typedef void (*opl_object_cb)(void *context, uint32_t timestamp, uint32_t objId, uint16_t instId, const uint8_t *data, uint16_t length);
+
+int32_t opl_read_file(const char *path, opl_object_cb callback, void *context, struct opl_stats *stats);
+
+#endif /* OPLREADER_H */
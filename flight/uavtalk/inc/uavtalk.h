@@ -30,7 +30,9 @@
 #define UAVTALK_H
 
 // Public types
-typedef int32_t (*UAVTalkOutputStream)(uint8_t *data, int32_t length);
+struct pios_com_iovec;
+// a frame is passed as header, data and checksum segments, see PIOS_COM_SendBufferV()
+typedef int32_t (*UAVTalkOutputStream)(const struct pios_com_iovec *iov, uint8_t iovcnt);
 
 typedef struct {
     uint32_t txBytes;
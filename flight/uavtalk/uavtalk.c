@@ -508,20 +508,17 @@ int32_t UAVTalkRelayPacket(UAVTalkConnection inConnectionHandle, UAVTalkConnecti
         headerLength += 2;
     }
 
-    // Copy data (if any)
-    if (inIproc->length > 0) {
-        memcpy(&outConnection->txBuffer[headerLength], inConnection->rxBuffer, inIproc->length);
-    }
-
     // Store the packet length
     outConnection->txBuffer[2] = (uint8_t)((headerLength + inIproc->length) & 0xFF);
     outConnection->txBuffer[3] = (uint8_t)(((headerLength + inIproc->length) >> 8) & 0xFF);
 
-    // Copy the checksum
-    outConnection->txBuffer[headerLength + inIproc->length] = inIproc->cs;
-
-    // Send the buffer.
-    int32_t rc = (*outConnection->outStream)(outConnection->txBuffer, headerLength + inIproc->length + UAVTALK_CHECKSUM_LENGTH);
+    // Send the header, the data straight from the input buffer and the checksum
+    struct pios_com_iovec iov[] = {
+        { .base = outConnection->txBuffer, .len = headerLength            },
+        { .base = inConnection->rxBuffer,  .len = inIproc->length         },
+        { .base = &inIproc->cs,            .len = UAVTALK_CHECKSUM_LENGTH },
+    };
+    int32_t rc = (*outConnection->outStream)(iov, NELEMENTS(iov));
 
     // Update stats
     outConnection->stats.txBytes += (rc > 0) ? rc : 0;
@@ -864,7 +861,8 @@ static int32_t sendSingleObject(UAVTalkConnectionData *connection, uint8_t type,
 
     // Send object
     uint16_t tx_msg_len = headerLength + length + UAVTALK_CHECKSUM_LENGTH;
-    int32_t rc = (*connection->outStream)(connection->txBuffer, tx_msg_len);
+    struct pios_com_iovec iov = { .base = connection->txBuffer, .len = tx_msg_len };
+    int32_t rc = (*connection->outStream)(&iov, 1);
 
     // Update stats
     if (rc == tx_msg_len) {